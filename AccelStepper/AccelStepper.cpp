@@ -25,7 +25,9 @@ void AccelStepper::moveTo(long absolute)
     if (_targetPos != absolute)
     {
 	_targetPos = absolute;
-	computeNewSpeed();
+	// A ramp table profile takes the new target into account at the next step
+	if (_profile == PROFILE_AUSTIN || _stepInterval == 0)
+	    computeNewSpeed();
 	// compute new n?
     }
 }
@@ -98,6 +100,12 @@ void AccelStepper::setCurrentPosition(long position)
 
 void AccelStepper::computeNewSpeed()
 {
+    if (_profile != PROFILE_AUSTIN)
+    {
+	computeProfileSpeed();
+	return;
+    }
+
     long distanceTo = distanceToGo(); // +ve is clockwise from curent location
 
     long stepsToStop = (long)((_speed * _speed) / (2.0 * _acceleration)); // Equation 16
@@ -213,6 +221,13 @@ AccelStepper::AccelStepper(uint8_t interface, uint8_t pin1, uint8_t pin2, uint8_
     _cn = 0.0;
     _cmin = 1.0;
     _direction = DIRECTION_CCW;
+    _profile = PROFILE_AUSTIN;
+    _jerk = 0.0;
+    _ramp = NULL;
+    _rampSize = 0;
+    _rampShift = 0;
+    _rampBits = 0;
+    _rampSteps = 0;
 
     int i;
     for (i = 0; i < 4; i++)
@@ -247,6 +262,13 @@ AccelStepper::AccelStepper(void (*forward)(), void (*backward)())
     _cn = 0.0;
     _cmin = 1.0;
     _direction = DIRECTION_CCW;
+    _profile = PROFILE_AUSTIN;
+    _jerk = 0.0;
+    _ramp = NULL;
+    _rampSize = 0;
+    _rampShift = 0;
+    _rampBits = 0;
+    _rampSteps = 0;
 
     int i;
     for (i = 0; i < 4; i++)
@@ -259,8 +281,10 @@ void AccelStepper::setMaxSpeed(float speed)
     {
 	_maxSpeed = speed;
 	_cmin = 1000000.0 / speed;
+	if (_profile != PROFILE_AUSTIN)
+	    computeRamp();
 	// Recompute _n from current speed and adjust speed if accelerating or cruising
-	if (_n > 0)
+	else if (_n > 0)
 	{
 	    _n = (long)((_speed * _speed) / (2.0 * _acceleration)); // Equation 16
 	    computeNewSpeed();
@@ -275,11 +299,15 @@ void AccelStepper::setAcceleration(float acceleration)
     if (_acceleration != acceleration)
     {
 	// Recompute _n per Equation 17
-	_n = _n * (_acceleration / acceleration);
+	if (_profile == PROFILE_AUSTIN)
+	    _n = _n * (_acceleration / acceleration);
 	// New c0 per Equation 7
 	_c0 = sqrt(2.0 / acceleration) * 1000000.0;
 	_acceleration = acceleration;
-	computeNewSpeed();
+	if (_profile != PROFILE_AUSTIN)
+	    computeRamp();
+	else
+	    computeNewSpeed();
     }
 }
 
@@ -300,9 +328,241 @@ void AccelStepper::setSpeed(float speed)
 
 float AccelStepper::speed()
 {
+    if (_profile != PROFILE_AUSTIN && _speed != 0.0 && _stepInterval)
+	return (_speed > 0.0) ? 1000000.0 / _stepInterval : -1000000.0 / _stepInterval;
     return _speed;
 }
 
+void AccelStepper::setProfile(Profile profile, unsigned long* table, uint8_t size)
+{
+    if (profile != PROFILE_AUSTIN && (!table || size < 2))
+	profile = PROFILE_AUSTIN;
+    _profile = profile;
+    _ramp = table;
+    _rampSize = size;
+    _n = 0;
+    if (_profile != PROFILE_AUSTIN)
+	computeRamp();
+}
+
+void AccelStepper::setJerk(float jerk)
+{
+    if (_jerk != jerk)
+    {
+	_jerk = jerk;
+	if (_profile != PROFILE_AUSTIN)
+	    computeRamp();
+    }
+}
+
+// Position on the acceleration ramp is piecewise cubic in time, so invert it by bisection.
+// Only called by computeRamp(), never per step.
+float AccelStepper::rampTime(float steps)
+{
+    if (_profile != PROFILE_SCURVE || _jerk <= 0.0)
+	return sqrt(2.0 * steps / _acceleration);
+
+    // Peak acceleration, and the times of jerk and constant acceleration phases
+    float peak = sqrt(_maxSpeed * _jerk);
+    peak = min(peak, _acceleration);
+    float t1 = peak / _jerk;
+    float v1 = peak * t1 / 2.0;
+    float t2 = (_maxSpeed - 2.0 * v1) / peak;
+    float x1 = v1 * t1 / 3.0;
+    float v2 = v1 + peak * t2;
+    float x2 = x1 + (v1 + v2) * t2 / 2.0;
+
+    float low = 0.0;
+    float high = 2.0 * t1 + t2;
+    uint8_t i;
+    for (i = 0; i < 24; i++)
+    {
+	float t = (low + high) / 2.0;
+	float x;
+	if (t < t1)
+	    x = _jerk * t * t * t / 6.0;
+	else if (t < t1 + t2)
+	{
+	    float dt = t - t1;
+	    x = x1 + v1 * dt + peak * dt * dt / 2.0;
+	}
+	else
+	{
+	    float dt = t - t1 - t2;
+	    x = x2 + v2 * dt + peak * dt * dt / 2.0 - _jerk * dt * dt * dt / 6.0;
+	}
+	if (x < steps)
+	    low = t;
+	else
+	    high = t;
+    }
+    return (low + high) / 2.0;
+}
+
+// Entries of the ramp table are 1 << _rampShift steps wide at the start of the
+// ramp, where the speed changes fastest. After the first 2 << _rampBits entries
+// the width doubles every 1 << _rampBits entries. Shifts one bit at a time, as
+// AVR has no barrel shifter.
+uint8_t AccelStepper::rampEntry(long n, uint8_t* width)
+{
+    uint8_t e = _rampShift;
+    n >>= e;
+    while (n >= (2L << _rampBits))
+    {
+	n >>= 1;
+	e++;
+    }
+    *width = e;
+    return ((e - _rampShift) << _rampBits) + n;
+}
+
+void AccelStepper::computeRamp()
+{
+    // Steps to reach the maximum speed
+    float steps;
+    if (_profile == PROFILE_SCURVE && _jerk > 0.0)
+    {
+	float peak = sqrt(_maxSpeed * _jerk);
+	peak = min(peak, _acceleration);
+	steps = _maxSpeed * (_maxSpeed / peak + peak / _jerk) / 2.0;
+    }
+    else
+	steps = _maxSpeed * _maxSpeed / (2.0 * _acceleration);
+    _rampSteps = max((long)steps, 1L);
+
+    // Use the most entries per doubling of the width that fit the ramp in the table,
+    // with one step wide entries at the start if possible. The interval at the end
+    // of the last entry needs an entry too
+    long n;
+    uint8_t i;
+    uint8_t e;
+    _rampShift = 0;
+    _rampBits = 0;
+    for (_rampBits = 7; ; _rampBits--)
+    {
+	for (n = 0, i = 1; n < _rampSteps && i < _rampSize; i++)
+	{
+	    rampEntry(n, &e);
+	    n += 1L << e;
+	}
+	if (n >= _rampSteps)
+	    break;
+	if (_rampBits == 0)
+	{
+	    // Too small: widen the first entries, up to 65536 steps, then cut the ramp short
+	    if (_rampShift == 16)
+	    {
+		_rampSteps = n;
+		break;
+	    }
+	    _rampShift++;
+	    _rampBits++;
+	}
+    }
+
+    // Each entry holds the interval of the step at its start
+    float start = 0.0;
+    float last = 0.0;
+    long lastN = 0;
+    for (n = 0, i = 0; i < _rampSize; i++)
+    {
+	if (n >= _rampSteps)
+	{
+	    // Carry on the line from the last entry so it reaches the maximum speed at
+	    // the end of the ramp
+	    float interval = last - (last - _cmin) * (n - lastN) / (_rampSteps - lastN);
+	    _ramp[i] = max(interval, (float)0.0);
+	    break;
+	}
+	float end = rampTime(n + 1);
+	float interval = (end - start) * 1000000.0;
+	// Never faster than the maximum speed, or than the entry before
+	interval = max(interval, _cmin);
+	if (i > 0)
+	    interval = min(interval, last);
+	_ramp[i] = interval;
+	last = interval;
+	lastN = n;
+	rampEntry(n, &e);
+	n += 1L << e;
+	start = rampTime(n);
+    }
+    if (_rampShift)
+    {
+	// The first entry is too wide to follow the speed from rest: instead make
+	// its steps take as long in total as they should
+	long w = 1L << _rampShift;
+	float first = (2.0 * rampTime(w) * 1000000.0 - (float)_ramp[1] * (w - 1)) / (w + 1);
+	_ramp[0] = max(first, (float)_ramp[1]);
+    }
+    _n = min(_n, _rampSteps);
+}
+
+unsigned long AccelStepper::rampInterval(long n)
+{
+    if (n >= _rampSteps)
+	return _cmin;
+
+    // Interpolate between the intervals at the start of this entry and the next
+    uint8_t e;
+    uint8_t i = rampEntry(n, &e);
+    unsigned long first = _ramp[i];
+    unsigned long offset = n & ((1L << e) - 1);
+    unsigned long difference = first - _ramp[i + 1];
+    // offset is less than 1 << width. Where the product would not fit in 32 bits, drop
+    // low bits from the wider of the two until it does
+    uint8_t width = e;
+    uint8_t shift = e;
+    while (difference > (0xffffffffUL >> width))
+    {
+	if (difference >> width)
+	    difference >>= 1;
+	else
+	{
+	    offset >>= 1;
+	    width--;
+	}
+	shift--;
+    }
+    unsigned long interval = first - ((difference * offset) >> shift);
+    // The line through the last entry may dip below the maximum speed after the ramp ends
+    return max(interval, (unsigned long)_cmin);
+}
+
+// _n is the number of steps along the ramp from rest, which is also the number
+// of steps it takes to stop. Accelerate while there is room to stop after the
+// next step, decelerate back down the ramp when there is not, or when going
+// the wrong way. Integer arithmetic only.
+void AccelStepper::computeProfileSpeed()
+{
+    long distanceTo = distanceToGo();
+    long stepsToGo = labs(distanceTo);
+
+    if (stepsToGo == 0 && _n == 0)
+    {
+	// We are at the target and stopped
+	_stepInterval = 0;
+	_speed = 0.0;
+	return;
+    }
+
+    if (_n == 0)
+	_direction = (distanceTo > 0) ? DIRECTION_CW : DIRECTION_CCW;
+
+    if (_n > 0 && (stepsToGo <= _n || _direction != ((distanceTo > 0) ? DIRECTION_CW : DIRECTION_CCW)))
+    {
+	_n--;
+	_stepInterval = rampInterval(_n);
+    }
+    else
+    {
+	_stepInterval = rampInterval(_n);
+	if (stepsToGo >= _n + 2 && _n < _rampSteps)
+	    _n++;
+    }
+    _speed = (_direction == DIRECTION_CW) ? _maxSpeed : -_maxSpeed;
+}
+
 // Subclasses can override
 void AccelStepper::step(long step)
 {
@@ -613,7 +873,13 @@ void AccelStepper::runToNewPosition(long position)
 
 void AccelStepper::stop()
 {
-    if (_speed != 0.0)
+    if (_profile != PROFILE_AUSTIN)
+    {
+	// Straight down the ramp
+	if (_speed != 0.0)
+	    move((_direction == DIRECTION_CW) ? _n : -_n);
+    }
+    else if (_speed != 0.0)
     {    
 	long stepsToStop = (long)((_speed * _speed) / (2.0 * _acceleration)) + 1; // Equation 16 (+integer rounding)
 	if (_speed > 0)
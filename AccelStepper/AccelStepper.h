@@ -25,6 +25,15 @@
 /// The version of the package that this documentation refers to can be downloaded 
 /// from http://www.airspayce.com/mikem/arduino/AccelStepper/AccelStepper-1.39.zip
 ///
+/// \par Local additions
+/// This copy adds to release 1.39 and is not an upstream release:
+/// \li StepperGroup, which moves several steppers in coordination so they arrive
+///     together, stepped from a timer interrupt with integer arithmetic only.
+///     See example StepperGroup.
+/// \li setProfile() and setJerk(): optional trapezoidal and S-curve motion profiles
+///     from a ramp table computed when the speed or acceleration changes,
+///     so run() needs no floating point after each step. See example Profile.
+///
 /// Example Arduino programs are included to show the main modes of use.
 ///
 /// You can also find online help and discussion at http://groups.google.com/group/accelstepper
@@ -216,8 +225,25 @@
 /// whenever required for the speed set.
 /// Calling setAcceleration() is expensive,
 /// since it requires a square root to be calculated.
+///
+/// \par Motion profiles
+/// By default the speed after each step is computed by David Austin's algorithm,
+/// which takes several floating point divisions per step and so limits the top
+/// speed. setProfile() selects a ramp table instead: the step intervals of the
+/// acceleration from rest are computed once, when the maximum speed,
+/// acceleration or jerk change, into a table supplied by the caller. After each
+/// step the next interval is then looked up in the table, accelerating from the
+/// start and decelerating on the same ramp backwards to the target. With
+/// PROFILE_SCURVE the ramp also limits the rate of change of the acceleration
+/// (the jerk), for smoother starts and stops. If the ramp has more steps than the
+/// table has entries, the intervals of the steps between entries are interpolated.
+/// The entries are one step apart at the start of the ramp, where the speed changes
+/// fastest, and further apart as it levels off.
 class AccelStepper
 {
+    /// StepperGroup steps the motor and keeps its position from a timer interrupt
+    friend class StepperGroup;
+
 public:
     /// \brief Symbolic names for number of pins.
     /// Use this in the pins argument the AccelStepper constructor to 
@@ -234,6 +260,15 @@ public:
 	HALF4WIRE = 8  ///< 4 wire half stepper, 4 motor pins required
     } MotorInterfaceType;
 
+    /// \brief Symbolic names for the motion profiles.
+    /// Use this in the profile argument of setProfile()
+    typedef enum
+    {
+	PROFILE_AUSTIN    = 0, ///< Speed computed after each step by David Austin's algorithm (the default)
+	PROFILE_TRAPEZOID = 1, ///< Constant acceleration, from a ramp table
+	PROFILE_SCURVE    = 2  ///< Acceleration limited by the jerk set by setJerk(), from a ramp table
+    } Profile;
+
     /// Constructor. You can have multiple simultaneous steppers, all moving
     /// at different speeds and accelerations, provided you call their run()
     /// functions at frequent enough intervals. Current Position is set to 0, target
@@ -323,6 +358,24 @@ public:
     /// crystal. Jitter depends on how frequently you call the runSpeed() function.
     void    setSpeed(float speed);
 
+    /// Selects how run() accelerates and decelerates. Call it while the motor is stopped.
+    /// PROFILE_TRAPEZOID and PROFILE_SCURVE compute the ramp into the table
+    /// here and again whenever setMaxSpeed(), setAcceleration() or setJerk()
+    /// change it, so call those before setProfile() if you can.
+    /// \param[in] profile One of the \ref Profile symbolic names
+    /// \param[in] table Array of at least 2 entries for the ramp. It must remain valid while
+    /// the profile is in use. Not needed for PROFILE_AUSTIN. Each entry costs 4 bytes of RAM: 
+    /// the intervals of the steps between entries are interpolated, and the entries are closest 
+    /// together at the start of the ramp, so 64 entries are enough for most ramps. With fewer 
+    /// than 16 the first entry may have to cover several steps, which then start too fast.
+    /// \param[in] size Number of entries in the table
+    void    setProfile(Profile profile, unsigned long* table = NULL, uint8_t size = 0);
+
+    /// Sets the jerk of PROFILE_SCURVE: the rate at which the acceleration rises and falls.
+    /// \param[in] jerk The jerk in steps per second per second per second. 0 (the default)
+    /// means no limit, as in PROFILE_TRAPEZOID.
+    void    setJerk(float jerk);
+
     /// The most recently set speed
     /// \return the most recent speed in steps per second
     float   speed();
@@ -431,6 +484,29 @@ protected:
     /// move() or moveTo()
     void           computeNewSpeed();
 
+    /// computeNewSpeed() for PROFILE_TRAPEZOID and PROFILE_SCURVE: looks up the next
+    /// step interval in the ramp table.
+    void           computeProfileSpeed();
+
+    /// Computes the ramp table for the current profile, maximum speed, acceleration and jerk.
+    void           computeRamp();
+
+    /// Time from rest to reach a position on the acceleration ramp.
+    /// \param[in] steps Distance from the start of the ramp in steps
+    /// \return The time in seconds
+    float          rampTime(float steps);
+
+    /// Finds the ramp table entry that holds a step.
+    /// \param[in] n Step number on the ramp
+    /// \param[out] width The number of steps in the entry, as a power of 2
+    /// \return The index of the entry
+    uint8_t        rampEntry(long n, uint8_t* width);
+
+    /// The interval between step n and step n+1 of the acceleration from rest.
+    /// \param[in] n Step number on the ramp. Beyond the ramp the interval at the maximum speed is returned.
+    /// \return The interval in microseconds, interpolated between the table entries around n
+    unsigned long  rampInterval(long n);
+
     /// Low level function to set the motor output pins
     /// bit 0 of the mask corresponds to _pin[0]
     /// bit 1 of the mask corresponds to _pin[1]
@@ -513,7 +589,8 @@ private:
     long           _targetPos;     // Steps
 
     /// The current motos speed in steps per second
-    /// Positive is clockwise
+    /// Positive is clockwise. With a ramp table profile only the sign is kept
+    /// up to date (+/- _maxSpeed while moving), and speed() computes the speed
     float          _speed;         // Steps per second
 
     /// The maximum permitted speed in steps per second. Must be > 0.
@@ -567,6 +644,25 @@ private:
     /// Current direction motor is spinning in
     boolean _direction; // 1 == CW
 
+    /// The motion profile, see Profile
+    uint8_t _profile;
+
+    /// Jerk for PROFILE_SCURVE in steps per second per second per second, 0 for none
+    float _jerk;
+
+    /// The ramp table supplied to setProfile(): the interval in microseconds of the step at
+    /// the start of each entry of the acceleration from rest. The first (2 << _rampBits) entries
+    /// are (1 << _rampShift) steps wide, then the width doubles every (1 << _rampBits) entries
+    unsigned long* _ramp;
+    uint8_t _rampSize;
+    uint8_t _rampShift;
+    uint8_t _rampBits;
+
+    /// Number of steps of the acceleration from rest to the maximum speed.
+    /// With a ramp table profile _n is the number of steps along it, which is also
+    /// the number of steps needed to stop
+    long _rampSteps;
+
 };
 
 /// @example Random.pde
@@ -586,6 +682,9 @@ private:
 /// Shows how to run AccelStepper in the simplest,
 /// fixed speed mode with no accelerations
 
+/// @example Profile.pde
+/// Runs a stepper back and forth with an S-curve profile from a ramp table
+
 /// @example Blocking.pde 
 /// Shows how to use the blocking call runToNewPosition
 /// Which sets a new target position and then waits until the stepper has 
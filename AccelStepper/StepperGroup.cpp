@@ -0,0 +1,192 @@
+// StepperGroup.cpp
+//
+// Part of the AccelStepper library, and distributed under the same
+// license conditions: see LICENSE
+
+#include "StepperGroup.h"
+
+// Fixed point velocities and accelerations are in 2^-32 steps per tick
+#define STEPPERGROUP_ONE_STEP 4294967296.0
+
+StepperGroup::StepperGroup(unsigned long tickRate)
+{
+    _numSteppers = 0;
+    _tickRate = tickRate;
+    _running = false;
+    _steps = 0;
+    _stepsDone = 0;
+    setMaxSpeed(1.0);
+    setAcceleration(1.0);
+}
+
+boolean StepperGroup::addStepper(AccelStepper& stepper)
+{
+    if (_numSteppers >= STEPPERGROUP_MAX_STEPPERS)
+	return false;
+    _steppers[_numSteppers++] = &stepper;
+    return true;
+}
+
+// Only recorded here: tick() uses the fixed point values moveTo() makes of it
+void StepperGroup::setMaxSpeed(float speed)
+{
+    _maxSpeed = speed;
+}
+
+void StepperGroup::setAcceleration(float acceleration)
+{
+    if (acceleration == 0.0)
+	return;
+    _accel = acceleration;
+}
+
+void StepperGroup::moveTo(long absolute[])
+{
+    // Fixed point speed and acceleration for this move, worked out before
+    // interrupts are disabled
+    float velocity = _maxSpeed / _tickRate * STEPPERGROUP_ONE_STEP;
+    uint32_t maxVelocity = (velocity >= STEPPERGROUP_ONE_STEP) ? 0xffffffff : (uint32_t)velocity;
+    if (maxVelocity == 0)
+	maxVelocity = 1;
+    float perTick = _accel / _tickRate / _tickRate * STEPPERGROUP_ONE_STEP;
+    uint32_t acceleration = (perTick >= STEPPERGROUP_ONE_STEP) ? 0xffffffff : (uint32_t)perTick;
+    if (acceleration == 0)
+	acceleration = 1;
+
+    // tick() must see either no move or the whole of the new one
+    noInterrupts();
+    _running = false;
+
+    uint8_t i;
+    _steps = 0;
+    for (i = 0; i < _numSteppers; i++)
+    {
+	long distance = absolute[i] - _steppers[i]->_currentPos;
+	_delta[i] = labs(distance);
+	if (_delta[i] > _steps)
+	    _steps = _delta[i];
+    }
+    if (_steps == 0)
+    {
+	interrupts();
+	return;
+    }
+
+    for (i = 0; i < _numSteppers; i++)
+    {
+	AccelStepper* s = _steppers[i];
+	long distance = absolute[i] - s->_currentPos;
+	// Round to the nearest step along the line
+	_error[i] = _steps / 2;
+	// Leave the stepper stopped as far as run() is concerned, but with the
+	// target, direction and sign of speed the step functions expect
+	s->_targetPos = absolute[i];
+	s->_stepInterval = 0;
+	s->_n = 0;
+	s->_direction = (distance > 0) ? AccelStepper::DIRECTION_CW : AccelStepper::DIRECTION_CCW;
+	s->_speed = _maxSpeed * distance / _steps;
+    }
+
+    _maxVelocity = maxVelocity;
+    _acceleration = acceleration;
+    _stepsDone = 0;
+    _accelSteps = 0;
+    _velocity = 0;
+    _minVelocity = 1;
+    _fraction = 0;
+    _phase = ACCELERATING;
+    _running = true;
+    interrupts();
+}
+
+void StepperGroup::move(long relative[])
+{
+    long absolute[STEPPERGROUP_MAX_STEPPERS];
+    uint8_t i;
+    for (i = 0; i < _numSteppers; i++)
+	absolute[i] = _steppers[i]->currentPosition() + relative[i];
+    moveTo(absolute);
+}
+
+// Called from the timer interrupt: integer adds and compares only
+boolean StepperGroup::tick()
+{
+    if (!_running)
+	return false;
+
+    if (_phase == ACCELERATING)
+    {
+	if (_maxVelocity - _velocity <= _acceleration)
+	{
+	    _velocity = _maxVelocity;
+	    _phase = CRUISING;
+	}
+	else
+	    _velocity += _acceleration;
+    }
+    else if (_phase == DECELERATING)
+    {
+	if (_velocity - _minVelocity > _acceleration)
+	    _velocity -= _acceleration;
+	else
+	    _velocity = _minVelocity;
+    }
+
+    uint32_t last = _fraction;
+    _fraction += _velocity;
+    if (_fraction < last)
+	stepAll(); // Crossed a whole step
+    return _running;
+}
+
+void StepperGroup::stepAll()
+{
+    uint8_t i;
+    for (i = 0; i < _numSteppers; i++)
+    {
+	_error[i] += _delta[i];
+	if (_error[i] >= _steps)
+	{
+	    _error[i] -= _steps;
+	    AccelStepper* s = _steppers[i];
+	    if (s->_direction == AccelStepper::DIRECTION_CW)
+		s->_currentPos += 1;
+	    else
+		s->_currentPos -= 1;
+	    s->step(s->_currentPos);
+	}
+    }
+
+    _stepsDone++;
+    if (_stepsDone == _steps)
+    {
+	for (i = 0; i < _numSteppers; i++)
+	    _steppers[i]->_speed = 0.0;
+	_running = false;
+	return;
+    }
+
+    unsigned long stepsLeft = _steps - _stepsDone;
+    if (_phase == ACCELERATING)
+    {
+	// Decelerate no slower than the first step was taken
+	if (_stepsDone == 1)
+	    _minVelocity = _velocity;
+	_accelSteps = _stepsDone;
+	if (stepsLeft <= _accelSteps)
+	    _phase = DECELERATING; // Half way without reaching max speed
+    }
+    else if (_phase == CRUISING && stepsLeft <= _accelSteps)
+	_phase = DECELERATING;
+}
+
+boolean StepperGroup::isRunning()
+{
+    return _running;
+}
+
+void StepperGroup::runToPosition()
+{
+    while (_running)
+	;
+}
@@ -0,0 +1,151 @@
+// StepperGroup.h
+//
+// Part of the AccelStepper library, and distributed under the same
+// license conditions: see LICENSE
+
+#ifndef StepperGroup_h
+#define StepperGroup_h
+
+#include "AccelStepper.h"
+
+/// Maximum number of steppers in a StepperGroup. Each one costs 10 bytes of RAM.
+#ifndef STEPPERGROUP_MAX_STEPPERS
+#define STEPPERGROUP_MAX_STEPPERS 4
+#endif
+
+/////////////////////////////////////////////////////////////////////
+/// \class StepperGroup StepperGroup.h <StepperGroup.h>
+/// \brief Coordinated moves of several AccelSteppers, stepped from a timer interrupt
+///
+/// Moves a group of up to STEPPERGROUP_MAX_STEPPERS AccelSteppers in a straight
+/// line: all of them start together, accelerate and decelerate together, and
+/// arrive at their target positions on the same step.
+///
+/// \par Operation
+/// The caller sets up a timer to interrupt at a fixed rate, typically 5 to 20 kHz,
+/// and calls tick() from the interrupt handler. A tick that steps every axis must
+/// fit in the timer period: sim/stepper_group_sim puts it at about 37 us for one
+/// DRIVER axis and 27 us more for each other one on a 16 MHz AVR, most of it in
+/// digitalWrite(), so about 10 kHz for three axes. These costs are estimates, not
+/// measurements.
+/// The stepper with the longest move (the dominant axis) is stepped whenever its position, advanced by its
+/// velocity on every tick, crosses a whole step. Its velocity is advanced by
+/// the acceleration on every tick. The other steppers are stepped by
+/// Bresenham's line algorithm off the dominant axis, so none of them is ever
+/// more than half a step from the straight line.
+/// Velocity, acceleration and position are fixed point fractions of a step
+/// per tick, computed once by setMaxSpeed() and setAcceleration(), so tick()
+/// only adds and compares integers: no micros(), no float and no division.
+///
+/// The deceleration starts when the steps left are as many as the
+/// acceleration took, so the move is symmetric whatever the rounding.
+///
+/// \par Caveats
+/// The steppers must not be run() while the group is moving them, and their
+/// positions are updated from the interrupt: read currentPosition() when
+/// isRunning() is false, or with interrupts disabled. The speed and
+/// acceleration only change between moves: set during a move, they take
+/// effect from the next moveTo().
+/// Steps are placed on ticks, so each step is up to one tick late.
+class StepperGroup
+{
+public:
+    /// Constructor.
+    /// \param[in] tickRate The rate in Hz at which tick() will be called
+    StepperGroup(unsigned long tickRate = 10000);
+
+    /// Adds a stepper to the group. Its speed and acceleration settings are not
+    /// used: the group has its own.
+    /// \param[in] stepper The stepper to add
+    /// \return true if there was room for it
+    boolean addStepper(AccelStepper& stepper);
+
+    /// Sets the maximum speed of the dominant axis. The others go proportionally slower.
+    /// Speeds above tickRate steps per second are limited to that.
+    /// Takes effect from the next moveTo() or move(): a move in progress keeps its speed.
+    /// \param[in] speed The maximum speed in steps per second
+    void    setMaxSpeed(float speed);
+
+    /// Sets the acceleration and deceleration of the dominant axis.
+    /// Takes effect from the next moveTo() or move(), as setMaxSpeed().
+    /// \param[in] acceleration The acceleration in steps per second per second
+    void    setAcceleration(float acceleration);
+
+    /// Starts a coordinated move of every stepper in the group from rest,
+    /// with the speed and acceleration set last.
+    /// Any move in progress is abandoned where it is. Interrupts are disabled
+    /// while the move is set up, so tick() never sees it half done.
+    /// \param[in] absolute The target position of each stepper, in the order they were added
+    void    moveTo(long absolute[]);
+
+    /// Starts a coordinated move of every stepper by a number of steps.
+    /// \param[in] relative The distance for each stepper, in the order they were added
+    void    move(long relative[]);
+
+    /// Call this from the timer interrupt, at the tickRate given to the constructor.
+    /// Steps the steppers that are due.
+    /// \return true if the move is still in progress
+    boolean tick();
+
+    /// \return true while a move is in progress
+    boolean isRunning();
+
+    /// Blocks until the move in progress is complete. tick() must be running from an interrupt.
+    void    runToPosition();
+
+private:
+    /// Steps the dominant axis, the others that are due, and moves on the profile
+    void           stepAll();
+
+    /// Motion profile phases
+    typedef enum
+    {
+	ACCELERATING,
+	CRUISING,
+	DECELERATING
+    } Phase;
+
+    /// The steppers in the group
+    AccelStepper*  _steppers[STEPPERGROUP_MAX_STEPPERS];
+    uint8_t        _numSteppers;
+
+    /// Ticks per second
+    unsigned long  _tickRate;
+
+    /// Maximum speed and acceleration set for the next move, in steps per second
+    /// and steps per second per second
+    float          _maxSpeed;
+    float          _accel;
+
+    /// Maximum speed of this move in 2^-32 steps per tick
+    uint32_t       _maxVelocity;
+
+    /// Acceleration of this move in 2^-32 steps per tick per tick
+    uint32_t       _acceleration;
+
+    /// Steps of each stepper in this move, and its Bresenham error term
+    unsigned long  _delta[STEPPERGROUP_MAX_STEPPERS];
+    unsigned long  _error[STEPPERGROUP_MAX_STEPPERS];
+
+    /// Steps of the dominant axis in this move, and taken so far
+    unsigned long  _steps;
+    unsigned long  _stepsDone;
+
+    /// Steps taken while accelerating, to be taken again decelerating
+    unsigned long  _accelSteps;
+
+    /// Current and lowest velocity of the dominant axis in 2^-32 steps per tick,
+    /// and its position within the current step. 32 bits, so a step is a carry out of _fraction
+    uint32_t       _velocity;
+    uint32_t       _minVelocity;
+    uint32_t       _fraction;
+
+    uint8_t        _phase;
+    volatile boolean _running;
+};
+
+/// @example StepperGroup.pde
+/// Moves three steppers together so they arrive at the same time,
+/// stepped from a Timer1 interrupt
+
+#endif
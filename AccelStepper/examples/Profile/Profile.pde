@@ -0,0 +1,33 @@
+// Profile.pde
+// -*- mode: C++ -*-
+//
+// Make a single stepper bounce from one limit to another with an
+// S-curve motion profile from a ramp table, which allows faster stepping
+// than the default profile
+
+#include <AccelStepper.h>
+
+// Define a stepper and the pins it will use
+AccelStepper stepper(AccelStepper::DRIVER, 2, 3);
+
+// Ramp table for the profile, 4 bytes per entry
+unsigned long ramp[64];
+
+void setup()
+{  
+  // Change these to suit your stepper if you want
+  stepper.setMaxSpeed(5000);
+  stepper.setAcceleration(10000);
+  stepper.setJerk(50000);
+  stepper.setProfile(AccelStepper::PROFILE_SCURVE, ramp, 64);
+  stepper.moveTo(10000);
+}
+
+void loop()
+{
+    // If at the end of travel go to the other end
+    if (stepper.distanceToGo() == 0)
+      stepper.moveTo(-stepper.currentPosition());
+
+    stepper.run();
+}
@@ -0,0 +1,54 @@
+// StepperGroup.pde
+// -*- mode: C++ -*-
+//
+// Moves three steppers together so they arrive at the same time,
+// stepped from the Timer1 compare interrupt at 10 kHz, about as fast
+// as the interrupt can step all three at once.
+// For AVR boards such as Uno and Mega.
+
+#include <AccelStepper.h>
+#include <StepperGroup.h>
+
+#define TICK_RATE 10000
+
+// Three stepper drivers: step pins 2, 3, 4 and direction pins 5, 6, 7
+AccelStepper stepperX(AccelStepper::DRIVER, 2, 5);
+AccelStepper stepperY(AccelStepper::DRIVER, 3, 6);
+AccelStepper stepperZ(AccelStepper::DRIVER, 4, 7);
+StepperGroup group(TICK_RATE);
+
+ISR(TIMER1_COMPA_vect)
+{
+    group.tick();
+}
+
+void setup()
+{  
+    group.addStepper(stepperX);
+    group.addStepper(stepperY);
+    group.addStepper(stepperZ);
+    group.setMaxSpeed(5000.0);
+    group.setAcceleration(10000.0);
+
+    // Timer1 in CTC mode without prescaler, interrupting TICK_RATE times a second
+    noInterrupts();
+    TCCR1A = 0;
+    TCCR1B = _BV(WGM12) | _BV(CS10);
+    OCR1A = F_CPU / TICK_RATE - 1;
+    TIMSK1 |= _BV(OCIE1A);
+    interrupts();
+}
+
+void loop()
+{
+    static long positions[3] = { 4000, 1500, -700 };
+
+    // Back and forth between two corners of a box
+    if (!group.isRunning())
+    {
+	group.moveTo(positions);
+	positions[0] = -positions[0];
+	positions[1] = -positions[1];
+	positions[2] = -positions[2];
+    }
+}
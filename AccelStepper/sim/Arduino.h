@@ -0,0 +1,35 @@
+/*
+ * Minimal Arduino core for building AccelStepper on the host: the pin
+ * functions do nothing and micros() reads the virtual clock simMicros,
+ * which the simulation advances.
+ */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define min(a,b) ((a)<(b)?(a):(b))
+
+extern unsigned long simMicros;
+inline unsigned long micros() { return simMicros; }
+inline unsigned long millis() { return simMicros / 1000; }
+inline void delayMicroseconds(unsigned int) {}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+#endif
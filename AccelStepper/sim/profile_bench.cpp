@@ -0,0 +1,269 @@
+/*
+ * Host benchmark of the AccelStepper motion profiles: the default
+ * PROFILE_AUSTIN, computing the speed after each step in float, against
+ * PROFILE_TRAPEZOID and PROFILE_SCURVE looking it up in ramp tables of
+ * several sizes.
+ *
+ * Each move is run() on a virtual clock advanced a microsecond at a time,
+ * and every step is logged with its time.  For each profile this prints
+ *  - timing: the largest error of a step against the ideal profile
+ *    (trapezoid, or S-curve with the same jerk), in microseconds,
+ *  - interval: the largest error of the time between two steps, in
+ *    percent of the ideal one, leaving out the first and last steps,
+ *  - the total time of the move against the ideal one,
+ *  - the host time of setProfile(), which computes the table.
+ * Then a stepper is given new targets while it moves, and must arrive at
+ * the last one.  Last the host time per step of run() at full speed,
+ * where every call steps, for each profile, and of runSpeed() alone.
+ *
+ * Exits non-zero if a move misses its target, steps faster than the
+ * maximum speed, or if a step interval is further from the ideal one than
+ * 1% with a table of 64 entries or more, or 10% with a smaller one.
+ */
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "AccelStepper.h"
+
+unsigned long simMicros;
+
+static unsigned int errors;
+static std::vector<double> steps; // Time of each step
+
+class SimStepper : public AccelStepper
+{
+public:
+    SimStepper() : AccelStepper(AccelStepper::DRIVER, 2, 3, 4, 5, false) {}
+protected:
+    virtual void step(long)
+    {
+	steps.push_back(simMicros);
+    }
+};
+
+typedef std::chrono::steady_clock Clock;
+
+static double seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+//------------------------------------------------------------------------------
+// Ideal profiles, in double
+
+struct Motion
+{
+    double speed;
+    double accel;
+    double jerk; // 0 for a trapezoid
+};
+
+// Time to reach x from rest along the acceleration ramp, and its length
+static double rampTime(const Motion& m, double x)
+{
+    if (m.jerk == 0)
+	return sqrt(2 * x / m.accel);
+    double peak = min(m.accel, sqrt(m.speed * m.jerk));
+    double t1 = peak / m.jerk, v1 = peak * t1 / 2, t2 = (m.speed - 2 * v1) / peak;
+    double x1 = v1 * t1 / 3, v2 = v1 + peak * t2, x2 = x1 + (v1 + v2) * t2 / 2;
+    double low = 0, high = 2 * t1 + t2;
+    for (int i = 0; i < 60; i++)
+    {
+	double t = (low + high) / 2, p;
+	if (t < t1)
+	    p = m.jerk * t * t * t / 6;
+	else if (t < t1 + t2)
+	    p = x1 + v1 * (t - t1) + peak * (t - t1) * (t - t1) / 2;
+	else
+	{
+	    double dt = t - t1 - t2;
+	    p = x2 + v2 * dt + peak * dt * dt / 2 - m.jerk * dt * dt * dt / 6;
+	}
+	(p < x ? low : high) = t;
+    }
+    return (low + high) / 2;
+}
+
+static double rampSteps(const Motion& m)
+{
+    if (m.jerk == 0)
+	return m.speed * m.speed / (2 * m.accel);
+    double peak = min(m.accel, sqrt(m.speed * m.jerk));
+    return m.speed * (m.speed / peak + peak / m.jerk) / 2;
+}
+
+// Time of step x of a move of d steps from rest to rest, in microseconds
+static double idealTime(const Motion& m, double x, double d)
+{
+    double ramp = min(rampSteps(m), d / 2);
+    double top = rampTime(m, ramp);
+    double total = 2 * top + (d - 2 * ramp) / m.speed;
+    if (x <= ramp)
+	return rampTime(m, x) * 1e6;
+    if (x >= d - ramp)
+	return (total - rampTime(m, d - x)) * 1e6;
+    return (top + (x - ramp) / m.speed) * 1e6;
+}
+
+//------------------------------------------------------------------------------
+
+struct Config
+{
+    const char* name;
+    AccelStepper::Profile profile;
+    uint8_t size;
+};
+
+static const Config configs[] =
+{
+    { "austin",         AccelStepper::PROFILE_AUSTIN,    0 },
+    { "trapezoid 255",  AccelStepper::PROFILE_TRAPEZOID, 255 },
+    { "trapezoid 64",   AccelStepper::PROFILE_TRAPEZOID, 64 },
+    { "trapezoid 16",   AccelStepper::PROFILE_TRAPEZOID, 16 },
+    { "s-curve 255",    AccelStepper::PROFILE_SCURVE,    255 },
+    { "s-curve 64",     AccelStepper::PROFILE_SCURVE,    64 },
+    { "s-curve 16",     AccelStepper::PROFILE_SCURVE,    16 },
+};
+
+static unsigned long table[255];
+
+static void setup(SimStepper& stepper, const Motion& m, const Config& c)
+{
+    stepper.setMaxSpeed(m.speed);
+    stepper.setAcceleration(m.accel);
+    stepper.setJerk(c.profile == AccelStepper::PROFILE_SCURVE ? m.jerk : 0);
+    stepper.setProfile(c.profile, table, c.size);
+}
+
+static void simulate(const Motion& motion, long distance)
+{
+    printf("move %ld steps at %.0f steps/s, %.0f steps/s/s, jerk %.0f steps/s/s/s\n",
+	   distance, motion.speed, motion.accel, motion.jerk);
+    for (unsigned int i = 0; i < sizeof(configs) / sizeof(configs[0]); i++)
+    {
+	const Config& c = configs[i];
+	Motion m = motion;
+	if (c.profile != AccelStepper::PROFILE_SCURVE)
+	    m.jerk = 0;
+
+	SimStepper stepper;
+	Clock::time_point start = Clock::now();
+	setup(stepper, m, c);
+	double setupTime = seconds(start);
+
+	steps.clear();
+	simMicros = 0;
+	stepper.moveTo(distance);
+	while (stepper.run())
+	    simMicros++;
+
+	double timing = 0, interval = 0;
+	for (size_t s = 0; s < steps.size(); s++)
+	{
+	    double ideal = idealTime(m, s + 1, distance);
+	    timing = max(timing, fabs(steps[s] - ideal));
+	    if (s > 0 && s + 1 < steps.size())
+	    {
+		double idealInterval = ideal - idealTime(m, s, distance);
+		interval = max(interval, fabs(steps[s] - steps[s - 1] - idealInterval) / idealInterval);
+	    }
+	}
+	bool arrived = stepper.currentPosition() == distance && steps.size() == (size_t)distance;
+	printf("  %-14s timing %7.0f us   interval %6.2f %%   total %8.0f us (ideal %.0f)   table %6.1f us%s\n",
+	       c.name, timing, interval * 100, steps.empty() ? 0.0 : steps.back(),
+	       idealTime(m, distance, distance), setupTime * 1e6, arrived ? "" : "   MISSED TARGET");
+	if (!arrived || (c.size && interval > (c.size >= 64 ? 0.01 : 0.1)))
+	    errors++;
+    }
+}
+
+// New targets while moving, as in the Random example: each profile must
+// turn round and arrive at the last one, never faster than the maximum speed
+static void retarget()
+{
+    Motion m = { 2000, 4000, 40000 };
+    srand(1);
+    for (unsigned int i = 0; i < sizeof(configs) / sizeof(configs[0]); i++)
+    {
+	const Config& c = configs[i];
+	SimStepper stepper;
+	setup(stepper, m, c);
+	steps.clear();
+	simMicros = 0;
+	long target = 0;
+	for (int move = 0; move < 200; move++)
+	{
+	    target = rand() % 4000 - 2000;
+	    stepper.moveTo(target);
+	    unsigned long until = simMicros + rand() % 300000;
+	    while (simMicros < until && stepper.run())
+		simMicros++;
+	}
+	while (stepper.run())
+	    simMicros++;
+	double fastest = 1e9;
+	for (size_t s = 1; s < steps.size(); s++)
+	    fastest = min(fastest, steps[s] - steps[s - 1]);
+	bool ok = stepper.currentPosition() == target && fastest >= 1e6 / m.speed - 1;
+	printf("  %-14s %6lu steps, shortest interval %4.0f us%s\n", c.name,
+	       (unsigned long)steps.size(), fastest, ok ? "" : "   FAILED");
+	if (!ok)
+	    errors++;
+    }
+}
+
+// Host time per step, with every run() due to step
+static void benchHost()
+{
+    const long distance = 2000000;
+    Motion m = { 1000000, 1000000, 1e8 };
+    for (unsigned int i = 0; i < sizeof(configs) / sizeof(configs[0]); i++)
+    {
+	const Config& c = configs[i];
+	SimStepper stepper;
+	setup(stepper, m, c);
+	steps.clear();
+	steps.reserve(distance);
+	stepper.moveTo(distance);
+	Clock::time_point start = Clock::now();
+	while (stepper.distanceToGo())
+	{
+	    simMicros += 1000000;
+	    stepper.run();
+	}
+	double perStep = seconds(start) / steps.size();
+	printf("  %-14s %5.1f ns per step\n", c.name, perStep * 1e9);
+    }
+
+    // The same without computing any speed: the cost of runSpeed() and logging the step
+    SimStepper stepper;
+    stepper.setMaxSpeed(m.speed);
+    stepper.setSpeed(m.speed);
+    steps.clear();
+    Clock::time_point start = Clock::now();
+    while (stepper.currentPosition() < distance)
+    {
+	simMicros += 1000000;
+	stepper.runSpeed();
+    }
+    printf("  %-14s %5.1f ns per step\n", "runSpeed() only", seconds(start) / steps.size() * 1e9);
+}
+
+int main()
+{
+    Motion motion = { 4000, 8000, 80000 };
+    simulate(motion, 5000);
+    simulate(motion, 300);
+    Motion slow = { 500, 200, 1000 };
+    simulate(slow, 2000);
+    Motion shortRamp = { 1000, 4000, 40000 };
+    simulate(shortRamp, 1000);
+
+    printf("200 new targets while moving:\n");
+    retarget();
+
+    printf("host time per step at full speed:\n");
+    benchHost();
+    printf("%s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
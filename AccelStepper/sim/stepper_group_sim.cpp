@@ -0,0 +1,368 @@
+/*
+ * Host simulation of coordinated moves: StepperGroup against the usual
+ * way of doing them with AccelStepper, one stepper per axis with its
+ * speed and acceleration scaled by its share of the move, all run() from
+ * loop().
+ *
+ * Both run on a virtual clock, charged what they are assumed to cost on a
+ * 16 MHz AVR.  The run() loop is charged RUN_US for each run() that does
+ * not step, and STEP_US more for one that steps and computes the next
+ * speed (float square root and divides).  The timer interrupt of
+ * StepperGroup is charged ISR_US for tick(), STEP_ALL_US more for a tick
+ * that steps, and AXIS_US for each axis stepAll() looks at, plus PULSE_US
+ * for each axis it steps.  A tick due while the interrupt still runs is
+ * taken when it returns, and one due while another is already waiting is
+ * lost, as with the AVR's single interrupt flag.  None of these costs
+ * has been measured on an AVR.  Every step is logged with its time, and
+ * for each move this prints
+ *  - timing: the largest error of a dominant axis step against the ideal
+ *    trapezoidal profile, in microseconds,
+ *  - path: the largest distance of any axis from the straight line,
+ *    in steps, between steps taken at different times,
+ *  - late: how long after the dominant axis the last axis arrives,
+ *  - the total time of the move against the ideal one,
+ *  - for StepperGroup, the longest interrupt against the tick period, the
+ *    share of the CPU the interrupt takes and the ticks lost.
+ * Then, for each number of axes, the highest tick rate at which the
+ * interrupt still fits in its period when every axis steps on the same
+ * tick, against the highest step rate of the run() loop, and last the
+ * host time of run() and tick() per step, at full speed.
+ *
+ * Exits non-zero if StepperGroup leaves the line by more than half a
+ * step, an axis misses its target or arrives after the dominant axis.
+ */
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "AccelStepper.h"
+#include "StepperGroup.h"
+
+unsigned long simMicros;
+
+// Assumed AVR costs of the run() loop
+#define RUN_US  10
+#define STEP_US 100
+
+// Assumed AVR costs of the StepperGroup timer interrupt.  ISR_US is the
+// entry and exit, saving the registers the call to tick() may use, and
+// tick() itself.  STEP_ALL_US is the end of stepAll() that moves on the
+// profile, and AXIS_US the Bresenham update of an axis.  PULSE_US is the
+// virtual step() of a DRIVER stepper: six digitalWrite()s of about 3.5 us
+// each and delayMicroseconds(1).
+#define ISR_US      8
+#define STEP_ALL_US 2
+#define AXIS_US     3
+#define PULSE_US    24
+
+#define AXES 3
+
+static unsigned int errors;
+
+struct StepEvent
+{
+    double time;
+    int axis;
+    long position;
+};
+
+static std::vector<StepEvent> events;
+static double simTime; // For StepperGroup, in fractions of a microsecond
+
+class SimStepper : public AccelStepper
+{
+public:
+    SimStepper(int axis) : AccelStepper(AccelStepper::DRIVER, 2, 3, 4, 5, false), _axis(axis) {}
+protected:
+    virtual void step(long step)
+    {
+	StepEvent e = { simTime, _axis, step };
+	events.push_back(e);
+    }
+private:
+    int _axis;
+};
+
+//------------------------------------------------------------------------------
+// Ideal trapezoid of the dominant axis: the time it reaches position x
+
+static double idealTime(double x, double steps, double speed, double accel)
+{
+    double ramp = speed * speed / (2 * accel);
+    if (2 * ramp > steps)
+	ramp = steps / 2;
+    double top = sqrt(2 * ramp * accel);
+    double total = 2 * top / accel + (steps - 2 * ramp) / top;
+    if (x <= ramp)
+	return sqrt(2 * x / accel) * 1e6;
+    if (x >= steps - ramp)
+	return (total - sqrt(2 * (steps - x) / accel)) * 1e6;
+    return (top / accel + (x - ramp) / top) * 1e6;
+}
+
+struct Result
+{
+    double timing;
+    double path;
+    double late;
+    double total;
+    bool arrived;
+    double isrMax;  // Longest timer interrupt, StepperGroup only
+    double isrLoad; // Share of the CPU it takes
+    unsigned long lost; // Ticks lost while one was waiting
+};
+
+static Result analyse(const long distance[AXES], double speed, double accel)
+{
+    Result r = { 0, 0, 0, 0, true, 0, 0, 0 };
+    long steps = 0;
+    int dominant = 0;
+    for (int i = 0; i < AXES; i++)
+	if (labs(distance[i]) > steps)
+	{
+	    steps = labs(distance[i]);
+	    dominant = i;
+	}
+
+    long position[AXES] = { 0 };
+    double arrival[AXES] = { 0 };
+    for (size_t e = 0; e < events.size(); e++)
+    {
+	const StepEvent& ev = events[e];
+	position[ev.axis] = ev.position;
+	arrival[ev.axis] = ev.time;
+	if (ev.axis == dominant)
+	{
+	    double error = fabs(ev.time - idealTime(labs(ev.position), steps, speed, accel));
+	    if (error > r.timing)
+		r.timing = error;
+	}
+	// Only between steps at different times: a group steps its axes one after another
+	if (e + 1 < events.size() && events[e + 1].time == ev.time)
+	    continue;
+	for (int i = 0; i < AXES; i++)
+	{
+	    double off = fabs((double)position[i] * steps - (double)distance[i] * labs(position[dominant])) / steps;
+	    if (off > r.path)
+		r.path = off;
+	}
+    }
+
+    r.total = arrival[dominant];
+    for (int i = 0; i < AXES; i++)
+    {
+	if (position[i] != distance[i])
+	    r.arrived = false;
+	if (arrival[i] - arrival[dominant] > r.late)
+	    r.late = arrival[i] - arrival[dominant];
+    }
+    return r;
+}
+
+//------------------------------------------------------------------------------
+
+static Result runLegacy(const long distance[AXES], float speed, float accel)
+{
+    SimStepper a(0), b(1), c(2);
+    SimStepper* steppers[AXES] = { &a, &b, &c };
+    long steps = 0;
+    for (int i = 0; i < AXES; i++)
+	if (labs(distance[i]) > steps)
+	    steps = labs(distance[i]);
+
+    events.clear();
+    simMicros = 0;
+    for (int i = 0; i < AXES; i++)
+    {
+	if (distance[i] == 0)
+	    continue;
+	float share = (float)labs(distance[i]) / steps;
+	steppers[i]->setMaxSpeed(speed * share);
+	steppers[i]->setAcceleration(accel * share);
+	steppers[i]->moveTo(distance[i]);
+    }
+
+    bool running = true;
+    while (running)
+    {
+	running = false;
+	for (int i = 0; i < AXES; i++)
+	{
+	    long before = steppers[i]->currentPosition();
+	    simTime = simMicros;
+	    if (steppers[i]->run())
+		running = true;
+	    simMicros += RUN_US;
+	    if (steppers[i]->currentPosition() != before)
+		simMicros += STEP_US;
+	}
+    }
+    return analyse(distance, speed, accel);
+}
+
+static Result runGroup(const long distance[AXES], float speed, float accel, unsigned long rate)
+{
+    SimStepper a(0), b(1), c(2);
+    StepperGroup group(rate);
+    group.addStepper(a);
+    group.addStepper(b);
+    group.addStepper(c);
+    group.setMaxSpeed(speed);
+    group.setAcceleration(accel);
+
+    events.clear();
+    long target[AXES] = { distance[0], distance[1], distance[2] };
+    group.moveTo(target);
+    double period = 1e6 / rate;
+    double start = 0, end = 0, busy = 0, isrMax = 0;
+    unsigned long lost = 0;
+    for (unsigned long tick = 1; group.isRunning(); tick++)
+    {
+	double due = tick * period;
+	// Due while the last interrupt waited to run: the flag was already set
+	if (due < start)
+	{
+	    lost++;
+	    continue;
+	}
+	start = max(due, end);
+	simTime = start;
+	size_t before = events.size();
+	group.tick();
+	size_t stepped = events.size() - before;
+	double isr = ISR_US;
+	if (stepped)
+	    isr += STEP_ALL_US + AXES * AXIS_US + stepped * PULSE_US;
+	end = start + isr;
+	busy += isr;
+	if (isr > isrMax)
+	    isrMax = isr;
+    }
+    Result r = analyse(distance, speed, accel);
+    r.isrMax = isrMax;
+    r.isrLoad = busy / end;
+    r.lost = lost;
+    return r;
+}
+
+static void print(const char* name, const Result& r, double ideal)
+{
+    printf("  %-14s timing %7.0f us   path %5.2f steps   late %7.0f us   total %8.0f us (ideal %.0f)%s\n",
+	   name, r.timing, r.path, r.late, r.total, ideal, r.arrived ? "" : "   MISSED TARGET");
+}
+
+static void printIsr(const Result& r, unsigned long rate)
+{
+    printf("  %-14s interrupt up to %3.0f us of %3.0f us   load %3.0f%%   lost %lu ticks\n",
+	   "", r.isrMax, 1e6 / rate, r.isrLoad * 100, r.lost);
+}
+
+static void simulate(const long distance[AXES], float speed, float accel)
+{
+    long steps = max(max(labs(distance[0]), labs(distance[1])), labs(distance[2]));
+    double ideal = idealTime(steps, steps, speed, accel);
+    printf("move %ld %ld %ld at %.0f steps/s, %.0f steps/s/s\n",
+	   distance[0], distance[1], distance[2], speed, accel);
+
+    print("run() loop", runLegacy(distance, speed, accel), ideal);
+    static const unsigned long rates[] = { 10000, 20000, 40000 };
+    for (unsigned int i = 0; i < sizeof(rates) / sizeof(rates[0]); i++)
+    {
+	Result r = runGroup(distance, speed, accel, rates[i]);
+	char name[32];
+	snprintf(name, sizeof(name), "group %lu kHz", rates[i] / 1000);
+	print(name, r, ideal);
+	printIsr(r, rates[i]);
+	if (r.path > 0.5 || !r.arrived || r.late > 0)
+	    errors++;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Highest rates on the assumed AVR costs
+
+static void maxRates()
+{
+    printf("highest rates, every axis stepping together, on the assumed AVR costs:\n");
+    for (int axes = 1; axes <= STEPPERGROUP_MAX_STEPPERS; axes++)
+    {
+	// The longest interrupt, and the run() loop when every axis steps
+	double isr = ISR_US + STEP_ALL_US + axes * (AXIS_US + PULSE_US);
+	double loop = axes * (RUN_US + STEP_US);
+	printf("  %d axes: group ticks up to %5.0f Hz (interrupt %3.0f us), run() loop steps up to %5.0f Hz\n",
+	       axes, 1e6 / isr, isr, 1e6 / loop);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Host time per step at full speed
+
+typedef std::chrono::steady_clock Clock;
+
+static double seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void benchHost()
+{
+    const long distance = 2000000;
+    SimStepper a(0), b(1), c(2);
+    SimStepper* steppers[AXES] = { &a, &b, &c };
+    events.reserve(3 * distance + 16);
+
+    events.clear();
+    for (int i = 0; i < AXES; i++)
+    {
+	steppers[i]->setMaxSpeed(1e6);
+	steppers[i]->setAcceleration(1e6);
+	steppers[i]->moveTo(distance);
+    }
+    Clock::time_point start = Clock::now();
+    bool running = true;
+    while (running)
+    {
+	simMicros += 1000000; // Every run() steps
+	running = false;
+	for (int i = 0; i < AXES; i++)
+	    if (steppers[i]->run())
+		running = true;
+    }
+    double legacy = seconds(start) / events.size();
+
+    events.clear();
+    StepperGroup group(20000);
+    for (int i = 0; i < AXES; i++)
+	group.addStepper(*steppers[i]);
+    group.setMaxSpeed(20000); // A step on every tick
+    group.setAcceleration(1e9);
+    long relative[AXES] = { distance, distance, distance };
+    group.move(relative);
+    unsigned long ticks = 0;
+    start = Clock::now();
+    while (group.tick())
+	ticks++;
+    double tick = seconds(start) / events.size();
+
+    printf("host time per step: run() %.1f ns, tick() %.1f ns (%lu steps)\n",
+	   legacy * 1e9, tick * 1e9, (unsigned long)events.size());
+}
+
+int main()
+{
+    static const long moves[][AXES] =
+    {
+	{ 3000, 1000, -2000 },
+	{ 200, 150, 7 },
+	{ 10000, -9999, 1 },
+	{ 50, 0, 20 },
+	{ -1, 1, 0 },
+    };
+    for (unsigned int m = 0; m < sizeof(moves) / sizeof(moves[0]); m++)
+	simulate(moves[m], 2000, 4000);
+    simulate(moves[0], 8000, 40000);
+
+    maxRates();
+    benchHost();
+    printf("%s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
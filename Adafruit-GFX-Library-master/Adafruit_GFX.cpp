@@ -70,6 +70,61 @@ POSSIBILITY OF SUCH DAMAGE.
 #define _swap_int16_t(a, b) { int16_t t = a; a = b; b = t; }
 #endif
 
+// Clip a rectangle to a width x height area.  Returns false if nothing
+// of it is left.
+static inline boolean clipRect(int16_t width, int16_t height,
+ int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+  if((w <= 0) || (h <= 0) || (x >= width) || (y >= height) ||
+     ((x + w) <= 0) || ((y + h) <= 0)) return false;
+  if(x < 0) { w += x; x = 0; }
+  if(y < 0) { h += y; y = 0; }
+  if((x + w) > width)  w = width  - x;
+  if((y + h) > height) h = height - y;
+  return true;
+}
+
+// Map a rectangle in rotated coordinates to the unrotated WIDTH x HEIGHT
+// buffer of a canvas.  A 1x1 rectangle maps a single pixel.
+static inline void rotateRect(uint8_t rotation, int16_t WIDTH,
+ int16_t HEIGHT, int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+  int16_t t;
+  switch(rotation) {
+   case 1:
+    t = x;
+    x = WIDTH  - y - h;
+    y = t;
+    _swap_int16_t(w, h);
+    break;
+   case 2:
+    x = WIDTH  - x - w;
+    y = HEIGHT - y - h;
+    break;
+   case 3:
+    t = y;
+    y = HEIGHT - x - w;
+    x = t;
+    _swap_int16_t(w, h);
+    break;
+  }
+}
+
+// Clip a copy of a w x h rectangle from (sx,sy) in a source to (x,y) in
+// a destination, to both of their areas.  Returns false if nothing of it
+// is left.
+static inline boolean clipCopy(int16_t width, int16_t height,
+ int16_t srcWidth, int16_t srcHeight, int16_t &x, int16_t &y,
+ int16_t &sx, int16_t &sy, int16_t &w, int16_t &h) {
+  if(sx < 0) { x  -= sx; w += sx; sx = 0; }
+  if(sy < 0) { y  -= sy; h += sy; sy = 0; }
+  if(x  < 0) { sx -= x;  w += x;  x  = 0; }
+  if(y  < 0) { sy -= y;  h += y;  y  = 0; }
+  if((sx + w) > srcWidth)  w = srcWidth  - sx;
+  if((sy + h) > srcHeight) h = srcHeight - sy;
+  if((x  + w) > width)     w = width     - x;
+  if((y  + h) > height)    h = height    - y;
+  return (w > 0) && (h > 0);
+}
+
 Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h):
   WIDTH(w), HEIGHT(h)
 {
@@ -245,13 +300,18 @@ void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
 void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y,
  int16_t h, uint16_t color) {
   // Update in subclasses if desired!
-  drawLine(x, y, x, y+h-1, color);
+  // Straight pixel loop, no need for the line stepping of drawLine()
+  for (int16_t j=y; j<y+h; j++) {
+    drawPixel(x, j, color);
+  }
 }
 
 void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y,
  int16_t w, uint16_t color) {
   // Update in subclasses if desired!
-  drawLine(x, y, x+w-1, y, color);
+  for (int16_t i=x; i<x+w; i++) {
+    drawPixel(i, y, color);
+  }
 }
 
 void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
@@ -521,6 +581,17 @@ void Adafruit_GFX::write(uint8_t c) {
 #endif
 }
 
+// Draw one horizontal run of a glyph row, clipped to the display, so
+// subclasses get a single drawFastHLine() or fillRect() per run instead
+// of a drawPixel() per font pixel.
+void Adafruit_GFX::drawGlyphRun(int16_t x, int16_t y, int16_t w, int16_t h,
+ uint16_t color) {
+  if(!clipRect(_width, _height, x, y, w, h)) return;
+
+  if(h == 1) drawFastHLine(x, y, w, color);
+  else       fillRect(x, y, w, h, color);
+}
+
 // Draw a character
 void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
  uint16_t color, uint16_t bg, uint8_t size) {
@@ -533,20 +604,20 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
        ((y + 8 * size - 1) < 0))   // Clip top
       return;
 
-    if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
-
-    for(int8_t i=0; i<6; i++ ) {
-      uint8_t line;
-      if(i < 5) line = pgm_read_byte(font+(c*5)+i);
-      else      line = 0x0;
-      for(int8_t j=0; j<8; j++, line >>= 1) {
-        if(line & 0x1) {
-          if(size == 1) drawPixel(x+i, y+j, color);
-          else          fillRect(x+(i*size), y+(j*size), size, size, color);
-        } else if(bg != color) {
-          if(size == 1) drawPixel(x+i, y+j, bg);
-          else          fillRect(x+i*size, y+j*size, size, size, bg);
-        }
+    uint8_t line[5];
+    for(int8_t i=0; i<5; i++) line[i] = classicFontColumn(c, i);
+
+    // Background box once, then the set pixels of each row as runs
+    if(bg != color) drawGlyphRun(x, y, 6 * size, 8 * size, bg);
+
+    for(int8_t j=0; j<8; j++) {
+      uint8_t bit = 1 << j;
+      for(int8_t i=0; i<5; i++) {
+        if(!(line[i] & bit)) continue;
+        int8_t i0 = i;
+        while((i < 4) && (line[i+1] & bit)) i++;
+        drawGlyphRun(x + i0 * size, y + j * size, (i - i0 + 1) * size, size,
+          color);
       }
     }
 
@@ -562,19 +633,11 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 
     uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
     uint8_t  w  = pgm_read_byte(&glyph->width),
-             h  = pgm_read_byte(&glyph->height),
-             xa = pgm_read_byte(&glyph->xAdvance);
+             h  = pgm_read_byte(&glyph->height);
     int8_t   xo = pgm_read_byte(&glyph->xOffset),
              yo = pgm_read_byte(&glyph->yOffset);
-    uint8_t  xx, yy, bits, bit = 0;
-    int16_t  xo16, yo16;
-
-    if(size > 1) {
-      xo16 = xo;
-      yo16 = yo;
-    }
-
-    // Todo: Add character clipping here
+    uint8_t  xx, yy, bits = 0, bit = 0;
+    int16_t  run;
 
     // NOTE: THERE IS NO 'BACKGROUND' COLOR OPTION ON CUSTOM FONTS.
     // THIS IS ON PURPOSE AND BY DESIGN.  The background color feature
@@ -592,25 +655,38 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
 
+    // Glyph bitmaps are packed row by row with no row padding, so each
+    // row is scanned for runs of set bits.
     for(yy=0; yy<h; yy++) {
+      run = 0;
       for(xx=0; xx<w; xx++) {
         if(!(bit++ & 7)) {
           bits = pgm_read_byte(&bitmap[bo++]);
         }
         if(bits & 0x80) {
-          if(size == 1) {
-            drawPixel(x+xo+xx, y+yo+yy, color);
-          } else {
-            fillRect(x+(xo16+xx)*size, y+(yo16+yy)*size, size, size, color);
-          }
+          run++;
+        } else if(run) {
+          drawGlyphRun(x + (xo + xx - run) * size, y + (yo + yy) * size,
+            run * size, size, color);
+          run = 0;
         }
         bits <<= 1;
       }
+      if(run) {
+        drawGlyphRun(x + (xo + w - run) * size, y + (yo + yy) * size,
+          run * size, size, color);
+      }
     }
 
   } // End classic vs custom font
 }
 
+uint8_t Adafruit_GFX::classicFontColumn(unsigned char c, uint8_t i) const {
+  if(i >= 5) return 0x0; // Spacing column
+  if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
+  return pgm_read_byte(font+(c*5)+i);
+}
+
 void Adafruit_GFX::setCursor(int16_t x, int16_t y) {
   cursor_x = x;
   cursor_y = y;
@@ -960,7 +1036,7 @@ boolean Adafruit_GFX_Button::justReleased() { return (!currstate && laststate);
 // NOT EXTENSIVELY TESTED YET.  MAY CONTAIN WORST BUGS KNOWN TO HUMANKIND.
 
 GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
-  uint16_t bytes = ((w + 7) / 8) * h;
+  uint32_t bytes = (uint32_t)((w + 7) / 8) * h;
   if((buffer = (uint8_t *)malloc(bytes))) {
     memset(buffer, 0, bytes);
   }
@@ -1001,21 +1077,134 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
       break;
     }
 
-    uint8_t *ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+    uint8_t *ptr = &buffer[(x / 8) + (int32_t)y * ((WIDTH + 7) / 8)];
     if(color) *ptr |= pgm_read_byte(&GFXsetBit[x & 7]);
     else      *ptr &= pgm_read_byte(&GFXclrBit[x & 7]);
   }
 }
 
+boolean GFXcanvas1::getPixel(int16_t x, int16_t y) const {
+  if(!buffer || (x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    return false;
+
+  int16_t w = 1, h = 1;
+  rotateRect(rotation, WIDTH, HEIGHT, x, y, w, h);
+  return buffer[(x / 8) + (int32_t)y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+}
+
+void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h,
+ uint16_t color) {
+  GFXcanvas1::fillRect(x, y, 1, h, color);
+}
+
+void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w,
+ uint16_t color) {
+  GFXcanvas1::fillRect(x, y, w, 1, color);
+}
+
+// Rectangles are clipped and rotated once, then filled a scanline at a
+// time with masks for the partial bytes at either end and memset() for
+// the whole bytes in between.
+void GFXcanvas1::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+ uint16_t color) {
+  if(buffer && clipRect(_width, _height, x, y, w, h)) {
+    rotateRect(rotation, WIDTH, HEIGHT, x, y, w, h);
+    rawFillRect(x, y, w, h, color);
+  }
+}
+
+void GFXcanvas1::rawFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+ uint16_t color) {
+  int16_t  bytesPerRow = (WIDTH + 7) / 8,
+           first       = x / 8,
+           last        = (x + w - 1) / 8;
+  uint8_t  firstMask   = 0xFF >> (x & 7),
+           lastMask    = 0xFF << (7 - ((x + w - 1) & 7)),
+          *row         = &buffer[first + (int32_t)y * bytesPerRow];
+
+  if(first == last) firstMask &= lastMask;
+
+  while(h--) {
+    if(color) {
+      row[0] |= firstMask;
+      if(last > first) {
+        memset(row + 1, 0xFF, last - first - 1);
+        row[last - first] |= lastMask;
+      }
+    } else {
+      row[0] &= ~firstMask;
+      if(last > first) {
+        memset(row + 1, 0x00, last - first - 1);
+        row[last - first] &= ~lastMask;
+      }
+    }
+    row += bytesPerRow;
+  }
+}
+
 void GFXcanvas1::fillScreen(uint16_t color) {
   if(buffer) {
-    uint16_t bytes = ((WIDTH + 7) / 8) * HEIGHT;
+    uint32_t bytes = (uint32_t)((WIDTH + 7) / 8) * HEIGHT;
     memset(buffer, color ? 0xFF : 0x00, bytes);
   }
 }
 
+// Copy a w x h rectangle at (sx,sy) in src to (x,y) in this canvas, both
+// in their rotated coordinates.  src may be this canvas, with the source
+// and destination overlapping.  Unrotated canvases with the same bit
+// alignment copy whole bytes a scanline at a time.
+void GFXcanvas1::copyRect(int16_t x, int16_t y, const GFXcanvas1 *src,
+ int16_t sx, int16_t sy, int16_t w, int16_t h) {
+  if(!buffer || !src || !src->buffer ||
+     !clipCopy(_width, _height, src->_width, src->_height,
+       x, y, sx, sy, w, h)) return;
+
+  // Copy bottom-up / right-to-left when moving down / right within one
+  // canvas, so overlapping source pixels are read before being written.
+  boolean reverse = (src == this) && ((y > sy) || ((y == sy) && (x > sx)));
+  int16_t i, j;
+
+  if(!rotation && !src->rotation && ((x & 7) == (sx & 7))) {
+    int16_t  bytesPerRow    = (WIDTH + 7) / 8,
+             srcBytesPerRow = (src->WIDTH + 7) / 8,
+             first          = x / 8,
+             last           = (x + w - 1) / 8;
+    uint8_t  firstMask      = 0xFF >> (x & 7),
+             lastMask       = 0xFF << (7 - ((x + w - 1) & 7));
+    if(first == last) firstMask &= lastMask;
+
+    for(j=0; j<h; j++) {
+      int16_t  row = reverse ? (h - 1 - j) : j;
+      uint8_t *d   = &buffer[first + (int32_t)(y + row) * bytesPerRow];
+      const uint8_t *s = &src->buffer[sx / 8 +
+                                      (int32_t)(sy + row) * srcBytesPerRow];
+      uint8_t  d0  = (d[0] & ~firstMask) | (s[0] & firstMask);
+      if(last > first) {
+        uint8_t dn = (d[last - first] & ~lastMask) | (s[last - first] & lastMask);
+        memmove(d + 1, s + 1, last - first - 1);
+        d[last - first] = dn;
+      }
+      d[0] = d0;
+    }
+  } else {
+    for(j=0; j<h; j++) {
+      int16_t row = reverse ? (h - 1 - j) : j;
+      for(i=0; i<w; i++) {
+        int16_t col = reverse ? (w - 1 - i) : i;
+        GFXcanvas1::drawPixel(x + col, y + row,
+          src->getPixel(sx + col, sy + row));
+      }
+    }
+  }
+}
+
+// Copy all of src to (x,y) in this canvas
+void GFXcanvas1::blit(int16_t x, int16_t y, const GFXcanvas1 *src) {
+  if(src) copyRect(x, y, src, 0, 0, src->_width, src->_height);
+}
+
 GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
-  uint16_t bytes = w * h * 2;
+  uint32_t bytes = (uint32_t)w * h * 2;
   if((buffer = (uint16_t *)malloc(bytes))) {
     memset(buffer, 0, bytes);
   }
@@ -1051,7 +1240,57 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
       break;
     }
 
-    buffer[x + y * WIDTH] = color;
+    buffer[x + (int32_t)y * WIDTH] = color;
+  }
+}
+
+uint16_t GFXcanvas16::getPixel(int16_t x, int16_t y) const {
+  if(!buffer || (x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    return 0;
+
+  int16_t w = 1, h = 1;
+  rotateRect(rotation, WIDTH, HEIGHT, x, y, w, h);
+  return buffer[x + (int32_t)y * WIDTH];
+}
+
+void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h,
+ uint16_t color) {
+  GFXcanvas16::fillRect(x, y, 1, h, color);
+}
+
+void GFXcanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w,
+ uint16_t color) {
+  GFXcanvas16::fillRect(x, y, w, 1, color);
+}
+
+// Rectangles are clipped and rotated once, then filled a scanline at a
+// time: with memset() when both color bytes match, otherwise the first
+// scanline is filled by word and copied to the rest.
+void GFXcanvas16::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+ uint16_t color) {
+  if(buffer && clipRect(_width, _height, x, y, w, h)) {
+    rotateRect(rotation, WIDTH, HEIGHT, x, y, w, h);
+    rawFillRect(x, y, w, h, color);
+  }
+}
+
+void GFXcanvas16::rawFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+ uint16_t color) {
+  uint16_t *row = &buffer[x + (int32_t)y * WIDTH];
+  uint8_t   hi  = color >> 8, lo = color & 0xFF;
+
+  if(hi == lo) {
+    while(h--) {
+      memset(row, lo, w * 2);
+      row += WIDTH;
+    }
+  } else {
+    uint16_t *first = row;
+    for(int16_t i=0; i<w; i++) first[i] = color;
+    while(--h) {
+      row += WIDTH;
+      memcpy(row, first, w * 2);
+    }
   }
 }
 
@@ -1059,11 +1298,48 @@ void GFXcanvas16::fillScreen(uint16_t color) {
   if(buffer) {
     uint8_t hi = color >> 8, lo = color & 0xFF;
     if(hi == lo) {
-      memset(buffer, lo, WIDTH * HEIGHT * 2);
+      memset(buffer, lo, (uint32_t)WIDTH * HEIGHT * 2);
     } else {
-      uint16_t i, pixels = WIDTH * HEIGHT;
+      uint32_t i, pixels = (uint32_t)WIDTH * HEIGHT;
       for(i=0; i<pixels; i++) buffer[i] = color;
     }
   }
 }
 
+// Copy a w x h rectangle at (sx,sy) in src to (x,y) in this canvas, both
+// in their rotated coordinates.  src may be this canvas, with the source
+// and destination overlapping.  Unrotated canvases copy a scanline at a
+// time with memmove().
+void GFXcanvas16::copyRect(int16_t x, int16_t y, const GFXcanvas16 *src,
+ int16_t sx, int16_t sy, int16_t w, int16_t h) {
+  if(!buffer || !src || !src->buffer ||
+     !clipCopy(_width, _height, src->_width, src->_height,
+       x, y, sx, sy, w, h)) return;
+
+  // Copy bottom-up / right-to-left when moving down / right within one
+  // canvas, so overlapping source pixels are read before being written.
+  boolean reverse = (src == this) && ((y > sy) || ((y == sy) && (x > sx)));
+  int16_t i, j;
+
+  if(!rotation && !src->rotation) {
+    for(j=0; j<h; j++) {
+      int16_t row = reverse ? (h - 1 - j) : j;
+      memmove(&buffer[x + (int32_t)(y + row) * WIDTH],
+        &src->buffer[sx + (int32_t)(sy + row) * src->WIDTH], w * 2);
+    }
+  } else {
+    for(j=0; j<h; j++) {
+      int16_t row = reverse ? (h - 1 - j) : j;
+      for(i=0; i<w; i++) {
+        int16_t col = reverse ? (w - 1 - i) : i;
+        GFXcanvas16::drawPixel(x + col, y + row,
+          src->getPixel(sx + col, sy + row));
+      }
+    }
+  }
+}
+
+// Copy all of src to (x,y) in this canvas
+void GFXcanvas16::blit(int16_t x, int16_t y, const GFXcanvas16 *src) {
+  if(src) copyRect(x, y, src, 0, 0, src->_width, src->_height);
+}
@@ -28,7 +28,17 @@ class Adafruit_GFX : public Print {
     drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
     fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
     fillScreen(uint16_t color),
-    invertDisplay(boolean i);
+    invertDisplay(boolean i),
+    drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+      int16_t w, int16_t h, uint16_t color),
+    drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+      int16_t w, int16_t h, uint16_t color, uint16_t bg),
+    drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+      int16_t w, int16_t h, uint16_t color),
+    drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+      int16_t w, int16_t h, uint16_t color, uint16_t bg),
+    drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+      uint16_t bg, uint8_t size);
 
   // These exist only with Adafruit_GFX (no subclass overrides)
   void
@@ -46,18 +56,8 @@ class Adafruit_GFX : public Print {
       int16_t radius, uint16_t color),
     fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
       int16_t radius, uint16_t color),
-    drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
-      int16_t w, int16_t h, uint16_t color),
-    drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
-      int16_t w, int16_t h, uint16_t color, uint16_t bg),
-    drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
-      int16_t w, int16_t h, uint16_t color),
-    drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
-      int16_t w, int16_t h, uint16_t color, uint16_t bg),
     drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
       int16_t w, int16_t h, uint16_t color),
-    drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
-      uint16_t bg, uint8_t size),
     setCursor(int16_t x, int16_t y),
     setTextColor(uint16_t c),
     setTextColor(uint16_t c, uint16_t bg),
@@ -87,6 +87,14 @@ class Adafruit_GFX : public Print {
   int16_t getCursorY(void) const;
 
  protected:
+  // Column i (0-5) of character c in the 'classic' font, top row in bit 0,
+  // for subclasses that render the font directly
+  uint8_t classicFontColumn(unsigned char c, uint8_t i) const;
+
+  // Clipped horizontal run of text pixels, as one drawFastHLine() or fillRect()
+  void drawGlyphRun(int16_t x, int16_t y, int16_t w, int16_t h,
+    uint16_t color);
+
   const int16_t
     WIDTH, HEIGHT;   // This is the 'raw' display w/h - never changes
   int16_t
@@ -136,20 +144,41 @@ class GFXcanvas1 : public Adafruit_GFX {
   GFXcanvas1(uint16_t w, uint16_t h);
   ~GFXcanvas1(void);
   void     drawPixel(int16_t x, int16_t y, uint16_t color),
-           fillScreen(uint16_t color);
+           drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+           drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+           fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+             uint16_t color),
+           fillScreen(uint16_t color),
+           copyRect(int16_t x, int16_t y, const GFXcanvas1 *src,
+             int16_t sx, int16_t sy, int16_t w, int16_t h),
+           blit(int16_t x, int16_t y, const GFXcanvas1 *src);
+  boolean  getPixel(int16_t x, int16_t y) const;
   uint8_t *getBuffer(void);
  private:
   uint8_t *buffer;
+  void     rawFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+             uint16_t color);
 };
 
 class GFXcanvas16 : public Adafruit_GFX {
+ public:
   GFXcanvas16(uint16_t w, uint16_t h);
   ~GFXcanvas16(void);
   void      drawPixel(int16_t x, int16_t y, uint16_t color),
-            fillScreen(uint16_t color);
+            drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+            drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+            fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              uint16_t color),
+            fillScreen(uint16_t color),
+            copyRect(int16_t x, int16_t y, const GFXcanvas16 *src,
+              int16_t sx, int16_t sy, int16_t w, int16_t h),
+            blit(int16_t x, int16_t y, const GFXcanvas16 *src);
+  uint16_t  getPixel(int16_t x, int16_t y) const;
   uint16_t *getBuffer(void);
  private:
   uint16_t *buffer;
+  void      rawFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              uint16_t color);
 };
 
 #endif // _ADAFRUIT_GFX_H
@@ -0,0 +1,36 @@
+/***************************************************
+  Host stand-in for the Arduino core, used to build Adafruit_GFX and its
+  canvases natively for the text benchmark in this folder.
+
+  BSD license, check license.txt for more information
+ ****************************************************/
+#ifndef _SIM_ARDUINO_H_
+#define _SIM_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW  0
+#define INPUT  0
+#define OUTPUT 1
+
+// Flash strings live in ordinary memory on the host.
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+
+// Pins are not modeled. Not used by the canvases.
+inline void pinMode(uint8_t, uint8_t) { }
+inline void digitalWrite(uint8_t, uint8_t) { }
+inline int digitalRead(uint8_t) { return LOW; }
+inline void delay(unsigned long) { }
+
+#include "Print.h"
+
+#endif
@@ -0,0 +1,24 @@
+/***************************************************
+  Host stand-in for the Arduino Print class, with the subset of print()
+  overloads used by the benchmark.
+
+  BSD license, check license.txt for more information
+ ****************************************************/
+#ifndef _SIM_PRINT_H_
+#define _SIM_PRINT_H_
+
+#include <stdio.h>
+
+class Print {
+ public:
+  virtual ~Print() { }
+  virtual size_t write(uint8_t) = 0;
+
+  size_t print(const char *s) {
+    size_t n = 0;
+    while (*s) n += write((uint8_t)*s++);
+    return n;
+  }
+};
+
+#endif
@@ -0,0 +1,127 @@
+/***************************************************
+  Text rendering benchmark for Adafruit_GFX
+
+  Renders a line of text into a GFXcanvas16 with the classic font and
+  the FreeSans/FreeMono fonts, and reports the time per string and the
+  primitive calls the renderer makes into the canvas.  Then times the
+  canvas fill and copy primitives in each rotation.
+
+  BSD license, check license.txt for more information
+ ****************************************************/
+#include <stdio.h>
+#include <time.h>
+
+#include "Adafruit_GFX.h"
+#include "Fonts/FreeMono12pt7b.h"
+#include "Fonts/FreeSans9pt7b.h"
+#include "Fonts/FreeSans18pt7b.h"
+
+#define WIDTH  320
+#define HEIGHT 240
+#define REPEAT 2000
+
+static const char text[] = "Quick brown fox 0123456789";
+
+// GFXcanvas16 that counts the primitives called on it
+class CountingCanvas16 : public GFXcanvas16 {
+ public:
+  CountingCanvas16(uint16_t w, uint16_t h) : GFXcanvas16(w, h) { reset(); }
+
+  uint32_t pixels, hlines, vlines, rects;
+  void reset(void) { pixels = hlines = vlines = rects = 0; }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    pixels++;
+    GFXcanvas16::drawPixel(x, y, color);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    hlines++;
+    GFXcanvas16::drawFastHLine(x, y, w, color);
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    vlines++;
+    GFXcanvas16::drawFastVLine(x, y, h, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    rects++;
+    GFXcanvas16::fillRect(x, y, w, h, color);
+  }
+};
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return 1e6 * ts.tv_sec + 1e-3 * ts.tv_nsec;
+}
+
+static void drawText(Adafruit_GFX &gfx, const GFXfont *font, uint8_t size, uint16_t bg) {
+  gfx.setFont(font);
+  gfx.setTextSize(size);
+  gfx.setTextColor(0xFFFF, bg);
+  gfx.setCursor(0, font ? 40 : 10);
+  gfx.print(text);
+}
+
+static void bench(const char *name, const GFXfont *font, uint8_t size, uint16_t bg) {
+  GFXcanvas16 canvas(WIDTH, HEIGHT);
+  CountingCanvas16 counting(WIDTH, HEIGHT);
+
+  drawText(counting, font, size, bg);
+
+  double start = now_us();
+  for(int n=0; n<REPEAT; n++) drawText(canvas, font, size, bg);
+  double us = (now_us() - start) / REPEAT;
+
+  printf("  %-22s %8.2f us/string %8.0f chars/s  calls: %5lu pixel %4lu hline %4lu vline %4lu rect\n",
+    name, us, 1e6 * (sizeof(text) - 1) / us,
+    (unsigned long)counting.pixels, (unsigned long)counting.hlines,
+    (unsigned long)counting.vlines, (unsigned long)counting.rects);
+}
+
+// Times one canvas operation, repeated over a full-screen pattern of
+// small rectangles, and reports it in megapixels per second.
+template <class Canvas>
+static void benchCanvas(const char *name, Canvas &canvas, Canvas &src, uint8_t op) {
+  printf("  %-14s", name);
+  for(uint8_t r=0; r<4; r++) {
+    canvas.setRotation(r);
+    src.setRotation(r);
+    int16_t w = canvas.width(), h = canvas.height();
+    uint32_t pixels = 0;
+    double start = now_us();
+    for(int n=0; n<REPEAT/100; n++) {
+      for(int16_t y=0; y<h; y+=16) {
+        for(int16_t x=0; x<w; x+=40) {
+          switch(op) {
+           case 0: canvas.fillRect(x, y, 37, 13, 0x1234 + n); break;
+           case 1: canvas.drawFastHLine(x, y, 37, 0x1234 + n); break;
+           case 2: canvas.drawFastVLine(x, y, 13, 0x1234 + n); break;
+           case 3: canvas.copyRect(x, y, &src, y, x, 37, 13); break;
+          }
+          pixels += (op == 1) ? 37 : (op == 2) ? 13 : 37 * 13;
+        }
+      }
+    }
+    printf("  rot %d %8.1f Mpixel/s", r, pixels / (now_us() - start));
+  }
+  printf("\n");
+}
+
+int main(void) {
+  printf("\"%s\" on GFXcanvas16 %dx%d\n", text, WIDTH, HEIGHT);
+  bench("classic", NULL, 1, 0xFFFF);
+  bench("classic, background", NULL, 1, 0x0000);
+  bench("classic size 2", NULL, 2, 0xFFFF);
+  bench("FreeSans9pt7b", &FreeSans9pt7b, 1, 0xFFFF);
+  bench("FreeSans18pt7b", &FreeSans18pt7b, 1, 0xFFFF);
+  bench("FreeMono12pt7b", &FreeMono12pt7b, 1, 0xFFFF);
+
+  GFXcanvas1  canvas1(WIDTH, HEIGHT), src1(WIDTH, HEIGHT);
+  GFXcanvas16 canvas16(WIDTH, HEIGHT), src16(WIDTH, HEIGHT);
+  const char *ops[] = { "fillRect", "drawFastHLine", "drawFastVLine", "copyRect" };
+  printf("GFXcanvas1 %dx%d\n", WIDTH, HEIGHT);
+  for(uint8_t op=0; op<4; op++) benchCanvas(ops[op], canvas1, src1, op);
+  printf("GFXcanvas16 %dx%d\n", WIDTH, HEIGHT);
+  for(uint8_t op=0; op<4; op++) benchCanvas(ops[op], canvas16, src16, op);
+  return 0;
+}
@@ -556,6 +556,227 @@ void Adafruit_ILI9341::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 }
 
 
+// Begin a batch of window writes.  With SPI transactions, the bus is
+// claimed once for the whole batch instead of once per pixel.
+void Adafruit_ILI9341::startWrite(void) {
+  if (hwSPI) spi_begin();
+}
+
+void Adafruit_ILI9341::endWrite(void) {
+  if (hwSPI) spi_end();
+}
+
+// Send len pixels into the current address window.  Call between
+// startWrite() and endWrite(), after setAddrWindow().
+void Adafruit_ILI9341::writePixels(const uint16_t *colors, uint32_t len) {
+#if defined(USE_FAST_PINIO)
+  *dcport |=  dcpinmask;
+  *csport &= ~cspinmask;
+#else
+  digitalWrite(_dc, HIGH);
+  digitalWrite(_cs, LOW);
+#endif
+
+  while (len--) {
+    uint16_t color = *colors++;
+    spiwrite(color >> 8);
+    spiwrite(color);
+  }
+
+#if defined(USE_FAST_PINIO)
+  *csport |= cspinmask;
+#else
+  digitalWrite(_cs, HIGH);
+#endif
+}
+
+// Send len pixels of one color into the current address window
+void Adafruit_ILI9341::writeColor(uint16_t color, uint32_t len) {
+  uint8_t hi = color >> 8, lo = color;
+
+#if defined(USE_FAST_PINIO)
+  *dcport |=  dcpinmask;
+  *csport &= ~cspinmask;
+#else
+  digitalWrite(_dc, HIGH);
+  digitalWrite(_cs, LOW);
+#endif
+
+  while (len--) {
+    spiwrite(hi);
+    spiwrite(lo);
+  }
+
+#if defined(USE_FAST_PINIO)
+  *csport |= cspinmask;
+#else
+  digitalWrite(_cs, HIGH);
+#endif
+}
+
+// Draw a 16-bit 565 image from RAM, one window for the visible part
+void Adafruit_ILI9341::drawRGBBitmap(int16_t x, int16_t y,
+  const uint16_t *pcolors, int16_t w, int16_t h) {
+
+  int16_t x1 = x + w - 1, y1 = y + h - 1;
+  if((x >= _width) || (y >= _height) || (x1 < 0) || (y1 < 0)) return;
+
+  // Clip to the screen, skipping the hidden pixels of each row
+  int16_t skip = 0;
+  if(x < 0) { skip = -x; x = 0; }
+  if(y < 0) { pcolors += (int32_t)(-y) * w; y = 0; }
+  if(x1 >= _width)  x1 = _width  - 1;
+  if(y1 >= _height) y1 = _height - 1;
+
+  startWrite();
+  setAddrWindow(x, y, x1, y1);
+  for(int16_t row=y; row<=y1; row++) {
+    writePixels(pcolors + skip, x1 - x + 1);
+    pcolors += w;
+  }
+  endWrite();
+}
+
+// Draw a character.  The classic font with a background color is sent as
+// one window per glyph.  Transparent text, custom fonts and clipped glyphs
+// use Adafruit_GFX, which draws one window per run of set pixels.
+void Adafruit_ILI9341::drawChar(int16_t x, int16_t y, unsigned char c,
+ uint16_t color, uint16_t bg, uint8_t size) {
+
+  if(gfxFont || (bg == color) || (x < 0) || (y < 0) ||
+     ((x + 6 * size) > _width) || ((y + 8 * size) > _height)) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size);
+    return;
+  }
+
+  uint8_t line[6];
+  for(uint8_t i=0; i<6; i++) line[i] = classicFontColumn(c, i);
+
+  uint8_t fhi = color >> 8, flo = color, bhi = bg >> 8, blo = bg;
+
+  startWrite();
+  setAddrWindow(x, y, x + 6 * size - 1, y + 8 * size - 1);
+
+#if defined(USE_FAST_PINIO)
+  *dcport |=  dcpinmask;
+  *csport &= ~cspinmask;
+#else
+  digitalWrite(_dc, HIGH);
+  digitalWrite(_cs, LOW);
+#endif
+
+  for(uint8_t j=0; j<8; j++) {
+    for(uint8_t sy=0; sy<size; sy++) {
+      for(uint8_t i=0; i<6; i++) {
+        boolean set = line[i] & (1 << j);
+        for(uint8_t sx=0; sx<size; sx++) {
+          spiwrite(set ? fhi : bhi);
+          spiwrite(set ? flo : blo);
+        }
+      }
+    }
+  }
+
+#if defined(USE_FAST_PINIO)
+  *csport |= cspinmask;
+#else
+  digitalWrite(_cs, HIGH);
+#endif
+  endWrite();
+}
+
+// Draw a 1-bit bitmap fully on the screen.  Opaque bitmaps are sent as
+// one window, transparent ones as one window per horizontal run of set
+// pixels.
+void Adafruit_ILI9341::drawBitmapRows(int16_t x, int16_t y,
+ const uint8_t *bitmap, boolean progmem, int16_t w, int16_t h,
+ uint16_t color, uint16_t bg, boolean opaque) {
+
+  int16_t i, j, byteWidth = (w + 7) / 8;
+  uint8_t byte = 0;
+
+  if(opaque) {
+    uint8_t fhi = color >> 8, flo = color, bhi = bg >> 8, blo = bg;
+
+    startWrite();
+    setAddrWindow(x, y, x + w - 1, y + h - 1);
+
+#if defined(USE_FAST_PINIO)
+    *dcport |=  dcpinmask;
+    *csport &= ~cspinmask;
+#else
+    digitalWrite(_dc, HIGH);
+    digitalWrite(_cs, LOW);
+#endif
+
+    for(j=0; j<h; j++) {
+      const uint8_t *row = bitmap + j * byteWidth;
+      for(i=0; i<w; i++) {
+        if(i & 7) byte <<= 1;
+        else      byte   = progmem ? pgm_read_byte(row + i / 8) : row[i / 8];
+        spiwrite((byte & 0x80) ? fhi : bhi);
+        spiwrite((byte & 0x80) ? flo : blo);
+      }
+    }
+
+#if defined(USE_FAST_PINIO)
+    *csport |= cspinmask;
+#else
+    digitalWrite(_cs, HIGH);
+#endif
+    endWrite();
+  } else {
+    for(j=0; j<h; j++) {
+      const uint8_t *row = bitmap + j * byteWidth;
+      int16_t run = 0;
+      for(i=0; i<w; i++) {
+        if(i & 7) byte <<= 1;
+        else      byte   = progmem ? pgm_read_byte(row + i / 8) : row[i / 8];
+        if(byte & 0x80) {
+          run++;
+        } else if(run) {
+          drawFastHLine(x + i - run, y + j, run, color);
+          run = 0;
+        }
+      }
+      if(run) drawFastHLine(x + w - run, y + j, run, color);
+    }
+  }
+}
+
+void Adafruit_ILI9341::drawBitmap(int16_t x, int16_t y,
+ const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+  if((x < 0) || (y < 0) || ((x + w) > _width) || ((y + h) > _height))
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  else
+    drawBitmapRows(x, y, bitmap, true, w, h, color, color, false);
+}
+
+void Adafruit_ILI9341::drawBitmap(int16_t x, int16_t y,
+ const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+  if((x < 0) || (y < 0) || ((x + w) > _width) || ((y + h) > _height))
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  else
+    drawBitmapRows(x, y, bitmap, true, w, h, color, bg, true);
+}
+
+void Adafruit_ILI9341::drawBitmap(int16_t x, int16_t y,
+ uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+  if((x < 0) || (y < 0) || ((x + w) > _width) || ((y + h) > _height))
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  else
+    drawBitmapRows(x, y, bitmap, false, w, h, color, color, false);
+}
+
+void Adafruit_ILI9341::drawBitmap(int16_t x, int16_t y,
+ uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+  if((x < 0) || (y < 0) || ((x + w) > _width) || ((y + h) > _height))
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  else
+    drawBitmapRows(x, y, bitmap, false, w, h, color, bg, true);
+}
+
+
 // Pass 8-bit (each) R,G,B, get back 16-bit packed color
 uint16_t Adafruit_ILI9341::color565(uint8_t r, uint8_t g, uint8_t b) {
   return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
@@ -133,9 +133,29 @@ class Adafruit_ILI9341 : public Adafruit_GFX {
            fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
              uint16_t color),
            setRotation(uint8_t r),
-           invertDisplay(boolean i);
+           invertDisplay(boolean i),
+           drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+             uint16_t bg, uint8_t size),
+           drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+             int16_t w, int16_t h, uint16_t color),
+           drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+             int16_t w, int16_t h, uint16_t color, uint16_t bg),
+           drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+             int16_t w, int16_t h, uint16_t color),
+           drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+             int16_t w, int16_t h, uint16_t color, uint16_t bg),
+           drawRGBBitmap(int16_t x, int16_t y, const uint16_t *pcolors,
+             int16_t w, int16_t h);
   uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
 
+  // Bulk pixel streaming. Set one address window with setAddrWindow(),
+  // then send its pixels row by row, all between startWrite() and
+  // endWrite(), instead of addressing each pixel with drawPixel().
+  void     startWrite(void),
+           endWrite(void),
+           writePixels(const uint16_t *colors, uint32_t len),
+           writeColor(uint16_t color, uint32_t len);
+
   /* These are not for current use, 8-bit protocol only! */
   uint8_t  readdata(void),
     readcommand8(uint8_t reg, uint8_t index = 0);
@@ -154,6 +174,10 @@ class Adafruit_ILI9341 : public Adafruit_GFX {
  private:
   uint8_t  tabcolor;
 
+  void     drawBitmapRows(int16_t x, int16_t y, const uint8_t *bitmap,
+             boolean progmem, int16_t w, int16_t h, uint16_t color,
+             uint16_t bg, boolean opaque);
+
 
 
   boolean  hwSPI;
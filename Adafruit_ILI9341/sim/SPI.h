@@ -0,0 +1,34 @@
+/***************************************************
+  Host stand-in for the Arduino SPI library.  Counts the transactions
+  and the bytes transferred.
+
+  MIT license, all text above must be included in any redistribution
+ ****************************************************/
+#ifndef _SIM_SPI_H_
+#define _SIM_SPI_H_
+
+#include "Arduino.h"
+
+#define SPI_HAS_TRANSACTION
+#define MSBFIRST  1
+#define SPI_MODE0 0
+
+class SPISettings {
+ public:
+  SPISettings(uint32_t, uint8_t, uint8_t) { }
+};
+
+class SPIClass {
+ public:
+  uint32_t transactions; // SPI.beginTransaction() calls
+  uint32_t bytes;        // SPI.transfer() calls
+
+  void begin(void) { }
+  void beginTransaction(SPISettings) { transactions++; }
+  void endTransaction(void) { }
+  uint8_t transfer(uint8_t) { bytes++; return 0; }
+};
+
+extern SPIClass SPI;
+
+#endif
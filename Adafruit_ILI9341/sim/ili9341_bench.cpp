@@ -0,0 +1,106 @@
+/***************************************************
+  SPI traffic benchmark for Adafruit_ILI9341 text and bitmaps
+
+  Renders strings and bitmaps through the driver with SPI replaced by
+  the counting stand-in in this folder, once through the per-pixel
+  Adafruit_GFX paths and once through the windowed driver paths, and
+  reports the SPI transactions and bytes of each.
+
+  MIT license, all text above must be included in any redistribution
+ ****************************************************/
+#include <stdio.h>
+
+#include <SPI.h>
+#include "Adafruit_GFX.h"
+#include "Adafruit_ILI9341.h"
+
+SPIClass SPI;
+
+static Adafruit_ILI9341 tft(10, 9);
+
+static const char text[] = "Temp 21.5C";
+
+// 32x32 1-bit icon, a ring with a cross
+static uint8_t icon[32 * 4];
+static uint16_t image[32 * 32];
+
+static uint32_t startTransactions, startBytes;
+
+static void start(void) {
+  startTransactions = SPI.transactions;
+  startBytes = SPI.bytes;
+}
+
+static void report(const char *name, const char *path) {
+  printf("  %-28s %-10s %6lu transactions %7lu bytes\n", name, path,
+    (unsigned long)(SPI.transactions - startTransactions),
+    (unsigned long)(SPI.bytes - startBytes));
+}
+
+// Draws the string with the per-pixel Adafruit_GFX renderer
+static void drawTextGFX(int16_t x, int16_t y, uint16_t color, uint16_t bg, uint8_t size) {
+  for(const char *c = text; *c; c++, x += 6 * size) {
+    tft.Adafruit_GFX::drawChar(x, y, *c, color, bg, size);
+  }
+}
+
+static void drawText(int16_t x, int16_t y, uint16_t color, uint16_t bg, uint8_t size) {
+  tft.setCursor(x, y);
+  tft.setTextColor(color, bg);
+  tft.setTextSize(size);
+  tft.print(text);
+}
+
+static void benchText(const char *name, uint16_t bg, uint8_t size) {
+  start();
+  drawTextGFX(10, 10, ILI9341_WHITE, bg, size);
+  report(name, "GFX");
+  start();
+  drawText(10, 10, ILI9341_WHITE, bg, size);
+  report(name, "windowed");
+}
+
+int main(void) {
+  for(int16_t j=0; j<32; j++) {
+    for(int16_t i=0; i<32; i++) {
+      int16_t dx = i - 16, dy = j - 16, r2 = dx * dx + dy * dy;
+      if(((r2 >= 100) && (r2 <= 196)) || (i == 16) || (j == 16))
+        icon[j * 4 + i / 8] |= 0x80 >> (i & 7);
+      image[j * 32 + i] = tft.color565(i * 8, j * 8, 128);
+    }
+  }
+
+  tft.begin();
+
+  printf("\"%s\"\n", text);
+  benchText("size 1, transparent", ILI9341_WHITE, 1);
+  benchText("size 1, background", ILI9341_BLACK, 1);
+  benchText("size 2, transparent", ILI9341_WHITE, 2);
+  benchText("size 2, background", ILI9341_BLACK, 2);
+
+  printf("32x32 bitmaps\n");
+  start();
+  tft.Adafruit_GFX::drawBitmap(10, 40, icon, 32, 32, ILI9341_RED);
+  report("1-bit, transparent", "GFX");
+  start();
+  tft.drawBitmap(10, 40, icon, 32, 32, ILI9341_RED);
+  report("1-bit, transparent", "windowed");
+  start();
+  tft.Adafruit_GFX::drawBitmap(10, 40, icon, 32, 32, ILI9341_RED, ILI9341_BLACK);
+  report("1-bit, background", "GFX");
+  start();
+  tft.drawBitmap(10, 40, icon, 32, 32, ILI9341_RED, ILI9341_BLACK);
+  report("1-bit, background", "windowed");
+  start();
+  for(int16_t j=0; j<32; j++) {
+    for(int16_t i=0; i<32; i++) {
+      tft.drawPixel(10 + i, 80 + j, image[j * 32 + i]);
+    }
+  }
+  report("16-bit 565", "drawPixel");
+  start();
+  tft.drawRGBBitmap(10, 80, image, 32, 32);
+  report("16-bit 565", "windowed");
+
+  return 0;
+}
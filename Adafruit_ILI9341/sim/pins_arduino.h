@@ -0,0 +1 @@
+// Pin mapping is not modeled on the host.
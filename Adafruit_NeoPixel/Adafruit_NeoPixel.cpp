@@ -33,6 +33,17 @@
 
 #include "Adafruit_NeoPixel.h"
 
+#ifdef NEO_ASYNCMASK
+static Adafruit_NeoPixel *usartStrip = NULL; // NEO_ASYNC strip sent by USART1
+static boolean usartIsr = false;            // The sketch has NEO_ASYNC_ISR
+// XCK1 must be an output for USART1 to be an SPI master
+#if defined(__AVR_ATmega644P__) || defined(__AVR_ATmega1284P__)
+#define NEO_XCK1 _BV(PD4)
+#else
+#define NEO_XCK1 _BV(PD5)
+#endif
+#endif
+
 Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, uint8_t p, uint8_t t) : numLEDs(n), numBytes(n * 3), pin(p), pixels(NULL)
 #if defined(NEO_RGB) || defined(NEO_KHZ400)
   ,type(t)
@@ -42,25 +53,115 @@ Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, uint8_t p, uint8_t t) : numLEDs
    pinMask(digitalPinToBitMask(p))
 #endif
 {
+#ifdef NEO_ASYNCMASK
+  front         = NULL;
+  gamma         = NULL;
+  spiBrightness = 0;
+  sending       = false;
+  if((type & NEO_ASYNCMASK) == NEO_ASYNC) {
+    // Front and back buffers in one block
+    if((pixels = (uint8_t *)malloc(numBytes * 2))) {
+      memset(pixels, 0, numBytes * 2);
+      front = pixels + numBytes;
+    }
+    return;
+  }
+#endif
   if((pixels = (uint8_t *)malloc(numBytes))) {
     memset(pixels, 0, numBytes);
   }
 }
 
 Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+#ifdef NEO_ASYNCMASK
+  if((type & NEO_ASYNCMASK) == NEO_ASYNC) {
+    if(usartStrip == this) {
+      UCSR1B     &= ~_BV(UDRIE1);
+      usartStrip  = NULL;
+    }
+    if(pixels) free((front < pixels) ? front : pixels);
+    return;
+  }
+#endif
   if(pixels) free(pixels);
   pinMode(pin, INPUT);
 }
 
 void Adafruit_NeoPixel::begin(void) {
+#ifdef NEO_ASYNCMASK
+  if((type & NEO_ASYNCMASK) == NEO_ASYNC) {
+    // USART1 as an SPI master, MSB first, data out on TXD1 (PD3).
+    // SPI clock about 4 MHz for 800 KHz, 2 MHz for 400 KHz: the fastest
+    // F_CPU/2/(UBRR1+1) allows at or below that.
+    UBRR1   = 0;
+    PORTD  &= ~_BV(PD3);
+    DDRD   |= _BV(PD3) | NEO_XCK1;
+    UCSR1C  = _BV(UMSEL11) | _BV(UMSEL10);
+    UCSR1B  = _BV(TXEN1);
+    if((type & NEO_SPDMASK) == NEO_KHZ800) {
+      UBRR1 = (F_CPU + 8000000UL - 1) / 8000000UL - 1;
+    } else {
+      UBRR1 = (F_CPU + 4000000UL - 1) / 4000000UL - 1;
+    }
+    return;
+  }
+#endif
   pinMode(pin, OUTPUT);
   digitalWrite(pin, LOW);
 }
 
+// True when show() can send a new frame at once: any NEO_ASYNC frame has
+// gone out and the latch time has elapsed since.
+boolean Adafruit_NeoPixel::canShow(void) const {
+#ifdef NEO_ASYNCMASK
+  if(sending) return false;
+  // The USART1 interrupt writes endTime, which AVR reads a byte at a time
+  uint8_t  sreg = SREG;
+  cli();
+  uint32_t t    = endTime;
+  SREG          = sreg;
+  // The last two SPI bytes are still in the USART then, 4 us at most
+  if((type & NEO_ASYNCMASK) == NEO_ASYNC) return (micros() - t) >= 54L;
+#else
+  uint32_t t    = endTime;
+#endif
+  return (micros() - t) >= 50L;
+}
+
 void Adafruit_NeoPixel::show(void) {
 
   if(!pixels) return;
 
+#ifdef NEO_ASYNCMASK
+  if((type & NEO_ASYNCMASK) == NEO_ASYNC) {
+    // Wait for the frame before (of any NEO_ASYNC strip, as they share
+    // USART1) and its latch, then send the back buffer and carry on
+    // drawing over a copy of it.
+    while(usartStrip && usartStrip->sending);
+    while(!canShow());
+    uint8_t *p = front;
+    front      = pixels;
+    pixels     = p;
+    memcpy(pixels, front, numBytes);
+    spiPtr     = front;
+    spiCount   = numBytes;
+    spiCodes   = 0;
+    sending    = true;
+    usartStrip = this;
+    if(usartIsr) {
+      // UDR1 is empty, so the interrupt comes at once
+      UCSR1B |= _BV(UDRIE1);
+    } else {
+      // No NEO_ASYNC_ISR in the sketch: send the frame here
+      for(int16_t c; (c = nextSpiByte()) >= 0; ) {
+        while(!(UCSR1A & _BV(UDRE1)));
+        UDR1 = c;
+      }
+    }
+    return;
+  }
+#endif
+
   // Data latch = 50+ microsecond pause in the output stream.  Rather than
   // put a delay at the end of the function, the ending time is noted and
   // the function will simply hold off (if needed) on issuing the
@@ -792,6 +893,78 @@ void Adafruit_NeoPixel::show(void) {
   endTime = micros(); // Save EOD time for latch on next call
 }
 
+#ifdef NEO_ASYNCMASK
+
+// Called by NEO_ASYNC_ISR when the sketch defines the USART1 interrupt,
+// before setup().  Returns true so the macro can call it from an
+// initializer.
+boolean Adafruit_NeoPixel::useUsartInterrupt(void) {
+  usartIsr = true;
+  return true;
+}
+
+// The body of the USART1 data register empty interrupt defined by
+// NEO_ASYNC_ISR: loads the next SPI byte, or stops at the end of the frame.
+void Adafruit_NeoPixel::usartInterrupt(void) {
+  int16_t c = usartStrip->nextSpiByte();
+  if(c >= 0) UDR1    = c;
+  else       UCSR1B &= ~_BV(UDRIE1);
+}
+
+// Next SPI byte of the NEO_ASYNC frame being sent: two data bits, MSB
+// first, each as four SPI bits (1000 or 1110), so the USART times the
+// high pulses and every byte ends low.  Gamma and brightness are applied
+// here, a data byte at a time, so the buffers hold the colors as set.
+// Returns -1 at the end of the frame, and starts the latch time.
+int16_t Adafruit_NeoPixel::nextSpiByte(void) {
+  if(!spiCodes) {
+    if(!spiCount) {
+      endTime = micros();
+      sending = false;
+      return -1;
+    }
+    uint8_t c = *spiPtr++;
+    spiCount--;
+    if(gamma)         c = pgm_read_byte(&gamma[c]);
+    if(spiBrightness) c = (c * spiBrightness) >> 8;
+    spiByte  = c;
+    spiCodes = 4;
+  }
+  uint8_t code = 0x88;
+  if(spiByte & 0x80) code |= 0x60;
+  if(spiByte & 0x40) code |= 0x06;
+  spiByte <<= 2;
+  spiCodes--;
+  return code;
+}
+
+// Gamma table for NEO_ASYNC strips, or NULL for none.  The table is in
+// PROGMEM, e.g. gamma8.
+void Adafruit_NeoPixel::setGamma(const uint8_t *table) {
+  gamma = table;
+}
+
+const uint8_t Adafruit_NeoPixel::gamma8[256] PROGMEM = {
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,
+    1,  1,  1,  1,  2,  2,  2,  2,  2,  2,  2,  2,  3,  3,  3,  3,
+    3,  3,  4,  4,  4,  4,  5,  5,  5,  5,  5,  6,  6,  6,  6,  7,
+    7,  7,  8,  8,  8,  9,  9,  9, 10, 10, 10, 11, 11, 11, 12, 12,
+   13, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20,
+   20, 21, 21, 22, 22, 23, 24, 24, 25, 25, 26, 27, 27, 28, 29, 29,
+   30, 31, 31, 32, 33, 34, 34, 35, 36, 37, 38, 38, 39, 40, 41, 42,
+   42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+   58, 59, 60, 61, 62, 63, 64, 65, 66, 68, 69, 70, 71, 72, 73, 75,
+   76, 77, 78, 80, 81, 82, 84, 85, 86, 88, 89, 90, 92, 93, 94, 96,
+   97, 99,100,102,103,105,106,108,109,111,112,114,115,117,119,120,
+  122,124,125,127,129,130,132,134,136,137,139,141,143,145,146,148,
+  150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,
+  182,184,186,188,191,193,195,197,199,202,204,206,209,211,213,215,
+  218,220,223,225,227,230,232,235,237,240,242,245,247,250,252,255
+};
+
+#endif // NEO_ASYNCMASK
+
 // Set the output pin number
 void Adafruit_NeoPixel::setPin(uint8_t p) {
   pinMode(pin, INPUT);
@@ -905,7 +1078,15 @@ uint16_t Adafruit_NeoPixel::numPixels(void) const {
 // the limited number of steps (quantization) in the old data will be
 // quite visible in the re-scaled version.  For a non-destructive
 // change, you'll need to re-render the full strip data.  C'est la vie.
+// NEO_ASYNC strips are the exception: the interrupt that sends them has
+// the time to scale each byte on its way out, so the data is untouched.
 void Adafruit_NeoPixel::setBrightness(uint8_t b) {
+#ifdef NEO_ASYNCMASK
+  if((type & NEO_ASYNCMASK) == NEO_ASYNC) {
+    spiBrightness = b + 1;
+    return;
+  }
+#endif
   // Stored brightness value is different than what's passed.
   // This simplifies the actual scaling math later, allowing a fast
   // 8x8-bit multiply and taking the MSB.  'brightness' is a uint8_t,
@@ -37,6 +37,18 @@
 #ifndef __AVR_ATtiny85__
 #define NEO_RGB     0x00 // Wired for RGB data order
 #define NEO_KHZ400  0x00 // 400 KHz datastream
+// Double buffered: show() returns at once and the frame is sent in the
+// background by USART1 in master SPI mode, from its TXD1 pin (18 on a
+// Mega, 1 on a Leonardo) whatever pin is given, with interrupts enabled.
+// Brightness and gamma are applied as the data goes out.  Only AVRs with
+// a second USART have it; elsewhere the flag is accepted and the strip is
+// sent from its pin by show() as any other.
+#if defined(UCSR1C)
+#define NEO_ASYNC     0x04
+#define NEO_ASYNCMASK 0x04
+#else
+#define NEO_ASYNC     0x00
+#endif
 #endif
 
 class Adafruit_NeoPixel {
@@ -56,6 +68,20 @@ class Adafruit_NeoPixel {
     setBrightness(uint8_t);
   uint8_t
    *getPixels() const;
+  boolean
+    canShow(void) const;
+#ifdef NEO_ASYNCMASK
+  void
+    setGamma(const uint8_t *table);
+  int16_t
+    nextSpiByte(void);
+  static const uint8_t
+    gamma8[256];   // Gamma 2.6 table for setGamma(), in PROGMEM
+  static boolean
+    useUsartInterrupt(void);
+  static void
+    usartInterrupt(void);
+#endif
   uint16_t
     numPixels(void) const;
   static uint32_t
@@ -76,7 +102,7 @@ class Adafruit_NeoPixel {
     pin,           // Output pin number
     brightness,
    *pixels;        // Holds LED color values (3 bytes each)
-  uint32_t
+  volatile uint32_t
     endTime;       // Latch timing reference
 #ifdef __AVR__
   const volatile uint8_t
@@ -84,7 +110,42 @@ class Adafruit_NeoPixel {
   uint8_t
     pinMask;       // Output PORT bitmask
 #endif
+#ifdef NEO_ASYNCMASK
+  uint8_t
+   *front,         // NEO_ASYNC frame being sent while 'pixels' is drawn
+    spiByte,       // Data byte being encoded, shifted 2 bits per SPI byte
+    spiCodes,      // SPI bytes left for spiByte
+    spiBrightness; // Brightness applied when encoding, as 'brightness'
+  const uint8_t
+   *spiPtr,        // Next data byte to encode
+   *gamma;         // PROGMEM gamma table applied when encoding, or NULL
+  uint16_t
+    spiCount;      // Data bytes left after spiByte
+  volatile boolean
+    sending;       // A NEO_ASYNC frame is being sent
+#endif
 
 };
 
+#ifdef NEO_ASYNCMASK
+// The library leaves the USART1 data register empty interrupt to the
+// sketch, as the core's Serial1 has one too.  Put NEO_ASYNC_ISR on a line
+// of its own in one file of a sketch with NEO_ASYNC strips, and they are
+// sent from the interrupt; Serial1 can't be used then.  Without it show()
+// sends them itself, still with interrupts enabled, and returns when the
+// frame is out.
+// The USART holds the next SPI byte while it shifts one out, so bytes go
+// out back to back if the interrupt comes within an SPI byte, 2 us at
+// 800 KHz.  A later one, or one held off by another interrupt, stretches
+// the low end of a data bit, which the LEDs take up to a few
+// microseconds; a gap that reaches the latch time ends the frame there.
+// The interrupt runs once per SPI byte, so while a frame goes out it
+// takes much of the CPU: what this mode frees is interrupts, not cycles.
+#define NEO_ASYNC_ISR \
+  ISR(USART1_UDRE_vect) { Adafruit_NeoPixel::usartInterrupt(); } \
+  static const boolean neoAsyncIsr = Adafruit_NeoPixel::useUsartInterrupt();
+#else
+#define NEO_ASYNC_ISR // Nothing to send from an interrupt
+#endif
+
 #endif // ADAFRUIT_NEOPIXEL_H
@@ -0,0 +1,54 @@
+// Double buffered NeoPixel strip: frames are sent by USART1, from its
+// interrupt, while the sketch draws the next one and keeps reading Serial.
+// The strip's data line goes to the TXD1 pin (18 on a Mega, 1 on a
+// Leonardo), whatever pin is given to the constructor.  Serial1 can't be
+// used.  Boards without a second USART send the strip from that pin as
+// usual.  Not checked on LEDs: an interrupt that comes late, or is held
+// off by another one, stretches a low gap (see NEO_ASYNC_ISR in the header).
+#include <Adafruit_NeoPixel.h>
+
+#define NUMPIXELS 150
+
+Adafruit_NeoPixel strip = Adafruit_NeoPixel(NUMPIXELS, 6, NEO_GRB + NEO_KHZ800 + NEO_ASYNC);
+
+// Send NEO_ASYNC strips from the USART1 interrupt.  Without this line
+// show() sends them itself and returns when the frame is out.
+NEO_ASYNC_ISR
+
+uint16_t j = 0;
+
+void setup() {
+  Serial.begin(115200);
+  strip.begin();
+#if NEO_ASYNC
+  strip.setBrightness(64);                        // Applied as the data goes out
+  strip.setGamma(Adafruit_NeoPixel::gamma8);
+#endif
+}
+
+void loop() {
+  // Serial keeps working: interrupts stay on while the strip is sent
+  while(Serial.available()) Serial.write(Serial.read());
+
+  if(strip.canShow()) {
+    for(uint16_t i=0; i<strip.numPixels(); i++) {
+      strip.setPixelColor(i, Wheel(((i * 256 / strip.numPixels()) + j) & 255));
+    }
+    strip.show();                                 // Returns at once
+    j++;
+  }
+}
+
+// Input a value 0 to 255 to get a color value.
+// The colours are a transition r - g - b - back to r.
+uint32_t Wheel(byte WheelPos) {
+  if(WheelPos < 85) {
+   return strip.Color(WheelPos * 3, 255 - WheelPos * 3, 0);
+  } else if(WheelPos < 170) {
+   WheelPos -= 85;
+   return strip.Color(255 - WheelPos * 3, 0, WheelPos * 3);
+  } else {
+   WheelPos -= 170;
+   return strip.Color(0, WheelPos * 3, 255 - WheelPos * 3);
+  }
+}
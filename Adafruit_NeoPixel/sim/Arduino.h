@@ -0,0 +1,65 @@
+/*
+ * Minimal Arduino core for building Adafruit_NeoPixel on the host, with
+ * neither __AVR__ nor __arm__ defined: show() sends nothing from the pin.
+ * USART1 is a set of plain variables, except UDR1, which keeps every byte
+ * written to it for the test to decode.  micros() reads the virtual clock
+ * simMicros.
+ */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define F_CPU 16000000UL
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define _BV(bit) (1 << (bit))
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+#define ISR(vector) void vector()
+extern uint8_t SREG;
+inline void cli() {}
+
+// USART1 and port D as on a Mega or Leonardo, macros as in avr/io.h
+struct SimUdr
+{
+    std::vector<uint8_t> sent;
+    SimUdr& operator=(uint8_t b) { sent.push_back(b); return *this; }
+};
+extern SimUdr simUDR1;
+extern uint8_t simUCSR1A, simUCSR1B, simUCSR1C, simDDRD, simPORTD;
+extern uint16_t simUBRR1;
+#define UDR1    simUDR1
+#define UCSR1A  simUCSR1A
+#define UCSR1B  simUCSR1B
+#define UCSR1C  simUCSR1C
+#define DDRD    simDDRD
+#define PORTD   simPORTD
+#define UBRR1   simUBRR1
+#define UDRE1   5
+#define UDRIE1  5
+#define TXEN1   3
+#define UMSEL11 7
+#define UMSEL10 6
+#define PD3     3
+#define PD4     4
+#define PD5     5
+
+extern unsigned long simMicros;
+inline unsigned long micros() { return simMicros; }
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+#endif
@@ -0,0 +1,246 @@
+/*
+ * Host test of the NEO_ASYNC transmitter of Adafruit_NeoPixel
+ *
+ * Sends frames through the USART1 stand-in in Arduino.h: the data
+ * register empty interrupt that NEO_ASYNC_ISR defines runs for as long as
+ * it is enabled, or, built with NEO_TEST_POLL, show() sends the frame
+ * itself.  The SPI bytes written to UDR1 are turned into the waveform on
+ * TXD1 (a sample per SPI bit, 250 ns at 4 MHz, with random low gaps
+ * between bytes for a late interrupt), and decoded as a WS2812 would: a
+ * high pulse longer than 625 ns is a 1.  Checks that
+ *  - begin() puts USART1 in master SPI mode at 4 MHz (2 MHz for 400 KHz),
+ *    with TXD1 and XCK1 as outputs,
+ *  - every high pulse is 250 or 750 ns and the frame has 24 bits per LED,
+ *  - the decoded bytes are the colors as set, in GRB or RGB order, with
+ *    gamma and brightness applied only on the way out,
+ *  - setPixelColor() after show() draws into the back buffer without
+ *    touching the frame being sent, and the next frame starts from the
+ *    one shown,
+ *  - the interrupt is turned off at the end of the frame, and canShow()
+ *    waits for the end of the frame and the latch,
+ *  - strips without NEO_ASYNC still scale the data in setPixelColor().
+ * Then prints the host time per SPI byte.
+ * Exits non-zero on any mismatch.
+ */
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "Adafruit_NeoPixel.h"
+
+unsigned long simMicros;
+uint8_t SREG;
+SimUdr simUDR1;
+uint8_t simUCSR1A = _BV(UDRE1), simUCSR1B, simUCSR1C, simDDRD, simPORTD;
+uint16_t simUBRR1;
+
+#ifndef NEO_TEST_POLL
+NEO_ASYNC_ISR
+#endif
+
+static unsigned int errors;
+
+static void check(bool ok, const char *what)
+{
+    if (!ok)
+    {
+        printf("FAILED: %s\n", what);
+        errors++;
+    }
+}
+
+// Runs the USART1 interrupt until it turns itself off, and returns the
+// SPI bytes sent since the last call.  UDR1 takes each byte at once.
+static std::vector<uint8_t> takeFrame()
+{
+#ifndef NEO_TEST_POLL
+    for (unsigned long n = 0; UCSR1B & _BV(UDRIE1); n++)
+    {
+        if (n > 100000)
+        {
+            check(false, "interrupt turned off at the end of the frame");
+            break;
+        }
+        USART1_UDRE_vect();
+    }
+#endif
+    std::vector<uint8_t> spi;
+    spi.swap(UDR1.sent);
+    return spi;
+}
+
+// TXD1 samples, 250 ns each, with up to 3 us low between SPI bytes.  This
+// checks the encoding only: whether LEDs take such gaps, or the longer
+// ones other interrupts make on an AVR, is not known
+static std::vector<uint8_t> waveform(const std::vector<uint8_t>& spi)
+{
+    std::vector<uint8_t> samples;
+    for (size_t i = 0; i < spi.size(); i++)
+    {
+        for (int bit = 7; bit >= 0; bit--)
+            samples.push_back((spi[i] >> bit) & 1);
+        for (int gap = rand() % 13; gap; gap--)
+            samples.push_back(0);
+    }
+    return samples;
+}
+
+// Decodes the waveform into bytes as a WS2812 would
+static std::vector<uint8_t> decode(const std::vector<uint8_t>& samples)
+{
+    std::vector<uint8_t> bytes;
+    uint8_t byte = 0;
+    int bits = 0;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        if (!samples[i] || (i && samples[i - 1]))
+            continue;
+        size_t high = 0;
+        while (i + high < samples.size() && samples[i + high])
+            high++;
+        check(high == 1 || high == 3, "high pulse of 250 or 750 ns");
+        byte = (byte << 1) | (high * 250 > 625);
+        if (++bits == 8)
+        {
+            bytes.push_back(byte);
+            bits = 0;
+        }
+    }
+    check(bits == 0, "whole bytes");
+    check(samples.empty() || !samples.back(), "line low after the frame");
+    return bytes;
+}
+
+static uint8_t scaled(uint8_t c, const uint8_t *gamma, uint8_t brightness)
+{
+    if (gamma)
+        c = gamma[c];
+    return (c * (brightness + 1)) >> 8;
+}
+
+static uint32_t randomColor()
+{
+    return ((uint32_t)rand() << 16 ^ rand()) & 0xffffff;
+}
+
+static void checkFrame(const std::vector<uint8_t>& bytes, const std::vector<uint32_t>& colors,
+                       bool grb, const uint8_t *gamma, uint8_t brightness)
+{
+    check(bytes.size() == colors.size() * 3, "24 bits per LED");
+    for (size_t i = 0; i < colors.size() && 3 * i + 2 < bytes.size(); i++)
+    {
+        uint8_t r = colors[i] >> 16, g = colors[i] >> 8, b = colors[i];
+        uint8_t first = grb ? g : r, second = grb ? r : g;
+        if (bytes[3 * i] != scaled(first, gamma, brightness) ||
+            bytes[3 * i + 1] != scaled(second, gamma, brightness) ||
+            bytes[3 * i + 2] != scaled(b, gamma, brightness))
+        {
+            printf("LED %u: %02x %02x %02x\n", (unsigned)i, bytes[3 * i], bytes[3 * i + 1], bytes[3 * i + 2]);
+            check(false, "decoded colors");
+            return;
+        }
+    }
+}
+
+static void testAsync(uint8_t type, bool grb, const uint8_t *gamma, uint8_t brightness)
+{
+    const uint16_t n = 60;
+    Adafruit_NeoPixel strip(n, 6, type);
+    UCSR1B = UCSR1C = DDRD = 0;
+    strip.begin();
+    check(UCSR1C == (_BV(UMSEL11) | _BV(UMSEL10)), "USART1 in master SPI mode, MSB first");
+    check(UCSR1B == _BV(TXEN1), "USART1 transmitter on");
+    check((DDRD & (_BV(PD3) | _BV(PD5))) == (_BV(PD3) | _BV(PD5)), "TXD1 and XCK1 outputs");
+    check(UBRR1 == ((type & NEO_SPDMASK) == NEO_KHZ800 ? 1 : 3), "SPI clock 4 or 2 MHz");
+    strip.setBrightness(brightness);
+    strip.setGamma(gamma);
+
+    std::vector<uint32_t> colors(n);
+    for (uint16_t i = 0; i < n; i++)
+    {
+        colors[i] = randomColor();
+        strip.setPixelColor(i, colors[i]);
+    }
+    check(strip.getPixelColor(7) == colors[7], "colors kept as set");
+
+    simMicros += 1000;
+    check(strip.canShow(), "canShow() before the first frame");
+    strip.show();
+    check(!strip.canShow(), "canShow() while sending or latching");
+    check(strip.getPixelColor(7) == colors[7], "back buffer starts from the frame shown");
+
+    // Draw the next frame while this one goes out
+    std::vector<uint32_t> next(n);
+    for (uint16_t i = 0; i < n; i++)
+    {
+        next[i] = randomColor();
+        strip.setPixelColor(i, next[i]);
+    }
+    checkFrame(decode(waveform(takeFrame())), colors, grb, gamma, brightness);
+    check(!(UCSR1B & _BV(UDRIE1)), "interrupt off after the frame");
+
+    // The last SPI bytes are still in the USART for up to 4 us
+    simMicros += 53;
+    check(!strip.canShow(), "canShow() during the latch");
+    simMicros += 1;
+    check(strip.canShow(), "canShow() after the latch");
+
+    // The next frame, with one more change after show()
+    strip.show();
+    strip.setPixelColor(0, 0);
+    checkFrame(decode(waveform(takeFrame())), next, grb, gamma, brightness);
+    check(strip.getPixelColor(0) == 0 && strip.getPixelColor(1) == next[1], "drawing carries on");
+    simMicros += 54;
+}
+
+// Without NEO_ASYNC, setPixelColor() still scales the stored data
+static void testBlocking()
+{
+    Adafruit_NeoPixel strip(4, 6, NEO_GRB + NEO_KHZ800);
+    strip.setBrightness(127);
+    strip.setPixelColor(1, 200, 100, 50);
+    const uint8_t *p = strip.getPixels() + 3;
+    check(p[0] == 50 && p[1] == 100 && p[2] == 25, "blocking strip scales in setPixelColor()");
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static void bench()
+{
+    const uint16_t n = 300;
+    Adafruit_NeoPixel strip(n, 6, NEO_GRB + NEO_KHZ800 + NEO_ASYNC);
+    strip.begin();
+    strip.setBrightness(100);
+    strip.setGamma(Adafruit_NeoPixel::gamma8);
+    for (uint16_t i = 0; i < n; i++)
+        strip.setPixelColor(i, randomColor());
+
+    const int frames = 2000;
+    unsigned long bytes = 0;
+    Clock::time_point start = Clock::now();
+    for (int f = 0; f < frames; f++)
+    {
+        simMicros += 100;
+        strip.show();
+        bytes += takeFrame().size();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    printf("%u LEDs: %lu SPI bytes per frame, %.1f ns per SPI byte on the host\n",
+           n, bytes / frames, seconds / bytes * 1e9);
+}
+
+int main()
+{
+    srand(1);
+    testAsync(NEO_GRB + NEO_KHZ800 + NEO_ASYNC, true, Adafruit_NeoPixel::gamma8, 63);
+    testAsync(NEO_GRB + NEO_KHZ800 + NEO_ASYNC, true, NULL, 255);
+    testAsync(NEO_RGB + NEO_KHZ400 + NEO_ASYNC, false, Adafruit_NeoPixel::gamma8, 200);
+    testAsync(NEO_RGB + NEO_KHZ800 + NEO_ASYNC, false, NULL, 0);
+    testBlocking();
+#ifdef NEO_TEST_POLL
+    printf("encoder, sent by show(): %s\n", errors ? "MISMATCH" : "ok");
+#else
+    printf("encoder, sent by the interrupt: %s\n", errors ? "MISMATCH" : "ok");
+#endif
+    bench();
+    return errors ? 1 : 0;
+}
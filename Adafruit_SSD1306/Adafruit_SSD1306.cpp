@@ -111,6 +111,22 @@ static uint8_t buffer[SSD1306_LCDHEIGHT * SSD1306_LCDWIDTH / 8] = {
 
 #define ssd1306_swap(a, b) { int16_t t = a; a = b; b = t; }
 
+// grow the dirty box to cover raw columns x0..x1 and rows y0..y1, which must be on the display
+inline void Adafruit_SSD1306::markDirty(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1) {
+  if (x0 < dirty_x0) dirty_x0 = x0;
+  if (x1 > dirty_x1) dirty_x1 = x1;
+  if ((y0/8) < dirty_page0) dirty_page0 = y0/8;
+  if ((y1/8) > dirty_page1) dirty_page1 = y1/8;
+}
+
+// the whole buffer needs to be sent on the next display()
+inline void Adafruit_SSD1306::markAllDirty(void) {
+  dirty_x0 = 0;
+  dirty_x1 = SSD1306_LCDWIDTH-1;
+  dirty_page0 = 0;
+  dirty_page1 = SSD1306_LCDHEIGHT/8-1;
+}
+
 // the most basic function, set a single pixel
 void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
   if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
@@ -132,6 +148,8 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
     break;
   }
 
+  markDirty(x, x, y, y);
+
   // x is which column
     switch (color)
     {
@@ -149,6 +167,7 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t SID, int8_t SCLK, int8_t DC, int8_t RS
   sclk = SCLK;
   sid = SID;
   hwSPI = false;
+  markAllDirty();
 }
 
 // constructor for hardware SPI - we indicate DataCommand, ChipSelect, Reset
@@ -157,6 +176,7 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t DC, int8_t RST, int8_t CS) : Adafruit_
   rst = RST;
   cs = CS;
   hwSPI = true;
+  markAllDirty();
 }
 
 // initializer for I2C - we only indicate the reset pin!
@@ -164,6 +184,7 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t reset) :
 Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT) {
   sclk = dc = cs = sid = -1;
   rst = reset;
+  markAllDirty();
 }
 
 
@@ -286,6 +307,9 @@ void Adafruit_SSD1306::begin(uint8_t vccstate, uint8_t i2caddr, bool reset) {
   ssd1306_command(SSD1306_DEACTIVATE_SCROLL);
 
   ssd1306_command(SSD1306_DISPLAYON);//--turn on oled panel
+
+  // the display RAM is undefined after a reset, so the next display() sends everything
+  markAllDirty();
 }
 
 
@@ -341,6 +365,7 @@ void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop){
   ssd1306_command(0X00);
   ssd1306_command(0XFF);
   ssd1306_command(SSD1306_ACTIVATE_SCROLL);
+  markAllDirty();
 }
 
 // startscrollleft
@@ -356,6 +381,7 @@ void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop){
   ssd1306_command(0X00);
   ssd1306_command(0XFF);
   ssd1306_command(SSD1306_ACTIVATE_SCROLL);
+  markAllDirty();
 }
 
 // startscrolldiagright
@@ -373,6 +399,7 @@ void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop){
   ssd1306_command(stop);
   ssd1306_command(0X01);
   ssd1306_command(SSD1306_ACTIVATE_SCROLL);
+  markAllDirty();
 }
 
 // startscrolldiagleft
@@ -390,10 +417,13 @@ void Adafruit_SSD1306::startscrolldiagleft(uint8_t start, uint8_t stop){
   ssd1306_command(stop);
   ssd1306_command(0X01);
   ssd1306_command(SSD1306_ACTIVATE_SCROLL);
+  markAllDirty();
 }
 
+// the panel has moved its RAM around, so the next display() sends it all again
 void Adafruit_SSD1306::stopscroll(void){
   ssd1306_command(SSD1306_DEACTIVATE_SCROLL);
+  markAllDirty();
 }
 
 // Dim the display
@@ -417,22 +447,18 @@ void Adafruit_SSD1306::dim(boolean dim) {
   ssd1306_command(contrast);
 }
 
+// send the part of the buffer drawn since the last display(). The column and page address
+// window is set to the dirty box, so only its bytes go over the bus.
 void Adafruit_SSD1306::display(void) {
+  if (dirty_x0 > dirty_x1) return; // nothing drawn
+
   ssd1306_command(SSD1306_COLUMNADDR);
-  ssd1306_command(0);   // Column start address (0 = reset)
-  ssd1306_command(SSD1306_LCDWIDTH-1); // Column end address (127 = reset)
+  ssd1306_command(dirty_x0);    // Column start address (0 = reset)
+  ssd1306_command(dirty_x1);    // Column end address (127 = reset)
 
   ssd1306_command(SSD1306_PAGEADDR);
-  ssd1306_command(0); // Page start address (0 = reset)
-  #if SSD1306_LCDHEIGHT == 64
-    ssd1306_command(7); // Page end address
-  #endif
-  #if SSD1306_LCDHEIGHT == 32
-    ssd1306_command(3); // Page end address
-  #endif
-  #if SSD1306_LCDHEIGHT == 16
-    ssd1306_command(1); // Page end address
-  #endif
+  ssd1306_command(dirty_page0); // Page start address (0 = reset)
+  ssd1306_command(dirty_page1); // Page end address
 
   if (sid != -1)
   {
@@ -447,8 +473,11 @@ void Adafruit_SSD1306::display(void) {
     digitalWrite(cs, LOW);
 #endif
 
-    for (uint16_t i=0; i<(SSD1306_LCDWIDTH*SSD1306_LCDHEIGHT/8); i++) {
-      fastSPIwrite(buffer[i]);
+    for (uint8_t page=dirty_page0; page<=dirty_page1; page++) {
+      uint8_t *pBuf = buffer + page*SSD1306_LCDWIDTH + dirty_x0;
+      for (uint8_t x=dirty_x0; x<=dirty_x1; x++) {
+        fastSPIwrite(*pBuf++);
+      }
     }
 #ifdef HAVE_PORTREG
     *csport |= cspinmask;
@@ -468,26 +497,39 @@ void Adafruit_SSD1306::display(void) {
     //Serial.println(TWSR & 0x3, DEC);
 
     // I2C
-    for (uint16_t i=0; i<(SSD1306_LCDWIDTH*SSD1306_LCDHEIGHT/8); i++) {
-      // send a bunch of data in one xmission
-      Wire.beginTransmission(_i2caddr);
-      WIRE_WRITE(0x40);
-      for (uint8_t x=0; x<16; x++) {
-        WIRE_WRITE(buffer[i]);
-        i++;
+    // send a bunch of data in one xmission, continuing across the pages of the window
+    uint8_t count = 0;
+    for (uint8_t page=dirty_page0; page<=dirty_page1; page++) {
+      uint8_t *pBuf = buffer + page*SSD1306_LCDWIDTH + dirty_x0;
+      for (uint8_t x=dirty_x0; x<=dirty_x1; x++) {
+        if (count == 0) {
+          Wire.beginTransmission(_i2caddr);
+          WIRE_WRITE(0x40);
+        }
+        WIRE_WRITE(*pBuf++);
+        if (++count == 16) {
+          Wire.endTransmission();
+          count = 0;
+        }
       }
-      i--;
-      Wire.endTransmission();
     }
+    if (count) Wire.endTransmission();
 #ifdef TWBR
     TWBR = twbrbackup;
 #endif
   }
+
+  // the display now matches the buffer
+  dirty_x0 = SSD1306_LCDWIDTH;
+  dirty_x1 = 0;
+  dirty_page0 = SSD1306_LCDHEIGHT/8;
+  dirty_page1 = 0;
 }
 
 // clear everything
 void Adafruit_SSD1306::clearDisplay(void) {
   memset(buffer, 0, (SSD1306_LCDWIDTH*SSD1306_LCDHEIGHT/8));
+  markAllDirty();
 }
 
 
@@ -564,6 +606,8 @@ void Adafruit_SSD1306::drawFastHLineInternal(int16_t x, int16_t y, int16_t w, ui
   // if our width is now negative, punt
   if(w <= 0) { return; }
 
+  markDirty(x, x+w-1, y, y);
+
   // set up the pointer for  movement through the buffer
   register uint8_t *pBuf = buffer;
   // adjust the buffer pointer for the current row
@@ -638,6 +682,8 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y, int16_t __h
     return;
   }
 
+  markDirty(x, x, __y, __y+__h-1);
+
   // this display doesn't need ints for coordinates, use local byte registers for faster juggling
   register uint8_t y = __y;
   register uint8_t h = __h;
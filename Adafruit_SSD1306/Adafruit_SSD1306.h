@@ -171,6 +171,13 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
   void fastSPIwrite(uint8_t c);
 
   boolean hwSPI;
+
+  // Bounding box of the buffer modified since the last display(), in raw columns and pages.
+  // Nothing needs to be sent when dirty_x0 > dirty_x1.
+  uint8_t dirty_x0, dirty_x1, dirty_page0, dirty_page1;
+  inline void markDirty(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1) __attribute__((always_inline));
+  inline void markAllDirty(void) __attribute__((always_inline));
+
 #ifdef HAVE_PORTREG
   PortReg *mosiport, *clkport, *csport, *dcport;
   PortMask mosipinmask, clkpinmask, cspinmask, dcpinmask;
@@ -0,0 +1,34 @@
+/*********************************************************************
+Host stand-in for the Arduino core, used to build the SSD1306 driver
+and Adafruit_GFX natively for the bus traffic benchmark in this folder.
+
+BSD license, check license.txt for more information
+*********************************************************************/
+#ifndef _SIM_ARDUINO_H_
+#define _SIM_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW  0
+#define INPUT  0
+#define OUTPUT 1
+
+// Flash strings live in ordinary memory on the host.
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define PROGMEM
+
+// Pins are not modeled. Only the bytes sent by Wire and SPI are counted.
+inline void pinMode(uint8_t, uint8_t) { }
+inline void digitalWrite(uint8_t, uint8_t) { }
+inline void delay(unsigned long) { }
+
+#include "Print.h"
+
+#endif
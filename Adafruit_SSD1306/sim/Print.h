@@ -0,0 +1,35 @@
+/*********************************************************************
+Host stand-in for the Arduino Print class, with the subset of print()
+overloads used by the benchmark screens.
+
+BSD license, check license.txt for more information
+*********************************************************************/
+#ifndef _SIM_PRINT_H_
+#define _SIM_PRINT_H_
+
+#include <stdio.h>
+
+class Print {
+ public:
+  virtual ~Print() { }
+  virtual size_t write(uint8_t) = 0;
+
+  size_t print(const char *s) {
+    size_t n = 0;
+    while (*s) n += write((uint8_t)*s++);
+    return n;
+  }
+  size_t print(long v) {
+    char s[12];
+    snprintf(s, sizeof(s), "%ld", v);
+    return print(s);
+  }
+  size_t print(int v) { return print((long)v); }
+  size_t print(double v, int digits = 2) {
+    char s[24];
+    snprintf(s, sizeof(s), "%.*f", digits, v);
+    return print(s);
+  }
+};
+
+#endif
@@ -0,0 +1,22 @@
+/*********************************************************************
+Host stand-in for the Arduino SPI library. Counts the bytes transferred.
+
+BSD license, check license.txt for more information
+*********************************************************************/
+#ifndef _SIM_SPI_H_
+#define _SIM_SPI_H_
+
+#include "Arduino.h"
+
+class SPIClass {
+ public:
+  uint32_t bytes; // SPI.transfer() calls
+
+  void begin(void) { }
+  void setClockDivider(uint8_t) { }
+  uint8_t transfer(uint8_t) { bytes++; return 0; }
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,25 @@
+/*********************************************************************
+Host stand-in for the Arduino Wire library. Counts the transmissions
+and the bytes on the I2C bus, including each address byte.
+
+BSD license, check license.txt for more information
+*********************************************************************/
+#ifndef _SIM_WIRE_H_
+#define _SIM_WIRE_H_
+
+#include "Arduino.h"
+
+class TwoWire {
+ public:
+  uint32_t transmissions; // Wire.beginTransmission() calls
+  uint32_t bytes;         // bytes on the bus, with one address byte per transmission
+
+  void begin(void) { }
+  void beginTransmission(uint8_t) { transmissions++; bytes++; }
+  size_t write(uint8_t) { bytes++; return 1; }
+  uint8_t endTransmission(void) { return 0; }
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,127 @@
+/*********************************************************************
+Bus traffic benchmark for Adafruit_SSD1306::display()
+
+Draws typical dashboard screens through the driver and Adafruit_GFX,
+with Wire and SPI replaced by the counting stand-ins in this folder,
+and reports the bytes sent per frame update and the resulting bus time.
+
+BSD license, check license.txt for more information
+*********************************************************************/
+#include <stdio.h>
+
+#include <Wire.h>
+#include <SPI.h>
+#include "Adafruit_GFX.h"
+#include "Adafruit_SSD1306.h"
+
+TwoWire Wire;
+SPIClass SPI;
+
+#define FRAMES 100
+
+#define I2C_HZ 400000L // Fast mode, as set by display()
+#define SPI_HZ 8000000L
+
+static Adafruit_SSD1306 oled_i2c(-1);
+static Adafruit_SSD1306 oled_spi(9, -1, 10);
+
+// Static parts of the dashboard: title bar, frame, and labels.
+static void drawLayout(Adafruit_SSD1306 &oled) {
+  oled.fillRect(0, 0, SSD1306_LCDWIDTH, 10, WHITE);
+  oled.setTextSize(1);
+  oled.setTextColor(BLACK);
+  oled.setCursor(2, 1);
+  oled.print("SENSORS");
+  oled.drawRect(0, 12, SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT-12, WHITE);
+  oled.setTextColor(WHITE);
+  oled.setCursor(4, 16);
+  oled.print("TEMP");
+  oled.setCursor(4, 26);
+  oled.print("RPM");
+}
+
+// Changing fields of frame n: a temperature, a speed, and a seconds counter.
+static void drawFields(Adafruit_SSD1306 &oled, int n, boolean erase) {
+  oled.setTextSize(1);
+  oled.setTextColor(WHITE);
+  if (erase) oled.fillRect(40, 16, 36, 8, BLACK);
+  oled.setCursor(40, 16);
+  oled.print(20.0 + 0.1*(n%50), 1);
+  if (erase) oled.fillRect(40, 26, 30, 8, BLACK);
+  oled.setCursor(40, 26);
+  oled.print(1000 + 7*n);
+  oled.setTextSize(2);
+  if (erase) oled.fillRect(100, 0, 24, 16, BLACK);
+  oled.setCursor(100, 0);
+  oled.print(n%60);
+}
+
+// Only the seconds counter changes, with its previous digits erased.
+static void drawCounter(Adafruit_SSD1306 &oled, int n) {
+  oled.setTextSize(2);
+  oled.setTextColor(WHITE);
+  oled.fillRect(100, 0, 24, 16, BLACK);
+  oled.setCursor(100, 0);
+  oled.print(n%60);
+}
+
+static uint32_t busBytes(boolean i2c) {
+  return i2c ? Wire.bytes : SPI.bytes;
+}
+
+static void report(const char *name, boolean i2c, uint32_t bytes) {
+  double frame = (double)bytes/FRAMES;
+  if (i2c) {
+    // 9 clocks per byte, with the acknowledge bit
+    printf("  %-18s %7.1f bytes/frame  %7.2f ms/frame at 400 kHz\n", name, frame, 1e3*9*frame/I2C_HZ);
+  } else {
+    printf("  %-18s %7.1f bytes/frame  %7.3f ms/frame at 8 MHz\n", name, frame, 1e3*8*frame/SPI_HZ);
+  }
+}
+
+static void bench(Adafruit_SSD1306 &oled, boolean i2c) {
+  uint32_t start;
+
+  oled.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+  start = busBytes(i2c);
+  oled.display();
+  printf("%s %dx%d\n", i2c ? "I2C" : "SPI", SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT);
+  printf("  %-18s %7lu bytes\n", "splash screen", (unsigned long)(busBytes(i2c)-start));
+
+  // Whole screen cleared and redrawn each frame, as the examples do.
+  start = busBytes(i2c);
+  for (int n=0; n<FRAMES; n++) {
+    oled.clearDisplay();
+    drawLayout(oled);
+    drawFields(oled, n, false);
+    oled.display();
+  }
+  report("full redraw", i2c, busBytes(i2c)-start);
+
+  // Layout drawn once, then only the changed fields are erased and redrawn.
+  start = busBytes(i2c);
+  for (int n=0; n<FRAMES; n++) {
+    drawFields(oled, n, true);
+    oled.display();
+  }
+  report("changed fields", i2c, busBytes(i2c)-start);
+
+  start = busBytes(i2c);
+  for (int n=0; n<FRAMES; n++) {
+    drawCounter(oled, n);
+    oled.display();
+  }
+  report("seconds counter", i2c, busBytes(i2c)-start);
+
+  start = busBytes(i2c);
+  for (int n=0; n<FRAMES; n++) {
+    oled.display();
+  }
+  report("unchanged", i2c, busBytes(i2c)-start);
+}
+
+int main(void) {
+  bench(oled_i2c, true);
+  bench(oled_spi, false);
+  return 0;
+}
@@ -0,0 +1,13 @@
+/*********************************************************************
+Host stand-in for the AVR busy-wait delays, which the driver includes
+but does not call.
+
+BSD license, check license.txt for more information
+*********************************************************************/
+#ifndef _SIM_UTIL_DELAY_H_
+#define _SIM_UTIL_DELAY_H_
+
+#define _delay_us(us)
+#define _delay_ms(ms)
+
+#endif
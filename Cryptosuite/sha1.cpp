@@ -8,53 +8,72 @@
 #define SHA1_K40 0x8f1bbcdc
 #define SHA1_K60 0xca62c1d6
 
-const uint8_t sha1InitState[] PROGMEM = {
-  0x01,0x23,0x45,0x67, // H0
-  0x89,0xab,0xcd,0xef, // H1
-  0xfe,0xdc,0xba,0x98, // H2
-  0x76,0x54,0x32,0x10, // H3
-  0xf0,0xe1,0xd2,0xc3  // H4
+// SHA-1 words are big endian. Bytes are stored straight into the words
+// of the buffer, at the index that gives the right value on this CPU.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SHA1_BYTE(i) (i)
+#else
+#define SHA1_BYTE(i) ((i) ^ 3)
+#endif
+
+const uint32_t sha1InitState[] PROGMEM = {
+  0x67452301,0xefcdab89,0x98badcfe,0x10325476,0xc3d2e1f0
 };
 
 void Sha1Class::init(void) {
-  memcpy_P(state.b,sha1InitState,HASH_LENGTH);
+  memcpy_P(state.w,sha1InitState,HASH_LENGTH);
   byteCount = 0;
   bufferOffset = 0;
 }
 
-uint32_t Sha1Class::rol32(uint32_t number, uint8_t bits) {
+static inline uint32_t rol32(uint32_t number, uint8_t bits) {
   return ((number << bits) | (number >> (32-bits)));
 }
 
+// Round functions of each group of 20 rounds
+#define SHA1_F0(b,c,d) (d ^ (b & (c ^ d)))
+#define SHA1_F20(b,c,d) (b ^ c ^ d)
+#define SHA1_F40(b,c,d) ((b & c) | (d & (b | c)))
+#define SHA1_F60(b,c,d) (b ^ c ^ d)
+
+// Message schedule, computed in place over the 16 words of the block
+#define SHA1_W(i) (buffer.w[(i)&15] = rol32(buffer.w[((i)+13)&15] ^ buffer.w[((i)+8)&15] ^ \
+                                             buffer.w[((i)+2)&15] ^ buffer.w[(i)&15], 1))
+
+// One round. Instead of moving a..e down every round, the callers rotate
+// the names: five rounds in a row bring them back in place.
+#define SHA1_ROUND(a,b,c,d,e,f,k,w) \
+  e += rol32(a,5) + f(b,c,d) + k + (w); \
+  b = rol32(b,30);
+
+#define SHA1_ROUND5(f,k,w0,w1,w2,w3,w4) \
+  SHA1_ROUND(a,b,c,d,e,f,k,w0) \
+  SHA1_ROUND(e,a,b,c,d,f,k,w1) \
+  SHA1_ROUND(d,e,a,b,c,f,k,w2) \
+  SHA1_ROUND(c,d,e,a,b,f,k,w3) \
+  SHA1_ROUND(b,c,d,e,a,f,k,w4)
+
 void Sha1Class::hashBlock() {
   uint8_t i;
-  uint32_t a,b,c,d,e,t;
+  uint32_t a,b,c,d,e;
 
   a=state.w[0];
   b=state.w[1];
   c=state.w[2];
   d=state.w[3];
   e=state.w[4];
-  for (i=0; i<80; i++) {
-    if (i>=16) {
-      t = buffer.w[(i+13)&15] ^ buffer.w[(i+8)&15] ^ buffer.w[(i+2)&15] ^ buffer.w[i&15];
-      buffer.w[i&15] = rol32(t,1);
-    }
-    if (i<20) {
-      t = (d ^ (b & (c ^ d))) + SHA1_K0;
-    } else if (i<40) {
-      t = (b ^ c ^ d) + SHA1_K20;
-    } else if (i<60) {
-      t = ((b & c) | (d & (b | c))) + SHA1_K40;
-    } else {
-      t = (b ^ c ^ d) + SHA1_K60;
-    }
-    t+=rol32(a,5) + e + buffer.w[i&15];
-    e=d;
-    d=c;
-    c=rol32(b,30);
-    b=a;
-    a=t;
+  for (i=0; i<15; i+=5) {
+    SHA1_ROUND5(SHA1_F0, SHA1_K0, buffer.w[i], buffer.w[i+1], buffer.w[i+2], buffer.w[i+3], buffer.w[i+4])
+  }
+  SHA1_ROUND5(SHA1_F0, SHA1_K0, buffer.w[15], SHA1_W(16), SHA1_W(17), SHA1_W(18), SHA1_W(19))
+  for (i=20; i<40; i+=5) {
+    SHA1_ROUND5(SHA1_F20, SHA1_K20, SHA1_W(i), SHA1_W(i+1), SHA1_W(i+2), SHA1_W(i+3), SHA1_W(i+4))
+  }
+  for (i=40; i<60; i+=5) {
+    SHA1_ROUND5(SHA1_F40, SHA1_K40, SHA1_W(i), SHA1_W(i+1), SHA1_W(i+2), SHA1_W(i+3), SHA1_W(i+4))
+  }
+  for (i=60; i<80; i+=5) {
+    SHA1_ROUND5(SHA1_F60, SHA1_K60, SHA1_W(i), SHA1_W(i+1), SHA1_W(i+2), SHA1_W(i+3), SHA1_W(i+4))
   }
   state.w[0] += a;
   state.w[1] += b;
@@ -64,7 +83,7 @@ void Sha1Class::hashBlock() {
 }
 
 void Sha1Class::addUncounted(uint8_t data) {
-  buffer.b[bufferOffset ^ 3] = data;
+  buffer.b[SHA1_BYTE(bufferOffset)] = data;
   bufferOffset++;
   if (bufferOffset == BLOCK_LENGTH) {
     hashBlock();
@@ -72,6 +91,38 @@ void Sha1Class::addUncounted(uint8_t data) {
   }
 }
 
+size_t Sha1Class::update(const uint8_t* data, size_t length) {
+  size_t n = length;
+  uint8_t i;
+
+  byteCount += length;
+
+  // Complete a partly filled block
+  while (bufferOffset != 0 && n) {
+    addUncounted(*data++);
+    n--;
+  }
+
+  // Whole blocks go from data to the buffer a word at a time
+  for (; n >= BLOCK_LENGTH; n -= BLOCK_LENGTH) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    memcpy(buffer.b,data,BLOCK_LENGTH);
+    data += BLOCK_LENGTH;
+#else
+    for (i=0; i<BLOCK_LENGTH; i+=4) {
+      buffer.b[i+3] = *data++;
+      buffer.b[i+2] = *data++;
+      buffer.b[i+1] = *data++;
+      buffer.b[i] = *data++;
+    }
+#endif
+    hashBlock();
+  }
+
+  while (n--) addUncounted(*data++);
+  return length;
+}
+
 #if ARDUINO >= 100
 size_t Sha1Class::write(uint8_t data) {
 #else
@@ -79,7 +130,20 @@ void Sha1Class::write(uint8_t data) {
 #endif
   ++byteCount;
   addUncounted(data);
+#if ARDUINO >= 100
+  return 1;
+#endif
+}
+
+#if ARDUINO >= 100
+size_t Sha1Class::write(const uint8_t* data, size_t length) {
+  return update(data,length);
 }
+#else
+void Sha1Class::write(const uint8_t* data, size_t length) {
+  update(data,length);
+}
+#endif
 
 void Sha1Class::pad() {
   // Implement SHA-1 padding (fips180-2 §5.1.1)
@@ -103,7 +167,8 @@ void Sha1Class::pad() {
 uint8_t* Sha1Class::result(void) {
   // Pad to complete the last block
   pad();
-  
+
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
   // Swap byte order back
   for (int i=0; i<5; i++) {
     uint32_t a,b;
@@ -114,7 +179,8 @@ uint8_t* Sha1Class::result(void) {
     b|=a>>24;
     state.w[i]=b;
   }
-  
+#endif
+
   // Return pointer to hash (20 characters)
   return state.b;
 }
@@ -122,52 +188,76 @@ uint8_t* Sha1Class::result(void) {
 #define HMAC_IPAD 0x36
 #define HMAC_OPAD 0x5c
 
-void Sha1Class::initHmac(const uint8_t* key, int keyLength) {
+// Hash one block of the key xored with pad from the initial state
+void Sha1Class::hashKeyBlock(const uint8_t* keyBlock, uint8_t pad) {
   uint8_t i;
-  memset(keyBuffer,0,BLOCK_LENGTH);
+  init();
+  for (i=0; i<BLOCK_LENGTH; i++) {
+    buffer.b[SHA1_BYTE(i)] = keyBlock[i] ^ pad;
+  }
+  hashBlock();
+}
+
+// Precompute the outer and inner states, and start the inner hash
+void Sha1Class::initHmacKey(const uint8_t* keyBlock) {
+  hashKeyBlock(keyBlock,HMAC_OPAD);
+  memcpy(hmacKey.outer,state.w,HASH_LENGTH);
+  hashKeyBlock(keyBlock,HMAC_IPAD);
+  memcpy(hmacKey.inner,state.w,HASH_LENGTH);
+  byteCount = BLOCK_LENGTH;
+}
+
+void Sha1Class::initHmac(const uint8_t* key, int keyLength) {
+  uint8_t keyBlock[BLOCK_LENGTH];
+  memset(keyBlock,0,BLOCK_LENGTH);
   if (keyLength > BLOCK_LENGTH) {
     // Hash long keys
     init();
-    for (;keyLength--;) write(*key++);
-    memcpy(keyBuffer,result(),HASH_LENGTH);
+    update(key,keyLength);
+    memcpy(keyBlock,result(),HASH_LENGTH);
   } else {
     // Block length keys are used as is
-    memcpy(keyBuffer,key,keyLength);
-  }
-  // Start inner hash
-  init();
-  for (i=0; i<BLOCK_LENGTH; i++) {
-    write(keyBuffer[i] ^ HMAC_IPAD);
+    memcpy(keyBlock,key,keyLength);
   }
+  initHmacKey(keyBlock);
 }
 
 void Sha1Class::initHmac_P(const uint8_t* key, int keyLength) {
-  uint8_t i;
-  memset(keyBuffer,0,BLOCK_LENGTH);
+  uint8_t keyBlock[BLOCK_LENGTH];
+  memset(keyBlock,0,BLOCK_LENGTH);
   if (keyLength > BLOCK_LENGTH) {
     // Hash long keys
     init();
     for (;keyLength--;) write(pgm_read_byte(key++));
-    memcpy(keyBuffer,result(),HASH_LENGTH);
+    memcpy(keyBlock,result(),HASH_LENGTH);
   } else {
     // Block length keys are used as is
-    memcpy_P(keyBuffer,key,keyLength);
-  }
-  // Start inner hash
-  init();
-  for (i=0; i<BLOCK_LENGTH; i++) {
-    write(keyBuffer[i] ^ HMAC_IPAD);
+    memcpy_P(keyBlock,key,keyLength);
   }
+  initHmacKey(keyBlock);
+}
+
+// Start the inner hash from states saved by getHmacKey(), skipping the
+// two key blocks that initHmac() hashes.
+void Sha1Class::initHmac(const Sha1HmacKey& key) {
+  hmacKey = key;
+  memcpy(state.w,hmacKey.inner,HASH_LENGTH);
+  byteCount = BLOCK_LENGTH;
+  bufferOffset = 0;
+}
+
+void Sha1Class::getHmacKey(Sha1HmacKey& key) {
+  key = hmacKey;
 }
 
 uint8_t* Sha1Class::resultHmac(void) {
-  uint8_t i;
   // Complete inner hash
   memcpy(innerHash,result(),HASH_LENGTH);
-  // Calculate outer hash
-  init();
-  for (i=0; i<BLOCK_LENGTH; i++) write(keyBuffer[i] ^ HMAC_OPAD);
-  for (i=0; i<HASH_LENGTH; i++) write(innerHash[i]);
+  // Calculate outer hash, from the state after the key block
+  memcpy(state.w,hmacKey.outer,HASH_LENGTH);
+  byteCount = BLOCK_LENGTH;
+  bufferOffset = 0;
+  update(innerHash,HASH_LENGTH);
   return result();
 }
 Sha1Class Sha1;
@@ -15,6 +15,12 @@ union _state {
   uint8_t b[HASH_LENGTH];
   uint32_t w[HASH_LENGTH/4];
 };
+// HMAC states after hashing the key block xored with ipad and opad.
+// Saved with getHmacKey(), they restart HMAC without hashing the key.
+struct Sha1HmacKey {
+  uint32_t inner[HASH_LENGTH/4];
+  uint32_t outer[HASH_LENGTH/4];
+};
 
 class Sha1Class : public Print
 {
@@ -22,26 +28,32 @@ class Sha1Class : public Print
     void init(void);
     void initHmac(const uint8_t* secret, int secretLength);
     void initHmac_P(const uint8_t* secret, int secretLength);
+    void initHmac(const Sha1HmacKey& key);
+    void getHmacKey(Sha1HmacKey& key);
+    size_t update(const uint8_t* data, size_t length);
     uint8_t* result(void);
     uint8_t* resultHmac(void);
 #if ARDUINO >= 100
     virtual size_t write(uint8_t);
+    virtual size_t write(const uint8_t* data, size_t length);
 #else
     virtual void write(uint8_t);
+    virtual void write(const uint8_t* data, size_t length);
 #endif
     using Print::write;
   private:
     void pad();
     void addUncounted(uint8_t data);
     void hashBlock();
-    uint32_t rol32(uint32_t number, uint8_t bits);
+    void hashKeyBlock(const uint8_t* keyBlock, uint8_t pad);
+    void initHmacKey(const uint8_t* keyBlock);
     _buffer buffer;
     uint8_t bufferOffset;
     _state state;
     uint32_t byteCount;
-    uint8_t keyBuffer[BLOCK_LENGTH];
+    Sha1HmacKey hmacKey;
     uint8_t innerHash[HASH_LENGTH];
-    
+
 };
 extern Sha1Class Sha1;
 
@@ -0,0 +1,283 @@
+#include <string.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "sha256.h"
+
+// SHA-256 words are big endian. Bytes are stored straight into the words
+// of the buffer, at the index that gives the right value on this CPU.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SHA256_BYTE(i) (i)
+#else
+#define SHA256_BYTE(i) ((i) ^ 3)
+#endif
+
+#if SHA256_K_IN_RAM
+#define SHA256_K_MEMORY
+#define SHA256_K(i) (sha256K[i])
+#else
+#define SHA256_K_MEMORY PROGMEM
+#define SHA256_K(i) pgm_read_dword(&sha256K[i])
+#endif
+
+const uint32_t sha256K[] SHA256_K_MEMORY = {
+  0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
+  0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
+  0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
+  0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7,0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967,
+  0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13,0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85,
+  0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3,0xd192e819,0xd6990624,0xf40e3585,0x106aa070,
+  0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5,0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3,
+  0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
+};
+
+const uint32_t sha256InitState[] PROGMEM = {
+  0x6a09e667,0xbb67ae85,0x3c6ef372,0xa54ff53a,0x510e527f,0x9b05688c,0x1f83d9ab,0x5be0cd19
+};
+
+void Sha256Class::init(void) {
+  memcpy_P(state.w,sha256InitState,SHA256_HASH_LENGTH);
+  byteCount = 0;
+  bufferOffset = 0;
+}
+
+static inline uint32_t ror32(uint32_t number, uint8_t bits) {
+  return ((number >> bits) | (number << (32-bits)));
+}
+
+#define SHA256_S0(a) (ror32(a,2) ^ ror32(a,13) ^ ror32(a,22))
+#define SHA256_S1(e) (ror32(e,6) ^ ror32(e,11) ^ ror32(e,25))
+#define SHA256_CH(e,f,g) (g ^ (e & (f ^ g)))
+#define SHA256_MAJ(a,b,c) ((a & b) | (c & (a | b)))
+
+// Message schedule, computed in place over the 16 words of the block
+#define SHA256_W(i) (buffer.w[(i)&15] += \
+  (ror32(buffer.w[((i)+14)&15],17) ^ ror32(buffer.w[((i)+14)&15],19) ^ (buffer.w[((i)+14)&15] >> 10)) + \
+  buffer.w[((i)+9)&15] + \
+  (ror32(buffer.w[((i)+1)&15],7) ^ ror32(buffer.w[((i)+1)&15],18) ^ (buffer.w[((i)+1)&15] >> 3)))
+
+// One round. Instead of moving a..h down every round, the callers rotate
+// the names: eight rounds in a row bring them back in place.
+#define SHA256_ROUND(a,b,c,d,e,f,g,h,i,w) \
+  t = h + SHA256_S1(e) + SHA256_CH(e,f,g) + SHA256_K(i) + (w); \
+  d += t; \
+  h = t + SHA256_S0(a) + SHA256_MAJ(a,b,c);
+
+#define SHA256_ROUND8(i,w) \
+  SHA256_ROUND(a,b,c,d,e,f,g,h,(i),w((i))) \
+  SHA256_ROUND(h,a,b,c,d,e,f,g,(i)+1,w((i)+1)) \
+  SHA256_ROUND(g,h,a,b,c,d,e,f,(i)+2,w((i)+2)) \
+  SHA256_ROUND(f,g,h,a,b,c,d,e,(i)+3,w((i)+3)) \
+  SHA256_ROUND(e,f,g,h,a,b,c,d,(i)+4,w((i)+4)) \
+  SHA256_ROUND(d,e,f,g,h,a,b,c,(i)+5,w((i)+5)) \
+  SHA256_ROUND(c,d,e,f,g,h,a,b,(i)+6,w((i)+6)) \
+  SHA256_ROUND(b,c,d,e,f,g,h,a,(i)+7,w((i)+7))
+
+#define SHA256_BLOCK_W(i) buffer.w[i]
+
+void Sha256Class::hashBlock() {
+  uint8_t i;
+  uint32_t a,b,c,d,e,f,g,h,t;
+
+  a=state.w[0];
+  b=state.w[1];
+  c=state.w[2];
+  d=state.w[3];
+  e=state.w[4];
+  f=state.w[5];
+  g=state.w[6];
+  h=state.w[7];
+  for (i=0; i<16; i+=8) {
+    SHA256_ROUND8(i, SHA256_BLOCK_W)
+  }
+  for (i=16; i<64; i+=8) {
+    SHA256_ROUND8(i, SHA256_W)
+  }
+  state.w[0] += a;
+  state.w[1] += b;
+  state.w[2] += c;
+  state.w[3] += d;
+  state.w[4] += e;
+  state.w[5] += f;
+  state.w[6] += g;
+  state.w[7] += h;
+}
+
+void Sha256Class::addUncounted(uint8_t data) {
+  buffer.b[SHA256_BYTE(bufferOffset)] = data;
+  bufferOffset++;
+  if (bufferOffset == SHA256_BLOCK_LENGTH) {
+    hashBlock();
+    bufferOffset = 0;
+  }
+}
+
+size_t Sha256Class::update(const uint8_t* data, size_t length) {
+  size_t n = length;
+  uint8_t i;
+
+  byteCount += length;
+
+  // Complete a partly filled block
+  while (bufferOffset != 0 && n) {
+    addUncounted(*data++);
+    n--;
+  }
+
+  // Whole blocks go from data to the buffer a word at a time
+  for (; n >= SHA256_BLOCK_LENGTH; n -= SHA256_BLOCK_LENGTH) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    memcpy(buffer.b,data,SHA256_BLOCK_LENGTH);
+    data += SHA256_BLOCK_LENGTH;
+#else
+    for (i=0; i<SHA256_BLOCK_LENGTH; i+=4) {
+      buffer.b[i+3] = *data++;
+      buffer.b[i+2] = *data++;
+      buffer.b[i+1] = *data++;
+      buffer.b[i] = *data++;
+    }
+#endif
+    hashBlock();
+  }
+
+  while (n--) addUncounted(*data++);
+  return length;
+}
+
+#if ARDUINO >= 100
+size_t Sha256Class::write(uint8_t data) {
+#else
+void Sha256Class::write(uint8_t data) {
+#endif
+  ++byteCount;
+  addUncounted(data);
+#if ARDUINO >= 100
+  return 1;
+#endif
+}
+
+#if ARDUINO >= 100
+size_t Sha256Class::write(const uint8_t* data, size_t length) {
+  return update(data,length);
+}
+#else
+void Sha256Class::write(const uint8_t* data, size_t length) {
+  update(data,length);
+}
+#endif
+
+void Sha256Class::pad() {
+  // Implement SHA-256 padding (fips180-2 §5.1.1)
+
+  // Pad with 0x80 followed by 0x00 until the end of the block
+  addUncounted(0x80);
+  while (bufferOffset != 56) addUncounted(0x00);
+
+  // Append length in the last 8 bytes
+  addUncounted(0); // We're only using 32 bit lengths
+  addUncounted(0); // But SHA-256 supports 64 bit lengths
+  addUncounted(0); // So zero pad the top bits
+  addUncounted(byteCount >> 29); // Shifting to multiply by 8
+  addUncounted(byteCount >> 21); // as SHA-256 supports bitstreams as well as
+  addUncounted(byteCount >> 13); // byte.
+  addUncounted(byteCount >> 5);
+  addUncounted(byteCount << 3);
+}
+
+
+uint8_t* Sha256Class::result(void) {
+  // Pad to complete the last block
+  pad();
+
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
+  // Swap byte order back
+  for (int i=0; i<8; i++) {
+    uint32_t a,b;
+    a=state.w[i];
+    b=a<<24;
+    b|=(a<<8) & 0x00ff0000;
+    b|=(a>>8) & 0x0000ff00;
+    b|=a>>24;
+    state.w[i]=b;
+  }
+#endif
+
+  // Return pointer to hash (32 characters)
+  return state.b;
+}
+
+#define HMAC_IPAD 0x36
+#define HMAC_OPAD 0x5c
+
+// Hash one block of the key xored with pad from the initial state
+void Sha256Class::hashKeyBlock(const uint8_t* keyBlock, uint8_t pad) {
+  uint8_t i;
+  init();
+  for (i=0; i<SHA256_BLOCK_LENGTH; i++) {
+    buffer.b[SHA256_BYTE(i)] = keyBlock[i] ^ pad;
+  }
+  hashBlock();
+}
+
+// Precompute the outer and inner states, and start the inner hash
+void Sha256Class::initHmacKey(const uint8_t* keyBlock) {
+  hashKeyBlock(keyBlock,HMAC_OPAD);
+  memcpy(hmacKey.outer,state.w,SHA256_HASH_LENGTH);
+  hashKeyBlock(keyBlock,HMAC_IPAD);
+  memcpy(hmacKey.inner,state.w,SHA256_HASH_LENGTH);
+  byteCount = SHA256_BLOCK_LENGTH;
+}
+
+void Sha256Class::initHmac(const uint8_t* key, int keyLength) {
+  uint8_t keyBlock[SHA256_BLOCK_LENGTH];
+  memset(keyBlock,0,SHA256_BLOCK_LENGTH);
+  if (keyLength > SHA256_BLOCK_LENGTH) {
+    // Hash long keys
+    init();
+    update(key,keyLength);
+    memcpy(keyBlock,result(),SHA256_HASH_LENGTH);
+  } else {
+    // Block length keys are used as is
+    memcpy(keyBlock,key,keyLength);
+  }
+  initHmacKey(keyBlock);
+}
+
+void Sha256Class::initHmac_P(const uint8_t* key, int keyLength) {
+  uint8_t keyBlock[SHA256_BLOCK_LENGTH];
+  memset(keyBlock,0,SHA256_BLOCK_LENGTH);
+  if (keyLength > SHA256_BLOCK_LENGTH) {
+    // Hash long keys
+    init();
+    for (;keyLength--;) write(pgm_read_byte(key++));
+    memcpy(keyBlock,result(),SHA256_HASH_LENGTH);
+  } else {
+    // Block length keys are used as is
+    memcpy_P(keyBlock,key,keyLength);
+  }
+  initHmacKey(keyBlock);
+}
+
+// Start the inner hash from states saved by getHmacKey(), skipping the
+// two key blocks that initHmac() hashes.
+void Sha256Class::initHmac(const Sha256HmacKey& key) {
+  hmacKey = key;
+  memcpy(state.w,hmacKey.inner,SHA256_HASH_LENGTH);
+  byteCount = SHA256_BLOCK_LENGTH;
+  bufferOffset = 0;
+}
+
+void Sha256Class::getHmacKey(Sha256HmacKey& key) {
+  key = hmacKey;
+}
+
+uint8_t* Sha256Class::resultHmac(void) {
+  // Complete inner hash
+  memcpy(innerHash,result(),SHA256_HASH_LENGTH);
+  // Calculate outer hash, from the state after the key block
+  memcpy(state.w,hmacKey.outer,SHA256_HASH_LENGTH);
+  byteCount = SHA256_BLOCK_LENGTH;
+  bufferOffset = 0;
+  update(innerHash,SHA256_HASH_LENGTH);
+  return result();
+}
+Sha256Class Sha256;
@@ -0,0 +1,68 @@
+#ifndef Sha256_h
+#define Sha256_h
+
+#include <inttypes.h>
+#include "Print.h"
+
+#define SHA256_HASH_LENGTH 32
+#define SHA256_BLOCK_LENGTH 64
+
+// The 64 round constants take 256 bytes. They are read from flash unless
+// SHA256_K_IN_RAM is 1, which is a little faster and costs that much RAM.
+// Change it here, or pass -DSHA256_K_IN_RAM=1 to the whole build: a
+// #define in the sketch does not reach sha256.cpp, which is compiled on
+// its own.
+#ifndef SHA256_K_IN_RAM
+#define SHA256_K_IN_RAM 0
+#endif
+
+union _sha256Buffer {
+  uint8_t b[SHA256_BLOCK_LENGTH];
+  uint32_t w[SHA256_BLOCK_LENGTH/4];
+};
+union _sha256State {
+  uint8_t b[SHA256_HASH_LENGTH];
+  uint32_t w[SHA256_HASH_LENGTH/4];
+};
+// HMAC states after hashing the key block xored with ipad and opad.
+// Saved with getHmacKey(), they restart HMAC without hashing the key.
+struct Sha256HmacKey {
+  uint32_t inner[SHA256_HASH_LENGTH/4];
+  uint32_t outer[SHA256_HASH_LENGTH/4];
+};
+
+class Sha256Class : public Print
+{
+  public:
+    void init(void);
+    void initHmac(const uint8_t* secret, int secretLength);
+    void initHmac_P(const uint8_t* secret, int secretLength);
+    void initHmac(const Sha256HmacKey& key);
+    void getHmacKey(Sha256HmacKey& key);
+    size_t update(const uint8_t* data, size_t length);
+    uint8_t* result(void);
+    uint8_t* resultHmac(void);
+#if ARDUINO >= 100
+    virtual size_t write(uint8_t);
+    virtual size_t write(const uint8_t* data, size_t length);
+#else
+    virtual void write(uint8_t);
+    virtual void write(const uint8_t* data, size_t length);
+#endif
+    using Print::write;
+  private:
+    void pad();
+    void addUncounted(uint8_t data);
+    void hashBlock();
+    void hashKeyBlock(const uint8_t* keyBlock, uint8_t pad);
+    void initHmacKey(const uint8_t* keyBlock);
+    _sha256Buffer buffer;
+    uint8_t bufferOffset;
+    _sha256State state;
+    uint32_t byteCount;
+    Sha256HmacKey hmacKey;
+    uint8_t innerHash[SHA256_HASH_LENGTH];
+};
+extern Sha256Class Sha256;
+
+#endif
@@ -0,0 +1,28 @@
+/*
+ * Print base class of the Arduino core, as far as Cryptosuite uses it:
+ * the single byte write() that hashes and the bulk ones built on it.
+ */
+#ifndef Print_h
+#define Print_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+            n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+    size_t print(const char *str) { return write(str); }
+};
+
+#endif
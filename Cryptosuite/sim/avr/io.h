@@ -0,0 +1 @@
+/* Nothing of avr/io.h is used by Cryptosuite on the host. */
@@ -0,0 +1,12 @@
+/* Program memory is plain memory on the host. */
+#ifndef pgmspace_h
+#define pgmspace_h
+
+#include <string.h>
+
+#define PROGMEM
+#define memcpy_P memcpy
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#endif
@@ -0,0 +1,298 @@
+/*
+ * Host test vectors and throughput benchmark for Sha1Class
+ *
+ * Checks the FIPS 180-2 SHA-1 and RFC 2202 HMAC-SHA-1 vectors through
+ * every way of feeding data: write() a byte at a time, update() and
+ * print() in pieces, HMAC keys from RAM, PROGMEM and a saved Sha1HmacKey.
+ * Cross-checks random lengths and splits against the old Sha1Class kept
+ * in sha1_legacy.h, then prints bytes per second hashed byte by byte and
+ * in bulk, and HMACs per second of short messages.
+ * Exits non-zero on any mismatch.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "sha1.h"
+#include "sha1_legacy.h"
+
+static unsigned int errors;
+
+static void check(const char *name, const uint8_t *hash, const char *expected)
+{
+    char hex[2 * HASH_LENGTH + 1];
+    for (int i = 0; i < HASH_LENGTH; i++)
+        sprintf(&hex[2 * i], "%02x", hash[i]);
+    if (strcmp(hex, expected) != 0)
+    {
+        printf("%-32s %s, expected %s\n", name, hex, expected);
+        errors++;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Test vectors
+
+struct HashVector
+{
+    const char *data;
+    unsigned long repeat;
+    const char *digest;
+};
+
+static const HashVector hashVectors[] =
+{
+    { "", 1, "da39a3ee5e6b4b0d3255bfef95601890afd80709" },
+    { "abc", 1, "a9993e364706816aba3e25717850c26c9cd0d89d" },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+      "84983e441c3bd26ebaae4aa1f95129e5e54670f1" },
+    { "a", 1000000, "34aa973cd4c4daa4f61eeb2bdbad27316534016f" },
+    { "0123456701234567012345670123456701234567012345670123456701234567", 10,
+      "dea356a2cddd90c7a7ecedc5ebb563934f460452" },
+};
+
+struct HmacVector
+{
+    uint8_t key[80];
+    int keyLength;
+    const char *data;
+    int dataLength;
+    const char *digest;
+};
+
+static HmacVector hmacVectors[] =
+{
+    { { 0 }, 20, "Hi There", 8, "b617318655057264e28bc0b6fb378c8ef146be00" },
+    { "Jefe", 4, "what do ya want for nothing?", 28, "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79" },
+    { { 0 }, 20, 0, 50, "125d7342b9ac11cd91a39af48aa17b4f63f175d3" },
+    { { 0 }, 25, 0, 50, "4c9007f4026250c6bc8414f9bf50c86c2d7235da" },
+    { { 0 }, 20, "Test With Truncation", 20, "4c1a03424b55e07fe7f27be1d58bb9324a9a5a04" },
+    { { 0 }, 80, "Test Using Larger Than Block-Size Key - Hash Key First", 54,
+      "aa4ae5e15272d00e95705637ce8a3b55ed402112" },
+    { { 0 }, 80, "Test Using Larger Than Block-Size Key and Larger Than One Block-Size Data", 73,
+      "e8e99d0f45237d786d6bbaa7965c7808bbff1a91" },
+};
+
+static uint8_t hmacData3[50], hmacData4[50];
+
+static void setupHmacVectors()
+{
+    memset(hmacVectors[0].key, 0x0b, 20);
+    memset(hmacVectors[2].key, 0xaa, 20);
+    for (int i = 0; i < 25; i++)
+        hmacVectors[3].key[i] = i + 1;
+    memset(hmacVectors[4].key, 0x0c, 20);
+    memset(hmacVectors[5].key, 0xaa, 80);
+    memset(hmacVectors[6].key, 0xaa, 80);
+    memset(hmacData3, 0xdd, sizeof(hmacData3));
+    memset(hmacData4, 0xcd, sizeof(hmacData4));
+    hmacVectors[2].data = (const char *)hmacData3;
+    hmacVectors[3].data = (const char *)hmacData4;
+}
+
+static void checkHashVectors()
+{
+    for (unsigned int v = 0; v < sizeof(hashVectors) / sizeof(hashVectors[0]); v++)
+    {
+        const HashVector& t = hashVectors[v];
+        const size_t length = strlen(t.data);
+
+        Sha1.init();
+        for (unsigned long r = 0; r < t.repeat; r++)
+            for (size_t i = 0; i < length; i++)
+                Sha1.write(t.data[i]);
+        check("sha1 write", Sha1.result(), t.digest);
+
+        Sha1.init();
+        for (unsigned long r = 0; r < t.repeat; r++)
+            Sha1.update((const uint8_t *)t.data, length);
+        check("sha1 update", Sha1.result(), t.digest);
+
+        // All repeats in one buffer, fed in uneven pieces through print()
+        std::string all;
+        for (unsigned long r = 0; r < t.repeat; r++)
+            all += t.data;
+        for (size_t piece = 1; piece < 200; piece += 37)
+        {
+            Sha1.init();
+            for (size_t i = 0; i < all.size(); i += piece)
+                Sha1.print(all.substr(i, piece).c_str());
+            check("sha1 print", Sha1.result(), t.digest);
+        }
+    }
+}
+
+static void checkHmacVectors()
+{
+    for (unsigned int v = 0; v < sizeof(hmacVectors) / sizeof(hmacVectors[0]); v++)
+    {
+        const HmacVector& t = hmacVectors[v];
+        Sha1HmacKey saved;
+
+        Sha1.initHmac(t.key, t.keyLength);
+        Sha1.getHmacKey(saved);
+        for (int i = 0; i < t.dataLength; i++)
+            Sha1.write(t.data[i]);
+        check("hmac write", Sha1.resultHmac(), t.digest);
+
+        Sha1.initHmac_P(t.key, t.keyLength);
+        Sha1.update((const uint8_t *)t.data, t.dataLength);
+        check("hmac_P update", Sha1.resultHmac(), t.digest);
+
+        // Twice from the saved key, with another key in between
+        for (int round = 0; round < 2; round++)
+        {
+            Sha1.initHmac((const uint8_t *)"other", 5);
+            Sha1.update((const uint8_t *)"x", 1);
+            Sha1.resultHmac();
+
+            Sha1.initHmac(saved);
+            Sha1.update((const uint8_t *)t.data, t.dataLength);
+            check("hmac saved key", Sha1.resultHmac(), t.digest);
+        }
+    }
+}
+
+static void checkAgainstLegacy()
+{
+    static LegacySha1Class legacy;
+    uint8_t data[1000];
+    srand(1);
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = rand();
+
+    for (int run = 0; run < 2000; run++)
+    {
+        const size_t length = rand() % sizeof(data);
+        char digest[2 * HASH_LENGTH + 1];
+
+        legacy.init();
+        for (size_t i = 0; i < length; i++)
+            legacy.write(data[i]);
+        const uint8_t *expected = legacy.result();
+        for (int i = 0; i < HASH_LENGTH; i++)
+            sprintf(&digest[2 * i], "%02x", expected[i]);
+
+        Sha1.init();
+        for (size_t i = 0; i < length; )
+        {
+            const size_t piece = rand() % 150;
+            const size_t n = (piece < length - i) ? piece : length - i;
+            if (n == 1)
+                Sha1.write(data[i]);
+            else
+                Sha1.update(&data[i], n);
+            i += n;
+        }
+        check("random split", Sha1.result(), digest);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Throughput
+
+typedef std::chrono::steady_clock Clock;
+
+static double seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static volatile uint8_t sink;
+
+static void benchHash()
+{
+    const size_t size = 1 << 20;
+    std::vector<uint8_t> data(size + 1, 0x5a);
+    static LegacySha1Class legacy;
+    const int rounds = 20;
+
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        legacy.init();
+        for (size_t i = 0; i < size; i++)
+            legacy.write(data[i]);
+        sink = legacy.result()[0];
+    }
+    const double before = rounds * size / seconds(start);
+
+    start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        Sha1.init();
+        for (size_t i = 0; i < size; i++)
+            Sha1.write(data[i]);
+        sink = Sha1.result()[0];
+    }
+    const double bytes = rounds * size / seconds(start);
+
+    start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        Sha1.init();
+        Sha1.update(&data[1], size);    // not word aligned
+        sink = Sha1.result()[0];
+    }
+    const double bulk = rounds * size / seconds(start);
+
+    printf("sha1   before %6.1f MB/s   write() %6.1f MB/s   update() %6.1f MB/s\n",
+           before / 1e6, bytes / 1e6, bulk / 1e6);
+}
+
+static void benchHmac()
+{
+    const uint8_t key[] = "0123456789abcdef0123456789abcdef";
+    const uint8_t message[] = "GET /api/v1/sensors?id=42&t=1718";
+    const int rounds = 300000;
+    static LegacySha1Class legacy;
+    Sha1HmacKey saved;
+
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        legacy.initHmac(key, 32);
+        for (size_t i = 0; i < 32; i++)
+            legacy.write(message[i]);
+        sink = legacy.resultHmac()[0];
+    }
+    const double before = rounds / seconds(start);
+
+    start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        Sha1.initHmac(key, 32);
+        Sha1.update(message, 32);
+        sink = Sha1.resultHmac()[0];
+    }
+    const double perKey = rounds / seconds(start);
+
+    Sha1.initHmac(key, 32);
+    Sha1.getHmacKey(saved);
+    start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        Sha1.initHmac(saved);
+        Sha1.update(message, 32);
+        sink = Sha1.resultHmac()[0];
+    }
+    const double cached = rounds / seconds(start);
+
+    printf("hmac   before %7.0f /s     initHmac(key) %7.0f /s   initHmac(saved) %7.0f /s"
+           "   (32 byte messages)\n", before, perKey, cached);
+}
+
+int main()
+{
+    setupHmacVectors();
+    checkHashVectors();
+    checkHmacVectors();
+    checkAgainstLegacy();
+    printf("test vectors: %s\n", errors ? "MISMATCH" : "ok");
+
+    benchHash();
+    benchHmac();
+    return errors ? 1 : 0;
+}
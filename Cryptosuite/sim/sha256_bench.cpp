@@ -0,0 +1,252 @@
+/*
+ * Host test vectors and benchmark for Sha256Class against Sha1Class
+ *
+ * Checks the FIPS 180-2 SHA-256 and RFC 4231 HMAC-SHA-256 vectors through
+ * write() a byte at a time, update() and print() in pieces, HMAC keys from
+ * RAM, PROGMEM and a saved Sha256HmacKey.  Then hashes the same buffers
+ * and HMACs the same messages with both classes and prints the rates.
+ * The stack each one needs is printed by "make stack".
+ * Exits non-zero on any mismatch.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "sha1.h"
+#include "sha256.h"
+
+static unsigned int errors;
+
+static void check(const char *name, const uint8_t *hash, const char *expected)
+{
+    char hex[2 * SHA256_HASH_LENGTH + 1];
+    for (int i = 0; i < SHA256_HASH_LENGTH; i++)
+        sprintf(&hex[2 * i], "%02x", hash[i]);
+    if (strcmp(hex, expected) != 0)
+    {
+        printf("%-32s %s, expected %s\n", name, hex, expected);
+        errors++;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Test vectors
+
+struct HashVector
+{
+    const char *data;
+    unsigned long repeat;
+    const char *digest;
+};
+
+static const HashVector hashVectors[] =
+{
+    { "", 1, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+    { "abc", 1, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+      "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+    { "a", 1000000, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" },
+    { "0123456701234567012345670123456701234567012345670123456701234567", 10,
+      "594847328451bdfa85056225462cc1d867d877fb388df0ce35f25ab5562bfbb5" },
+};
+
+struct HmacVector
+{
+    uint8_t key[131];
+    int keyLength;
+    const char *data;
+    int dataLength;
+    const char *digest;
+};
+
+static HmacVector hmacVectors[] =
+{
+    { { 0 }, 20, "Hi There", 8,
+      "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7" },
+    { "Jefe", 4, "what do ya want for nothing?", 28,
+      "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843" },
+    { { 0 }, 20, 0, 50,
+      "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe" },
+    { { 0 }, 25, 0, 50,
+      "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b" },
+    { { 0 }, 131, "Test Using Larger Than Block-Size Key - Hash Key First", 54,
+      "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" },
+    { { 0 }, 131, "This is a test using a larger than block-size key and a larger than block-size data. "
+                  "The key needs to be hashed before being used by the HMAC algorithm.", 152,
+      "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2" },
+};
+
+static uint8_t hmacData3[50], hmacData4[50];
+
+static void setupHmacVectors()
+{
+    memset(hmacVectors[0].key, 0x0b, 20);
+    memset(hmacVectors[2].key, 0xaa, 20);
+    for (int i = 0; i < 25; i++)
+        hmacVectors[3].key[i] = i + 1;
+    memset(hmacVectors[4].key, 0xaa, 131);
+    memset(hmacVectors[5].key, 0xaa, 131);
+    memset(hmacData3, 0xdd, sizeof(hmacData3));
+    memset(hmacData4, 0xcd, sizeof(hmacData4));
+    hmacVectors[2].data = (const char *)hmacData3;
+    hmacVectors[3].data = (const char *)hmacData4;
+}
+
+static void checkHashVectors()
+{
+    for (unsigned int v = 0; v < sizeof(hashVectors) / sizeof(hashVectors[0]); v++)
+    {
+        const HashVector& t = hashVectors[v];
+        const size_t length = strlen(t.data);
+
+        Sha256.init();
+        for (unsigned long r = 0; r < t.repeat; r++)
+            for (size_t i = 0; i < length; i++)
+                Sha256.write(t.data[i]);
+        check("sha256 write", Sha256.result(), t.digest);
+
+        Sha256.init();
+        for (unsigned long r = 0; r < t.repeat; r++)
+            Sha256.update((const uint8_t *)t.data, length);
+        check("sha256 update", Sha256.result(), t.digest);
+
+        // All repeats in one buffer, fed in uneven pieces through print()
+        std::string all;
+        for (unsigned long r = 0; r < t.repeat; r++)
+            all += t.data;
+        for (size_t piece = 1; piece < 200; piece += 37)
+        {
+            Sha256.init();
+            for (size_t i = 0; i < all.size(); i += piece)
+                Sha256.print(all.substr(i, piece).c_str());
+            check("sha256 print", Sha256.result(), t.digest);
+        }
+    }
+}
+
+static void checkHmacVectors()
+{
+    for (unsigned int v = 0; v < sizeof(hmacVectors) / sizeof(hmacVectors[0]); v++)
+    {
+        const HmacVector& t = hmacVectors[v];
+        Sha256HmacKey saved;
+
+        Sha256.initHmac(t.key, t.keyLength);
+        Sha256.getHmacKey(saved);
+        for (int i = 0; i < t.dataLength; i++)
+            Sha256.write(t.data[i]);
+        check("hmac write", Sha256.resultHmac(), t.digest);
+
+        Sha256.initHmac_P(t.key, t.keyLength);
+        Sha256.update((const uint8_t *)t.data, t.dataLength);
+        check("hmac_P update", Sha256.resultHmac(), t.digest);
+
+        // Twice from the saved key, with another key in between
+        for (int round = 0; round < 2; round++)
+        {
+            Sha256.initHmac((const uint8_t *)"other", 5);
+            Sha256.update((const uint8_t *)"x", 1);
+            Sha256.resultHmac();
+
+            Sha256.initHmac(saved);
+            Sha256.update((const uint8_t *)t.data, t.dataLength);
+            check("hmac saved key", Sha256.resultHmac(), t.digest);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Throughput, on the same inputs for both
+
+typedef std::chrono::steady_clock Clock;
+
+static double seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static volatile uint8_t sink;
+
+template <class Hash>
+static void benchHash(const char *name, Hash& hash, const std::vector<uint8_t>& data, size_t size)
+{
+    const int rounds = 20;
+
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        hash.init();
+        for (size_t i = 0; i < size; i++)
+            hash.write(data[i]);
+        sink = hash.result()[0];
+    }
+    const double bytes = rounds * size / seconds(start);
+
+    start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        hash.init();
+        hash.update(&data[0], size);
+        sink = hash.result()[0];
+    }
+    const double bulk = rounds * size / seconds(start);
+
+    printf("%-8s write() %6.1f MB/s   update() %6.1f MB/s\n", name, bytes / 1e6, bulk / 1e6);
+}
+
+template <class Hash, class Key>
+static void benchHmac(const char *name, Hash& hash, Key& saved)
+{
+    const uint8_t key[] = "0123456789abcdef0123456789abcdef";
+    const uint8_t message[] = "GET /api/v1/sensors?id=42&t=1718";
+    const int rounds = 300000;
+
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        hash.initHmac(key, 32);
+        hash.update(message, 32);
+        sink = hash.resultHmac()[0];
+    }
+    const double perKey = rounds / seconds(start);
+
+    hash.initHmac(key, 32);
+    hash.getHmacKey(saved);
+    start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        hash.initHmac(saved);
+        hash.update(message, 32);
+        sink = hash.resultHmac()[0];
+    }
+    const double cached = rounds / seconds(start);
+
+    printf("%-8s initHmac(key) %8.0f /s   initHmac(saved) %8.0f /s   (32 byte messages)\n",
+           name, perKey, cached);
+}
+
+int main()
+{
+    setupHmacVectors();
+    checkHashVectors();
+    checkHmacVectors();
+    printf("test vectors: %s   K table in %s   sizeof Sha1Class %u, Sha256Class %u\n",
+           errors ? "MISMATCH" : "ok", SHA256_K_IN_RAM ? "RAM" : "flash",
+           (unsigned)sizeof(Sha1Class), (unsigned)sizeof(Sha256Class));
+
+    const size_t size = 1 << 20;
+    std::vector<uint8_t> data(size);
+    srand(1);
+    for (size_t i = 0; i < size; i++)
+        data[i] = rand();
+    benchHash("sha1", Sha1, data, size);
+    benchHash("sha256", Sha256, data, size);
+
+    Sha1HmacKey sha1Key;
+    Sha256HmacKey sha256Key;
+    benchHmac("sha1", Sha1, sha1Key);
+    benchHmac("sha256", Sha256, sha256Key);
+    return errors ? 1 : 0;
+}
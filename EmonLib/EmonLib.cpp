@@ -9,6 +9,7 @@
 
 //#include "WProgram.h" un-comment for use on older versions of Arduino IDE
 #include "EmonLib.h"
+#include <string.h>
 
 #if defined(ARDUINO) && ARDUINO >= 100
 #include "Arduino.h"
@@ -208,6 +209,159 @@ double EnergyMonitor::calcIrms(unsigned int Number_of_Samples)
   return Irms;
 }
 
+//--------------------------------------------------------------------------------------
+// Continuous sampling
+// The ADC converts voltage and current in turn, without stopping, at 125 kHz / 13:
+// 4808 pairs per second on a 16 MHz AVR. Its interrupt calls addSample(), which
+// removes the offsets, applies the phase calibration and adds up V², I² and V*I in
+// integers. At every whole mains cycle, from one positive-going voltage crossing to
+// the next, it hands the sums to calcContinuous() if that has taken the last ones,
+// or else keeps adding to them, so no sample is ever missed. The float maths is
+// done once per report, by calcContinuous().
+//--------------------------------------------------------------------------------------
+#if defined(F_CPU)
+#define CONTINUOUS_PAIR_RATE (F_CPU/128/13/2)
+#else
+#define CONTINUOUS_PAIR_RATE 4808
+#endif
+
+#if defined(__AVR__) && defined(ADATE)
+static EnergyMonitor *continuousMonitor;
+static uint8_t continuousMuxV, continuousMuxI;
+static boolean continuousReadingI;
+static boolean continuousIsr;                               // The sketch has EMONLIB_CONTINUOUS_ISR
+
+// Called by EMONLIB_CONTINUOUS_ISR, before setup()
+boolean EnergyMonitor::useContinuousInterrupt()
+{
+  continuousIsr = true;
+  return true;
+}
+
+void EnergyMonitor::continuousInterrupt()
+{
+  int sample = ADC;
+  // The next conversion has already started, so the channel set here is for the
+  // one after that: the same as this one.
+  ADMUX = continuousReadingI ? continuousMuxI : continuousMuxV;
+  continuousReadingI = !continuousReadingI;
+  continuousMonitor->addSample(sample);
+}
+#endif
+
+boolean EnergyMonitor::startContinuous(unsigned int _cycles, unsigned int timeout)
+{
+  #if defined(__AVR__) && defined(ADATE)
+  if (!continuousIsr) return false;
+  #endif
+
+  #if defined emonTxV3
+  continuousVcc = 3300;
+  #else
+  continuousVcc = readVcc();
+  #endif
+
+  cycles = _cycles;
+  cycleCount = 0;
+  timeoutSamples = (unsigned long)timeout * CONTINUOUS_PAIR_RATE / 1000;
+  phaseCalx = PHASECAL * 256;
+  offsetVx = (long)(offsetV * 65536.0);
+  offsetIx = (long)(offsetI * 65536.0);
+  filteredVx = 0;
+  lastFilteredVx = 0;
+  nextIsCurrent = false;
+  belowZero = false;
+  memset(&sums, 0, sizeof(sums));
+  reportReady = false;
+
+  #if defined(__AVR__) && defined(ADATE)
+  continuousMonitor = this;
+  continuousMuxV = _BV(REFS0) | (inPinV & 0x07);
+  continuousMuxI = _BV(REFS0) | (inPinI & 0x07);
+  continuousReadingI = false;
+  ADMUX = continuousMuxV;
+  ADCSRB = 0;                                               // Free running
+  ADCSRA = _BV(ADEN) | _BV(ADSC) | _BV(ADATE) | _BV(ADIE) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0);
+  delayMicroseconds(16);                                    // The first conversion has its channel
+  ADMUX = continuousMuxI;                                   // so the second reads the current
+  return true;
+  #else
+  return false;                                             // Feed addSample() some other way
+  #endif
+}
+
+void EnergyMonitor::stopContinuous()
+{
+  #if defined(__AVR__) && defined(ADATE)
+  ADCSRA &= ~(_BV(ADATE) | _BV(ADIE));
+  while (bit_is_set(ADCSRA,ADSC));
+  continuousMonitor = NULL;
+  #endif
+  offsetV = offsetVx / 65536.0;
+  offsetI = offsetIx / 65536.0;
+}
+
+//--------------------------------------------------------------------------------------
+// One ADC result: integer maths only, as it runs in the interrupt
+//--------------------------------------------------------------------------------------
+void EnergyMonitor::addSample(int sample)
+{
+  // Low pass filters as calcVI(), with the offsets in counts<<16
+  if (!nextIsCurrent)
+  {
+    nextIsCurrent = true;
+    offsetVx += (((long)sample << 16) - offsetVx) >> 10;
+    lastFilteredVx = filteredVx;
+    filteredVx = (sample << CONTINUOUS_FRACTION_BITS) - (int)(offsetVx >> (16 - CONTINUOUS_FRACTION_BITS));
+    return;
+  }
+  nextIsCurrent = false;
+  offsetIx += (((long)sample << 16) - offsetIx) >> 10;
+  int filteredIx = (sample << CONTINUOUS_FRACTION_BITS) - (int)(offsetIx >> (16 - CONTINUOUS_FRACTION_BITS));
+
+  long phaseShiftedVx = lastFilteredVx + ((long)phaseCalx * (filteredVx - lastFilteredVx) >> 8);
+  sums.sumV += (long)filteredVx * filteredVx;
+  sums.sumI += (long)filteredIx * filteredIx;
+  sums.sumP += phaseShiftedVx * filteredIx;
+  sums.samples++;
+
+  // A mains cycle ends where the voltage goes up through 0
+  boolean cycleEnd = false;
+  if (filteredVx < -(CONTINUOUS_HYSTERESIS << CONTINUOUS_FRACTION_BITS))
+    belowZero = true;
+  else if (belowZero && filteredVx >= 0)
+  {
+    belowZero = false;
+    cycleEnd = ++cycleCount >= cycles;
+  }
+  if ((cycleEnd || sums.samples >= timeoutSamples) && !reportReady)
+  {
+    report = sums;
+    memset(&sums, 0, sizeof(sums));
+    cycleCount = 0;
+    reportReady = true;
+  }
+}
+
+boolean EnergyMonitor::calcContinuous()
+{
+  if (!reportReady)
+    return false;
+
+  // The interrupt doesn't touch report until reportReady is cleared
+  double scale = 1.0 / (1 << CONTINUOUS_FRACTION_BITS);
+  double V_RATIO = VCAL *((continuousVcc/1000.0) / (ADC_COUNTS)) * scale;
+  double I_RATIO = ICAL *((continuousVcc/1000.0) / (ADC_COUNTS)) * scale;
+  numberOfSamples = report.samples;
+  Vrms = V_RATIO * sqrt((double)report.sumV / numberOfSamples);
+  Irms = I_RATIO * sqrt((double)report.sumI / numberOfSamples);
+  realPower = V_RATIO * I_RATIO * report.sumP / numberOfSamples;
+  apparentPower = Vrms * Irms;
+  powerFactor = realPower / apparentPower;
+  reportReady = false;
+  return true;
+}
+
 void EnergyMonitor::serialprint()
 {
     Serial.print(realPower);
@@ -41,6 +41,21 @@
 
 #define ADC_COUNTS  (1<<ADC_BITS)
 
+// Continuous sampling: filtered samples carry this many fraction bits, as
+// many as keep them within 15 bits and their products within 31, and a
+// positive-going voltage crossing must first go this far below 0 (in ADC
+// counts) to count as the start of a mains cycle.
+#define CONTINUOUS_FRACTION_BITS (14-ADC_BITS)
+#define CONTINUOUS_HYSTERESIS    (ADC_COUNTS>>6)
+
+// Integer sums over whole mains cycles, handed from the ADC interrupt to
+// calcContinuous().
+struct EmonSums
+{
+  int64_t sumV, sumI, sumP;
+  unsigned long samples;
+};
+
 
 class EnergyMonitor
 {
@@ -56,6 +71,20 @@ class EnergyMonitor
     double calcIrms(unsigned int NUMBER_OF_SAMPLES);
     void serialprint();
 
+    // Continuous sampling: the ADC runs free, alternating voltage and
+    // current, and its interrupt accumulates every sample. calcContinuous()
+    // returns true when a new report of at least 'cycles' mains cycles is
+    // in realPower...Irms. analogRead() and readVcc() can't be used until
+    // stopContinuous(). One EnergyMonitor at a time (AVR only). The sketch
+    // must have EMONLIB_CONTINUOUS_ISR, or startContinuous() returns false.
+    boolean startContinuous(unsigned int cycles, unsigned int timeout);
+    void stopContinuous();
+    boolean calcContinuous();
+    void addSample(int sample);        // From the ADC interrupt, voltage and current in turn
+    unsigned long numberOfSamples;     // Sample pairs in the last continuous report
+    static void continuousInterrupt(); // The body of EMONLIB_CONTINUOUS_ISR
+    static boolean useContinuousInterrupt();
+
     long readVcc();
     //Useful value variables
     double realPower,
@@ -94,7 +123,32 @@ class EnergyMonitor
 
 	boolean lastVCross, checkVCross;                  //Used to measure number of times threshold is crossed.
 
+	//--------------------------------------------------------------------------------------
+	// Continuous sampling, integers only; filtered values have CONTINUOUS_FRACTION_BITS
+	//--------------------------------------------------------------------------------------
+	int continuousVcc;                                //mV, read once by startContinuous()
+	long offsetVx, offsetIx;                          //Low-pass filter outputs, counts<<16
+	int filteredVx, lastFilteredVx;                   //Voltage now and one pair earlier
+	int phaseCalx;                                    //PHASECAL * 256
+	boolean nextIsCurrent;                            //The next sample is the current
+	boolean belowZero;                                //Voltage went negative since the last crossing
+	unsigned int cycles, cycleCount;                  //Mains cycles per report, and so far
+	unsigned long timeoutSamples;                     //Sample pairs to report after without crossings
+	EmonSums sums;                                    //Being accumulated by the interrupt
+	EmonSums report;                                  //Complete, for calcContinuous()
+	volatile boolean reportReady;
+
 
 };
 
+#if defined(__AVR__) && defined(ADATE)
+// The library leaves the ADC interrupt vector to the sketch, so that calcVI()
+// and calcIrms() can be used beside other ADC interrupt code. A sketch that
+// calls startContinuous() puts EMONLIB_CONTINUOUS_ISR on a line of its own,
+// in one of its files.
+#define EMONLIB_CONTINUOUS_ISR \
+  ISR(ADC_vect) { EnergyMonitor::continuousInterrupt(); } \
+  static const boolean emonContinuousIsr = EnergyMonitor::useContinuousInterrupt();
+#endif
+
 #endif
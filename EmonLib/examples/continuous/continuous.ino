@@ -0,0 +1,24 @@
+// EmonLibrary examples openenergymonitor.org, Licence GNU GPL V3
+// Continuous sampling: the ADC interrupt measures every mains cycle while loop() is free
+
+#include "EmonLib.h"             // Include Emon Library
+EnergyMonitor emon1;             // Create an instance
+EMONLIB_CONTINUOUS_ISR           // The ADC interrupt, for startContinuous()
+
+void setup()
+{  
+  Serial.begin(9600);
+  
+  emon1.voltage(2, 234.26, 1.7);  // Voltage: input pin, calibration, phase_shift
+  emon1.current(1, 111.1);       // Current: input pin, calibration.
+  emon1.startContinuous(50,2000); // Report every 50 mains cycles, or 2 s without a voltage
+}
+
+void loop()
+{
+  if (emon1.calcContinuous())    // A new report every 50 cycles, nothing to do otherwise
+  {
+    emon1.serialprint();         // Print out all variables (realpower, apparent power, Vrms, Irms, power factor)
+  }
+  // ... the rest of the sketch runs here, without missing any samples
+}
@@ -0,0 +1,34 @@
+/*
+ * Minimal Arduino core for building EmonLib on the host, with neither
+ * __AVR__ nor __arm__ defined: readVcc() returns 3300 and there is no ADC
+ * interrupt.  analogRead() and millis() are provided by the test, which
+ * serves the synthetic waveforms on the virtual clock simMicros.
+ */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define F_CPU 16000000L
+
+extern unsigned long simMicros;
+inline unsigned long millis() { return simMicros / 1000; }
+inline void delay(unsigned long ms) { simMicros += ms * 1000; }
+int analogRead(uint8_t pin);
+
+struct SimSerial
+{
+  void begin(unsigned long) {}
+  void print(double) {}
+  void print(char) {}
+  void println(char) {}
+};
+extern SimSerial Serial;
+
+#endif
@@ -0,0 +1,290 @@
+/*
+ * Host test and benchmark for the EnergyMonitor continuous sampling mode
+ *
+ * Serves synthetic mains waveforms, sampled as the free-running AVR ADC
+ * would: voltage and current in turn, one conversion every 104 us, with
+ * a dc offset away from mid-scale and a count of noise.  The samples go
+ * through addSample(), as from the ADC interrupt, and through calcVI()
+ * via analogRead().  Checks that:
+ *  - Vrms, Irms, real power and power factor match the waveforms, at
+ *    50 and 60 Hz, leading and lagging, and agree with calcVI();
+ *  - every report is a whole number of mains cycles, at 4808 pairs/s;
+ *  - a late calcContinuous() gets a longer report, not a gap: every
+ *    sample fed is in exactly one report;
+ *  - with no voltage the timeout still gives current reports.
+ * Then prints the host time per sample for addSample() and calcVI().
+ * Exits non-zero on any mismatch.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <chrono>
+#include "EmonLib.h"
+
+unsigned long simMicros;
+SimSerial Serial;
+
+static unsigned int errors;
+
+static void check(bool ok, const char *what, double got, double expected)
+{
+    if (!ok)
+    {
+        printf("  %-28s %10.3f, expected %10.3f\n", what, got, expected);
+        errors++;
+    }
+}
+
+static void checkNear(const char *what, double got, double expected, double tolerance)
+{
+    check(fabs(got - expected) <= tolerance * fabs(expected), what, got, expected);
+}
+
+//------------------------------------------------------------------------------
+// Waveforms
+
+static const double conversionMicros = 1e6 / (F_CPU / 128.0 / 13.0);
+static const double supplyVolts = 3.3;
+static const uint8_t pinV = 2, pinI = 1;
+
+struct Mains
+{
+    double frequency;    // Hz
+    double vrms, irms;   // V and A
+    double phase;        // Current lag, radians
+    double amplitudeV;   // Peak ADC counts
+    double amplitudeI;
+    double offsetV;      // Mid-point ADC counts
+    double offsetI;
+
+    double vcal() const { return vrms / (amplitudeV / sqrt(2) * supplyVolts / ADC_COUNTS); }
+    double ical() const { return irms / (amplitudeI / sqrt(2) * supplyVolts / ADC_COUNTS); }
+    double power() const { return vrms * irms * cos(phase); }
+};
+
+static Mains mains;
+static uint32_t noiseState = 1;
+
+static int adc(double counts)
+{
+    noiseState = noiseState * 1664525 + 1013904223;
+    counts += (int)(noiseState >> 30) - 1.5;          // -1.5 to +1.5 counts
+    int sample = (int)floor(counts + 0.5);
+    return sample < 0 ? 0 : (sample >= ADC_COUNTS ? ADC_COUNTS - 1 : sample);
+}
+
+static int sampleAt(uint8_t pin, double micros)
+{
+    const double w = 2 * M_PI * mains.frequency * micros * 1e-6;
+    if (pin == pinV)
+        return adc(mains.offsetV + mains.amplitudeV * sin(w));
+    return adc(mains.offsetI + mains.amplitudeI * sin(w - mains.phase));
+}
+
+// calcVI()'s analogRead() takes one conversion time, and its maths none
+int analogRead(uint8_t pin)
+{
+    static double micros;
+    if (micros < simMicros)
+        micros = simMicros;
+    int sample = sampleAt(pin, micros);
+    micros += conversionMicros;
+    simMicros = (unsigned long)micros;
+    return sample;
+}
+
+//------------------------------------------------------------------------------
+// Continuous mode, fed a conversion at a time as the interrupt would
+
+struct Run
+{
+    unsigned int reports;
+    unsigned long fed, reported;
+    double vrms, irms, power, pf, pairs;
+};
+
+static Run runContinuous(EnergyMonitor& emon, unsigned int cycles, double seconds,
+                         unsigned long pollPairs, unsigned int skipReports)
+{
+    Run run = Run();
+    emon.startContinuous(cycles, 2000);
+    const unsigned long pairs = (unsigned long)(seconds * 1e6 / conversionMicros / 2);
+    for (unsigned long i = 0; i < pairs; i++)
+    {
+        const double t = 2 * i * conversionMicros;
+        emon.addSample(sampleAt(pinV, t));
+        emon.addSample(sampleAt(pinI, t + conversionMicros));
+        run.fed++;
+        if ((i + 1) % pollPairs == 0 && emon.calcContinuous())
+        {
+            run.reported += emon.numberOfSamples;
+            if (skipReports)
+            {
+                skipReports--;                       // Offset filters settling
+                continue;
+            }
+            run.reports++;
+            run.vrms += emon.Vrms;
+            run.irms += emon.Irms;
+            run.power += emon.realPower;
+            run.pf += emon.powerFactor;
+            run.pairs += emon.numberOfSamples;
+        }
+    }
+    emon.stopContinuous();
+    if (run.reports)
+    {
+        run.vrms /= run.reports;
+        run.irms /= run.reports;
+        run.power /= run.reports;
+        run.pf /= run.reports;
+        run.pairs /= run.reports;
+    }
+    return run;
+}
+
+static EnergyMonitor monitorFor(const Mains& m)
+{
+    EnergyMonitor emon;
+    // V is read half a pair before I: bring it forward by that
+    emon.voltage(pinV, m.vcal(), 1.5);
+    emon.current(pinI, m.ical());
+    return emon;
+}
+
+static void checkMains(const char *name, const Mains& m, double tolerance)
+{
+    mains = m;
+    EnergyMonitor emon = monitorFor(m);
+    const unsigned int cycles = 50;
+    Run run = runContinuous(emon, cycles, 12.0, 1, 3);
+
+    // calcVI() on the same waveforms, after the same settling
+    EnergyMonitor legacy = monitorFor(m);
+    simMicros = 0;
+    for (int i = 0; i < 3; i++)
+        legacy.calcVI(2 * cycles, 2000);
+    double legacyPower = 0, legacyV = 0, legacyI = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        legacy.calcVI(2 * cycles, 2000);
+        legacyPower += legacy.realPower / 5;
+        legacyV += legacy.Vrms / 5;
+        legacyI += legacy.Irms / 5;
+    }
+
+    const double pairsPerCycle = 1e6 / conversionMicros / 2 / m.frequency;
+    printf("%-22s Vrms %7.2f (calcVI %7.2f)  Irms %6.3f (%6.3f)  P %8.1f (%8.1f, exact %8.1f)  pf %6.3f  %u reports of %.0f pairs\n",
+           name, run.vrms, legacyV, run.irms, legacyI, run.power, legacyPower, m.power(), run.pf,
+           run.reports, run.pairs);
+    checkNear("Vrms", run.vrms, m.vrms, tolerance);
+    checkNear("Irms", run.irms, m.irms, tolerance);
+    check(fabs(run.power - m.power()) <= tolerance * m.vrms * m.irms, "real power", run.power, m.power());
+    check(fabs(run.pf - cos(m.phase)) <= tolerance, "power factor", run.pf, cos(m.phase));
+    checkNear("Vrms against calcVI", run.vrms, legacyV, 0.005);
+    checkNear("Irms against calcVI", run.irms, legacyI, 0.01);
+    check(fabs(run.power - legacyPower) <= 0.005 * m.vrms * m.irms, "power against calcVI", run.power, legacyPower);
+    check(fabs(run.pairs - cycles * pairsPerCycle) <= 2, "pairs per report", run.pairs, cycles * pairsPerCycle);
+}
+
+//------------------------------------------------------------------------------
+
+static void checkLatePolling()
+{
+    Mains m = { 50, 240, 10, 0.5, 300, 200, 512, 512 };
+    mains = m;
+    EnergyMonitor emon = monitorFor(m);
+    // Polled every 1.5 s for 10-cycle (0.2 s) reports
+    const unsigned long poll = (unsigned long)(1.5e6 / conversionMicros / 2);
+    Run run = runContinuous(emon, 10, 30.0, poll, 0);
+    const unsigned long pending = run.fed - run.reported;
+    printf("late polling           %u reports of %.0f pairs, %lu of %lu pairs not yet reported\n",
+           run.reports, run.pairs, pending, run.fed);
+    check(run.reports >= 19, "reports", run.reports, 19);
+    check(pending < poll + 1000, "pairs not reported", pending, poll);
+    checkNear("Vrms", run.vrms, m.vrms, 0.005);
+    check(fabs(run.power - m.power()) <= 0.01 * m.vrms * m.irms, "real power", run.power, m.power());
+}
+
+static void checkNoVoltage()
+{
+    Mains m = { 50, 240, 10, 0, 0, 200, 512, 512 };
+    mains = m;
+    EnergyMonitor emon;
+    emon.voltage(pinV, 100, 1.5);
+    emon.current(pinI, m.ical());
+    Run run = runContinuous(emon, 50, 10.0, 1, 1);
+    printf("no voltage             Irms %6.3f  %u reports of %.0f pairs (2 s timeout)\n",
+           run.irms, run.reports, run.pairs);
+    checkNear("Irms", run.irms, m.irms, 0.005);
+    checkNear("timeout pairs", run.pairs, 2 * 1e6 / conversionMicros / 2, 0.001);
+}
+
+//------------------------------------------------------------------------------
+// Host time per sample
+
+typedef std::chrono::steady_clock Clock;
+
+static double seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void bench()
+{
+    Mains m = { 50, 240, 10, 0.5, 300, 200, 512, 512 };
+    mains = m;
+    const unsigned long pairs = 1000000;
+    static int samples[2 * 9616];
+    for (int i = 0; i < 2 * 9616; i++)
+        samples[i] = sampleAt(i & 1 ? pinI : pinV, i * conversionMicros);
+
+    EnergyMonitor emon = monitorFor(m);
+    emon.startContinuous(50, 2000);
+    Clock::time_point start = Clock::now();
+    for (unsigned long i = 0; i < pairs; i++)
+    {
+        const int k = 2 * (i % 9616);
+        emon.addSample(samples[k]);
+        emon.addSample(samples[k + 1]);
+        emon.calcContinuous();
+    }
+    const double continuous = seconds(start);
+    emon.stopContinuous();
+
+    // calcVI() includes serving analogRead() from the waveform
+    EnergyMonitor legacy = monitorFor(m);
+    unsigned long legacyPairs = 0;
+    start = Clock::now();
+    while (legacyPairs < pairs / 10)
+    {
+        legacy.calcVI(100, 2000);
+        legacyPairs += 4808;
+    }
+    const double legacyTime = seconds(start);
+
+    printf("host addSample() %5.1f ns/sample, %5.1f M samples/s   calcVI() %5.1f ns/sample (with the waveform)\n",
+           continuous * 1e9 / (2 * pairs), 2 * pairs / continuous / 1e6,
+           legacyTime * 1e9 / (2 * legacyPairs));
+}
+
+int main()
+{
+    const double lag = acos(0.8);
+    Mains cases[] =
+    {
+        { 50, 240, 10, 0, 300, 200, 500, 520 },
+        { 50, 240, 10, lag, 300, 200, 500, 520 },
+        { 50, 230, 5, -lag, 300, 100, 530, 490 },
+        { 60, 120, 15, lag, 250, 300, 512, 512 },
+        { 50, 240, 10, M_PI, 300, 200, 512, 512 },
+    };
+    const char *names[] = { "50 Hz pf 1", "50 Hz pf 0.8 lagging", "50 Hz pf 0.8 leading",
+                            "60 Hz pf 0.8 lagging", "50 Hz exporting" };
+    for (unsigned int i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+        checkMains(names[i], cases[i], 0.005);
+    checkLatePolling();
+    checkNoVoltage();
+    printf("checks: %s\n", errors ? "MISMATCH" : "ok");
+    bench();
+    return errors ? 1 : 0;
+}
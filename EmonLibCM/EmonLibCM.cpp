@@ -36,7 +36,7 @@ float datalog_period_in_seconds = 1.0;
 int min_startup_cycles = 10;
 
 // Maximum number of channels used to create arrays
-static const int max_no_of_channels = 5;
+static const int max_no_of_channels = EMONLIBCM_MAX_CHANNELS;
 
 // User set number of channels used by for loops
 int no_of_channels = 4;
@@ -44,7 +44,8 @@ int no_of_channels = 4;
 // for general interaction between the main code and the ISR
 volatile boolean datalogEventPending;
 volatile boolean newMainsCycle = false; // provides a 50 Hz 'tick'
-unsigned long lastCycle = 0;     // provides a timeout mechamism
+unsigned long sampleSetsSinceLastCycle;   // provides a timeout mechanism
+unsigned long maxSampleSetsWithoutCycle;  // without a voltage, reports come after this many
 
 int realPower_CT[max_no_of_channels];
 double Irms_CT[max_no_of_channels];
@@ -55,7 +56,7 @@ int EmonLibCM_Vrms;
     
 // analogue ports
 static const byte voltageSensor = 0;                // <-- used as an input
-static const byte ADC_Sequence[] = {0,1,2,3,4,5};   // <-- used as an input
+static const byte ADC_Sequence[] = {0,1,2,3,4,5,6,7};   // <-- used as an input
 
 // Calibration values
 //-------------------
@@ -127,8 +128,11 @@ long DCoffset_V_long;                   // <--- for LPF
 long DCoffsetV_min;                     // <--- for LPF
 long DCoffsetV_max;                     // <--- for LPF
 long cumV_deltasThisCycle_long;         // for the LPF which determines DC offset (voltage)
-static long lastSampleV_minusDC_long;          // for the phaseCal algorithm
+static int sampleV16, lastSampleV16, deltaV16;  // for the phaseCal algorithm, V x16 (2^4)
 int phaseCal_int_CT[max_no_of_channels];    // to avoid the need for floating-point maths
+static byte DCoffsetShift;                  // LP filter gain, for the sample sets per cycle
+static byte sample_index;                   // 0 for the voltage, then each CT
+static byte ADMUX_nextButOne[max_no_of_channels+1];  // by sample_index, built by EmonLibCM_Start()
 int datalogPeriodInMainsCycles;
 
 // accumulators & counters for use by the ISR
@@ -158,6 +162,16 @@ enum polarities polarityConfirmedOfLastSampleV;  // for zero-crossing detection
 float powerCal_CT[max_no_of_channels];
 float residualEnergy_CT[max_no_of_channels];
 
+// The ISR timing diagnostic reads a clock that the ISR itself can't disturb
+#if !defined(EMONLIBCM_ISR_CLOCK) && defined(__AVR__)
+#define EMONLIBCM_ISR_CLOCK() TCNT0           // Timer0 counts system clock / 64 for millis()
+#define EMONLIBCM_ISR_CLOCK_TYPE uint8_t
+#define EMONLIBCM_ISR_CLOCK_CYCLES 64
+#endif
+#ifdef EMONLIBCM_ISR_CLOCK
+volatile EMONLIBCM_ISR_CLOCK_TYPE ISRmaxTicks;
+#endif
+
 void EmonLibCM_number_of_channels(int _no_of_channels)
 {
     no_of_channels = _no_of_channels;
@@ -210,13 +224,29 @@ int EmonLibCM_getWattHour(int channel)
     return wh_CT[channel];
 }
 
+unsigned long EmonLibCM_getISRmaxCycles()
+{
+#ifdef EMONLIBCM_ISR_CLOCK
+    return (unsigned long)ISRmaxTicks * EMONLIBCM_ISR_CLOCK_CYCLES;
+#else
+    return 0;
+#endif
+}
+
 
 
 void EmonLibCM_Init()
 {   
+    // Interpolating between voltage samples one sample set apart changes the amplitude
+    // as well as the phase, by a factor that depends only on phaseCal.  Take it out of
+    // powerCal here rather than in the ISR.
+    double setAngle = 2 * PI * cycles_per_second * (no_of_channels + 1) / (double)EMONLIBCM_ADC_RATE;
+    
     for (int i=0; i<no_of_channels; i++) 
     {
-        powerCal_CT[i] = voltageCal * currentCal[i];
+        double p = phaseCal_CT[i];
+        double interpolationGain = sqrt(1 - 2 * p * (1 - p) * (1 - cos(setAngle)));
+        powerCal_CT[i] = voltageCal * currentCal[i] / interpolationGain;
     
         residualEnergy_CT[i] = 0;
         
@@ -233,16 +263,37 @@ void EmonLibCM_Init()
     DCoffsetV_min = (long)(512L - 100) * 256; // mid-point of ADC minus a working margin
     DCoffsetV_max = (long)(512L + 100) * 256; // mid-point of ADC minus a working margin
 
-    EmonLibCM_Start();
-    
+#ifdef EMONLIBCM_ISR_CLOCK
+    ISRmaxTicks = 0;
+#endif
     datalogPeriodInMainsCycles = datalog_period_in_seconds * cycles_per_second;  
     datalogEventPending = false;
+
+    EmonLibCM_Start();
 }
 
 void EmonLibCM_Start()
 {
     firstcycle = true;
-    lastCycle = millis();
+
+    // Everything that depends only on the number of channels is worked out here,
+    // so that the ISR doesn't have to.
+    long sampleSetsPerSecond = EMONLIBCM_ADC_RATE / (no_of_channels + 1);
+    sampleSetsSinceLastCycle = 0;
+    maxSampleSetsWithoutCycle = (datalogPeriodInMainsCycles + 1) * sampleSetsPerSecond / cycles_per_second;
+
+    // The LP filter adds up the offsets of a whole cycle: divide by at least as many
+    DCoffsetShift = 6;
+    while ((1L << DCoffsetShift) < sampleSetsPerSecond / cycles_per_second) DCoffsetShift++;
+
+    // In free-running mode the channel is set two conversions ahead
+    for (int i=0; i<=no_of_channels; i++) {
+        int next = i + 2;
+        if (next > no_of_channels) next -= no_of_channels + 1;
+        ADMUX_nextButOne[i] = 0x40 + ADC_Sequence[next];
+    }
+    sample_index = 0;
+    ADMUX = 0x40 + ADC_Sequence[0];
     
     // Set up the ADC to be free-running 
     // 
@@ -265,7 +316,11 @@ void EmonLibCM_Start()
     // The following sets ADCSRA to a value of 239
     //         1     1     1     0     1     1      1      1
      
+#if EMONLIBCM_ADC_PRESCALER == 64
+    ADCSRA  = (1<<ADPS1)+(1<<ADPS2);             // Set the ADC's clock to system clock / 64
+#else
     ADCSRA  = (1<<ADPS0)+(1<<ADPS1)+(1<<ADPS2);  // Set the ADC's clock to system clock / 128
+#endif
     ADCSRA |= (1 << ADEN);                       // Enable the ADC 
 
     ADCSRA |= (1<<ADATE);  // set the Auto Trigger Enable bit in the ADCSRA register.  Because 
@@ -373,7 +428,7 @@ void EmonLibCM_allGeneralProcessing_withinISR()
          * counters are then reset for use during the next period.
          */       
         cycleCountForDatalogging ++;
-        lastCycle = millis();
+        sampleSetsSinceLastCycle = 0;
         
         // Used in stop start opperation, discards the first partial cycle
         if (cycleCountForDatalogging >= min_startup_cycles && firstcycle==true)
@@ -427,7 +482,7 @@ void EmonLibCM_allGeneralProcessing_withinISR()
       // one on each voltage channel.  This needs to be done right from the start.
       long previousOffset;       
       previousOffset = DCoffset_V_long; // for voltage source V
-      DCoffset_V_long = previousOffset + (cumV_deltasThisCycle_long>>6); // faster than * 0.01
+      DCoffset_V_long = previousOffset + (cumV_deltasThisCycle_long>>DCoffsetShift); // faster than * 0.01
       cumV_deltasThisCycle_long = 0;
       
       // To ensure that each of these LP filters will always start up correctly when 240V AC is 
@@ -446,14 +501,12 @@ void EmonLibCM_allGeneralProcessing_withinISR()
     } // end of processing that is specific to the first Vsample in each -ve half cycle
   } // end of processing that is specific to samples where the voltage is positive
   
-  // In the case where the voltage signal is missing this part counts the missing cycles
+  // In the case where the voltage signal is missing this part counts the sample sets
   // up to the duration of the datalog period at which point it will make the rms current      
   // readings available for CT only mode.
   
-  unsigned long missing_cycles = (millis() - lastCycle) / (1000 / cycles_per_second);
-  
-  if (missing_cycles > datalogPeriodInMainsCycles) {
-    lastCycle = millis(); // reset the lastCycle count here.
+  if (++sampleSetsSinceLastCycle > maxSampleSetsWithoutCycle) {
+    sampleSetsSinceLastCycle = 0; // reset the count here.
     firstcycle = true;    // firstcycle reset to true so that next reading
                           // with voltage signal starts from the right place
                           
@@ -482,6 +535,29 @@ void EmonLibCM_allGeneralProcessing_withinISR()
 }
 // end of allGeneralProcessing()
 
+// The work for one current sample.  It is inlined with a constant channel number,
+// once for each channel, so that every array access is to a fixed address.  All
+// values are x16 (2^4), which keeps them within 16 bits and their products within
+// 32, for the AVR's 16 x 16 bit multiplies.
+static inline void EmonLibCM_currentSample(const byte ch, int rawSample) __attribute__((always_inline));
+static inline void EmonLibCM_currentSample(const byte ch, int rawSample)
+{
+  if (rawSample>10) {
+    // remove most of the DC offset from the current sample (the precise value does not matter)
+    int sampleI16 = (rawSample - DCoffset_I)<<4;
+
+    // phase-shift the voltage waveform so that it aligns with the current
+    int phaseShiftedV16 = lastSampleV16 + (int)(((long)deltaV16*phaseCal_int_CT[ch])>>8);
+
+    // calculate the "real power" in this sample pair and add to the accumulated sum,
+    // rounded to a scaling of x1, as for Mk2 (V_ADC x I_ADC)
+    sumP_CT[ch] += ((long)phaseShiftedV16*sampleI16 + 128)>>8;
+    sumI_CT[ch] += ((long)sampleI16*sampleI16 + 128)>>8;
+  }
+}
+
+#define EMONLIBCM_CT_CASE(ch) case (ch)+1: EmonLibCM_currentSample((ch), rawSample); break;
+
 // This Interrupt Service Routine is for use when the ADC is in the free-running mode.
 // It is executed whenever an ADC conversion has finished, approx every 104 us.  In 
 // free-running mode, the ADC has already started its next conversion by the time that
@@ -494,29 +570,20 @@ void EmonLibCM_allGeneralProcessing_withinISR()
 // the helper function, allGeneralProcessing_withinISR().
 //   A second helper function, confirmPolarity() is used to apply a persistence criterion
 // when the polarity status of each voltage sample is checked. 
+//   The voltage difference used by the phaseCal algorithm is worked out once per sample
+// set, with the voltage sample, for all of the current channels.
 // 
 void EmonLibCM_interrupt()  
 {                                         
-  static unsigned char sample_index = 0;
-  unsigned char next = 0;
-  static  long sampleV_minusDC_long;
+  static long sampleV_minusDC_long;
   int rawSample;
-  long filtV_div4;
-  long filtI_div4;
-  long instP;
-  long inst_Vsquared;
-  long inst_Isquared;
-  long sampleIminusDC_long;
-  long phaseShiftedSampleV_minusDC_long;
   
   rawSample = ADC;
+  ADMUX = ADMUX_nextButOne[sample_index]; // set up the next-but-one conversion
   
-  next = sample_index + 2;
-  if (next>=no_of_channels+1) next -= no_of_channels+1;
-  ADMUX = 0x40 + ADC_Sequence[next]; // set up the next-but-one conversion
-  
-  if (sample_index==0)
+  switch (sample_index)
   {
+  case 0:
       // remove DC offset from the raw voltage sample by subtracting the accurate value 
       // as determined by a LP filter.
       sampleV_minusDC_long = ((long)rawSample<<8) - DCoffset_V_long;
@@ -534,42 +601,37 @@ void EmonLibCM_interrupt()
       sampleSetsDuringThisMainsCycle++; 
       samplesDuringThisDatalogPeriod++;      
       //
+      // for the phaseCal algorithm: this voltage sample and the last one
+      lastSampleV16 = sampleV16;
+      sampleV16 = sampleV_minusDC_long>>4;   // reduce to 16-bits (now x16, or 2^4)
+      deltaV16 = sampleV16 - lastSampleV16;
+      //
       // for the Vrms calculation 
-      filtV_div4 = sampleV_minusDC_long>>2;  // reduce to 16-bits (now x64, or 2^6)
-      inst_Vsquared = filtV_div4 * filtV_div4; // 32-bits (now x4096, or 2^12)
-      inst_Vsquared = inst_Vsquared>>12;     // scaling is now x1 (V_ADC x I_ADC)
-      sum_Vsquared += inst_Vsquared; // cumulative V^2 (V_ADC x I_ADC)
+      sum_Vsquared += ((long)sampleV16*sampleV16 + 128)>>8; // cumulative V^2 (V_ADC x I_ADC)
       //
       // store items for later use
       cumV_deltasThisCycle_long += sampleV_minusDC_long; // for use with LP filter
-      lastSampleV_minusDC_long = sampleV_minusDC_long;  // required for phaseCal algorithm  
       polarityConfirmedOfLastSampleV = polarityConfirmed;  // for identification of half cycle boundaries
-  }
-  
-  if (sample_index>=1 && sample_index <= no_of_channels)
-  {
-      if (rawSample>10) {
-      // remove most of the DC offset from the current sample (the precise value does not matter)
-      sampleIminusDC_long = ((long)(rawSample - DCoffset_I))<<8;
-      
-      // phase-shift the voltage waveform so that it aligns with the current 
-      //phaseShiftedSampleV_minusDC_long = sampleV_minusDC_long;
-      phaseShiftedSampleV_minusDC_long = lastSampleV_minusDC_long
-         + (((sampleV_minusDC_long - lastSampleV_minusDC_long)*phaseCal_int_CT[sample_index-1])>>8);  
-      
-      // calculate the "real power" in this sample pair and add to the accumulated sum
-      filtV_div4 = phaseShiftedSampleV_minusDC_long>>2;  // reduce to 16-bits (now x64, or 2^6)
-      filtI_div4 = sampleIminusDC_long>>2; // reduce to 16-bits (now x64, or 2^6)
-      instP = filtV_div4 * filtI_div4;  // 32-bits (now x4096, or 2^12)
-      instP = instP>>12;     // scaling is now x1, as for Mk2 (V_ADC x I_ADC)  
-      
-      inst_Isquared = filtI_div4 * filtI_div4;
-      inst_Isquared = inst_Isquared>>12;
-      sumI_CT[sample_index-1] += inst_Isquared;
-      
-      // if (sample_CT4==0) instP_CT4 = 0;  
-      sumP_CT[sample_index-1] +=instP; // cumulative power, scaling as for Mk2 (V_ADC x I_ADC)
-      }
+      break;
+  EMONLIBCM_CT_CASE(0)
+#if EMONLIBCM_MAX_CHANNELS > 1
+  EMONLIBCM_CT_CASE(1)
+#endif
+#if EMONLIBCM_MAX_CHANNELS > 2
+  EMONLIBCM_CT_CASE(2)
+#endif
+#if EMONLIBCM_MAX_CHANNELS > 3
+  EMONLIBCM_CT_CASE(3)
+#endif
+#if EMONLIBCM_MAX_CHANNELS > 4
+  EMONLIBCM_CT_CASE(4)
+#endif
+#if EMONLIBCM_MAX_CHANNELS > 5
+  EMONLIBCM_CT_CASE(5)
+#endif
+#if EMONLIBCM_MAX_CHANNELS > 6
+  EMONLIBCM_CT_CASE(6)
+#endif
   }
   
   sample_index++; // advance the control flag
@@ -577,5 +639,14 @@ void EmonLibCM_interrupt()
 }
 
 ISR(ADC_vect) {
+#ifdef EMONLIBCM_ISR_CLOCK
+    // Times EmonLibCM_interrupt() only: the compiler's prologue and epilogue 
+    // around this run outside the two reads
+    EMONLIBCM_ISR_CLOCK_TYPE start = EMONLIBCM_ISR_CLOCK();
     EmonLibCM_interrupt();
+    EMONLIBCM_ISR_CLOCK_TYPE ticks = (EMONLIBCM_ISR_CLOCK_TYPE)(EMONLIBCM_ISR_CLOCK() - start);
+    if (ticks > ISRmaxTicks) ISRmaxTicks = ticks;
+#else
+    EmonLibCM_interrupt();
+#endif
 }
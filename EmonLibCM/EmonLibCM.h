@@ -30,6 +30,32 @@
 
 #endif
 
+// The two settings below are edited here, not defined in the sketch: the
+// Arduino IDE compiles EmonLibCM.cpp on its own, so it would not see them.
+
+// Current channels the arrays are sized for, 1 to 7. The ADC sequence has
+// inputs for up to 7, which the ATmega328P has only in its TQFP and QFN
+// packages.
+#ifdef EMONLIBCM_MAX_CHANNELS
+#error EMONLIBCM_MAX_CHANNELS is set in EmonLibCM.h, not in the sketch.
+#endif
+#define EMONLIBCM_MAX_CHANNELS 5
+#if EMONLIBCM_MAX_CHANNELS < 1 || EMONLIBCM_MAX_CHANNELS > 7
+#error EMONLIBCM_MAX_CHANNELS must be 1 to 7.
+#endif
+
+// The ADC clock is the system clock divided by this, 64 or 128, and a
+// conversion takes 13 ADC clocks: 9615 samples per second at 16 MHz. 64
+// doubles the sample rate, for more channels, at some cost in ADC accuracy.
+#ifdef EMONLIBCM_ADC_PRESCALER
+#error EMONLIBCM_ADC_PRESCALER is set in EmonLibCM.h, not in the sketch.
+#endif
+#define EMONLIBCM_ADC_PRESCALER 128
+#if EMONLIBCM_ADC_PRESCALER != 64 && EMONLIBCM_ADC_PRESCALER != 128
+#error EMONLIBCM_ADC_PRESCALER must be 64 or 128.
+#endif
+#define EMONLIBCM_ADC_RATE (F_CPU / EMONLIBCM_ADC_PRESCALER / 13)
+
 void EmonLibCM_number_of_channels(int _no_of_channels);
 void EmonLibCM_cycles_per_second(int _cycles_per_second);
 void EmonLibCM_min_startup_cycles(int _min_startup_cycles);
@@ -50,6 +76,12 @@ void EmonLibCM_Stop();
 
 bool EmonLibCM_Ready();
 
+// Diagnostic: a lower bound on the longest ADC interrupt since EmonLibCM_Init(),
+// in CPU cycles. Only the body of the handler is timed, so the interrupt entry
+// and exit (register saves and restores, RETI) are left out, and it is read
+// from Timer0, so on an AVR it is in steps of 64 cycles.
+unsigned long EmonLibCM_getISRmaxCycles();
+
 // for general interaction between the main code and the ISR
 extern volatile boolean datalogEventPending;
 
@@ -0,0 +1,52 @@
+/*
+ * Minimal Arduino core for building EmonLibCM on the host.  The ADC
+ * registers are plain variables: the harness puts each conversion result
+ * in ADC, reads the channel from ADMUX and calls the ADC_vect handler as
+ * the free-running ADC would.  The ISR timing diagnostic reads a Timer0
+ * stand-in that the harness steps, so only its logic is checked.
+ */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define F_CPU 16000000L
+#define PI 3.1415926535897932384626433832795
+
+inline void sei() {}
+inline void cli() {}
+
+extern volatile uint16_t ADC;
+extern volatile uint8_t ADMUX, ADCSRA, ADCSRB;
+#define ADPS0 0
+#define ADPS1 1
+#define ADPS2 2
+#define ADIE  3
+#define ADIF  4
+#define ADATE 5
+#define ADSC  6
+#define ADEN  7
+
+#define ISR(vector) void vector()
+
+// Timer0 as the ISR timing diagnostic reads it on an AVR, 8 bits counting
+// system clock / 64.  Each read moves it on by TCNT0step, the length in
+// counts the harness wants the next interrupt to appear to take.
+extern uint8_t TCNT0, TCNT0step;
+inline uint8_t readTCNT0()
+{
+    uint8_t count = TCNT0;
+    TCNT0 += TCNT0step;
+    return count;
+}
+#define EMONLIBCM_ISR_CLOCK() readTCNT0()
+#define EMONLIBCM_ISR_CLOCK_TYPE uint8_t
+#define EMONLIBCM_ISR_CLOCK_CYCLES 64
+
+#endif
@@ -0,0 +1,230 @@
+/*
+ * Host harness for the EmonLibCM ADC interrupt
+ *
+ * Drives ADC_vect with synthetic mains waveforms on every channel, as the
+ * free-running ADC would: one conversion every 13 ADC clocks, on the
+ * channel that ADMUX held when the conversion before it finished.  The
+ * voltage has a dc offset for the LP filter to find; each CT has its own
+ * current and power factor, from 0.5 leading to exporting, and the
+ * phaseCal that lines the voltage up with it.  Every sample has up to
+ * 1.5 counts of noise.
+ *
+ * For 1 to EMONLIBCM_MAX_CHANNELS channels at the ADC rate set by
+ * EMONLIBCM_ADC_PRESCALER, it checks Vrms, Irms and real power on every
+ * channel against the waveforms, and prints the sample sets per mains
+ * cycle, the worst error and the host time per sample.  The maximum
+ * channel count at that rate is the most channels that are all within 1%.
+ * Then it checks the current-only reports with no voltage, and the logic
+ * of EmonLibCM_getISRmaxCycles() against a stepped Timer0.  Host times say
+ * nothing about the ISR's length on an AVR, and the diagnostic has not
+ * been measured on one.
+ * Exits non-zero if the 4 channel set up of the emonTx or a check fails.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "EmonLibCM.h"
+
+volatile uint16_t ADC;
+volatile uint8_t ADMUX, ADCSRA, ADCSRB;
+uint8_t TCNT0, TCNT0step;
+void ADC_vect();
+
+static unsigned int errors;
+
+//------------------------------------------------------------------------------
+// Waveforms
+
+static const double conversionMicros = 1e6 / EMONLIBCM_ADC_RATE;
+static const double tolerance = 0.01;
+
+struct Load
+{
+    double amplitude;   // Peak ADC counts
+    double phase;       // Current lag, radians
+};
+
+static const Load loads[] =
+{
+    { 150, 0 },
+    { 250, 0.6435 },    // pf 0.8 lagging
+    { 80, -0.6435 },    // pf 0.8 leading
+    { 400, 1.0472 },    // pf 0.5 lagging
+    { 200, M_PI },      // exporting
+    { 300, 0.4510 },    // pf 0.9 lagging
+    { 120, -1.0472 },   // pf 0.5 leading
+};
+
+static const double frequency = 50;
+static const double amplitudeV = 300, offsetV = 520;
+static const double voltsPerCount = 240 / (amplitudeV / sqrt(2));
+static const double ampsPerCount = 0.1 / sqrt(2);
+static bool voltagePresent;
+static uint32_t noiseState = 1;
+
+static int adc(double counts)
+{
+    noiseState = noiseState * 1664525 + 1013904223;
+    counts += (int)(noiseState >> 30) - 1.5;          // -1.5 to +1.5 counts
+    int sample = (int)floor(counts + 0.5);
+    return sample < 0 ? 0 : (sample > 1023 ? 1023 : sample);
+}
+
+static int sampleAt(uint8_t pin, double micros)
+{
+    const double w = 2 * M_PI * frequency * micros * 1e-6;
+    if (pin == 0)
+        return adc(offsetV + (voltagePresent ? amplitudeV * sin(w) : 0));
+    const Load& load = loads[pin - 1];
+    return adc(512 + load.amplitude * sin(w - load.phase));
+}
+
+//------------------------------------------------------------------------------
+
+typedef std::chrono::steady_clock Clock;
+
+struct Result
+{
+    double nsPerSample;  // Host time for the ISR and EmonLibCM_Ready()
+    double worstError;   // Of real power as a fraction of the apparent power, Irms and Vrms
+    double setsPerCycle;
+    unsigned int reports;
+    bool ACAC;
+};
+
+static Result run(int channels, double seconds, double settleSeconds)
+{
+    EmonLibCM_number_of_channels(channels);
+    EmonLibCM_cycles_per_second(frequency);
+    EmonLibCM_datalog_period(1.0);
+    EmonLibCM_min_startup_cycles(10);
+    EmonLibCM_voltageCal(voltsPerCount);
+    for (int i = 0; i < channels; i++)
+    {
+        EmonLibCM_currentCal(i, ampsPerCount);
+        // CT i is sampled i+1 conversions after the voltage, and the voltage
+        // before that one conversions+1 earlier still
+        EmonLibCM_phaseCal(i, 1.0 + (i + 1.0) / (channels + 1));
+    }
+    EmonLibCM_Init();
+
+    // Every input at every conversion, so that only the ISR is timed
+    const unsigned long conversions = (unsigned long)(seconds * EMONLIBCM_ADC_RATE);
+    const unsigned long settle = (unsigned long)(settleSeconds * EMONLIBCM_ADC_RATE);
+    std::vector<uint16_t> samples(conversions * 8);
+    for (unsigned long k = 0; k < conversions; k++)
+        for (int pin = 0; pin <= channels; pin++)
+            samples[k * 8 + pin] = sampleAt(pin, k * conversionMicros);
+
+    Result result = Result();
+    double sumV = 0;
+    double sumP[EMONLIBCM_MAX_CHANNELS] = { 0 }, sumI[EMONLIBCM_MAX_CHANNELS] = { 0 };
+    uint8_t channel = ADMUX & 0x07;
+    Clock::time_point start = Clock::now();
+    for (unsigned long k = 0; k < conversions; k++)
+    {
+        ADC = samples[k * 8 + channel];
+        channel = ADMUX & 0x07;            // The next conversion has started
+        ADC_vect();
+        if (EmonLibCM_Ready() && k > settle)
+        {
+            result.reports++;
+            result.ACAC = EmonLibCM_ACAC;
+            sumV += EmonLibCM_Vrms;
+            for (int i = 0; i < channels; i++)
+            {
+                sumP[i] += EmonLibCM_getRealPower(i);
+                sumI[i] += EmonLibCM_getIrms(i);
+            }
+        }
+    }
+    result.nsPerSample = std::chrono::duration<double>(Clock::now() - start).count() * 1e9 / conversions;
+    if (!result.reports)
+    {
+        result.worstError = 1;
+        return result;
+    }
+
+    // With no voltage, Vrms is whatever the LP filter has left of the dc offset
+    const double vrms = voltagePresent ? 240 : 0;
+    if (voltagePresent)
+        result.worstError = fabs(sumV / result.reports - vrms) / vrms;
+    for (int i = 0; i < channels; i++)
+    {
+        const double irms = loads[i].amplitude / sqrt(2) * ampsPerCount;
+        const double power = vrms * irms * cos(loads[i].phase);
+        const double errorP = fabs(sumP[i] / result.reports - power) / (240 * irms);
+        const double errorI = fabs(sumI[i] / result.reports - irms) / irms;
+        if (errorP > result.worstError)
+            result.worstError = errorP;
+        if (errorI > result.worstError)
+            result.worstError = errorI;
+    }
+    result.setsPerCycle = EMONLIBCM_ADC_RATE / (channels + 1.0) / frequency;
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+// The longest of a few interrupts, one of them across the Timer0 wrap,
+// and cleared again by EmonLibCM_Init().
+static void checkISRmax()
+{
+    static const uint8_t counts[] = { 7, 3, 2, 5 };
+    EmonLibCM_Init();
+    TCNT0 = 251;
+    for (unsigned i = 0; i < sizeof(counts); i++)
+    {
+        TCNT0step = counts[i];
+        ADC = 512;
+        ADC_vect();
+    }
+    TCNT0step = 0;
+    const unsigned long cycles = EmonLibCM_getISRmaxCycles();
+    EmonLibCM_Init();
+    const unsigned long cleared = EmonLibCM_getISRmaxCycles();
+    printf("ISR max: %lu cycles for 7 Timer0 counts, %lu after EmonLibCM_Init()\n", cycles, cleared);
+    printf("  EmonLibCM_getISRmaxCycles() is checked for logic only, not measured on an AVR\n");
+    if (cycles != 7 * 64 || cleared != 0)
+        errors++;
+}
+
+int main()
+{
+    printf("ADC at %ld samples/s (system clock / %d)\n", (long)EMONLIBCM_ADC_RATE, EMONLIBCM_ADC_PRESCALER);
+    printf("channels  sets/cycle  worst error  ns/sample (host)\n");
+    int maxChannels = 0;
+    voltagePresent = true;
+    for (int channels = 1; channels <= EMONLIBCM_MAX_CHANNELS; channels++)
+    {
+        // The host is sometimes interrupted itself: the best of three runs
+        Result result = run(channels, 10, 6);
+        for (int i = 0; i < 2; i++)
+        {
+            Result again = run(channels, 10, 6);
+            if (again.nsPerSample < result.nsPerSample)
+                result.nsPerSample = again.nsPerSample;
+        }
+        const bool ok = result.worstError <= tolerance;
+        printf("%8d  %10.1f  %10.2f%%  %16.1f%s\n", channels, result.setsPerCycle,
+               result.worstError * 100, result.nsPerSample, ok ? "" : "  over 1%");
+        if (ok && maxChannels == channels - 1)
+            maxChannels = channels;
+        if (channels == 4 && EMONLIBCM_ADC_PRESCALER == 128 && !ok)
+            errors++;
+    }
+    printf("max channels within 1%% at %ld samples/s: %d\n", (long)EMONLIBCM_ADC_RATE, maxChannels);
+
+    // No voltage: current-only reports once per datalog period
+    voltagePresent = false;
+    Result result = run(4, 10, 3);
+    printf("no voltage: %u reports in 7 s, worst Irms error %.2f%%, ACAC %s\n",
+           result.reports, result.worstError * 100, result.ACAC ? "true" : "false");
+    if (result.reports < 5 || result.reports > 7 || result.worstError > tolerance || result.ACAC)
+        errors++;
+
+    checkISRmax();
+    printf("checks: %s\n", errors ? "MISMATCH" : "ok");
+    return errors ? 1 : 0;
+}
@@ -22,57 +22,31 @@
 
 // Provides ISR
 #include <avr/interrupt.h>
+#include <avr/pgmspace.h>
 
 volatile irparams_t irparams;
 
-// These versions of MATCH, MATCH_MARK, and MATCH_SPACE are only for debugging.
-// To use them, set DEBUG in IRremoteInt.h
-// Normally macros are used for efficiency
+// Tests a measured interval against a window from the protocol table.
+// This version of MATCH_RANGE is only for debugging.
+// To use it, set DEBUG in IRremote.h
+// Normally a macro is used for efficiency
 #ifdef DEBUG
-int MATCH(int measured, int desired) {
+static int MATCH_RANGE(unsigned int measured, const irrange_t &range) {
   Serial.print("Testing: ");
-  Serial.print(TICKS_LOW(desired), DEC);
+  Serial.print(range.low, DEC);
   Serial.print(" <= ");
   Serial.print(measured, DEC);
   Serial.print(" <= ");
-  Serial.println(TICKS_HIGH(desired), DEC);
-  return measured >= TICKS_LOW(desired) && measured <= TICKS_HIGH(desired);
-}
-
-int MATCH_MARK(int measured_ticks, int desired_us) {
-  Serial.print("Testing mark ");
-  Serial.print(measured_ticks * USECPERTICK, DEC);
-  Serial.print(" vs ");
-  Serial.print(desired_us, DEC);
-  Serial.print(": ");
-  Serial.print(TICKS_LOW(desired_us + MARK_EXCESS), DEC);
-  Serial.print(" <= ");
-  Serial.print(measured_ticks, DEC);
-  Serial.print(" <= ");
-  Serial.println(TICKS_HIGH(desired_us + MARK_EXCESS), DEC);
-  return measured_ticks >= TICKS_LOW(desired_us + MARK_EXCESS) && measured_ticks <= TICKS_HIGH(desired_us + MARK_EXCESS);
-}
-
-int MATCH_SPACE(int measured_ticks, int desired_us) {
-  Serial.print("Testing space ");
-  Serial.print(measured_ticks * USECPERTICK, DEC);
-  Serial.print(" vs ");
-  Serial.print(desired_us, DEC);
-  Serial.print(": ");
-  Serial.print(TICKS_LOW(desired_us - MARK_EXCESS), DEC);
-  Serial.print(" <= ");
-  Serial.print(measured_ticks, DEC);
-  Serial.print(" <= ");
-  Serial.println(TICKS_HIGH(desired_us - MARK_EXCESS), DEC);
-  return measured_ticks >= TICKS_LOW(desired_us - MARK_EXCESS) && measured_ticks <= TICKS_HIGH(desired_us - MARK_EXCESS);
+  Serial.println(range.high, DEC);
+  return measured >= range.low && measured <= range.high;
 }
 #else
-int MATCH(int measured, int desired) {return measured >= TICKS_LOW(desired) && measured <= TICKS_HIGH(desired);}
-int MATCH_MARK(int measured_ticks, int desired_us) {return MATCH(measured_ticks, (desired_us + MARK_EXCESS));}
-int MATCH_SPACE(int measured_ticks, int desired_us) {return MATCH(measured_ticks, (desired_us - MARK_EXCESS));}
-// Debugging versions are in IRremote.cpp
+#define MATCH_RANGE(measured, range) ((measured) >= (range).low && (measured) <= (range).high)
 #endif
 
+// The same test with the window as its low end and width, one compare
+#define IN_SPAN(measured, low, span) ((unsigned int)((measured) - (low)) <= (unsigned int)(span))
+
 void IRsend::sendNEC(unsigned long data, int nbits)
 {
   enableIROut(38);
@@ -409,6 +383,200 @@ void IRrecv::resume() {
 
 
 
+// Manchester windows for getRClevel(): a mark one, two and three half
+// bits long, then a space one, two and three half bits long.
+#define RC_WINDOWS(t1) { MARK_RANGE(t1), MARK_RANGE(2 * (t1)), MARK_RANGE(3 * (t1)), \
+  SPACE_RANGE(t1), SPACE_RANGE(2 * (t1)), SPACE_RANGE(3 * (t1)) }
+static const irrange_t rc5Windows[6] PROGMEM = RC_WINDOWS(RC5_T1);
+static const irrange_t rc6Windows[6] PROGMEM = RC_WINDOWS(RC6_T1);
+
+// Protocols tried by decode(), one row each, in irprotocolRow order.
+// decode() only tries the rows whose header mark window may hold the first
+// mark, through irhdrBuckets below, and the rows with a repeat frame that
+// has no header mark.  Where windows overlap (Sony and Sanyo gap repeats,
+// the Mitsubishi header and JVC repeats) rows are tried in table order,
+// the order the per protocol decoders always ran in.  A protocol built
+// from mark/space pairs needs a row here, a row number and a term in
+// IR_HDR_BUCKET.
+enum irprotocolRow {
+  NEC_ROW, SONY_ROW, SANYO_ROW, MITSUBISHI_ROW, RC5_ROW,
+  RC6_ROW, PANASONIC_ROW, LG_ROW, JVC_ROW, SAMSUNG_ROW,
+  IR_PROTOCOL_COUNT // at most 16, decode() keeps the rows in a mask
+};
+static const irprotocol_t irprotocols[IR_PROTOCOL_COUNT] PROGMEM = {
+  { NEC, IR_HDR_MARK | IR_HDR_SPACE | IR_REPEAT_SHORT | IR_PULSE_DISTANCE,
+    NEC_BITS, 2 * NEC_BITS + 4,
+    MARK_RANGE(NEC_HDR_MARK), SPACE_RANGE(NEC_HDR_SPACE), MARK_RANGE(NEC_BIT_MARK),
+    SPACE_RANGE(NEC_ONE_SPACE), SPACE_RANGE(NEC_ZERO_SPACE), SPACE_RANGE(NEC_RPT_SPACE),
+    0, 0, NULL },
+  // Some Sony's deliver repeats fast after first, unfortunately can't spot
+  // difference from of repeat from two fast clicks.  The gap is in ticks.
+  { SONY, IR_HDR_MARK | IR_VARIABLE_LENGTH | IR_REPEAT_GAP,
+    SONY_BITS, 2 * SONY_BITS + 2,
+    MARK_RANGE(SONY_HDR_MARK), NO_RANGE, SPACE_RANGE(SONY_HDR_SPACE),
+    MARK_RANGE(SONY_ONE_MARK), MARK_RANGE(SONY_ZERO_MARK), NO_RANGE,
+    SONY_DOUBLE_SPACE_USECS, SANYO, NULL },
+  // I think this is a Sanyo decoder - serial = SA 8650B
+  // Looks like Sony except for timings, the header space is matched as a
+  // second mark.
+  { SANYO, IR_HDR_MARK | IR_HDR_SPACE | IR_VARIABLE_LENGTH | IR_REPEAT_GAP,
+    SANYO_BITS, 2 * SANYO_BITS + 2,
+    MARK_RANGE(SANYO_HDR_MARK), MARK_RANGE(SANYO_HDR_MARK), SPACE_RANGE(SANYO_HDR_SPACE),
+    MARK_RANGE(SANYO_ONE_MARK), MARK_RANGE(SANYO_ZERO_MARK), NO_RANGE,
+    SANYO_DOUBLE_SPACE_USECS, SANYO, NULL },
+  // Typical
+  // 14200 7 41 7 42 7 42 7 17 7 17 7 18 7 41 7 18 7 17 7 17 7 18 7 41 8 17 7 17 7 18 7 17 7
+  { MITSUBISHI, IR_HDR_MARK | IR_VARIABLE_LENGTH | IR_DATA_FIRST,
+    MITSUBISHI_BITS, 2 * MITSUBISHI_BITS + 2,
+    MARK_RANGE(MITSUBISHI_HDR_SPACE), NO_RANGE, SPACE_RANGE(MITSUBISHI_HDR_SPACE),
+    MARK_RANGE(MITSUBISHI_ONE_MARK), MARK_RANGE(MITSUBISHI_ZERO_MARK), NO_RANGE,
+    0, 0, NULL },
+  // No header, hdrMark only spans the first mark's one to three half bits
+  { RC5, IR_MANCHESTER,
+    0, MIN_RC5_SAMPLES + 2,
+    { TICKS_LOW(RC5_T1 + MARK_EXCESS), TICKS_HIGH(3 * RC5_T1 + MARK_EXCESS) }, NO_RANGE, NO_RANGE,
+    NO_RANGE, NO_RANGE, NO_RANGE,
+    0, 0, rc5Windows },
+  { RC6, IR_HDR_MARK | IR_HDR_SPACE | IR_MANCHESTER | IR_MARK_FIRST | IR_TRAILER_BIT,
+    0, MIN_RC6_SAMPLES,
+    MARK_RANGE(RC6_HDR_MARK), SPACE_RANGE(RC6_HDR_SPACE), NO_RANGE,
+    NO_RANGE, NO_RANGE, NO_RANGE,
+    0, 0, rc6Windows },
+  // The header space has always been matched as a mark
+  { PANASONIC, IR_HDR_MARK | IR_HDR_SPACE | IR_PULSE_DISTANCE,
+    PANASONIC_BITS, 2 * PANASONIC_BITS + 2,
+    MARK_RANGE(PANASONIC_HDR_MARK), MARK_RANGE(PANASONIC_HDR_SPACE), MARK_RANGE(PANASONIC_BIT_MARK),
+    SPACE_RANGE(PANASONIC_ONE_SPACE), SPACE_RANGE(PANASONIC_ZERO_SPACE), NO_RANGE,
+    0, 0, NULL },
+  { LG, IR_HDR_MARK | IR_HDR_SPACE | IR_STOP_MARK | IR_PULSE_DISTANCE,
+    LG_BITS, 2 * LG_BITS + 1,
+    MARK_RANGE(LG_HDR_MARK), SPACE_RANGE(LG_HDR_SPACE), MARK_RANGE(LG_BIT_MARK),
+    SPACE_RANGE(LG_ONE_SPACE), SPACE_RANGE(LG_ZERO_SPACE), NO_RANGE,
+    0, 0, NULL },
+  { JVC, IR_HDR_MARK | IR_HDR_SPACE | IR_STOP_MARK | IR_REPEAT_HEADERLESS,
+    JVC_BITS, 2 * JVC_BITS + 1,
+    MARK_RANGE(JVC_HDR_MARK), SPACE_RANGE(JVC_HDR_SPACE), MARK_RANGE(JVC_BIT_MARK),
+    SPACE_RANGE(JVC_ONE_SPACE), SPACE_RANGE(JVC_ZERO_SPACE), NO_RANGE,
+    0, 0, NULL },
+  { SAMSUNG, IR_HDR_MARK | IR_HDR_SPACE | IR_REPEAT_SHORT | IR_PULSE_DISTANCE,
+    SAMSUNG_BITS, 2 * SAMSUNG_BITS + 4,
+    MARK_RANGE(SAMSUNG_HDR_MARK), SPACE_RANGE(SAMSUNG_HDR_SPACE), MARK_RANGE(SAMSUNG_BIT_MARK),
+    SPACE_RANGE(SAMSUNG_ONE_SPACE), SPACE_RANGE(SAMSUNG_ZERO_SPACE), SPACE_RANGE(SAMSUNG_RPT_SPACE),
+    0, 0, NULL },
+};
+
+// Rows to try by the first mark, in buckets of 16 ticks.  A row is in
+// every bucket its hdrMark window reaches into, so decode() still checks
+// the window.
+#define IR_HDR_BUCKET_SHIFT 4
+#define IR_HDR_BUCKETS 16 // hdrMark windows end below 256 ticks
+#define IR_HDR_ROW(b, row, lowUs, highUs) \
+  (TICKS_LOW((lowUs) + MARK_EXCESS) < ((b) + 1) << IR_HDR_BUCKET_SHIFT && \
+  TICKS_HIGH((highUs) + MARK_EXCESS) >= (b) << IR_HDR_BUCKET_SHIFT ? 1 << (row) : 0)
+#define IR_HDR_BUCKET(b) ( \
+  IR_HDR_ROW(b, NEC_ROW, NEC_HDR_MARK, NEC_HDR_MARK) | \
+  IR_HDR_ROW(b, SONY_ROW, SONY_HDR_MARK, SONY_HDR_MARK) | \
+  IR_HDR_ROW(b, SANYO_ROW, SANYO_HDR_MARK, SANYO_HDR_MARK) | \
+  IR_HDR_ROW(b, MITSUBISHI_ROW, MITSUBISHI_HDR_SPACE, MITSUBISHI_HDR_SPACE) | \
+  IR_HDR_ROW(b, RC5_ROW, RC5_T1, 3 * RC5_T1) | \
+  IR_HDR_ROW(b, RC6_ROW, RC6_HDR_MARK, RC6_HDR_MARK) | \
+  IR_HDR_ROW(b, PANASONIC_ROW, PANASONIC_HDR_MARK, PANASONIC_HDR_MARK) | \
+  IR_HDR_ROW(b, LG_ROW, LG_HDR_MARK, LG_HDR_MARK) | \
+  IR_HDR_ROW(b, JVC_ROW, JVC_HDR_MARK, JVC_HDR_MARK) | \
+  IR_HDR_ROW(b, SAMSUNG_ROW, SAMSUNG_HDR_MARK, SAMSUNG_HDR_MARK))
+static const uint16_t irhdrBuckets[IR_HDR_BUCKETS] PROGMEM = {
+  IR_HDR_BUCKET(0), IR_HDR_BUCKET(1), IR_HDR_BUCKET(2), IR_HDR_BUCKET(3),
+  IR_HDR_BUCKET(4), IR_HDR_BUCKET(5), IR_HDR_BUCKET(6), IR_HDR_BUCKET(7),
+  IR_HDR_BUCKET(8), IR_HDR_BUCKET(9), IR_HDR_BUCKET(10), IR_HDR_BUCKET(11),
+  IR_HDR_BUCKET(12), IR_HDR_BUCKET(13), IR_HDR_BUCKET(14), IR_HDR_BUCKET(15),
+};
+
+// One bit for decodePulseDistance(): the mark, then the space shifted into
+// data as a one or a zero.  Returns ERR on a mark or space outside its
+// window.
+#define PULSE_DISTANCE_BIT(mark, space) do { \
+    if (!IN_SPAN(mark, markLow, markSpan)) { \
+      return ERR; \
+    } \
+    if (IN_SPAN(space, oneLow, oneSpan)) { \
+      data = (data << 1) | 1; \
+    } \
+    else if (IN_SPAN(space, zeroLow, zeroSpan)) { \
+      data <<= 1; \
+    } \
+    else { \
+      return ERR; \
+    } \
+  } while (0)
+
+// Decodes results against an IR_PULSE_DISTANCE row (NEC, Panasonic, LG,
+// Samsung), read from flash: a header mark and space, an optional short
+// repeat, then a fixed number of mark/space bits.  The windows are loaded
+// once, no flags are tested per bit and the bits are read four a pass, so
+// a row's bit count, and its count past 32 when over 32, must be a
+// multiple of 4.  decode() has matched the header mark.
+static long decodePulseDistance(decode_results *results, const irprotocol_t *row) {
+  const unsigned int *rawbuf = (const unsigned int *)results->rawbuf;
+  int rawlen = results->rawlen;
+  unsigned int flags = pgm_read_word(&row->flags);
+  // Each window as its low end and width, for one unsigned compare
+  unsigned int markLow = pgm_read_byte(&row->mark.low);
+  unsigned int markSpan = pgm_read_byte(&row->mark.high) - markLow;
+
+  if ((flags & IR_REPEAT_SHORT) && rawlen == 4) {
+    unsigned int repeatLow = pgm_read_byte(&row->repeat.low);
+    if (IN_SPAN(rawbuf[2], repeatLow, pgm_read_byte(&row->repeat.high) - repeatLow) &&
+      IN_SPAN(rawbuf[3], markLow, markSpan)) {
+      results->bits = 0;
+      results->value = REPEAT;
+      results->decode_type = pgm_read_byte(&row->type);
+      return DECODED;
+    }
+  }
+  unsigned int hdrSpaceLow = pgm_read_byte(&row->hdrSpace.low);
+  if (rawlen < pgm_read_byte(&row->minRawlen) ||
+    !IN_SPAN(rawbuf[2], hdrSpaceLow, pgm_read_byte(&row->hdrSpace.high) - hdrSpaceLow)) {
+    return ERR;
+  }
+  unsigned int oneLow = pgm_read_byte(&row->one.low);
+  unsigned int oneSpan = pgm_read_byte(&row->one.high) - oneLow;
+  unsigned int zeroLow = pgm_read_byte(&row->zero.low);
+  unsigned int zeroSpan = pgm_read_byte(&row->zero.high) - zeroLow;
+  uint8_t bits = pgm_read_byte(&row->bits);
+  const unsigned int *p = rawbuf + 3;
+  const unsigned int *end = p + 2 * bits;
+  // A frame over 32 bits long is read in two runs, the bits ahead of the
+  // last 32 first, kept in high as panasonicAddress
+  const unsigned int *run = bits > 32 ? end - 2 * 32 : end;
+  unsigned int high = 0;
+  unsigned long data = 0;
+  for (;;) {
+    do {
+      PULSE_DISTANCE_BIT(p[0], p[1]);
+      PULSE_DISTANCE_BIT(p[2], p[3]);
+      PULSE_DISTANCE_BIT(p[4], p[5]);
+      PULSE_DISTANCE_BIT(p[6], p[7]);
+    } while ((p += 8) != run);
+    if (run == end) {
+      break;
+    }
+    high = data;
+    run = end;
+  }
+  //Stop bit
+  if ((flags & IR_STOP_MARK) && !IN_SPAN(p[0], markLow, markSpan)) {
+    return ERR;
+  }
+  // Success
+  if (bits > 32) {
+    results->panasonicAddress = high;
+  }
+  results->bits = bits;
+  results->value = data;
+  results->decode_type = pgm_read_byte(&row->type);
+  return DECODED;
+}
+
 // Decodes the received IR message
 // Returns 0 if no data ready, 1 if data ready.
 // Results of decoding are stored in results
@@ -418,69 +586,49 @@ int IRrecv::decode(decode_results *results) {
   if (irparams.rcvstate != STATE_STOP) {
     return ERR;
   }
-#ifdef DEBUG
-  Serial.println("Attempting NEC decode");
-#endif
-  if (decodeNEC(results)) {
-    return DECODED;
-  }
-#ifdef DEBUG
-  Serial.println("Attempting Sony decode");
-#endif
-  if (decodeSony(results)) {
-    return DECODED;
-  }
-#ifdef DEBUG
-  Serial.println("Attempting Sanyo decode");
-#endif
-  if (decodeSanyo(results)) {
-    return DECODED;
-  }
-#ifdef DEBUG
-  Serial.println("Attempting Mitsubishi decode");
-#endif
-  if (decodeMitsubishi(results)) {
-    return DECODED;
-  }
-#ifdef DEBUG
-  Serial.println("Attempting RC5 decode");
-#endif  
-  if (decodeRC5(results)) {
-    return DECODED;
-  }
-#ifdef DEBUG
-  Serial.println("Attempting RC6 decode");
-#endif 
-  if (decodeRC6(results)) {
-    return DECODED;
-  }
-#ifdef DEBUG
-    Serial.println("Attempting Panasonic decode");
-#endif 
-    if (decodePanasonic(results)) {
-        return DECODED;
+  // Collect the rows to try as a mask, so they are tried in table order.
+  // A bucket row whose window misses the first mark is passed over on one
+  // compare, without copying it out of flash.
+  unsigned int hdrMark = results->rawbuf[1];
+  unsigned int bucket = hdrMark >> IR_HDR_BUCKET_SHIFT;
+  uint16_t rows = bucket < IR_HDR_BUCKETS ? pgm_read_word(&irhdrBuckets[bucket]) : 0;
+  // JVC repeats have no header, Sony and Sanyo repeats are told by the gap
+  uint16_t repeats = 1 << JVC_ROW;
+  unsigned int gap = results->rawbuf[0];
+  if (gap < pgm_read_word(&irprotocols[SONY_ROW].repeatGap)) {
+    repeats |= 1 << SONY_ROW;
+  }
+  if (gap < pgm_read_word(&irprotocols[SANYO_ROW].repeatGap)) {
+    repeats |= 1 << SANYO_ROW;
+  }
+  rows |= repeats;
+  irprotocol_t protocol;
+  for (const irprotocol_t *row = irprotocols; rows; row++, rows >>= 1, repeats >>= 1) {
+    if (!(rows & 1)) {
+      continue;
+    }
+    if (!(repeats & 1) &&
+      (hdrMark < pgm_read_byte(&row->hdrMark.low) ||
+      hdrMark > pgm_read_byte(&row->hdrMark.high))) {
+      continue;
     }
 #ifdef DEBUG
-    Serial.println("Attempting LG decode");
-#endif 
-    if (decodeLG(results)) {
+    Serial.print("Attempting decode of type ");
+    Serial.println((int8_t)pgm_read_byte(&row->type), DEC);
+#endif
+    if (pgm_read_word(&row->flags) & IR_PULSE_DISTANCE) {
+      if (decodePulseDistance(results, row)) {
         return DECODED;
+      }
+      continue;
     }
-#ifdef DEBUG
-    Serial.println("Attempting JVC decode");
-#endif 
-    if (decodeJVC(results)) {
-        return DECODED;
+    memcpy_P(&protocol, row, sizeof(protocol));
+    if (decodeProtocol(results, &protocol)) {
+      return DECODED;
     }
-#ifdef DEBUG
-  Serial.println("Attempting SAMSUNG decode");
-#endif
-  if (decodeSAMSUNG(results)) {
-    return DECODED;
   }
   // decodeHash returns a hash on any input.
   // Thus, it needs to be last in the list.
-  // If you add any decodes, add them before this.
   if (decodeHash(results)) {
     return DECODED;
   }
@@ -489,260 +637,153 @@ int IRrecv::decode(decode_results *results) {
   return ERR;
 }
 
-// NECs have a repeat only 4 items long
-long IRrecv::decodeNEC(decode_results *results) {
-  long data = 0;
-  int offset = 1; // Skip first space
-  // Initial mark
-  if (!MATCH_MARK(results->rawbuf[offset], NEC_HDR_MARK)) {
-    return ERR;
-  }
-  offset++;
-  // Check for repeat
-  if (irparams.rawlen == 4 &&
-    MATCH_SPACE(results->rawbuf[offset], NEC_RPT_SPACE) &&
-    MATCH_MARK(results->rawbuf[offset+1], NEC_BIT_MARK)) {
+// Decodes results against one row of the protocol table.
+// rawbuf[0] is the gap, the header starts at rawbuf[1].
+long IRrecv::decodeProtocol(decode_results *results, const irprotocol_t *protocol) {
+  // The interrupt handler leaves rawbuf alone until resume()
+  const unsigned int *rawbuf = (const unsigned int *)results->rawbuf;
+  int rawlen = results->rawlen;
+  unsigned int flags = protocol->flags;
+
+  if ((flags & IR_REPEAT_GAP) && rawlen >= protocol->minRawlen &&
+    rawbuf[0] < protocol->repeatGap) {
     results->bits = 0;
     results->value = REPEAT;
-    results->decode_type = NEC;
+    results->decode_type = protocol->repeatType;
     return DECODED;
   }
-  if (irparams.rawlen < 2 * NEC_BITS + 4) {
-    return ERR;
-  }
-  // Initial space  
-  if (!MATCH_SPACE(results->rawbuf[offset], NEC_HDR_SPACE)) {
-    return ERR;
-  }
-  offset++;
-  for (int i = 0; i < NEC_BITS; i++) {
-    if (!MATCH_MARK(results->rawbuf[offset], NEC_BIT_MARK)) {
-      return ERR;
-    }
-    offset++;
-    if (MATCH_SPACE(results->rawbuf[offset], NEC_ONE_SPACE)) {
-      data = (data << 1) | 1;
-    } 
-    else if (MATCH_SPACE(results->rawbuf[offset], NEC_ZERO_SPACE)) {
-      data <<= 1;
-    } 
-    else {
-      return ERR;
-    }
-    offset++;
-  }
-  // Success
-  results->bits = NEC_BITS;
-  results->value = data;
-  results->decode_type = NEC;
-  return DECODED;
-}
-
-long IRrecv::decodeSony(decode_results *results) {
-  long data = 0;
-  if (irparams.rawlen < 2 * SONY_BITS + 2) {
-    return ERR;
-  }
-  int offset = 0; // Dont skip first space, check its size
-
-  // Some Sony's deliver repeats fast after first
-  // unfortunately can't spot difference from of repeat from two fast clicks
-  if (results->rawbuf[offset] < SONY_DOUBLE_SPACE_USECS) {
-    // Serial.print("IR Gap found: ");
+  if ((flags & IR_REPEAT_HEADERLESS) && rawlen == 2 * protocol->bits + 2 &&
+    MATCH_RANGE(rawbuf[1], protocol->mark) &&
+    MATCH_RANGE(rawbuf[rawlen - 1], protocol->mark)) {
     results->bits = 0;
     results->value = REPEAT;
-    results->decode_type = SANYO;
+    results->decode_type = protocol->type;
     return DECODED;
   }
-  offset++;
-
-  // Initial mark
-  if (!MATCH_MARK(results->rawbuf[offset], SONY_HDR_MARK)) {
-    return ERR;
-  }
-  offset++;
-
-  while (offset + 1 < irparams.rawlen) {
-    if (!MATCH_SPACE(results->rawbuf[offset], SONY_HDR_SPACE)) {
-      break;
-    }
-    offset++;
-    if (MATCH_MARK(results->rawbuf[offset], SONY_ONE_MARK)) {
-      data = (data << 1) | 1;
-    } 
-    else if (MATCH_MARK(results->rawbuf[offset], SONY_ZERO_MARK)) {
-      data <<= 1;
-    } 
-    else {
+  int offset = 1; // Skip first space
+  if (flags & IR_HDR_MARK) {
+    if (!MATCH_RANGE(rawbuf[offset], protocol->hdrMark)) {
       return ERR;
     }
     offset++;
   }
-
-  // Success
-  results->bits = (offset - 1) / 2;
-  if (results->bits < 12) {
-    results->bits = 0;
-    return ERR;
-  }
-  results->value = data;
-  results->decode_type = SONY;
-  return DECODED;
-}
-
-// I think this is a Sanyo decoder - serial = SA 8650B
-// Looks like Sony except for timings, 48 chars of data and time/space different
-long IRrecv::decodeSanyo(decode_results *results) {
-  long data = 0;
-  if (irparams.rawlen < 2 * SANYO_BITS + 2) {
-    return ERR;
-  }
-  int offset = 0; // Skip first space
-  // Initial space  
-  /* Put this back in for debugging - note can't use #DEBUG as if Debug on we don't see the repeat cos of the delay
-  Serial.print("IR Gap: ");
-  Serial.println( results->rawbuf[offset]);
-  Serial.println( "test against:");
-  Serial.println(results->rawbuf[offset]);
-  */
-  if (results->rawbuf[offset] < SANYO_DOUBLE_SPACE_USECS) {
-    // Serial.print("IR Gap found: ");
+  if ((flags & IR_REPEAT_SHORT) && rawlen == 4 &&
+    MATCH_RANGE(rawbuf[offset], protocol->repeat) &&
+    MATCH_RANGE(rawbuf[offset + 1], protocol->mark)) {
     results->bits = 0;
     results->value = REPEAT;
-    results->decode_type = SANYO;
+    results->decode_type = protocol->type;
     return DECODED;
   }
-  offset++;
-
-  // Initial mark
-  if (!MATCH_MARK(results->rawbuf[offset], SANYO_HDR_MARK)) {
-    return ERR;
-  }
-  offset++;
-
-  // Skip Second Mark
-  if (!MATCH_MARK(results->rawbuf[offset], SANYO_HDR_MARK)) {
+  if (rawlen < protocol->minRawlen) {
     return ERR;
   }
-  offset++;
-
-  while (offset + 1 < irparams.rawlen) {
-    if (!MATCH_SPACE(results->rawbuf[offset], SANYO_HDR_SPACE)) {
-      break;
-    }
-    offset++;
-    if (MATCH_MARK(results->rawbuf[offset], SANYO_ONE_MARK)) {
-      data = (data << 1) | 1;
-    } 
-    else if (MATCH_MARK(results->rawbuf[offset], SANYO_ZERO_MARK)) {
-      data <<= 1;
-    } 
-    else {
+  if (flags & IR_HDR_SPACE) {
+    if (!MATCH_RANGE(rawbuf[offset], protocol->hdrSpace)) {
       return ERR;
     }
     offset++;
   }
-
-  // Success
-  results->bits = (offset - 1) / 2;
-  if (results->bits < 12) {
-    results->bits = 0;
-    return ERR;
+  if (flags & IR_MANCHESTER) {
+    return decodeRC(results, protocol, offset);
   }
-  results->value = data;
-  results->decode_type = SANYO;
-  return DECODED;
-}
 
-// Looks like Sony except for timings, 48 chars of data and time/space different
-long IRrecv::decodeMitsubishi(decode_results *results) {
-  // Serial.print("?!? decoding Mitsubishi:");Serial.print(irparams.rawlen); Serial.print(" want "); Serial.println( 2 * MITSUBISHI_BITS + 2);
-  long data = 0;
-  if (irparams.rawlen < 2 * MITSUBISHI_BITS + 2) {
-    return ERR;
-  }
-  int offset = 0; // Skip first space
-  // Initial space  
-  /* Put this back in for debugging - note can't use #DEBUG as if Debug on we don't see the repeat cos of the delay
-  Serial.print("IR Gap: ");
-  Serial.println( results->rawbuf[offset]);
-  Serial.println( "test against:");
-  Serial.println(results->rawbuf[offset]);
-  */
-  /* Not seeing double keys from Mitsubishi
-  if (results->rawbuf[offset] < MITSUBISHI_DOUBLE_SPACE_USECS) {
-    // Serial.print("IR Gap found: ");
-    results->bits = 0;
-    results->value = REPEAT;
-    results->decode_type = MITSUBISHI;
-    return DECODED;
-  }
-  */
-  offset++;
-
-  // Typical
-  // 14200 7 41 7 42 7 42 7 17 7 17 7 18 7 41 7 18 7 17 7 17 7 18 7 41 8 17 7 17 7 18 7 17 7 
-
-  // Initial Space
-  if (!MATCH_MARK(results->rawbuf[offset], MITSUBISHI_HDR_SPACE)) {
-    return ERR;
-  }
-  offset++;
-  while (offset + 1 < irparams.rawlen) {
-    if (MATCH_MARK(results->rawbuf[offset], MITSUBISHI_ONE_MARK)) {
-      data = (data << 1) | 1;
-    } 
-    else if (MATCH_MARK(results->rawbuf[offset], MITSUBISHI_ZERO_MARK)) {
-      data <<= 1;
-    } 
-    else {
-      // Serial.println("A"); Serial.println(offset); Serial.println(results->rawbuf[offset]);
+  unsigned long data = 0;
+  unsigned int high = 0; // bits shifted out of the top of data
+  int nbits;
+  if (flags & IR_VARIABLE_LENGTH) {
+    while (offset + 1 < rawlen) {
+      if (!(flags & IR_DATA_FIRST)) {
+        if (!MATCH_RANGE(rawbuf[offset], protocol->mark)) {
+          break;
+        }
+        offset++;
+      }
+      high = (high << 1) | ((unsigned int)(data >> 31) & 1);
+      if (MATCH_RANGE(rawbuf[offset], protocol->one)) {
+        data = (data << 1) | 1;
+      } 
+      else if (MATCH_RANGE(rawbuf[offset], protocol->zero)) {
+        data <<= 1;
+      } 
+      else {
+        return ERR;
+      }
+      offset++;
+      if (flags & IR_DATA_FIRST) {
+        if (!MATCH_RANGE(rawbuf[offset], protocol->mark)) {
+          break;
+        }
+        offset++;
+      }
+    }
+    // Counted as the Sony, Sanyo and Mitsubishi decoders always have
+    nbits = (offset - 1) / 2;
+    if (nbits < protocol->bits) {
+      results->bits = 0;
       return ERR;
     }
-    offset++;
-    if (!MATCH_SPACE(results->rawbuf[offset], MITSUBISHI_HDR_SPACE)) {
-      // Serial.println("B"); Serial.println(offset); Serial.println(results->rawbuf[offset]);
-      break;
+  } 
+  else {
+    for (nbits = 0; nbits < protocol->bits; nbits++) {
+      if (!MATCH_RANGE(rawbuf[offset], protocol->mark)) {
+        return ERR;
+      }
+      offset++;
+      high = (high << 1) | ((unsigned int)(data >> 31) & 1);
+      if (MATCH_RANGE(rawbuf[offset], protocol->one)) {
+        data = (data << 1) | 1;
+      } 
+      else if (MATCH_RANGE(rawbuf[offset], protocol->zero)) {
+        data <<= 1;
+      } 
+      else {
+        return ERR;
+      }
+      offset++;
+    }
+    //Stop bit
+    if ((flags & IR_STOP_MARK) && !MATCH_RANGE(rawbuf[offset], protocol->mark)) {
+      return ERR;
     }
-    offset++;
   }
-
   // Success
-  results->bits = (offset - 1) / 2;
-  if (results->bits < MITSUBISHI_BITS) {
-    results->bits = 0;
-    return ERR;
+  if (protocol->bits > 32) {
+    results->panasonicAddress = high;
   }
+  results->bits = nbits;
   results->value = data;
-  results->decode_type = MITSUBISHI;
+  results->decode_type = protocol->type;
   return DECODED;
 }
 
-
 // Gets one undecoded level at a time from the raw buffer.
 // The RC5/6 decoding is easier if the data is broken into time intervals.
 // E.g. if the buffer has MARK for 2 time intervals and SPACE for 1,
 // successive calls to getRClevel will return MARK, MARK, SPACE.
 // offset and used are updated to keep track of the current position.
-// t1 is the time interval for a single bit in microseconds.
+// windows holds the tick windows of a mark one, two and three half bits
+// long, followed by those of a space.
 // Returns -1 for error (measured time interval is not a multiple of t1).
-int IRrecv::getRClevel(decode_results *results, int *offset, int *used, int t1) {
+int IRrecv::getRClevel(decode_results *results, int *offset, int *used, const irrange_t *windows) {
   if (*offset >= results->rawlen) {
     // After end of recorded buffer, assume SPACE.
     return SPACE;
   }
-  int width = results->rawbuf[*offset];
+  unsigned int width = results->rawbuf[*offset];
   int val = ((*offset) % 2) ? MARK : SPACE;
-  int correction = (val == MARK) ? MARK_EXCESS : - MARK_EXCESS;
+  if (val == SPACE) {
+    windows += 3;
+  }
 
   int avail;
-  if (MATCH(width, t1 + correction)) {
+  if (MATCH_RANGE(width, windows[0])) {
     avail = 1;
   } 
-  else if (MATCH(width, 2*t1 + correction)) {
+  else if (MATCH_RANGE(width, windows[1])) {
     avail = 2;
   } 
-  else if (MATCH(width, 3*t1 + correction)) {
+  else if (MATCH_RANGE(width, windows[2])) {
     avail = 3;
   } 
   else {
@@ -765,78 +806,41 @@ int IRrecv::getRClevel(decode_results *results, int *offset, int *used, int t1)
   return val;   
 }
 
-long IRrecv::decodeRC5(decode_results *results) {
-  if (irparams.rawlen < MIN_RC5_SAMPLES + 2) {
-    return ERR;
-  }
-  int offset = 1; // Skip gap space
+// Decodes the Manchester bits of RC5 and RC6 starting at rawbuf[offset].
+// An RC5 one is SPACE then MARK, an RC6 one is MARK then SPACE.
+long IRrecv::decodeRC(decode_results *results, const irprotocol_t *protocol, int offset) {
+  irrange_t windows[6];
+  memcpy_P(windows, protocol->windows, sizeof(windows));
+  int one = (protocol->flags & IR_MARK_FIRST) ? MARK : SPACE;
+  int zero = !one;
+  unsigned int trailer = protocol->flags & IR_TRAILER_BIT;
   long data = 0;
   int used = 0;
-  // Get start bits
-  if (getRClevel(results, &offset, &used, RC5_T1) != MARK) return ERR;
-  if (getRClevel(results, &offset, &used, RC5_T1) != SPACE) return ERR;
-  if (getRClevel(results, &offset, &used, RC5_T1) != MARK) return ERR;
-  int nbits;
-  for (nbits = 0; offset < irparams.rawlen; nbits++) {
-    int levelA = getRClevel(results, &offset, &used, RC5_T1); 
-    int levelB = getRClevel(results, &offset, &used, RC5_T1);
-    if (levelA == SPACE && levelB == MARK) {
-      // 1 bit
-      data = (data << 1) | 1;
-    } 
-    else if (levelA == MARK && levelB == SPACE) {
-      // zero bit
-      data <<= 1;
-    } 
-    else {
-      return ERR;
-    } 
+  if (one == SPACE) {
+    // No header, the space of the first start bit is lost in the gap
+    if (getRClevel(results, &offset, &used, windows) != MARK) return ERR;
   }
-
-  // Success
-  results->bits = nbits;
-  results->value = data;
-  results->decode_type = RC5;
-  return DECODED;
-}
-
-long IRrecv::decodeRC6(decode_results *results) {
-  if (results->rawlen < MIN_RC6_SAMPLES) {
-    return ERR;
-  }
-  int offset = 1; // Skip first space
-  // Initial mark
-  if (!MATCH_MARK(results->rawbuf[offset], RC6_HDR_MARK)) {
-    return ERR;
-  }
-  offset++;
-  if (!MATCH_SPACE(results->rawbuf[offset], RC6_HDR_SPACE)) {
-    return ERR;
-  }
-  offset++;
-  long data = 0;
-  int used = 0;
   // Get start bit (1)
-  if (getRClevel(results, &offset, &used, RC6_T1) != MARK) return ERR;
-  if (getRClevel(results, &offset, &used, RC6_T1) != SPACE) return ERR;
+  if (getRClevel(results, &offset, &used, windows) != one) return ERR;
+  if (getRClevel(results, &offset, &used, windows) != zero) return ERR;
   int nbits;
   for (nbits = 0; offset < results->rawlen; nbits++) {
     int levelA, levelB; // Next two levels
-    levelA = getRClevel(results, &offset, &used, RC6_T1); 
-    if (nbits == 3) {
+    levelA = getRClevel(results, &offset, &used, windows); 
+    if (trailer && nbits == 3) {
       // T bit is double wide; make sure second half matches
-      if (levelA != getRClevel(results, &offset, &used, RC6_T1)) return ERR;
+      if (levelA != getRClevel(results, &offset, &used, windows)) return ERR;
     } 
-    levelB = getRClevel(results, &offset, &used, RC6_T1);
-    if (nbits == 3) {
+    levelB = getRClevel(results, &offset, &used, windows);
+    if (trailer && nbits == 3) {
       // T bit is double wide; make sure second half matches
-      if (levelB != getRClevel(results, &offset, &used, RC6_T1)) return ERR;
+      if (levelB != getRClevel(results, &offset, &used, windows)) return ERR;
     } 
-    if (levelA == MARK && levelB == SPACE) { // reversed compared to RC5
+    if (levelA == one && levelB == zero) {
       // 1 bit
       data = (data << 1) | 1;
     } 
-    else if (levelA == SPACE && levelB == MARK) {
+    else if (levelA == zero && levelB == one) {
       // zero bit
       data <<= 1;
     } 
@@ -847,186 +851,7 @@ long IRrecv::decodeRC6(decode_results *results) {
   // Success
   results->bits = nbits;
   results->value = data;
-  results->decode_type = RC6;
-  return DECODED;
-}
-long IRrecv::decodePanasonic(decode_results *results) {
-    unsigned long long data = 0;
-    int offset = 1;
-    
-    if (!MATCH_MARK(results->rawbuf[offset], PANASONIC_HDR_MARK)) {
-        return ERR;
-    }
-    offset++;
-    if (!MATCH_MARK(results->rawbuf[offset], PANASONIC_HDR_SPACE)) {
-        return ERR;
-    }
-    offset++;
-    
-    // decode address
-    for (int i = 0; i < PANASONIC_BITS; i++) {
-        if (!MATCH_MARK(results->rawbuf[offset++], PANASONIC_BIT_MARK)) {
-            return ERR;
-        }
-        if (MATCH_SPACE(results->rawbuf[offset],PANASONIC_ONE_SPACE)) {
-            data = (data << 1) | 1;
-        } else if (MATCH_SPACE(results->rawbuf[offset],PANASONIC_ZERO_SPACE)) {
-            data <<= 1;
-        } else {
-            return ERR;
-        }
-        offset++;
-    }
-    results->value = (unsigned long)data;
-    results->panasonicAddress = (unsigned int)(data >> 32);
-    results->decode_type = PANASONIC;
-    results->bits = PANASONIC_BITS;
-    return DECODED;
-}
-
-long IRrecv::decodeLG(decode_results *results) {
-    long data = 0;
-    int offset = 1; // Skip first space
-  
-    // Initial mark
-    if (!MATCH_MARK(results->rawbuf[offset], LG_HDR_MARK)) {
-        return ERR;
-    }
-    offset++; 
-    if (irparams.rawlen < 2 * LG_BITS + 1 ) {
-        return ERR;
-    }
-    // Initial space 
-    if (!MATCH_SPACE(results->rawbuf[offset], LG_HDR_SPACE)) {
-        return ERR;
-    }
-    offset++;
-    for (int i = 0; i < LG_BITS; i++) {
-        if (!MATCH_MARK(results->rawbuf[offset], LG_BIT_MARK)) {
-            return ERR;
-        }
-        offset++;
-        if (MATCH_SPACE(results->rawbuf[offset], LG_ONE_SPACE)) {
-            data = (data << 1) | 1;
-        } 
-        else if (MATCH_SPACE(results->rawbuf[offset], LG_ZERO_SPACE)) {
-            data <<= 1;
-        } 
-        else {
-            return ERR;
-        }
-        offset++;
-    }
-    //Stop bit
-    if (!MATCH_MARK(results->rawbuf[offset], LG_BIT_MARK)){
-        return ERR;
-    }
-    // Success
-    results->bits = LG_BITS;
-    results->value = data;
-    results->decode_type = LG;
-    return DECODED;
-}
-
-
-long IRrecv::decodeJVC(decode_results *results) {
-    long data = 0;
-    int offset = 1; // Skip first space
-    // Check for repeat
-    if (irparams.rawlen - 1 == 33 &&
-        MATCH_MARK(results->rawbuf[offset], JVC_BIT_MARK) &&
-        MATCH_MARK(results->rawbuf[irparams.rawlen-1], JVC_BIT_MARK)) {
-        results->bits = 0;
-        results->value = REPEAT;
-        results->decode_type = JVC;
-        return DECODED;
-    } 
-    // Initial mark
-    if (!MATCH_MARK(results->rawbuf[offset], JVC_HDR_MARK)) {
-        return ERR;
-    }
-    offset++; 
-    if (irparams.rawlen < 2 * JVC_BITS + 1 ) {
-        return ERR;
-    }
-    // Initial space 
-    if (!MATCH_SPACE(results->rawbuf[offset], JVC_HDR_SPACE)) {
-        return ERR;
-    }
-    offset++;
-    for (int i = 0; i < JVC_BITS; i++) {
-        if (!MATCH_MARK(results->rawbuf[offset], JVC_BIT_MARK)) {
-            return ERR;
-        }
-        offset++;
-        if (MATCH_SPACE(results->rawbuf[offset], JVC_ONE_SPACE)) {
-            data = (data << 1) | 1;
-        } 
-        else if (MATCH_SPACE(results->rawbuf[offset], JVC_ZERO_SPACE)) {
-            data <<= 1;
-        } 
-        else {
-            return ERR;
-        }
-        offset++;
-    }
-    //Stop bit
-    if (!MATCH_MARK(results->rawbuf[offset], JVC_BIT_MARK)){
-        return ERR;
-    }
-    // Success
-    results->bits = JVC_BITS;
-    results->value = data;
-    results->decode_type = JVC;
-    return DECODED;
-}
-
-// SAMSUNGs have a repeat only 4 items long
-long IRrecv::decodeSAMSUNG(decode_results *results) {
-  long data = 0;
-  int offset = 1; // Skip first space
-  // Initial mark
-  if (!MATCH_MARK(results->rawbuf[offset], SAMSUNG_HDR_MARK)) {
-    return ERR;
-  }
-  offset++;
-  // Check for repeat
-  if (irparams.rawlen == 4 &&
-    MATCH_SPACE(results->rawbuf[offset], SAMSUNG_RPT_SPACE) &&
-    MATCH_MARK(results->rawbuf[offset+1], SAMSUNG_BIT_MARK)) {
-    results->bits = 0;
-    results->value = REPEAT;
-    results->decode_type = SAMSUNG;
-    return DECODED;
-  }
-  if (irparams.rawlen < 2 * SAMSUNG_BITS + 4) {
-    return ERR;
-  }
-  // Initial space  
-  if (!MATCH_SPACE(results->rawbuf[offset], SAMSUNG_HDR_SPACE)) {
-    return ERR;
-  }
-  offset++;
-  for (int i = 0; i < SAMSUNG_BITS; i++) {
-    if (!MATCH_MARK(results->rawbuf[offset], SAMSUNG_BIT_MARK)) {
-      return ERR;
-    }
-    offset++;
-    if (MATCH_SPACE(results->rawbuf[offset], SAMSUNG_ONE_SPACE)) {
-      data = (data << 1) | 1;
-    } 
-    else if (MATCH_SPACE(results->rawbuf[offset], SAMSUNG_ZERO_SPACE)) {
-      data <<= 1;
-    } 
-    else {
-      return ERR;
-    }
-    offset++;
-  }
-  // Success
-  results->bits = SAMSUNG_BITS;
-  results->value = data;
-  results->decode_type = SAMSUNG;
+  results->decode_type = protocol->type;
   return DECODED;
 }
 
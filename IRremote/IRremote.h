@@ -24,6 +24,9 @@
 // #define DEBUG
 // #define TEST
 
+struct irrange;
+struct irprotocol;
+
 // Results returned from the decoder
 class decode_results {
 public:
@@ -67,17 +70,9 @@ public:
   void resume();
 private:
   // These are called by decode
-  int getRClevel(decode_results *results, int *offset, int *used, int t1);
-  long decodeNEC(decode_results *results);
-  long decodeSony(decode_results *results);
-  long decodeSanyo(decode_results *results);
-  long decodeMitsubishi(decode_results *results);
-  long decodeRC5(decode_results *results);
-  long decodeRC6(decode_results *results);
-  long decodePanasonic(decode_results *results);
-  long decodeLG(decode_results *results);
-  long decodeJVC(decode_results *results);
-  long decodeSAMSUNG(decode_results *results);
+  int getRClevel(decode_results *results, int *offset, int *used, const struct irrange *windows);
+  long decodeProtocol(decode_results *results, const struct irprotocol *protocol);
+  long decodeRC(decode_results *results, const struct irprotocol *protocol, int offset);
   long decodeHash(decode_results *results);
   int compare(unsigned int oldval, unsigned int newval);
 
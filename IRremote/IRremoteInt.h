@@ -228,6 +228,55 @@ extern volatile irparams_t irparams;
 #define LG_BITS 28
 #define SAMSUNG_BITS 32
 
+// Window of tick counts accepted for one mark or space.  The limits are
+// worked out by the compiler from the microsecond timings above, so
+// matching a received interval is two integer compares.
+typedef struct irrange {
+  uint8_t low;
+  uint8_t high;
+}
+irrange_t;
+
+// Marks arrive MARK_EXCESS too long and spaces MARK_EXCESS too short
+#define MARK_RANGE(us)  { TICKS_LOW((us) + MARK_EXCESS), TICKS_HIGH((us) + MARK_EXCESS) }
+#define SPACE_RANGE(us) { TICKS_LOW((us) - MARK_EXCESS), TICKS_HIGH((us) - MARK_EXCESS) }
+#define NO_RANGE        { 0, 0 }
+
+// Layout flags for irprotocol_t
+#define IR_HDR_MARK          0x0001 // rawbuf[1] must fall in hdrMark
+#define IR_HDR_SPACE         0x0002 // rawbuf[2] must fall in hdrSpace
+#define IR_STOP_MARK         0x0004 // a bit mark follows the last bit
+#define IR_VARIABLE_LENGTH   0x0008 // bits run until a separator is missing, bits is the minimum
+#define IR_DATA_FIRST        0x0010 // each bit is data then separator (variable length only)
+#define IR_REPEAT_SHORT      0x0020 // header mark, repeat space, bit mark is a repeat
+#define IR_REPEAT_HEADERLESS 0x0040 // a frame without its header is a repeat
+#define IR_REPEAT_GAP        0x0080 // a gap shorter than repeatGap is a repeat
+#define IR_MANCHESTER        0x0100 // bi-phase bits, RC5 and RC6
+#define IR_MARK_FIRST        0x0200 // Manchester one is mark then space (RC6)
+#define IR_TRAILER_BIT       0x0400 // Manchester bit 3 is double width (RC6)
+#define IR_PULSE_DISTANCE    0x0800 // header, then a multiple of 4 bits: decodePulseDistance()
+
+// Description of one protocol for IRrecv::decode().  Bits are pairs of
+// intervals, a separator matching mark and a data interval matching one
+// or zero, sent most significant bit first.  Up to 48 bits are kept,
+// the top 16 of a longer frame are returned in panasonicAddress.
+typedef struct irprotocol {
+  int8_t type;             // decode_type of a match
+  uint16_t flags;          // IR_* flags above
+  uint8_t bits;            // data bits in a frame
+  uint8_t minRawlen;       // shortest rawlen that can hold a frame
+  irrange_t hdrMark;       // also picks the rows decode() tries
+  irrange_t hdrSpace;
+  irrange_t mark;          // separator half of each bit
+  irrange_t one;
+  irrange_t zero;
+  irrange_t repeat;        // space of an IR_REPEAT_SHORT frame
+  uint16_t repeatGap;      // ticks, IR_REPEAT_GAP only
+  int8_t repeatType;       // decode_type of an IR_REPEAT_GAP repeat
+  const irrange_t *windows; // IR_MANCHESTER only, in flash, see getRClevel()
+}
+irprotocol_t;
+
 
 
 
@@ -0,0 +1,27 @@
+/*
+ * Host stand-in for the pre-1.0 Arduino core used by IRremote.
+ *
+ * Pins and delays do nothing; the benchmark fills rawbuf itself.
+ */
+#ifndef sim_WProgram_h
+#define sim_WProgram_h
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/io.h>
+
+#define HIGH 1
+#define LOW  0
+#define INPUT  0
+#define OUTPUT 1
+
+// Port masks used by BLINKLED_ON() and BLINKLED_OFF()
+#define B00100000 0x20
+#define B11011111 0xDF
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) {return HIGH;}
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned int) {}
+#endif  // sim_WProgram_h
@@ -0,0 +1,11 @@
+/*
+ * Host stand-in for avr/interrupt.h.  ISR() declares an ordinary
+ * function that is never called.
+ */
+#ifndef sim_avr_interrupt_h
+#define sim_avr_interrupt_h
+
+#define ISR(vector) extern "C" void vector(void); void vector(void)
+inline void cli(void) {}
+inline void sei(void) {}
+#endif  // sim_avr_interrupt_h
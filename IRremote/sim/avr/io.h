@@ -0,0 +1,21 @@
+/*
+ * Host stand-in for the AVR timer 2 and port registers used by IRremote.
+ * Registers are plain memory.
+ */
+#ifndef sim_avr_io_h
+#define sim_avr_io_h
+#include <stdint.h>
+
+extern volatile uint8_t PORTB;
+extern volatile uint8_t TCCR2A, TCCR2B, OCR2A, OCR2B, TIMSK2, TCNT2;
+
+#define _BV(bit) (1 << (bit))
+
+#define WGM20  0
+#define WGM21  1
+#define COM2B1 5
+#define CS20   0
+#define CS21   1
+#define WGM22  3
+#define OCIE2A 1
+#endif  // sim_avr_io_h
@@ -0,0 +1,13 @@
+/*
+ * Host stand-in for avr/pgmspace.h.  Flash tables live in ordinary memory.
+ */
+#ifndef sim_avr_pgmspace_h
+#define sim_avr_pgmspace_h
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define memcpy_P(dst, src, n) memcpy((dst), (src), (n))
+#endif  // sim_avr_pgmspace_h
@@ -0,0 +1,33 @@
+/*
+ * Sequential IR decoder, kept as the reference for irremote_bench.
+ */
+
+#ifndef ir_sequential_h
+#define ir_sequential_h
+
+#include "IRremote.h"
+
+// IRrecv::decode() with one decoder per protocol, tried in turn
+class IRrecvSequential
+{
+public:
+  int decode(decode_results *results);
+  void resume();
+private:
+  int getRClevel(decode_results *results, int *offset, int *used, int t1);
+  long decodeNEC(decode_results *results);
+  long decodeSony(decode_results *results);
+  long decodeSanyo(decode_results *results);
+  long decodeMitsubishi(decode_results *results);
+  long decodeRC5(decode_results *results);
+  long decodeRC6(decode_results *results);
+  long decodePanasonic(decode_results *results);
+  long decodeLG(decode_results *results);
+  long decodeJVC(decode_results *results);
+  long decodeSAMSUNG(decode_results *results);
+  long decodeHash(decode_results *results);
+  int compare(unsigned int oldval, unsigned int newval);
+}
+;
+
+#endif
@@ -0,0 +1,298 @@
+/*
+ * Decode time benchmark for IRrecv::decode()
+ *
+ * Builds a corpus of raw timings the way the receive interrupt records
+ * them: frames from the IRsend encoders and from the protocol timings,
+ * each received several times with a tick of jitter on every interval,
+ * repeat frames, the Mitsubishi capture quoted in IRremoteInt.h and
+ * noise that only the hash decoder accepts.  Every frame is decoded with
+ * the protocol table and with the old sequential decoders, and the
+ * results must agree.  Prints the average decode time of each in time
+ * stamp counter ticks, less the time to load the frame, taking each
+ * frame's best of REPEATS.  Exits non-zero on any mismatch.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <x86intrin.h>
+#include "IRremote.h"
+#include "IRremoteInt.h"
+#include "ir_sequential.h"
+
+// Registers touched by IRsend and the receive interrupt
+volatile uint8_t PORTB;
+volatile uint8_t TCCR2A, TCCR2B, OCR2A, OCR2B, TIMSK2, TCNT2;
+
+#define MAX_FRAMES  512
+#define JITTER_COPIES 6
+#define GAP_TICKS_NORMAL 2000 // 100 ms between frames
+#define REPEATS 2000 // best of
+
+struct frame_t {
+  unsigned int rawbuf[RAWBUF];
+  uint8_t rawlen;
+  int type; // decode_type expected
+};
+
+static frame_t corpus[MAX_FRAMES];
+static int frameCount;
+
+//------------------------------------------------------------------------------
+// Small deterministic generator so every run sees the same corpus
+static unsigned long seed = 12345;
+static unsigned int nextRandom(unsigned int n) {
+  seed = seed * 1103515245UL + 12345;
+  return (seed >> 16) % n;
+}
+//------------------------------------------------------------------------------
+// IRsend that records marks and spaces as rawbuf ticks, the way the
+// receive interrupt would see them from a detector.
+class IRsendCapture : public IRsend {
+public:
+  frame_t *frame;
+  int jitter; // max ticks added to or taken from each interval
+  int last;
+  void start(frame_t *f, unsigned int gap, int type, int maxJitter) {
+    frame = f;
+    frame->rawbuf[0] = gap;
+    frame->rawlen = 1;
+    frame->type = type;
+    jitter = maxJitter;
+    last = SPACE;
+  }
+  // The trailing space is part of the next gap, which is not recorded
+  void finish() {
+    if (last == SPACE && frame->rawlen > 1) {
+      frame->rawlen--;
+    }
+  }
+  void mark(int usec) {
+    if (usec <= 0) return;
+    record(MARK, usec, (usec + MARK_EXCESS) / USECPERTICK);
+  }
+  void space(int usec) {
+    if (usec <= 0) return;
+    record(SPACE, usec, (usec - MARK_EXCESS) / USECPERTICK);
+  }
+private:
+  void record(int level, int usec, int ticks) {
+    if (level == last) {
+      // Longer mark or space
+      frame->rawbuf[frame->rawlen - 1] += usec / USECPERTICK;
+      return;
+    }
+    if (frame->rawlen >= RAWBUF) return;
+    if (jitter) ticks += (int)nextRandom(2 * jitter + 1) - jitter;
+    frame->rawbuf[frame->rawlen++] = ticks;
+    last = level;
+  }
+};
+
+static IRsendCapture capture;
+//------------------------------------------------------------------------------
+// Encoders for protocols IRsend has no send function for
+static void sendPairs(int hdrMark, int hdrSpace, int bitMark, int oneSpace,
+  int zeroSpace, unsigned long data, int nbits, bool stopMark) {
+  capture.mark(hdrMark);
+  capture.space(hdrSpace);
+  for (int i = nbits - 1; i >= 0; i--) {
+    capture.mark(bitMark);
+    capture.space(data & (1UL << i) ? oneSpace : zeroSpace);
+  }
+  if (stopMark) capture.mark(bitMark);
+}
+static void sendLG(unsigned long data) {
+  sendPairs(LG_HDR_MARK, LG_HDR_SPACE, LG_BIT_MARK, LG_ONE_SPACE,
+    LG_ZERO_SPACE, data, LG_BITS, true);
+}
+static void sendSanyo(unsigned long data) {
+  capture.mark(SANYO_HDR_MARK);
+  capture.space(SANYO_HDR_MARK);
+  for (int i = SANYO_BITS - 1; i >= 0; i--) {
+    capture.mark(SANYO_HDR_SPACE);
+    capture.space(data & (1UL << i) ? SANYO_ONE_MARK : SANYO_ZERO_MARK);
+  }
+  capture.mark(SANYO_HDR_SPACE);
+}
+//------------------------------------------------------------------------------
+// Mitsubishi RM 75501 capture, in ticks.  Neither decoder accepts it as
+// is: the 8 tick mark ends the frame early, so it is only hashed.
+static const unsigned int mitsubishiCapture[] = {
+  14200, 7, 41, 7, 42, 7, 42, 7, 17, 7, 17, 7, 18, 7, 41, 7, 18, 7, 17, 7,
+  17, 7, 18, 7, 41, 8, 17, 7, 17, 7, 18, 7, 17, 7
+};
+//------------------------------------------------------------------------------
+static frame_t *newFrame() {
+  if (frameCount >= MAX_FRAMES) {
+    printf("corpus full\n");
+    exit(1);
+  }
+  return &corpus[frameCount++];
+}
+
+// Adds JITTER_COPIES receptions of one transmission
+#define ADD(type, gap, send) \
+  for (int copy = 0; copy < JITTER_COPIES; copy++) { \
+    capture.start(newFrame(), gap, type, copy ? 1 : 0); \
+    send; \
+    capture.finish(); \
+  }
+
+static void buildCorpus() {
+  static const unsigned long necCodes[] = {0x00FF30CF, 0x20DF10EF, 0x807F40BF};
+  for (unsigned i = 0; i < sizeof(necCodes) / sizeof(necCodes[0]); i++) {
+    ADD(NEC, GAP_TICKS_NORMAL, capture.sendNEC(necCodes[i], NEC_BITS));
+  }
+  ADD(SONY, GAP_TICKS_NORMAL, capture.sendSony(0xA90, 12));
+  ADD(SONY, GAP_TICKS_NORMAL, capture.sendSony(0x5A5A, 15));
+  ADD(SONY, GAP_TICKS_NORMAL, capture.sendSony(0x3A5AB, 20));
+  ADD(SANYO, GAP_TICKS_NORMAL, sendSanyo(0x9A3));
+  ADD(RC5, GAP_TICKS_NORMAL, capture.sendRC5(0x80B, 12));
+  ADD(RC5, GAP_TICKS_NORMAL, capture.sendRC5(0x9A5, 12));
+  ADD(RC6, GAP_TICKS_NORMAL, capture.sendRC6(0x1000C, 20));
+  ADD(RC6, GAP_TICKS_NORMAL, capture.sendRC6(0xC8A5F, 20));
+  ADD(PANASONIC, GAP_TICKS_NORMAL, capture.sendPanasonic(0x4004, 0x0100BCBD));
+  ADD(LG, GAP_TICKS_NORMAL, sendLG(0x88C0051));
+  ADD(JVC, GAP_TICKS_NORMAL, capture.sendJVC(0xC5E8, JVC_BITS, 0));
+  ADD(SAMSUNG, GAP_TICKS_NORMAL, capture.sendSAMSUNG(0xE0E040BF, SAMSUNG_BITS));
+
+  // Repeats
+  ADD(NEC, GAP_TICKS_NORMAL,
+    (capture.mark(NEC_HDR_MARK), capture.space(NEC_RPT_SPACE), capture.mark(NEC_BIT_MARK)));
+  ADD(SAMSUNG, GAP_TICKS_NORMAL,
+    (capture.mark(SAMSUNG_HDR_MARK), capture.space(SAMSUNG_RPT_SPACE), capture.mark(SAMSUNG_BIT_MARK)));
+  ADD(JVC, GAP_TICKS_NORMAL, capture.sendJVC(0xC5E8, JVC_BITS, 1));
+  ADD(SANYO, 400, capture.sendSony(0xA90, 12)); // Sony gap repeat reports SANYO
+  ADD(SANYO, 700, sendSanyo(0x9A3));
+
+  // Mitsubishi, captured, then with the marks held at 7 ticks
+  for (int copy = 0; copy <= JITTER_COPIES; copy++) {
+    frame_t *f = newFrame();
+    f->rawlen = sizeof(mitsubishiCapture) / sizeof(mitsubishiCapture[0]);
+    f->type = copy ? MITSUBISHI : UNKNOWN;
+    for (int i = 0; i < f->rawlen; i++) {
+      f->rawbuf[i] = mitsubishiCapture[i];
+      if (copy && i % 2) f->rawbuf[i] = 7;
+      if (copy > 1 && i && i % 2 == 0) f->rawbuf[i] += nextRandom(3) - 1;
+    }
+  }
+
+  // Noise
+  for (int n = 0; n < 8 * JITTER_COPIES; n++) {
+    frame_t *f = newFrame();
+    f->rawlen = 2 * (10 + nextRandom(40));
+    f->type = UNKNOWN;
+    f->rawbuf[0] = GAP_TICKS_NORMAL;
+    for (int i = 1; i < f->rawlen; i++) {
+      f->rawbuf[i] = 3 + nextRandom(60);
+    }
+  }
+}
+//------------------------------------------------------------------------------
+static IRrecv irrecv(11);
+static IRrecvSequential sequential;
+static decode_results results;
+
+static void load(const frame_t *f) {
+  memcpy((void*)irparams.rawbuf, f->rawbuf, sizeof(f->rawbuf));
+  irparams.rawlen = f->rawlen;
+  irparams.rcvstate = STATE_STOP;
+}
+
+static const char *typeName(int type) {
+  switch (type) {
+    case NEC: return "NEC";
+    case SONY: return "SONY";
+    case RC5: return "RC5";
+    case RC6: return "RC6";
+    case PANASONIC: return "PANASONIC";
+    case JVC: return "JVC";
+    case SANYO: return "SANYO";
+    case MITSUBISHI: return "MITSUBISHI";
+    case SAMSUNG: return "SAMSUNG";
+    case LG: return "LG";
+    case UNKNOWN: return "UNKNOWN";
+  }
+  return "?";
+}
+
+// Host time stamp counter ticks of a load, or of a load and a decode with
+// the table or the sequential decoders (decoder -1, 1 or 0)
+static unsigned long ticks(const frame_t *f, int decoder) {
+  unsigned long long start = __rdtsc();
+  load(f);
+  if (decoder == 1) {
+    irrecv.decode(&results);
+  } else if (decoder == 0) {
+    sequential.decode(&results);
+  }
+  __asm__ __volatile__("" ::: "memory");
+  return (unsigned long)(__rdtsc() - start);
+}
+
+// Ticks per decode of the frames of one type, with each decoder, less the
+// cost of loading rawbuf.  Each frame is timed REPEATS times, the three
+// ways in turn, and its best of each is taken: host noise only ever adds,
+// and it rarely hits one frame every time.
+static void timeDecode(int type, double *sequentialTicks, double *tableTicks) {
+  double sum[3] = {0, 0, 0};
+  long count = 0;
+  for (int i = 0; i < frameCount; i++) {
+    if (corpus[i].type != type) continue;
+    unsigned long best[3] = {~0UL, ~0UL, ~0UL};
+    for (int r = 0; r < REPEATS; r++) {
+      for (int decoder = -1; decoder <= 1; decoder++) {
+        unsigned long t = ticks(&corpus[i], decoder);
+        if (t < best[decoder + 1]) best[decoder + 1] = t;
+      }
+    }
+    for (int k = 0; k < 3; k++) sum[k] += best[k];
+    count++;
+  }
+  *sequentialTicks = count ? (sum[1] - sum[0]) / count : 0;
+  *tableTicks = count ? (sum[2] - sum[0]) / count : 0;
+}
+//------------------------------------------------------------------------------
+int main() {
+  buildCorpus();
+
+  // The decoders must agree.  Frames they both hash instead of decoding
+  // as their protocol are counted, but are not an error.
+  int errors = 0;
+  int hashed = 0;
+  for (int i = 0; i < frameCount; i++) {
+    decode_results expect;
+    load(&corpus[i]);
+    int seqStatus = sequential.decode(&expect);
+    load(&corpus[i]);
+    int status = irrecv.decode(&results);
+    bool same = status == seqStatus &&
+      results.decode_type == expect.decode_type &&
+      results.value == expect.value &&
+      results.bits == expect.bits &&
+      (expect.decode_type != PANASONIC ||
+        results.panasonicAddress == expect.panasonicAddress);
+    if (!same) {
+      printf("frame %d (%s, rawlen %d): table %s %lX/%d, sequential %s %lX/%d\n",
+        i, typeName(corpus[i].type), corpus[i].rawlen,
+        typeName(results.decode_type), results.value, results.bits,
+        typeName(expect.decode_type), expect.value, expect.bits);
+      errors++;
+    } else if (results.decode_type != corpus[i].type) {
+      hashed++;
+    }
+  }
+  printf("%d frames, %d mismatches, %d outside their protocol's windows\n\n",
+    frameCount, errors, hashed);
+
+  static const int types[] = {NEC, SONY, SANYO, MITSUBISHI, RC5, RC6,
+    PANASONIC, LG, JVC, SAMSUNG, UNKNOWN};
+  printf("%-11s %8s %18s %13s\n", "protocol", "frames", "sequential ticks", "table ticks");
+  for (unsigned t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+    int n = 0;
+    for (int i = 0; i < frameCount; i++) n += corpus[i].type == types[t];
+    double sequentialTicks, tableTicks;
+    timeDecode(types[t], &sequentialTicks, &tableTicks);
+    printf("%-11s %8d %18.0f %13.0f\n", typeName(types[t]), n, sequentialTicks, tableTicks);
+  }
+  return errors ? 1 : 0;
+}
@@ -47,4 +47,6 @@
  */
 /*! \defgroup thru     MIDI Thru
  */
+/*! \defgroup scheduler MIDI Scheduler
+ */
 
@@ -0,0 +1,524 @@
+/*
+ * Input parser benchmark for MidiInterface
+ *
+ * Builds recorded-like MIDI streams from lists of messages: channel
+ * messages sent with running status, system common messages, SysEx that
+ * fit the array and sample dumps that do not, with Clock bytes interleaved
+ * anywhere, even inside messages.  Each stream is fed through a mock
+ * SerialPort to the parser, with read() and with feed() on random sized
+ * spans, and the received messages must match the ones sent.  Dumps are
+ * received with the SysEx chunk handler and must also come out of the
+ * Thru unchanged.  The old recursive parser (midi_legacy.h) is run on the
+ * same streams for timing; its mismatches are only reported.
+ * Exits non-zero on any mismatch of the new parser.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include "MIDI.h"
+#include "midi_legacy.h"
+
+USING_NAMESPACE_MIDI
+
+#define RUNS 50 // best of
+
+//------------------------------------------------------------------------------
+// Small deterministic generator so every run sees the same streams
+static unsigned long seed = 12345;
+static unsigned int nextRandom(unsigned int n)
+{
+    seed = seed * 1103515245UL + 12345;
+    return (seed >> 16) % n;
+}
+
+//------------------------------------------------------------------------------
+// SerialPort stand-in: reads from a recorded stream, records what is written.
+class MockSerial
+{
+public:
+    MockSerial() : data(0), length(0), pos(0) {}
+
+    void begin(long) {}
+    int available() { return length - pos; }
+    int read() { return data[pos++]; }
+    void write(byte b) { out.push_back(b); }
+
+    void load(const std::vector<byte>& stream)
+    {
+        data = &stream[0];
+        length = stream.size();
+        pos = 0;
+        out.clear();
+    }
+
+    const byte* data;
+    unsigned int length;
+    unsigned int pos;
+    std::vector<byte> out;
+};
+
+//------------------------------------------------------------------------------
+// Messages, as sent and as received
+
+struct Event
+{
+    MidiType type;
+    Channel channel;
+    byte data1;
+    byte data2;
+    std::vector<byte> sysex; // 0xF0 and 0xF7 included
+
+    bool operator==(const Event& e) const
+    {
+        if (type != e.type)
+            return false;
+        if (type >= NoteOff && type <= PitchBend && channel != e.channel)
+            return false;
+        if (type == SystemExclusive)
+            return sysex == e.sysex;
+        return data1 == e.data1 && data2 == e.data2;
+    }
+};
+
+typedef std::vector<Event> EventList;
+
+struct Stream
+{
+    const char* name;
+    std::vector<byte> bytes;
+    EventList events; // in order of completion
+    bool dumps;       // SysEx longer than the array
+};
+
+static Event makeEvent(MidiType type, Channel channel = 0, byte d1 = 0, byte d2 = 0)
+{
+    Event e;
+    e.type = type;
+    e.channel = channel;
+    e.data1 = d1;
+    e.data2 = d2;
+    return e;
+}
+
+static byte dataLength(MidiType type)
+{
+    switch (type)
+    {
+        case ProgramChange:
+        case AfterTouchChannel:
+        case TimeCodeQuarterFrame:
+        case SongSelect:
+            return 1;
+        case TuneRequest:
+            return 0;
+        default:
+            return 2;
+    }
+}
+
+// Encoder with running status, interleaving Clock bytes after any byte
+// with a probability of clockRate / 1000.
+class Encoder
+{
+public:
+    Encoder(Stream& s, unsigned int clockRate)
+        : stream(s), rate(clockRate), runningStatus(0) {}
+
+    void send(const Event& e)
+    {
+        std::vector<byte> bytes;
+
+        if (e.type == SystemExclusive)
+        {
+            bytes = e.sysex;
+            runningStatus = 0;
+        }
+        else
+        {
+            byte status = e.type;
+            if (e.type < SystemExclusive)
+                status |= (e.channel - 1);
+
+            if (status != runningStatus)
+                bytes.push_back(status);
+            runningStatus = (e.type < SystemExclusive) ? status : 0;
+
+            const byte n = dataLength(e.type);
+            if (n > 0) bytes.push_back(e.data1);
+            if (n > 1) bytes.push_back(e.data2);
+        }
+
+        for (unsigned int i = 0; i < bytes.size(); ++i)
+        {
+            stream.bytes.push_back(bytes[i]);
+            if (i == bytes.size() - 1)
+                stream.events.push_back(e);
+            if (nextRandom(1000) < rate)
+            {
+                stream.bytes.push_back(Clock);
+                stream.events.push_back(makeEvent(Clock));
+            }
+        }
+    }
+
+private:
+    Stream& stream;
+    unsigned int rate;
+    byte runningStatus;
+};
+
+static Event randomSysEx(unsigned int length)
+{
+    Event e = makeEvent(SystemExclusive);
+    e.sysex.push_back(0xF0);
+    for (unsigned int i = 2; i < length; ++i)
+        e.sysex.push_back(nextRandom(128));
+    e.sysex.push_back(0xF7);
+    return e;
+}
+
+static Event randomChannelMessage(bool withTwoBytes)
+{
+    static const MidiType types[] = {
+        NoteOn, NoteOn, NoteOn, NoteOff, ControlChange, ControlChange,
+        PitchBend, AfterTouchPoly, ProgramChange, AfterTouchChannel
+    };
+    const MidiType type = types[nextRandom(withTwoBytes ? 10 : 8)];
+    Event e = makeEvent(type, 1 + nextRandom(3), nextRandom(128), nextRandom(128));
+    if (dataLength(type) == 1)
+        e.data2 = 0;
+    return e;
+}
+
+static void buildStreams(std::vector<Stream>& streams)
+{
+    streams.resize(4);
+
+    // Notes and controllers, running status on three byte messages only,
+    // with system common messages cancelling it from time to time.
+    Stream& notes = streams[0];
+    notes.name = "notes";
+    notes.dumps = false;
+    {
+        Encoder enc(notes, 20);
+        Event last = randomChannelMessage(false);
+        for (int i = 0; i < 20000; ++i)
+        {
+            const unsigned int r = nextRandom(100);
+            if (r < 2)
+                enc.send(makeEvent(SongPosition, 0, nextRandom(128), nextRandom(128)));
+            else if (r < 3)
+                enc.send(makeEvent(SongSelect, 0, nextRandom(128)));
+            else if (r < 4)
+                enc.send(makeEvent(TimeCodeQuarterFrame, 0, nextRandom(128)));
+            else if (r < 5)
+                enc.send(makeEvent(TuneRequest));
+            else
+            {
+                // Mostly the same status, as in a chord or a controller sweep
+                Event e = (r < 70) ? last : randomChannelMessage(false);
+                e.data1 = nextRandom(128);
+                e.data2 = nextRandom(128);
+                enc.send(e);
+                last = e;
+            }
+        }
+    }
+
+    // Program changes and channel pressure under running status
+    Stream& programs = streams[1];
+    programs.name = "programs";
+    programs.dumps = false;
+    {
+        Encoder enc(programs, 20);
+        Event last = randomChannelMessage(true);
+        for (int i = 0; i < 20000; ++i)
+        {
+            Event e = (nextRandom(100) < 70) ? last : randomChannelMessage(true);
+            e.data1 = nextRandom(128);
+            e.data2 = (dataLength(e.type) == 1) ? 0 : nextRandom(128);
+            enc.send(e);
+            last = e;
+        }
+    }
+
+    // Patch SysEx that fit the array, between notes
+    Stream& sysex = streams[2];
+    sysex.name = "sysex";
+    sysex.dumps = false;
+    {
+        Encoder enc(sysex, 10);
+        for (int i = 0; i < 400; ++i)
+        {
+            enc.send(randomSysEx(3 + nextRandom(MIDI_SYSEX_ARRAY_SIZE - 2)));
+            for (int j = nextRandom(8); j > 0; --j)
+                enc.send(randomChannelMessage(false));
+        }
+    }
+
+    // Sample dumps, much longer than the array
+    Stream& dump = streams[3];
+    dump.name = "dump";
+    dump.dumps = true;
+    {
+        Encoder enc(dump, 2);
+        for (int i = 0; i < 16; ++i)
+        {
+            enc.send(randomSysEx(1000 + nextRandom(8000)));
+            enc.send(randomChannelMessage(false));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Receivers
+
+static MockSerial serial;
+static MidiInterface<MockSerial> midiIn(serial);
+static LegacyMidi<MockSerial> legacyIn(serial);
+
+static EventList received;
+static std::vector<byte> sysexChunks;
+static unsigned int chunkCount;
+
+template<class Parser>
+static void record(Parser& parser, bool chunked)
+{
+    Event e = makeEvent(parser.getType(), parser.getChannel(),
+                        parser.getData1(), parser.getData2());
+    if (e.type == SystemExclusive)
+    {
+        if (chunked)
+        {
+            e.sysex.swap(sysexChunks);
+            sysexChunks.clear();
+        }
+        else
+        {
+            const byte* array = parser.getSysExArray();
+            e.sysex.assign(array, array + parser.getSysExArrayLength());
+        }
+    }
+    received.push_back(e);
+}
+
+static void handleSysExChunk(const byte* data, unsigned int size, bool last)
+{
+    sysexChunks.insert(sysexChunks.end(), data, data + size);
+    chunkCount++;
+}
+
+// Callbacks recording what feed() dispatches
+static void onNoteOff(byte c, byte a, byte b)   { received.push_back(makeEvent(NoteOff, c, a, b)); }
+static void onNoteOn(byte c, byte a, byte b)    { received.push_back(makeEvent(NoteOn, c, a, b)); }
+static void onPoly(byte c, byte a, byte b)      { received.push_back(makeEvent(AfterTouchPoly, c, a, b)); }
+static void onControl(byte c, byte a, byte b)   { received.push_back(makeEvent(ControlChange, c, a, b)); }
+static void onProgram(byte c, byte a)           { received.push_back(makeEvent(ProgramChange, c, a)); }
+static void onPressure(byte c, byte a)          { received.push_back(makeEvent(AfterTouchChannel, c, a)); }
+static void onBend(byte c, int bend)
+{
+    const unsigned int value = bend - MIDI_PITCHBEND_MIN;
+    received.push_back(makeEvent(PitchBend, c, value & 0x7F, value >> 7));
+}
+static void onTimeCode(byte a)                  { received.push_back(makeEvent(TimeCodeQuarterFrame, 0, a)); }
+static void onSongPosition(unsigned int beats)  { received.push_back(makeEvent(SongPosition, 0, beats & 0x7F, beats >> 7)); }
+static void onSongSelect(byte a)                { received.push_back(makeEvent(SongSelect, 0, a)); }
+static void onTuneRequest()                     { received.push_back(makeEvent(TuneRequest)); }
+static void onClock()                           { received.push_back(makeEvent(Clock)); }
+static void onSysEx(byte* array, byte size)
+{
+    Event e = makeEvent(SystemExclusive);
+    e.sysex.assign(array, array + midiIn.getSysExArrayLength());
+    received.push_back(e);
+}
+static void onSysExChunk(const byte* data, unsigned int size, bool last)
+{
+    handleSysExChunk(data, size, last);
+    if (last)
+    {
+        Event e = makeEvent(SystemExclusive);
+        e.sysex.swap(sysexChunks);
+        sysexChunks.clear();
+        received.push_back(e);
+    }
+}
+
+static void setHandlers(bool chunked, bool feedCallbacks)
+{
+    midiIn.setHandleNoteOff(feedCallbacks ? onNoteOff : 0);
+    midiIn.setHandleNoteOn(feedCallbacks ? onNoteOn : 0);
+    midiIn.setHandleAfterTouchPoly(feedCallbacks ? onPoly : 0);
+    midiIn.setHandleControlChange(feedCallbacks ? onControl : 0);
+    midiIn.setHandleProgramChange(feedCallbacks ? onProgram : 0);
+    midiIn.setHandleAfterTouchChannel(feedCallbacks ? onPressure : 0);
+    midiIn.setHandlePitchBend(feedCallbacks ? onBend : 0);
+    midiIn.setHandleTimeCodeQuarterFrame(feedCallbacks ? onTimeCode : 0);
+    midiIn.setHandleSongPosition(feedCallbacks ? onSongPosition : 0);
+    midiIn.setHandleSongSelect(feedCallbacks ? onSongSelect : 0);
+    midiIn.setHandleTuneRequest(feedCallbacks ? onTuneRequest : 0);
+    midiIn.setHandleClock(feedCallbacks ? onClock : 0);
+    midiIn.setHandleSystemExclusive(feedCallbacks ? onSysEx : 0);
+    if (chunked)
+        midiIn.setHandleSystemExclusiveChunk(feedCallbacks ? onSysExChunk : handleSysExChunk);
+    else
+        midiIn.setHandleSystemExclusiveChunk(0);
+}
+
+static void receiveWithRead(const Stream& s)
+{
+    received.clear();
+    sysexChunks.clear();
+    setHandlers(s.dumps, false);
+    serial.load(s.bytes);
+    midiIn.begin(MIDI_CHANNEL_OMNI);
+    midiIn.turnThruOff();
+    while (serial.available())
+    {
+        if (midiIn.read())
+            record(midiIn, s.dumps);
+    }
+}
+
+static void receiveWithFeed(const Stream& s)
+{
+    received.clear();
+    sysexChunks.clear();
+    setHandlers(s.dumps, true);
+    serial.load(s.bytes);
+    midiIn.begin(MIDI_CHANNEL_OMNI);
+    midiIn.turnThruOff();
+    for (unsigned int pos = 0; pos < s.bytes.size(); )
+    {
+        unsigned int span = 1 + nextRandom(64);
+        if (span > s.bytes.size() - pos)
+            span = s.bytes.size() - pos;
+        midiIn.feed(&s.bytes[pos], span);
+        pos += span;
+    }
+}
+
+static void receiveWithLegacy(const Stream& s)
+{
+    received.clear();
+    serial.load(s.bytes);
+    legacyIn.begin(MIDI_CHANNEL_OMNI);
+    while (serial.available())
+    {
+        if (legacyIn.read())
+            record(legacyIn, false);
+    }
+}
+
+static unsigned int countMismatches(const EventList& expected)
+{
+    unsigned int errors = 0;
+    const unsigned int n = (expected.size() > received.size()) ? expected.size() : received.size();
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        if (i >= expected.size() || i >= received.size() || !(expected[i] == received[i]))
+            errors++;
+    }
+    return errors;
+}
+
+// Thru check: a dump stream without Clock must come out byte for byte.
+static unsigned int checkThru()
+{
+    Stream s;
+    s.name = "thru";
+    s.dumps = true;
+    Encoder enc(s, 0);
+    for (int i = 0; i < 4; ++i)
+        enc.send(randomSysEx(1000 + nextRandom(3000)));
+
+    received.clear();
+    sysexChunks.clear();
+    setHandlers(true, false);
+    serial.load(s.bytes);
+    midiIn.begin(MIDI_CHANNEL_OMNI);
+    midiIn.turnThruOn(Full);
+    while (serial.available())
+        midiIn.read();
+    midiIn.turnThruOff();
+
+    return (serial.out == s.bytes) ? 0 : 1;
+}
+
+//------------------------------------------------------------------------------
+// Timing
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+template<class Parser>
+static double timeParser(Parser& parser, const Stream& s)
+{
+    double best = 1e9;
+    for (int run = 0; run < RUNS; ++run)
+    {
+        serial.load(s.bytes);
+        parser.begin(MIDI_CHANNEL_OMNI);
+        unsigned int count = 0;
+        const double start = now();
+        while (serial.available())
+        {
+            if (parser.read())
+                count++;
+        }
+        const double elapsed = now() - start;
+        if (elapsed < best)
+            best = elapsed;
+        if (count == 0)
+            printf("  (no message?)\n");
+    }
+    return best * 1e9 / s.bytes.size();
+}
+
+int main()
+{
+    std::vector<Stream> streams;
+    buildStreams(streams);
+
+    unsigned int errors = 0;
+
+    printf("%-10s %8s %8s  %10s %10s  %12s %12s\n", "stream", "bytes", "messages",
+           "read() err", "feed() err", "new ns/byte", "old ns/byte");
+
+    for (unsigned int i = 0; i < streams.size(); ++i)
+    {
+        const Stream& s = streams[i];
+
+        receiveWithRead(s);
+        const unsigned int readErrors = countMismatches(s.events);
+        receiveWithFeed(s);
+        const unsigned int feedErrors = countMismatches(s.events);
+        receiveWithLegacy(s);
+        const unsigned int legacyErrors = countMismatches(s.events);
+        errors += readErrors + feedErrors;
+
+        setHandlers(s.dumps, false);
+        midiIn.turnThruOff();
+        const double newTime = timeParser(midiIn, s);
+        const double oldTime = timeParser(legacyIn, s);
+
+        printf("%-10s %8u %8u  %10u %10u  %12.2f %12.2f", s.name,
+               (unsigned)s.bytes.size(), (unsigned)s.events.size(),
+               readErrors, feedErrors, newTime, oldTime);
+        if (legacyErrors)
+            printf("  (old parser: %u mismatches)", legacyErrors);
+        printf("\n");
+    }
+
+    chunkCount = 0;
+    const unsigned int thruErrors = checkThru();
+    printf("thru of chunked dumps: %s (%u fragments)\n", thruErrors ? "MISMATCH" : "ok", chunkCount);
+    errors += thruErrors;
+
+    printf("%u mismatches\n", errors);
+    return errors ? 1 : 0;
+}
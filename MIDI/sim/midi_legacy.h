@@ -0,0 +1,474 @@
+/*
+ * The MIDI input parser as it was before the table driven one, kept as the
+ * reference for midi_bench: one byte per step, calling itself back to
+ * consume the rest of the serial buffer.  The code is unchanged except for
+ * the pending message, which is made as large as the SysEx array (the
+ * original 3 byte buffer was overrun by any SysEx), and the count of
+ * available bytes, which was a byte and read as empty a buffer holding a
+ * multiple of 256 bytes.  read() mirrors the old one, with the callback
+ * dispatch and the Thru test but no handler set.
+ */
+#pragma once
+
+#include "MIDI.h"
+
+BEGIN_MIDI_NAMESPACE
+
+template<class SerialPort>
+class LegacyMidi
+{
+public:
+    LegacyMidi(SerialPort& inSerial) : mSerial(inSerial)
+    {
+        // No handler is set: the dispatch is only timed.
+        mNoteOffCallback                = 0;
+        mNoteOnCallback                 = 0;
+        mAfterTouchPolyCallback         = 0;
+        mControlChangeCallback          = 0;
+        mProgramChangeCallback          = 0;
+        mAfterTouchChannelCallback      = 0;
+        mPitchBendCallback              = 0;
+        mSystemExclusiveCallback        = 0;
+        mTimeCodeQuarterFrameCallback   = 0;
+        mSongPositionCallback           = 0;
+        mSongSelectCallback             = 0;
+        mTuneRequestCallback            = 0;
+        mClockCallback                  = 0;
+        mStartCallback                  = 0;
+        mContinueCallback               = 0;
+        mStopCallback                   = 0;
+        mActiveSensingCallback          = 0;
+        mSystemResetCallback            = 0;
+        mThruActivated                  = false;
+    }
+    
+    void begin(Channel inChannel = 1)
+    {
+        mInputChannel = inChannel;
+        mRunningStatus_RX = InvalidType;
+        mPendingMessageIndex = 0;
+        mPendingMessageExpectedLenght = 0;
+        mMessage.valid = false;
+        mMessage.type = InvalidType;
+    }
+    
+    bool read()
+    {
+        if (mInputChannel >= MIDI_CHANNEL_OFF)
+            return false;
+        
+        if (parse(mInputChannel))
+        {
+            if (inputFilter(mInputChannel))
+            {
+                thruFilter(mInputChannel);
+                launchCallback();
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    MidiType getType() const        { return mMessage.type; }
+    Channel  getChannel() const     { return mMessage.channel; }
+    DataByte getData1() const       { return mMessage.data1; }
+    DataByte getData2() const       { return mMessage.data2; }
+    const byte* getSysExArray() const { return mMessage.sysex_array; }
+    unsigned int getSysExArrayLength() const
+    {
+        const unsigned int size = ((unsigned)(mMessage.data2) << 8) | mMessage.data1;
+        return (size > MIDI_SYSEX_ARRAY_SIZE) ? MIDI_SYSEX_ARRAY_SIZE : size;
+    }
+    
+    static MidiType getTypeFromStatusByte(const byte inStatus)
+    {
+        return MidiInterface<SerialPort>::getTypeFromStatusByte(inStatus);
+    }
+    
+private:
+    bool parse(Channel inChannel);
+    
+    bool inputFilter(Channel inChannel)
+    {
+        if (mMessage.type == InvalidType)
+            return false;
+        if (mMessage.type >= NoteOff && mMessage.type <= PitchBend)
+            return (mMessage.channel == mInputChannel) || 
+                   (mInputChannel == MIDI_CHANNEL_OMNI);
+        return true;
+    }
+    
+    void thruFilter(Channel inChannel)
+    {
+        if (!mThruActivated)
+            return;
+    }
+    
+    void launchCallback();
+    
+    void resetInput()
+    {
+        mPendingMessageIndex = 0;
+        mPendingMessageExpectedLenght = 0;
+        mRunningStatus_RX = InvalidType;
+    }
+    
+    StatusByte   mRunningStatus_RX;
+    Channel      mInputChannel;
+    byte         mPendingMessage[MIDI_SYSEX_ARRAY_SIZE];
+    unsigned int mPendingMessageExpectedLenght;
+    unsigned int mPendingMessageIndex;
+    Message      mMessage;
+    SerialPort&  mSerial;
+    bool         mThruActivated;
+    
+    void (*mNoteOffCallback)(byte channel, byte note, byte velocity);
+    void (*mNoteOnCallback)(byte channel, byte note, byte velocity);
+    void (*mAfterTouchPolyCallback)(byte channel, byte note, byte velocity);
+    void (*mControlChangeCallback)(byte channel, byte, byte);
+    void (*mProgramChangeCallback)(byte channel, byte);
+    void (*mAfterTouchChannelCallback)(byte channel, byte);
+    void (*mPitchBendCallback)(byte channel, int);
+    void (*mSystemExclusiveCallback)(byte * array, byte size);
+    void (*mTimeCodeQuarterFrameCallback)(byte data);
+    void (*mSongPositionCallback)(unsigned int beats);
+    void (*mSongSelectCallback)(byte songnumber);
+    void (*mTuneRequestCallback)(void);
+    void (*mClockCallback)(void);
+    void (*mStartCallback)(void);
+    void (*mContinueCallback)(void);
+    void (*mStopCallback)(void);
+    void (*mActiveSensingCallback)(void);
+    void (*mSystemResetCallback)(void);
+};
+
+// Private method: MIDI parser
+template<class SerialPort>
+bool LegacyMidi<SerialPort>::parse(Channel inChannel)
+{ 
+    const int bytes_available = mSerial.available();
+    
+    if (bytes_available == 0)
+        // No data available.
+        return false;
+    
+    
+    /* Parsing algorithm:
+     Get a byte from the serial buffer.
+     * If there is no pending message to be recomposed, start a new one.
+     - Find type and channel (if pertinent)
+     - Look for other bytes in buffer, call parser recursively, 
+     until the message is assembled or the buffer is empty.
+     * Else, add the extracted byte to the pending message, and check validity. 
+     When the message is done, store it.
+     */
+    
+    const byte extracted = mSerial.read();
+    
+    if (mPendingMessageIndex == 0) 
+    { 
+        // Start a new pending message
+        mPendingMessage[0] = extracted;
+        
+        // Check for running status first
+        switch (getTypeFromStatusByte(mRunningStatus_RX))
+        {
+                // Only these types allow Running Status:
+            case NoteOff:
+            case NoteOn:
+            case AfterTouchPoly:
+            case ControlChange:
+            case ProgramChange:
+            case AfterTouchChannel:
+            case PitchBend:
+                
+                // If the status byte is not received, prepend it 
+                // to the pending message
+                if (extracted < 0x80)
+                {
+                    mPendingMessage[0] = mRunningStatus_RX;
+                    mPendingMessage[1] = extracted;
+                    mPendingMessageIndex = 1;
+                }
+                // Else: well, we received another status byte,
+                // so the running status does not apply here.
+                // It will be updated upon completion of this message.
+                
+                if (mPendingMessageIndex >= (mPendingMessageExpectedLenght-1))
+                {
+                    mMessage.type = getTypeFromStatusByte(mPendingMessage[0]);
+                    mMessage.channel = (mPendingMessage[0] & 0x0F)+1;
+                    mMessage.data1 = mPendingMessage[1];
+                    
+                    // Save data2 only if applicable
+                    if (mPendingMessageExpectedLenght == 3)
+                        mMessage.data2 = mPendingMessage[2];
+                    else 
+                        mMessage.data2 = 0;
+                    
+                    mPendingMessageIndex = 0;
+                    mPendingMessageExpectedLenght = 0;
+                    mMessage.valid = true;
+                    return true;
+                }
+                break;
+            default:
+                // No running status
+                break;
+        }
+        
+        
+        switch (getTypeFromStatusByte(mPendingMessage[0]))
+        {
+                // 1 byte messages
+            case Start:
+            case Continue:
+            case Stop:
+            case Clock:
+            case ActiveSensing:
+            case SystemReset:
+            case TuneRequest:
+                // Handle the message type directly here.
+                mMessage.type = getTypeFromStatusByte(mPendingMessage[0]);
+                mMessage.channel = 0;
+                mMessage.data1 = 0;
+                mMessage.data2 = 0;
+                mMessage.valid = true;
+                
+                // \fix Running Status broken when receiving Clock messages.
+                // Do not reset all input attributes, Running Status must remain unchanged.
+                //resetInput(); 
+                
+                // We still need to reset these
+                mPendingMessageIndex = 0;
+                mPendingMessageExpectedLenght = 0;
+                
+                return true;
+                break;
+                
+                // 2 bytes messages
+            case ProgramChange:
+            case AfterTouchChannel:
+            case TimeCodeQuarterFrame:
+            case SongSelect:
+                mPendingMessageExpectedLenght = 2;
+                break;
+                
+                // 3 bytes messages
+            case NoteOn:
+            case NoteOff:
+            case ControlChange:
+            case PitchBend:
+            case AfterTouchPoly:
+            case SongPosition:
+                mPendingMessageExpectedLenght = 3;
+                break;
+                
+            case SystemExclusive:
+                // The message can be any lenght 
+                // between 3 and MIDI_SYSEX_ARRAY_SIZE bytes
+                mPendingMessageExpectedLenght = MIDI_SYSEX_ARRAY_SIZE; 
+                mRunningStatus_RX = InvalidType;
+                break;
+                
+            case InvalidType:
+            default:
+                // This is obviously wrong. Let's get the hell out'a here.
+                resetInput();
+                return false;
+                break;
+        }
+        
+        // Then update the index of the pending message.
+        mPendingMessageIndex++;
+        
+#if USE_1BYTE_PARSING
+        // Message is not complete.
+        return false;
+#else
+        // Call the parser recursively
+        // to parse the rest of the message.
+        return parse(inChannel);
+#endif
+        
+    }
+    else
+    { 
+        // First, test if this is a status byte
+        if (extracted >= 0x80)
+        {
+            // Reception of status bytes in the middle of an uncompleted message
+            // are allowed only for interleaved Real Time message or EOX
+            switch (extracted)
+            {
+                case Clock:
+                case Start:
+                case Continue:
+                case Stop:
+                case ActiveSensing:
+                case SystemReset:
+                    
+                    // Here we will have to extract the one-byte message, 
+                    // pass it to the structure for being read outside
+                    // the MIDI class, and recompose the message it was 
+                    // interleaved into. Oh, and without killing the running status.. 
+                    // This is done by leaving the pending message as is, 
+                    // it will be completed on next calls.
+                    
+                    mMessage.type = (MidiType)extracted;
+                    mMessage.data1 = 0;
+                    mMessage.data2 = 0;
+                    mMessage.channel = 0;
+                    mMessage.valid = true;
+                    return true;
+                    
+                    break;
+                    
+                    // End of Exclusive
+                case 0xF7:
+                    if (getTypeFromStatusByte(mPendingMessage[0]) == SystemExclusive)
+                    {
+                        // Store System Exclusive array in midimsg structure
+                        for (byte i=0;i<MIDI_SYSEX_ARRAY_SIZE;i++)
+                            mMessage.sysex_array[i] = mPendingMessage[i];
+                        
+                        mMessage.type = SystemExclusive;
+                        
+                        // Get length
+                        mMessage.data1 = (mPendingMessageIndex+1) & 0xFF;    
+                        mMessage.data2 = (mPendingMessageIndex+1) >> 8;
+                        mMessage.channel = 0;
+                        mMessage.valid = true;
+                        
+                        resetInput();
+                        return true;
+                    }
+                    else
+                    {
+                        // Well well well.. error.
+                        resetInput();
+                        return false;
+                    }
+                    
+                    break;
+                default:
+                    break;
+            }
+        }
+        
+        // Add extracted data byte to pending message
+        mPendingMessage[mPendingMessageIndex] = extracted;
+        
+        // Now we are going to check if we have reached the end of the message
+        if (mPendingMessageIndex >= (mPendingMessageExpectedLenght-1))
+        {
+            // "FML" case: fall down here with an overflown SysEx..
+            // This means we received the last possible data byte that can fit 
+            // the buffer. If this happens, try increasing MIDI_SYSEX_ARRAY_SIZE.
+            if (getTypeFromStatusByte(mPendingMessage[0]) == SystemExclusive)
+            {
+                resetInput();
+                return false;
+            }
+            
+            mMessage.type = getTypeFromStatusByte(mPendingMessage[0]);
+            // Don't check if it is a Channel Message
+            mMessage.channel = (mPendingMessage[0] & 0x0F)+1;
+            
+            mMessage.data1 = mPendingMessage[1];
+            
+            // Save data2 only if applicable
+            if (mPendingMessageExpectedLenght == 3)
+                mMessage.data2 = mPendingMessage[2];
+            else 
+                mMessage.data2 = 0;
+            
+            // Reset local variables
+            mPendingMessageIndex = 0;
+            mPendingMessageExpectedLenght = 0;
+            
+            mMessage.valid = true;
+            
+            // Activate running status (if enabled for the received type)
+            switch (mMessage.type)
+            {
+                case NoteOff:
+                case NoteOn:
+                case AfterTouchPoly:
+                case ControlChange:
+                case ProgramChange:
+                case AfterTouchChannel:
+                case PitchBend:    
+                    // Running status enabled: store it from received message
+                    mRunningStatus_RX = mPendingMessage[0];
+                    break;
+                    
+                default:
+                    // No running status
+                    mRunningStatus_RX = InvalidType;
+                    break;
+            }
+            return true;
+        }
+        else
+        {
+            // Then update the index of the pending message.
+            mPendingMessageIndex++;
+            
+#if USE_1BYTE_PARSING
+            // Message is not complete.
+            return false;
+#else
+            // Call the parser recursively
+            // to parse the rest of the message.
+            return parse(inChannel);
+#endif
+        }
+    }
+    
+    // What are our chances to fall here?
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+
+template<class SerialPort>
+void LegacyMidi<SerialPort>::launchCallback()
+{
+    // The order is mixed to allow frequent messages to trigger their callback faster.
+    switch (mMessage.type)
+    {
+            // Notes
+        case NoteOff:               if (mNoteOffCallback != 0)               mNoteOffCallback(mMessage.channel,mMessage.data1,mMessage.data2);   break;
+        case NoteOn:                if (mNoteOnCallback != 0)                mNoteOnCallback(mMessage.channel,mMessage.data1,mMessage.data2);    break;
+            
+            // Real-time messages
+        case Clock:                 if (mClockCallback != 0)                 mClockCallback();           break;            
+        case Start:                 if (mStartCallback != 0)                 mStartCallback();           break;
+        case Continue:              if (mContinueCallback != 0)              mContinueCallback();        break;
+        case Stop:                  if (mStopCallback != 0)                  mStopCallback();            break;
+        case ActiveSensing:         if (mActiveSensingCallback != 0)         mActiveSensingCallback();   break;
+            
+            // Continuous controllers
+        case ControlChange:         if (mControlChangeCallback != 0)         mControlChangeCallback(mMessage.channel,mMessage.data1,mMessage.data2);    break;
+        case PitchBend:             if (mPitchBendCallback != 0)             mPitchBendCallback(mMessage.channel,(int)((mMessage.data1 & 0x7F) | ((mMessage.data2 & 0x7F)<< 7)) + MIDI_PITCHBEND_MIN); break; // TODO: check this
+        case AfterTouchPoly:        if (mAfterTouchPolyCallback != 0)        mAfterTouchPolyCallback(mMessage.channel,mMessage.data1,mMessage.data2);    break;
+        case AfterTouchChannel:     if (mAfterTouchChannelCallback != 0)     mAfterTouchChannelCallback(mMessage.channel,mMessage.data1);    break;
+            
+        case ProgramChange:         if (mProgramChangeCallback != 0)         mProgramChangeCallback(mMessage.channel,mMessage.data1);    break;
+        case SystemExclusive:       if (mSystemExclusiveCallback != 0)       mSystemExclusiveCallback(mMessage.sysex_array,mMessage.data1);    break;
+            
+            // Occasional messages
+        case TimeCodeQuarterFrame:  if (mTimeCodeQuarterFrameCallback != 0)  mTimeCodeQuarterFrameCallback(mMessage.data1);    break;
+        case SongPosition:          if (mSongPositionCallback != 0)          mSongPositionCallback((mMessage.data1 & 0x7F) | ((mMessage.data2 & 0x7F)<< 7));    break;
+        case SongSelect:            if (mSongSelectCallback != 0)            mSongSelectCallback(mMessage.data1);    break;
+        case TuneRequest:           if (mTuneRequestCallback != 0)           mTuneRequestCallback();    break;
+            
+        case SystemReset:           if (mSystemResetCallback != 0)           mSystemResetCallback();    break;
+        case InvalidType:
+        default:
+            break;
+    }
+}
+
+END_MIDI_NAMESPACE
@@ -0,0 +1,350 @@
+/*
+ * Output timing benchmark for the MidiInterface scheduler
+ *
+ * Plays two seconds of a sequence on a simulated clock: 16th notes, a
+ * dense Control Change sweep, pitch bend on a second channel and MIDI
+ * Clock.  The sequence is sent twice over a 31250 baud UART model while
+ * loop() takes a random 0.2 to 4 ms per pass:
+ *  - immediately, with the send methods, when loop() sees the event due,
+ *  - queued ahead by loop() with schedule(), and sent by tick() from a
+ *    250 us timer.
+ * A second MidiInterface receives the wire bytes and timestamps every
+ * message as its last byte arrives.  Prints the latency spread (jitter)
+ * of both, and the bytes saved by running status.  Also checks the queue
+ * order on equal times, across the wrap of the clock, and with hundreds
+ * of messages queued between two of the same time.
+ * Exits non-zero if a message is lost or out of order.
+ */
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "MIDI.h"
+
+USING_NAMESPACE_MIDI
+
+#define BYTE_TIME       320     // us per byte at 31250 baud
+#define TICK_PERIOD     250     // us between timer ticks
+#define LOOKAHEAD       10000   // us queued ahead by loop()
+#define DURATION        2000000 // us of sequence
+
+//------------------------------------------------------------------------------
+// Small deterministic generator so every run sees the same loop timing
+static unsigned long seed = 12345;
+static unsigned int nextRandom(unsigned int n)
+{
+    seed = seed * 1103515245UL + 12345;
+    return (seed >> 16) % n;
+}
+
+//------------------------------------------------------------------------------
+// Simulated clock and UART
+
+static unsigned long now;       // us, as micros() would return
+static unsigned long rxTime;    // arrival of the byte being received
+
+static unsigned long simMicros() { return now; }
+static unsigned long rxMicros()  { return rxTime; }
+
+struct WireByte
+{
+    unsigned long end; // time the stop bit is out
+    byte value;
+};
+
+class MockUart
+{
+public:
+    MockUart() : free(0) {}
+
+    void begin(long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    void write(byte b)
+    {
+        const unsigned long start = (now > free) ? now : free;
+        free = start + BYTE_TIME;
+        WireByte w = { free, b };
+        wire.push_back(w);
+    }
+
+    unsigned long free;
+    std::vector<WireByte> wire;
+};
+
+//------------------------------------------------------------------------------
+// The sequence
+
+struct Event
+{
+    unsigned long time;
+    MidiType type;
+    Channel channel;
+    byte data1;
+    byte data2;
+};
+
+static std::vector<Event> sequence;
+
+static void add(unsigned long time, MidiType type, Channel channel, byte d1, byte d2)
+{
+    Event e = { time, type, channel, d1, d2 };
+    sequence.push_back(e);
+}
+
+static bool byTime(const Event& a, const Event& b) { return a.time < b.time; }
+
+static void buildSequence()
+{
+    for (unsigned long t = 0; t < DURATION; t += 125000)
+    {
+        const byte note = 36 + nextRandom(24);
+        add(t, NoteOn, 1, note, 100);
+        add(t + 60000, NoteOff, 1, note, 0);
+    }
+    for (unsigned long t = 1000, v = 0; t < DURATION; t += 2000, ++v)
+        add(t, ControlChange, 1, 74, (v & 0x40) ? 127 - (v & 0x3F) * 2 : (v & 0x3F) * 2);
+    for (unsigned long t = 500, v = 0; t < DURATION; t += 5000, ++v)
+        add(t, PitchBend, 2, v & 0x7F, 64);
+    for (unsigned long t = 0; t < DURATION; t += 20833)
+        add(t, Clock, 0, 0, 0);
+
+    // Stable sort keeps the order of events sharing a time.
+    std::stable_sort(sequence.begin(), sequence.end(), byTime);
+}
+
+static unsigned int fullLength(MidiType type)
+{
+    if (type >= 0xF8)
+        return 1;
+    return (type == ProgramChange || type == AfterTouchChannel) ? 2 : 3;
+}
+
+//------------------------------------------------------------------------------
+// Players
+
+static void sendNow(MidiInterface<MockUart>& midi, const Event& e)
+{
+    if (e.type == Clock)
+        midi.sendRealTime(Clock);
+    else
+        midi.send(e.type, e.data1, e.data2, e.channel);
+}
+
+// Sends each event when loop() finds it due.
+static void playImmediate(MockUart& uart)
+{
+    MidiInterface<MockUart> midi(uart);
+    midi.begin();
+
+    unsigned int next = 0;
+    for (now = 0; next < sequence.size(); now += 200 + nextRandom(3800))
+    {
+        while (next < sequence.size() && sequence[next].time <= now)
+            sendNow(midi, sequence[next++]);
+    }
+}
+
+// Queues events ahead from loop(), sends them from the timer tick.
+static void playScheduled(MockUart& uart)
+{
+    MidiInterface<MockUart> midi(uart);
+    midi.begin();
+    midi.setTimeSource(simMicros);
+
+    unsigned int next = 0;
+    unsigned long nextLoop = 0;
+    unsigned long nextTick = 0;
+
+    while (next < sequence.size() || midi.getScheduledCount() > 0)
+    {
+        if (nextTick <= nextLoop)
+        {
+            now = nextTick;
+            midi.tick();
+            nextTick += TICK_PERIOD;
+        }
+        else
+        {
+            now = nextLoop;
+            while (next < sequence.size() && sequence[next].time < now + LOOKAHEAD)
+            {
+                const Event& e = sequence[next];
+                if (!midi.schedule(e.time, e.type, e.data1, e.data2, e.channel ? e.channel : 1))
+                    break; // Queue full, try again on the next pass.
+                next++;
+            }
+            nextLoop += 200 + nextRandom(3800);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Receiver
+
+struct Received
+{
+    unsigned long time;
+    MidiType type;
+    Channel channel;
+    byte data1;
+    byte data2;
+};
+
+static std::vector<Received> received;
+static MockUart rxPort;
+static MidiInterface<MockUart> receiver(rxPort);
+
+static void onMessage()
+{
+    Received r = { receiver.getTimestamp(), receiver.getType(), receiver.getChannel(),
+                   receiver.getData1(), receiver.getData2() };
+    received.push_back(r);
+}
+static void onChannel(byte, byte, byte) { onMessage(); }
+static void onBend(byte, int)           { onMessage(); }
+
+static unsigned int receive(const MockUart& uart)
+{
+    received.clear();
+    receiver.begin(MIDI_CHANNEL_OMNI);
+    receiver.turnThruOff();
+    receiver.setTimeSource(rxMicros);
+    receiver.setHandleNoteOn(onChannel);
+    receiver.setHandleNoteOff(onChannel);
+    receiver.setHandleControlChange(onChannel);
+    receiver.setHandlePitchBend(onBend);
+    receiver.setHandleClock(onMessage);
+
+    for (unsigned int i = 0; i < uart.wire.size(); ++i)
+    {
+        rxTime = uart.wire[i].end;
+        receiver.feed(&uart.wire[i].value, 1);
+    }
+
+    // Same messages, same order
+    unsigned int errors = (received.size() != sequence.size()) ? 1 : 0;
+    for (unsigned int i = 0; i < received.size() && i < sequence.size(); ++i)
+    {
+        const Event& e = sequence[i];
+        const Received& r = received[i];
+        if (r.type != e.type || (e.type != Clock &&
+            (r.channel != e.channel || r.data1 != e.data1 || r.data2 != e.data2)))
+            errors++;
+    }
+    return errors;
+}
+
+static void report(const char* name, const MockUart& uart)
+{
+    double sum = 0, sum2 = 0;
+    long lo = 0x7FFFFFFF, hi = -0x7FFFFFFF;
+    unsigned int full = 0;
+
+    for (unsigned int i = 0; i < received.size(); ++i)
+    {
+        const long latency = received[i].time - sequence[i].time;
+        sum += latency;
+        sum2 += (double)latency * latency;
+        if (latency < lo) lo = latency;
+        if (latency > hi) hi = latency;
+        full += fullLength(sequence[i].type);
+    }
+    const double mean = sum / received.size();
+    const double sd = sqrt(sum2 / received.size() - mean * mean);
+
+    printf("%-10s latency mean %7.0f us  sd %6.0f us  min %6ld  max %6ld   "
+           "%u bytes (%u without running status, %.1f%% saved)\n",
+           name, mean, sd, lo, hi, (unsigned)uart.wire.size(), full,
+           100.0 * (full - uart.wire.size()) / full);
+}
+
+//------------------------------------------------------------------------------
+// Queue order checks
+
+static unsigned int checkOrder()
+{
+    unsigned int errors = 0;
+    const unsigned long base[] = { 1000, 0xFFFFFF00UL };
+
+    for (int b = 0; b < 2; ++b)
+    {
+        MockUart uart;
+        MidiInterface<MockUart> midi(uart);
+        midi.begin();
+        now = base[b];
+
+        // Out of order times, and runs of equal times queued in order:
+        // note numbers give the expected output order.
+        const unsigned long offsets[] = { 700, 100, 500, 100, 300, 700, 100, 0x200 };
+        const byte expected[] = { 6, 0, 4, 1, 3, 7, 2, 5 };
+        for (int i = 0; i < 8; ++i)
+        {
+            if (!midi.schedule(base[b] + offsets[i], NoteOn, expected[i], 1, 1))
+                errors++;
+        }
+
+        // Fill the queue, one more must be refused.
+        for (int i = 8; i < MIDI_SCHEDULER_QUEUE_SIZE; ++i)
+            midi.schedule(base[b] + 0x10000, NoteOff, 0, 0, 1);
+        if (midi.schedule(base[b] + 0x10000, NoteOff, 0, 0, 1))
+            errors++;
+
+        // Nothing is due before its time.
+        midi.tick(base[b] + 99);
+        if (!uart.wire.empty())
+            errors++;
+
+        midi.tick(base[b] + 0x1000);
+        std::vector<byte> notes;
+        for (unsigned int i = 1; i < uart.wire.size(); i += 2)
+            notes.push_back(uart.wire[i].value);
+        for (unsigned int i = 0; i < notes.size(); ++i)
+        {
+            if (notes[i] != i)
+                errors++;
+        }
+        if (notes.size() != 8 || midi.getScheduledCount() != MIDI_SCHEDULER_QUEUE_SIZE - 8)
+            errors++;
+    }
+
+    // Equal times stay in order with hundreds of messages queued between
+    // them, sent meanwhile as the queue only holds a few.
+    MockUart uart;
+    MidiInterface<MockUart> midi(uart);
+    midi.begin();
+    midi.schedule(1000, NoteOff, 60, 0, 1);
+    for (int i = 0; i < 200; ++i)
+    {
+        midi.schedule(500, ControlChange, 7, i & 0x7F, 1);
+        midi.tick(500);
+    }
+    midi.schedule(1000, NoteOn, 60, 100, 1);
+    const size_t sent = uart.wire.size();
+    midi.tick(1000);
+    if (uart.wire.size() != sent + 6 || uart.wire[sent].value != 0x80 ||
+        uart.wire[sent + 3].value != 0x90)
+        errors++;
+    return errors;
+}
+
+int main()
+{
+    buildSequence();
+
+    MockUart immediate, scheduled;
+    playImmediate(immediate);
+    playScheduled(scheduled);
+
+    unsigned int errors = checkOrder();
+    printf("queue order: %s\n", errors ? "MISMATCH" : "ok");
+
+    const unsigned int immediateErrors = receive(immediate);
+    report("immediate", immediate);
+    const unsigned int scheduledErrors = receive(scheduled);
+    report("scheduled", scheduled);
+
+    errors += immediateErrors + scheduledErrors;
+    printf("%u messages, %u mismatches\n", (unsigned)sequence.size(), errors);
+    return errors ? 1 : 0;
+}
@@ -23,6 +23,10 @@
 #   error For thru to work, you need to enable input.
 #endif
 
+#if MIDI_USE_SCHEDULER && (MIDI_SCHEDULER_QUEUE_SIZE > 128)
+#   error The scheduler queue can hold up to 128 events.
+#endif
+
 // -----------------------------------------------------------------------------
 
 #if MIDI_AUTO_INSTANCIATE
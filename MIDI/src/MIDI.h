@@ -95,6 +95,9 @@ public:
     bool read();
     bool read(Channel inChannel);
     
+    unsigned int feed(const byte* inData, unsigned int inLength);
+    unsigned int feed(const byte* inData, unsigned int inLength, Channel inChannel);
+    
 public:
     inline MidiType getType() const;
     inline Channel  getChannel() const;
@@ -103,6 +106,9 @@ public:
     inline const byte* getSysExArray() const;
     inline unsigned int getSysExArrayLength() const;
     inline bool check() const;
+#if MIDI_USE_SCHEDULER
+    inline unsigned long getTimestamp() const;
+#endif
     
 public:
     inline Channel getInputChannel() const;
@@ -113,18 +119,25 @@ public:
 	
 private:
     bool inputFilter(Channel inChannel);
+    bool processMessage(Channel inChannel);
     bool parse(Channel inChannel);
+    inline bool parseByte(byte inByte);
+    bool storeSysExByte(byte inByte);
     void resetInput();
     
+    static inline byte getMessageLength(StatusByte inStatus);
+    
 private:
     StatusByte mRunningStatus_RX;
     Channel    mInputChannel;
     
     byte         mPendingMessage[3];             // SysEx are dumped into mMessage directly.
-    unsigned int mPendingMessageExpectedLenght;
+    unsigned int mPendingMessageExpectedLenght;  // 0 when no message is pending.
     unsigned int mPendingMessageIndex;           // Extended to unsigned int for larger SysEx payloads.
     Message mMessage;
     
+    static const byte sSystemMessageLength[16];
+    
     
     // -------------------------------------------------------------------------
     // Input Callbacks
@@ -140,6 +153,7 @@ public:
     inline void setHandleAfterTouchChannel(void (*fptr)(byte channel, byte pressure));
     inline void setHandlePitchBend(void (*fptr)(byte channel, int bend));
     inline void setHandleSystemExclusive(void (*fptr)(byte * array, byte size));
+    inline void setHandleSystemExclusiveChunk(void (*fptr)(const byte* data, unsigned int size, bool last));
     inline void setHandleTimeCodeQuarterFrame(void (*fptr)(byte data));
     inline void setHandleSongPosition(void (*fptr)(unsigned int beats));
     inline void setHandleSongSelect(void (*fptr)(byte songnumber));
@@ -156,6 +170,7 @@ public:
 private:
     
     void launchCallback();
+    void flushSysExChunk(bool inLast);
     
     void (*mNoteOffCallback)(byte channel, byte note, byte velocity);
     void (*mNoteOnCallback)(byte channel, byte note, byte velocity);
@@ -165,6 +180,7 @@ private:
     void (*mAfterTouchChannelCallback)(byte channel, byte);
     void (*mPitchBendCallback)(byte channel, int);
     void (*mSystemExclusiveCallback)(byte * array, byte size);
+    void (*mSystemExclusiveChunkCallback)(const byte* data, unsigned int size, bool last);
     void (*mTimeCodeQuarterFrameCallback)(byte data);
     void (*mSongPositionCallback)(unsigned int beats);
     void (*mSongSelectCallback)(byte songnumber);
@@ -204,6 +220,48 @@ private:
     
 #endif // MIDI_BUILD_THRU
     
+    
+    // -------------------------------------------------------------------------
+    // MIDI Scheduler
+    
+#if MIDI_USE_SCHEDULER
+    
+public:
+    inline void setTimeSource(unsigned long (*fptr)(void));
+    
+#if MIDI_BUILD_OUTPUT
+    
+public:
+    bool schedule(unsigned long inTime,
+                  MidiType inType,
+                  DataByte inData1,
+                  DataByte inData2,
+                  Channel inChannel);
+    
+    void tick();
+    void tick(unsigned long inNow);
+    
+    inline byte getScheduledCount() const;
+    inline void clearSchedule();
+    
+private:
+    static inline bool isEarlier(const ScheduledEvent& inA,
+                                 const ScheduledEvent& inB);
+    void removeFirstEvent();
+    
+private:
+    ScheduledEvent  mSchedule[MIDI_SCHEDULER_QUEUE_SIZE]; // Binary min-heap.
+    volatile byte   mScheduleSize;
+    unsigned long   mScheduleOrder;
+    volatile bool   mScheduleLocked;
+    
+#endif // MIDI_BUILD_OUTPUT
+    
+private:
+    unsigned long (*mTimeSource)(void);
+    
+#endif // MIDI_USE_SCHEDULER
+    
 
 #if MIDI_USE_RUNNING_STATUS
     
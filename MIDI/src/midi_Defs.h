@@ -192,8 +192,33 @@ struct Message
      */
     bool valid;
     
+#if MIDI_USE_SCHEDULER
+    /*! The time at which the message was received,
+     as given by the time source of the scheduler.
+     */
+    unsigned long timestamp;
+#endif
+    
+};
+
+// -----------------------------------------------------------------------------
+
+#if MIDI_USE_SCHEDULER
+
+/*! A message waiting in the scheduler queue.
+ Channel messages keep their channel in the status byte.
+ */
+struct ScheduledEvent
+{
+    unsigned long time;     ///< When to send the message.
+    StatusByte status;
+    DataByte data1;
+    DataByte data2;
+    unsigned long order;    ///< Keeps the order of events sharing a time.
 };
 
+#endif
+
 // -----------------------------------------------------------------------------
 
 #define MIDI_CREATE_INSTANCE(Type, SerialPort, Name)                            \
@@ -26,6 +26,7 @@ MidiInterface<SerialPort>::MidiInterface(SerialPort& inSerial)
     mAfterTouchChannelCallback      = 0;
     mPitchBendCallback              = 0;
     mSystemExclusiveCallback        = 0;
+    mSystemExclusiveChunkCallback   = 0;
     mTimeCodeQuarterFrameCallback   = 0;
     mSongPositionCallback           = 0;
     mSongSelectCallback             = 0;
@@ -37,6 +38,10 @@ MidiInterface<SerialPort>::MidiInterface(SerialPort& inSerial)
     mActiveSensingCallback          = 0;
     mSystemResetCallback            = 0;
 #endif
+    
+#if MIDI_USE_SCHEDULER
+    mTimeSource                     = 0;
+#endif
 }
 
 /*! \brief Destructor for MidiInterface.
@@ -82,6 +87,10 @@ void MidiInterface<SerialPort>::begin(Channel inChannel)
     mMessage.data1 = 0;
     mMessage.data2 = 0;
     
+#if MIDI_USE_SCHEDULER
+    mMessage.timestamp = 0;
+#endif
+    
 #endif // MIDI_BUILD_INPUT
     
     
@@ -92,6 +101,15 @@ void MidiInterface<SerialPort>::begin(Channel inChannel)
     
 #endif // Thru
     
+    
+#if MIDI_BUILD_OUTPUT && MIDI_USE_SCHEDULER
+    
+    mScheduleSize = 0;
+    mScheduleOrder = 0;
+    mScheduleLocked = false;
+    
+#endif // MIDI_BUILD_OUTPUT && MIDI_USE_SCHEDULER
+    
 }
 
 
@@ -469,312 +487,319 @@ bool MidiInterface<SerialPort>::read(Channel inChannel)
         return false; // MIDI Input disabled.
     
     if (parse(inChannel))
+        return processMessage(inChannel);
+    
+    return false;
+}
+
+/*! \brief Parse a buffer of MIDI bytes using the main input channel.
+ 
+ @see feed(const byte*, unsigned int, Channel)
+ */
+template<class SerialPort>
+unsigned int MidiInterface<SerialPort>::feed(const byte* inData,
+                                             unsigned int inLength)
+{
+    return feed(inData, inLength, mInputChannel);
+}
+
+/*! \brief Parse a buffer of MIDI bytes on a specified channel.
+ 
+ Use this when the bytes do not come from the serial port (USB packets,
+ a file, a DMA buffer...). The whole buffer is consumed in a single call:
+ each complete message is filtered, sent to the Thru and passed to its
+ callback as it is parsed, and incomplete messages are carried over to
+ the next call.
+ \return The number of messages received on the channel.
+ */
+template<class SerialPort>
+unsigned int MidiInterface<SerialPort>::feed(const byte* inData,
+                                             unsigned int inLength,
+                                             Channel inChannel)
+{
+    if (inChannel >= MIDI_CHANNEL_OFF)
+        return 0; // MIDI Input disabled.
+    
+    unsigned int count = 0;
+    
+    for (unsigned int i = 0; i < inLength; ++i)
     {
-        if (inputFilter(inChannel))
-        {
-            
+        if (parseByte(inData[i]) && processMessage(inChannel))
+            count++;
+    }
+    
+    return count;
+}
+
+// Private method: filter the message stored in the structure, 
+// then mirror it to the Thru and launch its callback.
+template<class SerialPort>
+bool MidiInterface<SerialPort>::processMessage(Channel inChannel)
+{
+#if MIDI_USE_SCHEDULER
+    mMessage.timestamp = (mTimeSource != 0) ? mTimeSource() : 0;
+#endif
+    
+    if (!inputFilter(inChannel))
+        return false;
+    
 #if (MIDI_BUILD_OUTPUT && MIDI_BUILD_THRU)
-            thruFilter(inChannel);
+    thruFilter(inChannel);
 #endif
-            
+    
 #if MIDI_USE_CALLBACKS
-            launchCallback();
+    launchCallback();
 #endif
-            return true;
-        }
-    }
     
-    return false;
+    return true;
 }
 
 // -----------------------------------------------------------------------------
 
+// Total length of the System messages (status byte included), indexed by the 
+// low nibble of the status byte. 0 marks undefined status bytes, SysEx start 
+// and EOX, which are handled separately.
+template<class SerialPort>
+const byte MidiInterface<SerialPort>::sSystemMessageLength[16] = 
+{
+    0, 2, 3, 2, 0, 0, 1, 0,     // 0xF0 - 0xF7: System Exclusive and Common
+    1, 0, 1, 1, 1, 0, 1, 1      // 0xF8 - 0xFF: Real Time
+};
+
+// Private method: total length of the message started by a status byte.
+template<class SerialPort>
+byte MidiInterface<SerialPort>::getMessageLength(StatusByte inStatus)
+{
+    if (inStatus < 0xF0)
+        // Program Change and Channel AfterTouch carry a single data byte.
+        return ((inStatus & 0xE0) == 0xC0) ? 2 : 3;
+    
+    return sSystemMessageLength[inStatus & 0x0F];
+}
+
 // Private method: MIDI parser
 template<class SerialPort>
 bool MidiInterface<SerialPort>::parse(Channel inChannel)
 { 
-    const byte bytes_available = mSerial.available();
-    
-    if (bytes_available == 0)
-        // No data available.
-        return false;
-    
-    
     /* Parsing algorithm:
-     Get a byte from the serial buffer.
-     * If there is no pending message to be recomposed, start a new one.
-     - Find type and channel (if pertinent)
-     - Look for other bytes in buffer, call parser recursively, 
-     until the message is assembled or the buffer is empty.
-     * Else, add the extracted byte to the pending message, and check validity. 
-     When the message is done, store it.
+     Consume the serial buffer byte by byte, until a message is complete
+     or the buffer is empty. Incomplete messages are kept in the pending
+     message and completed on the next calls, so a burst of Running Status
+     or a whole SysEx dump is processed in a single call, without recursion.
      */
     
-    const byte extracted = mSerial.read();
-    
-    if (mPendingMessageIndex == 0) 
-    { 
-        // Start a new pending message
-        mPendingMessage[0] = extracted;
+    while (mSerial.available() > 0)
+    {
+        byte extracted = mSerial.read();
         
-        // Check for running status first
-        switch (getTypeFromStatusByte(mRunningStatus_RX))
+        if (extracted < 0x80 && 
+            mPendingMessageExpectedLenght != 0 && 
+            mPendingMessage[0] == SystemExclusive &&
+            mPendingMessageIndex < MIDI_SYSEX_ARRAY_SIZE)
         {
-                // Only these types allow Running Status:
-            case NoteOff:
-            case NoteOn:
-            case AfterTouchPoly:
-            case ControlChange:
-            case ProgramChange:
-            case AfterTouchChannel:
-            case PitchBend:
-                
-                // If the status byte is not received, prepend it 
-                // to the pending message
-                if (extracted < 0x80)
-                {
-                    mPendingMessage[0] = mRunningStatus_RX;
-                    mPendingMessage[1] = extracted;
-                    mPendingMessageIndex = 1;
-                }
-                // Else: well, we received another status byte,
-                // so the running status does not apply here.
-                // It will be updated upon completion of this message.
-                
-                if (mPendingMessageIndex >= (mPendingMessageExpectedLenght-1))
+            // SysEx payload: copy the run of data bytes straight into the 
+            // array, and give the byte that ends it to the parser.
+            byte* const array = mMessage.sysex_array;
+            unsigned int index = mPendingMessageIndex;
+            int available = mSerial.available();
+            int next = -1;
+            
+            array[index++] = extracted;
+            
+            while (index < MIDI_SYSEX_ARRAY_SIZE && available-- > 0)
+            {
+                const byte data = mSerial.read();
+                if (data >= 0x80)
                 {
-                    mMessage.type = getTypeFromStatusByte(mPendingMessage[0]);
-                    mMessage.channel = (mPendingMessage[0] & 0x0F)+1;
-                    mMessage.data1 = mPendingMessage[1];
-                    
-                    // Save data2 only if applicable
-                    if (mPendingMessageExpectedLenght == 3)
-                        mMessage.data2 = mPendingMessage[2];
-                    else 
-                        mMessage.data2 = 0;
-                    
-                    mPendingMessageIndex = 0;
-                    mPendingMessageExpectedLenght = 0;
-                    mMessage.valid = true;
-                    return true;
+                    next = data;
+                    break;
                 }
-                break;
-            default:
-                // No running status
-                break;
+                array[index++] = data;
+            }
+            
+            mPendingMessageIndex = index;
+            
+            if (next < 0)
+                continue;
+            
+            extracted = next;
         }
         
+        if (parseByte(extracted))
+            return true;
+    }
+    
+    return false;
+}
+
+// Private method: feed one byte to the parser.
+// Returns true when a message has been stored in the structure.
+template<class SerialPort>
+bool MidiInterface<SerialPort>::parseByte(byte inByte)
+{
+    const bool sysex_pending = (mPendingMessageExpectedLenght != 0 && 
+                                mPendingMessage[0] == SystemExclusive);
+    
+    if (inByte < 0x80)
+    {
+        // Data byte. SysEx payload first, as dumps are the bulk of the traffic.
+        if (sysex_pending)
+        {
+            if (mPendingMessageIndex < MIDI_SYSEX_ARRAY_SIZE)
+                mMessage.sysex_array[mPendingMessageIndex++] = inByte;
+            else
+                storeSysExByte(inByte);
+            return false;
+        }
         
-        switch (getTypeFromStatusByte(mPendingMessage[0]))
+        if (mPendingMessageExpectedLenght == 0)
         {
-                // 1 byte messages
-            case Start:
-            case Continue:
-            case Stop:
-            case Clock:
-            case ActiveSensing:
-            case SystemReset:
-            case TuneRequest:
-                // Handle the message type directly here.
-                mMessage.type = getTypeFromStatusByte(mPendingMessage[0]);
-                mMessage.channel = 0;
-                mMessage.data1 = 0;
-                mMessage.data2 = 0;
-                mMessage.valid = true;
-                
-                // \fix Running Status broken when receiving Clock messages.
-                // Do not reset all input attributes, Running Status must remain unchanged.
-                //resetInput(); 
-                
-                // We still need to reset these
-                mPendingMessageIndex = 0;
-                mPendingMessageExpectedLenght = 0;
-                
-                return true;
-                break;
-                
-                // 2 bytes messages
-            case ProgramChange:
-            case AfterTouchChannel:
-            case TimeCodeQuarterFrame:
-            case SongSelect:
-                mPendingMessageExpectedLenght = 2;
-                break;
-                
-                // 3 bytes messages
-            case NoteOn:
-            case NoteOff:
-            case ControlChange:
-            case PitchBend:
-            case AfterTouchPoly:
-            case SongPosition:
-                mPendingMessageExpectedLenght = 3;
-                break;
-                
-            case SystemExclusive:
-                // The message can be any lenght 
-                // between 3 and MIDI_SYSEX_ARRAY_SIZE bytes
-                mPendingMessageExpectedLenght = MIDI_SYSEX_ARRAY_SIZE; 
-                mRunningStatus_RX = InvalidType;
-                break;
-                
-            case InvalidType:
-            default:
-                // This is obviously wrong. Let's get the hell out'a here.
-                resetInput();
-                return false;
-                break;
+            if (mRunningStatus_RX == InvalidType)
+                return false; // Orphan data byte, ignore it.
+            
+            // Running Status: the status byte is implied.
+            mPendingMessage[0] = mRunningStatus_RX;
+            mPendingMessageIndex = 1;
+            mPendingMessageExpectedLenght = getMessageLength(mRunningStatus_RX);
         }
         
-        // Then update the index of the pending message.
-        mPendingMessageIndex++;
+        mPendingMessage[mPendingMessageIndex++] = inByte;
         
-#if USE_1BYTE_PARSING
-        // Message is not complete.
-        return false;
-#else
-        // Call the parser recursively
-        // to parse the rest of the message.
-        return parse(inChannel);
-#endif
+        if (mPendingMessageIndex < mPendingMessageExpectedLenght)
+            return false; // Message is not complete.
+        
+        const StatusByte status = mPendingMessage[0];
+        
+        mMessage.type = getTypeFromStatusByte(status);
+        mMessage.channel = (status < 0xF0) ? (status & 0x0F) + 1 : 0;
+        mMessage.data1 = mPendingMessage[1];
+        
+        // Save data2 only if applicable
+        if (mPendingMessageExpectedLenght == 3)
+            mMessage.data2 = mPendingMessage[2];
+        else 
+            mMessage.data2 = 0;
+        
+        mMessage.valid = true;
         
+        mPendingMessageIndex = 0;
+        mPendingMessageExpectedLenght = 0;
+        return true;
     }
-    else
-    { 
-        // First, test if this is a status byte
-        if (extracted >= 0x80)
+    
+    if (inByte >= 0xF8)
+    {
+        // Real Time messages can be interleaved anywhere, even in SysEx.
+        // They are passed on without touching the pending message
+        // nor the running status.
+        if (sSystemMessageLength[inByte & 0x0F] == 0)
+            return false; // Undefined, ignore it.
+        
+        mMessage.type = (MidiType)inByte;
+        mMessage.channel = 0;
+        mMessage.data1 = 0;
+        mMessage.data2 = 0;
+        mMessage.valid = true;
+        return true;
+    }
+    
+    if (inByte == 0xF7)
+    {
+        // End of Exclusive
+        if (!sysex_pending || !storeSysExByte(inByte))
         {
-            // Reception of status bytes in the middle of an uncompleted message
-            // are allowed only for interleaved Real Time message or EOX
-            switch (extracted)
-            {
-                case Clock:
-                case Start:
-                case Continue:
-                case Stop:
-                case ActiveSensing:
-                case SystemReset:
-                    
-                    // Here we will have to extract the one-byte message, 
-                    // pass it to the structure for being read outside
-                    // the MIDI class, and recompose the message it was 
-                    // interleaved into. Oh, and without killing the running status.. 
-                    // This is done by leaving the pending message as is, 
-                    // it will be completed on next calls.
-                    
-                    mMessage.type = (MidiType)extracted;
-                    mMessage.data1 = 0;
-                    mMessage.data2 = 0;
-                    mMessage.channel = 0;
-                    mMessage.valid = true;
-                    return true;
-                    
-                    break;
-                    
-                    // End of Exclusive
-                case 0xF7:
-                    if (getTypeFromStatusByte(mPendingMessage[0]) == SystemExclusive)
-                    {
-                        // Store System Exclusive array in midimsg structure
-                        for (byte i=0;i<MIDI_SYSEX_ARRAY_SIZE;i++)
-                            mMessage.sysex_array[i] = mPendingMessage[i];
-                        
-                        mMessage.type = SystemExclusive;
-                        
-                        // Get length
-                        mMessage.data1 = (mPendingMessageIndex+1) & 0xFF;    
-                        mMessage.data2 = (mPendingMessageIndex+1) >> 8;
-                        mMessage.channel = 0;
-                        mMessage.valid = true;
-                        
-                        resetInput();
-                        return true;
-                    }
-                    else
-                    {
-                        // Well well well.. error.
-                        resetInput();
-                        return false;
-                    }
-                    
-                    break;
-                default:
-                    break;
-            }
+            resetInput();
+            return false;
         }
         
-        // Add extracted data byte to pending message
-        mPendingMessage[mPendingMessageIndex] = extracted;
+        mMessage.type = SystemExclusive;
+        mMessage.channel = 0;
+        mMessage.data1 = mPendingMessageIndex & 0xFF;
+        mMessage.data2 = mPendingMessageIndex >> 8;
+        mMessage.valid = true;
         
-        // Now we are going to check if we have reached the end of the message
-        if (mPendingMessageIndex >= (mPendingMessageExpectedLenght-1))
+        mPendingMessageIndex = 0;
+        mPendingMessageExpectedLenght = 0;
+        return true;
+    }
+    
+    if (sysex_pending)
+    {
+        // Any other status byte terminates an unfinished SysEx.
+        // A chunked dump gets its last fragment, without EOX.
+#if MIDI_USE_CALLBACKS
+        if (mSystemExclusiveChunkCallback != 0)
+            flushSysExChunk(true);
+#endif
+    }
+    
+    // Only Channel messages allow Running Status.
+    mRunningStatus_RX = (inByte < 0xF0) ? inByte : InvalidType;
+    
+    if (inByte == SystemExclusive)
+    {
+        // The message can be any length, it is stored in mMessage.
+        mPendingMessage[0] = inByte;
+        mPendingMessageExpectedLenght = MIDI_SYSEX_ARRAY_SIZE;
+        mPendingMessageIndex = 0;
+        storeSysExByte(inByte);
+        return false;
+    }
+    
+    const byte length = getMessageLength(inByte);
+    
+    if (length == 0)
+    {
+        // Undefined status byte.
+        resetInput();
+        return false;
+    }
+    
+    if (length == 1)
+    {
+        // Tune Request
+        mMessage.type = (MidiType)inByte;
+        mMessage.channel = 0;
+        mMessage.data1 = 0;
+        mMessage.data2 = 0;
+        mMessage.valid = true;
+        
+        mPendingMessageIndex = 0;
+        mPendingMessageExpectedLenght = 0;
+        return true;
+    }
+    
+    mPendingMessage[0] = inByte;
+    mPendingMessageIndex = 1;
+    mPendingMessageExpectedLenght = length;
+    return false;
+}
+
+// Private method: append a byte to the SysEx array.
+// Returns false if the SysEx was dropped because it does not fit.
+template<class SerialPort>
+bool MidiInterface<SerialPort>::storeSysExByte(byte inByte)
+{
+    if (mPendingMessageIndex >= MIDI_SYSEX_ARRAY_SIZE)
+    {
+#if MIDI_USE_CALLBACKS
+        if (mSystemExclusiveChunkCallback != 0)
         {
-            // "FML" case: fall down here with an overflown SysEx..
-            // This means we received the last possible data byte that can fit 
-            // the buffer. If this happens, try increasing MIDI_SYSEX_ARRAY_SIZE.
-            if (getTypeFromStatusByte(mPendingMessage[0]) == SystemExclusive)
-            {
-                resetInput();
-                return false;
-            }
-            
-            mMessage.type = getTypeFromStatusByte(mPendingMessage[0]);
-            // Don't check if it is a Channel Message
-            mMessage.channel = (mPendingMessage[0] & 0x0F)+1;
-            
-            mMessage.data1 = mPendingMessage[1];
-            
-            // Save data2 only if applicable
-            if (mPendingMessageExpectedLenght == 3)
-                mMessage.data2 = mPendingMessage[2];
-            else 
-                mMessage.data2 = 0;
-            
-            // Reset local variables
-            mPendingMessageIndex = 0;
-            mPendingMessageExpectedLenght = 0;
-            
-            mMessage.valid = true;
-            
-            // Activate running status (if enabled for the received type)
-            switch (mMessage.type)
-            {
-                case NoteOff:
-                case NoteOn:
-                case AfterTouchPoly:
-                case ControlChange:
-                case ProgramChange:
-                case AfterTouchChannel:
-                case PitchBend:    
-                    // Running status enabled: store it from received message
-                    mRunningStatus_RX = mPendingMessage[0];
-                    break;
-                    
-                default:
-                    // No running status
-                    mRunningStatus_RX = InvalidType;
-                    break;
-            }
-            return true;
+            // Hand the full array over and start a new fragment.
+            flushSysExChunk(false);
         }
         else
+#endif
         {
-            // Then update the index of the pending message.
-            mPendingMessageIndex++;
-            
-#if USE_1BYTE_PARSING
-            // Message is not complete.
+            // The SysEx does not fit in the array: drop it.
+            // Try increasing MIDI_SYSEX_ARRAY_SIZE, or handle it in chunks.
+            resetInput();
             return false;
-#else
-            // Call the parser recursively
-            // to parse the rest of the message.
-            return parse(inChannel);
-#endif
         }
     }
     
-    // What are our chances to fall here?
-    return false;
+    mMessage.sysex_array[mPendingMessageIndex++] = inByte;
+    return true;
 }
 
 // Private method: check if the received message is on the listened channel
@@ -884,6 +909,21 @@ bool MidiInterface<SerialPort>::check() const
     return mMessage.valid;
 }
 
+#if MIDI_USE_SCHEDULER
+
+/*! \brief Get the time at which the last message was received.
+ 
+ The time is read from the source given to setTimeSource() when the 
+ message is complete, before its callback is launched.
+ */
+template<class SerialPort>
+unsigned long MidiInterface<SerialPort>::getTimestamp() const
+{
+    return mMessage.timestamp;
+}
+
+#endif
+
 // -----------------------------------------------------------------------------
 
 template<class SerialPort>
@@ -948,6 +988,20 @@ template<class SerialPort> void MidiInterface<SerialPort>::setHandleStop(void (*
 template<class SerialPort> void MidiInterface<SerialPort>::setHandleActiveSensing(void (*fptr)(void))                                      { mActiveSensingCallback        = fptr; }
 template<class SerialPort> void MidiInterface<SerialPort>::setHandleSystemReset(void (*fptr)(void))                                        { mSystemResetCallback          = fptr; }
 
+/*! \brief Receive System Exclusive messages in fragments.
+ 
+ The SysEx array is handed over each time it is full, and once more on EOX 
+ with \a last set, so dumps longer than MIDI_SYSEX_ARRAY_SIZE can be received.
+ The first fragment starts with 0xF0, the last one ends with 0xF7 unless the
+ dump was cut by another status byte. The data is only valid during the call.
+ When set, this handler replaces the one given to setHandleSystemExclusive.
+ */
+template<class SerialPort> 
+void MidiInterface<SerialPort>::setHandleSystemExclusiveChunk(void (*fptr)(const byte* data, unsigned int size, bool last))
+{
+    mSystemExclusiveChunkCallback = fptr;
+}
+
 /*! \brief Detach an external function from the given type.
  
  Use this method to cancel the effects of setHandle********.
@@ -966,7 +1020,8 @@ void MidiInterface<SerialPort>::disconnectCallbackFromType(MidiType inType)
         case ProgramChange:         mProgramChangeCallback          = 0; break;
         case AfterTouchChannel:     mAfterTouchChannelCallback      = 0; break;
         case PitchBend:             mPitchBendCallback              = 0; break;
-        case SystemExclusive:       mSystemExclusiveCallback        = 0; break;
+        case SystemExclusive:       mSystemExclusiveCallback        = 0; 
+                                    mSystemExclusiveChunkCallback   = 0; break;
         case TimeCodeQuarterFrame:  mTimeCodeQuarterFrameCallback   = 0; break;
         case SongPosition:          mSongPositionCallback           = 0; break;
         case SongSelect:            mSongSelectCallback             = 0; break;
@@ -984,6 +1039,20 @@ void MidiInterface<SerialPort>::disconnectCallbackFromType(MidiType inType)
 
 /*! @} */ // End of doc group MIDI Callbacks
 
+// Private - pass the SysEx fragment stored in the array to the chunk 
+// callback (and to the Thru), then start a new fragment.
+template<class SerialPort>
+void MidiInterface<SerialPort>::flushSysExChunk(bool inLast)
+{
+#if (MIDI_BUILD_OUTPUT && MIDI_BUILD_THRU)
+    if (mThruActivated && mThruFilterMode != Off)
+        sendSysEx(mPendingMessageIndex, mMessage.sysex_array, true);
+#endif
+    
+    mSystemExclusiveChunkCallback(mMessage.sysex_array, mPendingMessageIndex, inLast);
+    mPendingMessageIndex = 0;
+}
+
 // Private - launch callback function based on received type.
 template<class SerialPort>
 void MidiInterface<SerialPort>::launchCallback()
@@ -1009,7 +1078,12 @@ void MidiInterface<SerialPort>::launchCallback()
         case AfterTouchChannel:     if (mAfterTouchChannelCallback != 0)     mAfterTouchChannelCallback(mMessage.channel,mMessage.data1);    break;
             
         case ProgramChange:         if (mProgramChangeCallback != 0)         mProgramChangeCallback(mMessage.channel,mMessage.data1);    break;
-        case SystemExclusive:       if (mSystemExclusiveCallback != 0)       mSystemExclusiveCallback(mMessage.sysex_array,mMessage.data1);    break;
+        case SystemExclusive:
+            if (mSystemExclusiveChunkCallback != 0)
+                mSystemExclusiveChunkCallback(mMessage.sysex_array, getSysExArrayLength(), true);
+            else if (mSystemExclusiveCallback != 0)
+                mSystemExclusiveCallback(mMessage.sysex_array, mMessage.data1);
+            break;
             
             // Occasional messages
         case TimeCodeQuarterFrame:  if (mTimeCodeQuarterFrameCallback != 0)  mTimeCodeQuarterFrameCallback(mMessage.data1);    break;
@@ -1168,7 +1242,7 @@ void MidiInterface<SerialPort>::thruFilter(Channel inChannel)
                 
             case SystemExclusive:
                 // Send SysEx (0xF0 and 0xF7 are included in the buffer)
-                sendSysEx(mMessage.data1,mMessage.sysex_array,true); 
+                sendSysEx(getSysExArrayLength(),mMessage.sysex_array,true); 
                 return;
                 break;
                 
@@ -1194,6 +1268,193 @@ void MidiInterface<SerialPort>::thruFilter(Channel inChannel)
 
 #endif // MIDI_BUILD_THRU
 
+
+// -----------------------------------------------------------------------------
+//                                Scheduler
+// -----------------------------------------------------------------------------
+
+#if MIDI_USE_SCHEDULER
+
+/*! \addtogroup scheduler
+ @{
+ */
+
+/*! \brief Set the clock used by the scheduler and to timestamp input.
+ \param fptr A function returning the current time, for example micros
+ or millis. Any unit will do, as long as the scheduled times use the same.
+ */
+template<class SerialPort>
+void MidiInterface<SerialPort>::setTimeSource(unsigned long (*fptr)(void))
+{
+    mTimeSource = fptr;
+}
+
+#if MIDI_BUILD_OUTPUT
+
+/*! \brief Queue a message to be sent at a given time.
+ \param inTime    When to send the message, in the unit of the time source.
+ Times in the past are sent on the next tick.
+ \param inType    A Channel or Real Time message type.
+ \param inData1   The first data byte.
+ \param inData2   The second data byte (0 if the message has only one).
+ \param inChannel The output channel (1 to 16), ignored for Real Time.
+ \return false if the queue is full or the type cannot be scheduled.
+ 
+ Messages sharing the same time are sent in the order they were queued.
+ If tick() is called from an interrupt, send all messages through the
+ scheduler so they are not mixed with the ones sent directly.
+ */
+template<class SerialPort>
+bool MidiInterface<SerialPort>::schedule(unsigned long inTime,
+                                         MidiType inType,
+                                         DataByte inData1,
+                                         DataByte inData2,
+                                         Channel inChannel)
+{
+    StatusByte status;
+    
+    if (inType >= NoteOff && inType <= PitchBend)
+    {
+        if (inChannel >= MIDI_CHANNEL_OFF || inChannel == MIDI_CHANNEL_OMNI)
+            return false;
+        status = getStatus(inType, inChannel);
+    }
+    else if (inType >= TuneRequest && inType <= SystemReset)
+        status = inType;
+    else
+        return false; // SysEx and System Common are not queued.
+    
+    if (mScheduleLocked || mScheduleSize >= MIDI_SCHEDULER_QUEUE_SIZE)
+        return false;
+    
+    mScheduleLocked = true;
+    
+    ScheduledEvent event;
+    event.time = inTime;
+    event.status = status;
+    event.data1 = inData1;
+    event.data2 = inData2;
+    event.order = mScheduleOrder++;
+    
+    // Sift up from the new leaf.
+    byte index = mScheduleSize;
+    while (index > 0)
+    {
+        const byte parent = (index - 1) >> 1;
+        if (!isEarlier(event, mSchedule[parent]))
+            break;
+        mSchedule[index] = mSchedule[parent];
+        index = parent;
+    }
+    mSchedule[index] = event;
+    mScheduleSize = mScheduleSize + 1;
+    
+    mScheduleLocked = false;
+    return true;
+}
+
+/*! \brief Send the queued messages which are due, using the time source.
+ 
+ Call this from a timer interrupt, or as often as possible from loop().
+ The timing resolution of the output is the period of the calls.
+ */
+template<class SerialPort>
+void MidiInterface<SerialPort>::tick()
+{
+    if (mTimeSource != 0)
+        tick(mTimeSource());
+}
+
+/*! \brief Send the queued messages which are due at a given time.
+ \param inNow The current time, for example a count of timer ticks.
+ */
+template<class SerialPort>
+void MidiInterface<SerialPort>::tick(unsigned long inNow)
+{
+    // If the queue is being modified (tick called from an interrupt while
+    // schedule runs), the due messages will be sent on the next tick.
+    if (mScheduleLocked)
+        return;
+    
+    mScheduleLocked = true;
+    
+    while (mScheduleSize > 0 && (long)(inNow - mSchedule[0].time) >= 0)
+    {
+        const ScheduledEvent event = mSchedule[0];
+        removeFirstEvent();
+        
+        // Sent with Running Status, consecutive messages of the same 
+        // type and channel only send their data bytes.
+        if (event.status < 0xF0)
+            send((MidiType)(event.status & 0xF0), 
+                 event.data1, 
+                 event.data2, 
+                 (event.status & 0x0F) + 1);
+        else
+            sendRealTime((MidiType)event.status);
+    }
+    
+    mScheduleLocked = false;
+}
+
+/*! \brief Get the number of messages waiting in the queue. */
+template<class SerialPort>
+byte MidiInterface<SerialPort>::getScheduledCount() const
+{
+    return mScheduleSize;
+}
+
+/*! \brief Drop all the messages waiting in the queue. */
+template<class SerialPort>
+void MidiInterface<SerialPort>::clearSchedule()
+{
+    mScheduleSize = 0;
+}
+
+// Private - heap ordering: by time (wrapping around), then by queuing order.
+// The order is as wide as the time: any number of messages may be queued
+// and sent while one waits, short of 2^31.
+template<class SerialPort>
+bool MidiInterface<SerialPort>::isEarlier(const ScheduledEvent& inA,
+                                          const ScheduledEvent& inB)
+{
+    const long delta = inA.time - inB.time;
+    if (delta != 0)
+        return delta < 0;
+    return (long)(inA.order - inB.order) < 0;
+}
+
+// Private - remove the root of the heap.
+template<class SerialPort>
+void MidiInterface<SerialPort>::removeFirstEvent()
+{
+    const byte size = mScheduleSize - 1;
+    const ScheduledEvent last = mSchedule[size];
+    
+    // Sift the last leaf down from the root.
+    byte index = 0;
+    for (;;)
+    {
+        byte child = (index << 1) + 1;
+        if (child >= size)
+            break;
+        if (child + 1 < size && isEarlier(mSchedule[child + 1], mSchedule[child]))
+            child++;
+        if (!isEarlier(mSchedule[child], last))
+            break;
+        mSchedule[index] = mSchedule[child];
+        index = child;
+    }
+    mSchedule[index] = last;
+    mScheduleSize = size;
+}
+
+#endif // MIDI_BUILD_OUTPUT
+
+/*! @} */ // End of doc group MIDI Scheduler
+
+#endif // MIDI_USE_SCHEDULER
+
 // -----------------------------------------------------------------------------
 
 END_MIDI_NAMESPACE
@@ -31,6 +31,16 @@
 
 #define MIDI_USE_CALLBACKS              1
 
+// The scheduler queues messages to be sent at a given time by a timer hook,
+// and timestamps received messages. It is off by default as the queue takes
+// 11 bytes of RAM per event. Set it to 1 here to enable it: the MIDI object
+// in MIDI.cpp must be built with the same layout as your sketch sees, so it
+// can not be set from the sketch.
+#ifdef MIDI_USE_SCHEDULER
+#   error MIDI_USE_SCHEDULER is set in midi_Settings.h, not in the sketch.
+#endif
+#define MIDI_USE_SCHEDULER              0
+
 // -----------------------------------------------------------------------------
 
 // Create a MIDI object automatically on the port defined with MIDI_SERIAL_PORT.
@@ -60,11 +70,20 @@
 // of the same type and channel.
 // Set to 0 if you have troubles controlling your hardware.
 #define MIDI_USE_RUNNING_STATUS         1
-#define MIDI_USE_1BYTE_PARSING          1
 
 #define MIDI_BAUDRATE                   31250
 #define MIDI_SYSEX_ARRAY_SIZE           255     // Maximum size is 65535 bytes.
 
+// SysEx messages longer than MIDI_SYSEX_ARRAY_SIZE are dropped, unless a
+// handler is set with setHandleSystemExclusiveChunk(): the array is then used
+// as a fragment buffer, and dumps of any length are passed on piece by piece.
+
+// Like MIDI_USE_SCHEDULER, this is only set here.
+#ifdef MIDI_SCHEDULER_QUEUE_SIZE
+#   error MIDI_SCHEDULER_QUEUE_SIZE is set in midi_Settings.h, not in the sketch.
+#endif
+#define MIDI_SCHEDULER_QUEUE_SIZE       32      // Maximum size is 128 events.
+
 // -----------------------------------------------------------------------------
 
 BEGIN_MIDI_NAMESPACE
@@ -47,10 +47,18 @@ NfcTag MifareClassic::read(byte *uid, unsigned int uidLength)
         return NfcTag(uid, uidLength, MIFARE_CLASSIC);
     }
 
-    // this should be nested in the message length loop
-    int index = 0;
-    int bufferSize = getBufferSize(messageLength);
+    // Only the message is read, up to the block holding its last byte:
+    // the TLV terminator that follows it is not needed. The first block
+    // is kept and the rest of its sector read without a new authentication.
+    int index = BLOCK_SIZE;
+    int bufferSize = messageStartIndex + messageLength;
+    if (bufferSize % BLOCK_SIZE != 0)
+    {
+        bufferSize = ((bufferSize / BLOCK_SIZE) + 1) * BLOCK_SIZE;
+    }
     uint8_t buffer[bufferSize];
+    memcpy(buffer, data, BLOCK_SIZE);
+    currentBlock++;
 
     #ifdef MIFARE_CLASSIC_DEBUG
     Serial.print(F("Message Length "));Serial.println(messageLength);
@@ -60,14 +68,23 @@ NfcTag MifareClassic::read(byte *uid, unsigned int uidLength)
     while (index < bufferSize)
     {
 
-        // authenticate on every sector
+        // skip the trailer block
+        if (_nfcShield->mifareclassic_IsTrailerBlock(currentBlock))
+        {
+            #ifdef MIFARE_CLASSIC_DEBUG
+            Serial.print(F("Skipping block "));Serial.println(currentBlock);
+            #endif
+            currentBlock++;
+        }
+
+        // authenticate once per sector, then read its data blocks in a row
         if (_nfcShield->mifareclassic_IsFirstBlock(currentBlock))
         {
             success = _nfcShield->mifareclassic_AuthenticateBlock(uid, uidLength, currentBlock, 0, key);
             if (!success)
             {
                 Serial.print(F("Error. Block Authentication failed for "));Serial.println(currentBlock);
-                // TODO error handling
+                return NfcTag(uid, uidLength, MIFARE_CLASSIC);
             }
         }
 
@@ -83,49 +100,16 @@ NfcTag MifareClassic::read(byte *uid, unsigned int uidLength)
         else
         {
             Serial.print(F("Read failed "));Serial.println(currentBlock);
-            // TODO handle errors here
+            return NfcTag(uid, uidLength, MIFARE_CLASSIC);
         }
 
         index += BLOCK_SIZE;
         currentBlock++;
-
-        // skip the trailer block
-        if (_nfcShield->mifareclassic_IsTrailerBlock(currentBlock))
-        {
-            #ifdef MIFARE_CLASSIC_DEBUG
-            Serial.print(F("Skipping block "));Serial.println(currentBlock);
-            #endif
-            currentBlock++;
-        }
     }
 
     return NfcTag(uid, uidLength, MIFARE_CLASSIC, &buffer[messageStartIndex], messageLength);
 }
 
-int MifareClassic::getBufferSize(int messageLength)
-{
-
-    int bufferSize = messageLength;
-
-    // TLV header is 2 or 4 bytes, TLV terminator is 1 byte.
-    if (messageLength < 0xFF)
-    {
-        bufferSize += SHORT_TLV_SIZE + 1;
-    }
-    else
-    {
-        bufferSize += LONG_TLV_SIZE + 1;
-    }
-
-    // bufferSize needs to be a multiple of BLOCK_SIZE
-    if (bufferSize % BLOCK_SIZE != 0)
-    {
-        bufferSize = ((bufferSize / BLOCK_SIZE) + 1) * BLOCK_SIZE;
-    }
-
-    return bufferSize;
-}
-
 // skip null tlvs (0x0) before the real message
 // technically unlimited null tlvs, but we assume
 // T & L of TLV in the first block we read
@@ -331,7 +315,14 @@ boolean MifareClassic::write(NdefMessage& m, byte * uid, unsigned int uidLength)
     uint8_t encoded[m.getEncodedSize()];
     m.encode(encoded);
 
-    uint8_t buffer[getBufferSize(sizeof(encoded))];
+    // TLV header is 2 or 4 bytes, TLV terminator is 1 byte,
+    // and the buffer is written in whole blocks
+    int bufferSize = sizeof(encoded) + (sizeof(encoded) < 0xFF ? SHORT_TLV_SIZE : LONG_TLV_SIZE) + 1;
+    if (bufferSize % BLOCK_SIZE != 0)
+    {
+        bufferSize = ((bufferSize / BLOCK_SIZE) + 1) * BLOCK_SIZE;
+    }
+    uint8_t buffer[bufferSize];
     memset(buffer, 0, sizeof(buffer));
 
     #ifdef MIFARE_CLASSIC_DEBUG
@@ -17,7 +17,6 @@ class MifareClassic
         boolean formatMifare(byte * uid, unsigned int uidLength);
     private:
         PN532* _nfcShield;
-        int getBufferSize(int messageLength);
         int getNdefStartIndex(byte *data);
         bool decodeTlv(byte *data, int &messageLength, int &messageStartIndex);
 };
@@ -1,12 +1,11 @@
 #include <MifareUltralight.h>
 
 #define ULTRALIGHT_PAGE_SIZE 4
-#define ULTRALIGHT_READ_SIZE 4 // we should be able to read 16 bytes at a time
+#define ULTRALIGHT_READ_SIZE 16 // READ returns 4 pages
 
 #define ULTRALIGHT_DATA_START_PAGE 4
 #define ULTRALIGHT_MESSAGE_LENGTH_INDEX 1
 #define ULTRALIGHT_DATA_START_INDEX 2
-#define ULTRALIGHT_MAX_PAGE 63
 
 #define NFC_FORUM_TAG_TYPE_2 ("NFC Forum Type 2")
 
@@ -23,15 +22,49 @@ MifareUltralight::~MifareUltralight()
 
 NfcTag MifareUltralight::read(byte * uid, unsigned int uidLength)
 {
-    if (isUnformatted())
+    // READ returns 4 pages: the capability container on page 3, then the
+    // first 12 bytes of data, where the NDEF TLV normally starts
+    byte head[2 * ULTRALIGHT_READ_SIZE];
+    byte *data = &head[ULTRALIGHT_PAGE_SIZE];
+    unsigned int headLength = ULTRALIGHT_READ_SIZE - ULTRALIGHT_PAGE_SIZE;
+
+    if (!nfc->mifareultralight_ReadPages(3, head))
+    {
+        Serial.print(F("Error. Failed read page "));Serial.println(3);
+        return NfcTag(uid, uidLength, NFC_FORUM_TAG_TYPE_2);
+    }
+
+    // See AN1303 - different rules for Mifare Family byte2 = (additional data + 48)/8
+    tagCapacity = head[2] * 8;
+    #ifdef MIFARE_ULTRALIGHT_DEBUG
+    Serial.print(F("Tag capacity "));Serial.print(tagCapacity);Serial.println(F(" bytes"));
+    nfc->PrintHexChar(head, ULTRALIGHT_READ_SIZE);
+    #endif
+
+    if (data[0] == 0xFF && data[1] == 0xFF && data[2] == 0xFF && data[3] == 0xFF)
     {
         Serial.println(F("WARNING: Tag is not formatted."));
         return NfcTag(uid, uidLength, NFC_FORUM_TAG_TYPE_2);
     }
 
-    readCapabilityContainer(); // meta info for tag
-    findNdefMessage();
-    calculateBufferSize();
+    messageLength = 0;
+    ndefStartIndex = 0;
+    if (!findNdefMessage(data, headLength))
+    {
+        // lock and memory control TLVs pushed the NDEF TLV further
+        if (!nfc->mifareultralight_ReadPages(ULTRALIGHT_DATA_START_PAGE + headLength / ULTRALIGHT_PAGE_SIZE, &data[headLength]) ||
+            !findNdefMessage(data, headLength + ULTRALIGHT_READ_SIZE))
+        {
+            Serial.println(F("Error. Can't decode message length."));
+            messageLength = 0;
+        }
+        headLength += ULTRALIGHT_READ_SIZE;
+    }
+
+    #ifdef MIFARE_ULTRALIGHT_DEBUG
+    Serial.print(F("messageLength "));Serial.println(messageLength);
+    Serial.print(F("ndefStartIndex "));Serial.println(ndefStartIndex);
+    #endif
 
     if (messageLength == 0) { // data is 0x44 0x03 0x00 0xFE
         NdefMessage message = NdefMessage();
@@ -39,46 +72,95 @@ NfcTag MifareUltralight::read(byte * uid, unsigned int uidLength)
         return NfcTag(uid, uidLength, NFC_FORUM_TAG_TYPE_2, message);
     }
 
-    boolean success;
-    uint8_t page;
-    uint8_t index = 0;
-    byte buffer[bufferSize];
-    for (page = ULTRALIGHT_DATA_START_PAGE; page < ULTRALIGHT_MAX_PAGE; page++)
+    // the message ends where the TLV terminator starts, no need to read it
+    unsigned int messageEnd = ndefStartIndex + messageLength;
+    if (messageEnd > tagCapacity)
+    {
+        Serial.print(F("Error. Message is larger than the tag "));Serial.println(messageEnd);
+        return NfcTag(uid, uidLength, NFC_FORUM_TAG_TYPE_2);
+    }
+
+    // room for the last READ to run up to 3 pages past the message
+    byte buffer[messageEnd + ULTRALIGHT_READ_SIZE];
+    unsigned int index = headLength < messageEnd ? headLength : messageEnd;
+    memcpy(buffer, data, index);
+
+    if (!readPages(uid, uidLength, index, messageEnd, buffer))
+    {
+        return NfcTag(uid, uidLength, NFC_FORUM_TAG_TYPE_2);
+    }
+
+    NdefMessage ndefMessage = NdefMessage(&buffer[ndefStartIndex], messageLength);
+    return NfcTag(uid, uidLength, NFC_FORUM_TAG_TYPE_2, ndefMessage);
+
+}
+
+// Read data bytes index to end into buffer, index must start a page.
+// Every command reads several pages: FAST_READ when it is enabled and
+// the tag supports it, else READ, 4 pages at a time.
+boolean MifareUltralight::readPages(byte *uid, unsigned int uidLength, unsigned int index, unsigned int end, byte *buffer)
+{
+    #if ULTRALIGHT_FAST_READ_PAGES > 0
+    boolean fastRead = true;
+    #endif
+
+    while (index < end)
     {
-        // read the data
-        success = nfc->mifareultralight_ReadPage(page, &buffer[index]);
+        uint8_t page = ULTRALIGHT_DATA_START_PAGE + index / ULTRALIGHT_PAGE_SIZE;
+        unsigned int pages = (end - index + ULTRALIGHT_PAGE_SIZE - 1) / ULTRALIGHT_PAGE_SIZE;
+        boolean success = false;
+
+        #if ULTRALIGHT_FAST_READ_PAGES > 0
+        if (fastRead && pages > ULTRALIGHT_READ_SIZE / ULTRALIGHT_PAGE_SIZE)
+        {
+            if (pages > ULTRALIGHT_FAST_READ_PAGES)
+            {
+                pages = ULTRALIGHT_FAST_READ_PAGES;
+            }
+            success = nfc->mifareultralight_FastRead(page, page + pages - 1, &buffer[index]);
+            if (!success)
+            {
+                // tags without FAST_READ NAK it and go IDLE, select again
+                #ifdef MIFARE_ULTRALIGHT_DEBUG
+                Serial.println(F("FAST_READ failed, using READ"));
+                #endif
+                uint8_t length = uidLength;
+                fastRead = false;
+                nfc->readPassiveTargetID(PN532_MIFARE_ISO14443A, uid, &length);
+                continue;
+            }
+        }
+        #endif
+
+        if (!success)
+        {
+            pages = ULTRALIGHT_READ_SIZE / ULTRALIGHT_PAGE_SIZE;
+            success = nfc->mifareultralight_ReadPages(page, &buffer[index]);
+        }
+
         if (success)
         {
             #ifdef MIFARE_ULTRALIGHT_DEBUG
-            Serial.print(F("Page "));Serial.print(page);Serial.print(" ");
-            nfc->PrintHexChar(&buffer[index], ULTRALIGHT_PAGE_SIZE);
+            Serial.print(F("Pages "));Serial.print(page);Serial.print(" ");
+            nfc->PrintHexChar(&buffer[index], pages * ULTRALIGHT_PAGE_SIZE);
             #endif
         }
         else
         {
             Serial.print(F("Read failed "));Serial.println(page);
-            // TODO error handling
-            messageLength = 0;
-            break;
-        }
-
-        if (index >= (messageLength + ndefStartIndex))
-        {
-            break;
+            return false;
         }
 
-        index += ULTRALIGHT_PAGE_SIZE;
+        index += pages * ULTRALIGHT_PAGE_SIZE;
     }
 
-    NdefMessage ndefMessage = NdefMessage(&buffer[ndefStartIndex], messageLength);
-    return NfcTag(uid, uidLength, NFC_FORUM_TAG_TYPE_2, ndefMessage);
-
+    return true;
 }
 
 boolean MifareUltralight::isUnformatted()
 {
     uint8_t page = 4;
-    byte data[ULTRALIGHT_READ_SIZE];
+    byte data[ULTRALIGHT_PAGE_SIZE];
     boolean success = nfc->mifareultralight_ReadPage (page, data);
     if (success)
     {
@@ -108,44 +190,57 @@ void MifareUltralight::readCapabilityContainer()
     }
 }
 
-// read enough of the message to find the ndef message length
-void MifareUltralight::findNdefMessage()
+// Find the NDEF Message TLV in the first length bytes of data, skipping
+// NULL, Lock Control and Memory Control TLVs - NFCForum-TS-Type-2-Tag 2.3
+// messageLength and ndefStartIndex are set when it is found.
+// Returns false if more data is needed to reach the T and L of the NDEF TLV.
+//
+// { 0x3, LENGTH }
+// { 0x3, 0xFF, LENGTH, LENGTH }
+boolean MifareUltralight::findNdefMessage(byte *data, unsigned int length)
 {
-    int page;
-    byte data[12]; // 3 pages
-    byte* data_ptr = &data[0];
-
-    // the nxp read command reads 4 pages, unfortunately adafruit give me one page at a time
-    boolean success = true;
-    for (page = 4; page < 6; page++)
-    {
-        success = success && nfc->mifareultralight_ReadPage(page, data_ptr);
-        #ifdef MIFARE_ULTRALIGHT_DEBUG
-        Serial.print(F("Page "));Serial.print(page);Serial.print(F(" - "));
-        nfc->PrintHexChar(data_ptr, 4);
-        #endif
-        data_ptr += ULTRALIGHT_PAGE_SIZE;
-    }
+    unsigned int i = 0;
 
-    if (success)
+    while (i < length)
     {
-        if (data[0] == 0x03)
+        if (data[i] == 0x00) // NULL TLV
+        {
+            i++;
+        }
+        else if (data[i] == 0xFE) // Terminator TLV, no message
+        {
+            messageLength = 0;
+            return true;
+        }
+        else if (i + 1 >= length || (data[i+1] == 0xFF && i + 3 >= length))
         {
-            messageLength = data[1];
-            ndefStartIndex = 2;
+            break;
+        }
+        else if (data[i] == 0x03)
+        {
+            if (data[i+1] == 0xFF)
+            {
+                messageLength = ((0xFF & data[i+2]) << 8) | (0xFF & data[i+3]);
+                ndefStartIndex = i + 4;
+            }
+            else
+            {
+                messageLength = data[i+1];
+                ndefStartIndex = i + 2;
+            }
+            return true;
+        }
+        else if (data[i+1] == 0xFF) // any other TLV, skip it
+        {
+            i += 4 + (((0xFF & data[i+2]) << 8) | (0xFF & data[i+3]));
         }
-        else if (data[5] == 0x3) // page 5 byte 1
+        else
         {
-            // TODO should really read the lock control TLV to ensure byte[5] is correct
-            messageLength = data[6];
-            ndefStartIndex = 7;
+            i += 2 + data[i+1];
         }
     }
 
-    #ifdef MIFARE_ULTRALIGHT_DEBUG
-    Serial.print(F("messageLength "));Serial.println(messageLength);
-    Serial.print(F("ndefStartIndex "));Serial.println(ndefStartIndex);
-    #endif
+    return false;
 }
 
 // buffer is larger than the message, need to handle some data before and after
@@ -155,10 +250,10 @@ void MifareUltralight::calculateBufferSize()
     // TLV terminator 0xFE is 1 byte
     bufferSize = messageLength + ndefStartIndex + 1;
 
-    if (bufferSize % ULTRALIGHT_READ_SIZE != 0)
+    if (bufferSize % ULTRALIGHT_PAGE_SIZE != 0)
     {
         // buffer must be an increment of page size
-        bufferSize = ((bufferSize / ULTRALIGHT_READ_SIZE) + 1) * ULTRALIGHT_READ_SIZE;
+        bufferSize = ((bufferSize / ULTRALIGHT_PAGE_SIZE) + 1) * ULTRALIGHT_PAGE_SIZE;
     }
 }
 
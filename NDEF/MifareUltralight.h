@@ -5,6 +5,14 @@
 #include <NfcTag.h>
 #include <Ndef.h>
 
+// Pages read by one FAST_READ command, 0 reads 4 pages at a time with READ.
+// Only NTAG21x and Ultralight EV1 tags implement FAST_READ, others are
+// selected again and read with READ. Up to 15 pages fit in the PN532 packet
+// buffer, but the 32 bytes Wire buffer of AVR boards limits I2C to 5 pages.
+#ifndef ULTRALIGHT_FAST_READ_PAGES
+#define ULTRALIGHT_FAST_READ_PAGES 0
+#endif
+
 class MifareUltralight
 {
     public:
@@ -21,8 +29,9 @@ class MifareUltralight
         unsigned int ndefStartIndex;
         boolean isUnformatted();
         void readCapabilityContainer();
-        void findNdefMessage();
+        boolean findNdefMessage(byte *data, unsigned int length);
         void calculateBufferSize();
+        boolean readPages(byte *uid, unsigned int uidLength, unsigned int index, unsigned int end, byte *buffer);
 };
 
 #endif
@@ -6,6 +6,31 @@ NdefMessage::NdefMessage(void)
 }
 
 NdefMessage::NdefMessage(const byte * data, const int numBytes)
+{
+    decode(data, numBytes, NDEF_COPY);
+}
+
+// NDEF_VIEW decodes without any heap allocation, records point into data
+NdefMessage::NdefMessage(const byte * data, const int numBytes, const byte mode)
+{
+    decode(data, numBytes, mode);
+}
+
+// Copies data into a caller supplied buffer once, records point into it
+NdefMessage::NdefMessage(const byte * data, const int numBytes, byte * arena, const int arenaSize)
+{
+    if (numBytes > arenaSize)
+    {
+        Serial.println(F("WARNING: NDEF message is larger than the arena."));
+        _recordCount = 0;
+        return;
+    }
+
+    memcpy(arena, data, numBytes);
+    decode(arena, numBytes, NDEF_VIEW);
+}
+
+void NdefMessage::decode(const byte * data, const int numBytes, const byte mode)
 {
     #ifdef NDEF_DEBUG
     Serial.print(F("Decoding "));Serial.print(numBytes);Serial.println(F(" bytes"));
@@ -17,7 +42,7 @@ NdefMessage::NdefMessage(const byte * data, const int numBytes)
 
     int index = 0;
 
-    while (index <= numBytes)
+    while (index < numBytes)
     {
 
         // decode tnf - first byte is tnf with bit flags
@@ -30,9 +55,6 @@ NdefMessage::NdefMessage(const byte * data, const int numBytes)
         bool il = (tnf_byte & 0x8) != 0;
         byte tnf = (tnf_byte & 0x7);
 
-        NdefRecord record = NdefRecord();
-        record.setTnf(tnf);
-
         index++;
         int typeLength = data[index];
 
@@ -45,10 +67,11 @@ NdefMessage::NdefMessage(const byte * data, const int numBytes)
         else
         {
             payloadLength =
-		((0xFF & data[++index]) << 24)
-		| ((0xFF & data[++index]) << 16)
-		| ((0xFF & data[++index]) << 8)
-		| (0xFF & data[++index]);
+		((0xFF & data[index + 1]) << 24)
+		| ((0xFF & data[index + 2]) << 16)
+		| ((0xFF & data[index + 3]) << 8)
+		| (0xFF & data[index + 4]);
+            index += 4;
         }
 
         int idLength = 0;
@@ -59,17 +82,36 @@ NdefMessage::NdefMessage(const byte * data, const int numBytes)
         }
 
         index++;
-        record.setType(&data[index], typeLength);
+        const byte *type = &data[index];
         index += typeLength;
 
-        if (il)
+        const byte *id = &data[index];
+        index += idLength;
+
+        const byte *payload = &data[index];
+        index += payloadLength;
+
+        if (payloadLength < 0 || index > numBytes)
         {
-            record.setId(&data[index], idLength);
-            index += idLength;
+            Serial.println(F("WARNING: Record is longer than the message. Skipping."));
+            break;
         }
 
-        record.setPayload(&data[index], payloadLength);
-        index += payloadLength;
+        NdefRecord record = NdefRecord();
+        if (mode == NDEF_VIEW)
+        {
+            record.setView(tnf, type, typeLength, payload, payloadLength, id, idLength);
+        }
+        else
+        {
+            record.setTnf(tnf);
+            record.setType(type, typeLength);
+            if (il)
+            {
+                record.setId(id, idLength);
+            }
+            record.setPayload(payload, payloadLength);
+        }
 
         addRecord(record);
 
@@ -6,11 +6,17 @@
 
 #define MAX_NDEF_RECORDS 4
 
+// How NdefMessage(data, numBytes, mode) decodes records
+#define NDEF_COPY 0 // records own heap copies of their fields
+#define NDEF_VIEW 1 // records point into data, which must outlive the message
+
 class NdefMessage
 {
     public:
         NdefMessage(void);
         NdefMessage(const byte *data, const int numBytes);
+        NdefMessage(const byte *data, const int numBytes, const byte mode);
+        NdefMessage(const byte *data, const int numBytes, byte *arena, const int arenaSize);
         NdefMessage(const NdefMessage& rhs);
         ~NdefMessage();
         NdefMessage& operator=(const NdefMessage& rhs);
@@ -32,6 +38,7 @@ class NdefMessage
 
         void print();
     private:
+        void decode(const byte *data, const int numBytes, const byte mode);
         NdefRecord _records[MAX_NDEF_RECORDS];
         unsigned int _recordCount;
 };
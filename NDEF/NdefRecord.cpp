@@ -3,6 +3,7 @@
 NdefRecord::NdefRecord()
 {
     //Serial.println("NdefRecord Constructor 1");
+    _view = false;
     _tnf = 0;
     _typeLength = 0;
     _payloadLength = 0;
@@ -16,6 +17,7 @@ NdefRecord::NdefRecord(const NdefRecord& rhs)
 {
     //Serial.println("NdefRecord Constructor 2 (copy)");
 
+    _view = rhs._view;
     _tnf = rhs._tnf;
     _typeLength = rhs._typeLength;
     _payloadLength = rhs._payloadLength;
@@ -24,6 +26,15 @@ NdefRecord::NdefRecord(const NdefRecord& rhs)
     _payload = (byte *)NULL;
     _id = (byte *)NULL;
 
+    if (_view)
+    {
+        // views share the buffer, nothing to allocate
+        _type = rhs._type;
+        _payload = rhs._payload;
+        _id = rhs._id;
+        return;
+    }
+
     if (_typeLength)
     {
         _type = (byte*)malloc(_typeLength);
@@ -49,6 +60,11 @@ NdefRecord::NdefRecord(const NdefRecord& rhs)
 NdefRecord::~NdefRecord()
 {
     //Serial.println("NdefRecord Destructor");
+    if (_view)
+    {
+        return;
+    }
+
     if (_typeLength)
     {
         free(_type);
@@ -72,26 +88,39 @@ NdefRecord& NdefRecord::operator=(const NdefRecord& rhs)
     if (this != &rhs)
     {
         // free existing
-        if (_typeLength)
+        if (!_view)
         {
-            free(_type);
-        }
-
-        if (_payloadLength)
-        {
-            free(_payload);
-        }
-
-        if (_idLength)
-        {
-            free(_id);
+            if (_typeLength)
+            {
+                free(_type);
+            }
+
+            if (_payloadLength)
+            {
+                free(_payload);
+            }
+
+            if (_idLength)
+            {
+                free(_id);
+            }
         }
 
+        _view = rhs._view;
         _tnf = rhs._tnf;
         _typeLength = rhs._typeLength;
         _payloadLength = rhs._payloadLength;
         _idLength = rhs._idLength;
 
+        if (_view)
+        {
+            // views share the buffer, nothing to allocate
+            _type = rhs._type;
+            _payload = rhs._payload;
+            _id = rhs._id;
+            return *this;
+        }
+
         if (_typeLength)
         {
             _type = (byte*)malloc(_typeLength);
@@ -113,6 +142,65 @@ NdefRecord& NdefRecord::operator=(const NdefRecord& rhs)
     return *this;
 }
 
+// point the record at fields in a buffer that outlives it, without copying
+void NdefRecord::setView(byte tnf, const byte *type, unsigned int typeLength,
+                         const byte *payload, int payloadLength,
+                         const byte *id, unsigned int idLength)
+{
+    // drop owned fields
+    *this = NdefRecord();
+
+    _view = true;
+    _tnf = tnf;
+    _typeLength = typeLength;
+    _payloadLength = payloadLength;
+    _idLength = idLength;
+    _type = (byte *)type;
+    _payload = (byte *)payload;
+    _id = (byte *)id;
+}
+
+// make owned copies of the fields of a view before changing them
+void NdefRecord::detach()
+{
+    if (!_view)
+    {
+        return;
+    }
+
+    const byte *type = _type;
+    const byte *payload = _payload;
+    const byte *id = _id;
+
+    _view = false;
+    _type = (byte *)NULL;
+    _payload = (byte *)NULL;
+    _id = (byte *)NULL;
+
+    if (_typeLength)
+    {
+        _type = (byte*)malloc(_typeLength);
+        memcpy(_type, type, _typeLength);
+    }
+
+    if (_payloadLength)
+    {
+        _payload = (byte*)malloc(_payloadLength);
+        memcpy(_payload, payload, _payloadLength);
+    }
+
+    if (_idLength)
+    {
+        _id = (byte*)malloc(_idLength);
+        memcpy(_id, id, _idLength);
+    }
+}
+
+bool NdefRecord::isView()
+{
+    return _view;
+}
+
 // size of records in bytes
 int NdefRecord::getEncodedSize()
 {
@@ -249,6 +337,8 @@ void NdefRecord::getType(uint8_t* type)
 
 void NdefRecord::setType(const byte * type, const unsigned int numBytes)
 {
+    detach();
+
     if(_typeLength)
     {
         free(_type);
@@ -267,6 +357,8 @@ void NdefRecord::getPayload(byte *payload)
 
 void NdefRecord::setPayload(const byte * payload, const int numBytes)
 {
+    detach();
+
     if (_payloadLength)
     {
         free(_payload);
@@ -292,6 +384,8 @@ void NdefRecord::getId(byte *id)
 
 void NdefRecord::setId(const byte * id, const unsigned int numBytes)
 {
+    detach();
+
     if (_idLength)
     {
         free(_id);
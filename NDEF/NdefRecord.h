@@ -43,9 +43,18 @@ class NdefRecord
         void setPayload(const byte *payload, const int numBytes);
         void setId(const byte *id, const unsigned int numBytes);
 
+        // true if the record points into a buffer it does not own
+        bool isView();
+
         void print();
     private:
+        friend class NdefMessage;
+        void setView(byte tnf, const byte *type, unsigned int typeLength,
+                     const byte *payload, int payloadLength,
+                     const byte *id, unsigned int idLength);
+        void detach();
         byte getTnfByte(bool firstRecord, bool lastRecord);
+        bool _view; // fields point into a tag buffer or arena, don't free them
         byte _tnf; // 3 bit
         unsigned int _typeLength;
         int _payloadLength;
@@ -0,0 +1,82 @@
+/*
+ * Minimal Arduino core for building the NDEF and PN532 libraries on the
+ * host: integer types, a String over std::string and a Serial that
+ * prints to stdout only when serialEcho is set.
+ */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HEX 16
+#define DEC 10
+#define F(string_literal) (string_literal)
+
+inline void delay(unsigned long) {}
+
+class String
+{
+public:
+    String() {}
+    String(const char *s) : s(s) {}
+    String(const std::string& s) : s(s) {}
+    String(unsigned int value, unsigned char base = DEC)
+    {
+        char buf[16];
+        snprintf(buf, sizeof(buf), base == HEX ? "%x" : "%u", value);
+        s = buf;
+    }
+
+    unsigned int length() const { return s.length(); }
+    const char *c_str() const { return s.c_str(); }
+    void getBytes(byte *buf, unsigned int size) const
+    {
+        if (size == 0)
+            return;
+        unsigned int n = s.length() < size - 1 ? s.length() : size - 1;
+        memcpy(buf, s.data(), n);
+        buf[n] = 0;
+    }
+    void toUpperCase()
+    {
+        for (unsigned int i = 0; i < s.length(); i++)
+            s[i] = toupper(s[i]);
+    }
+
+    String& operator+=(const String& rhs) { s += rhs.s; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+    bool operator==(const String& rhs) const { return s == rhs.s; }
+
+private:
+    std::string s;
+};
+
+extern bool serialEcho;
+
+class HardwareSerial
+{
+public:
+    void print(const String& s)          { if (serialEcho) fputs(s.c_str(), stdout); }
+    void print(const char *s)            { if (serialEcho) fputs(s, stdout); }
+    void print(char c)                   { if (serialEcho) putchar(c); }
+    void print(unsigned long n, int base = DEC) { if (serialEcho) printf(base == HEX ? "%lX" : "%lu", n); }
+    void print(long n, int base = DEC)   { if (serialEcho) printf(base == HEX ? "%lX" : "%ld", n); }
+    void print(unsigned int n, int base = DEC) { print((unsigned long)n, base); }
+    void print(int n, int base = DEC)    { print((long)n, base); }
+    void print(unsigned char n, int base = DEC) { print((unsigned long)n, base); }
+    template <typename T> void println(T v) { print(v); print('\n'); }
+    template <typename T> void println(T v, int base) { print(v, base); print('\n'); }
+    void println()                       { print('\n'); }
+};
+
+extern HardwareSerial Serial;
+
+#endif
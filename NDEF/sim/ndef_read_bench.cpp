@@ -0,0 +1,365 @@
+/*
+ * Command round-trip benchmark for the NDEF tag readers
+ *
+ * Replaces the PN532 link with MockTag, a PN532Interface that answers
+ * InListPassiveTarget and InDataExchange from the memory image of a
+ * Mifare Classic 1K or an NFC Forum Type 2 tag: Ultralight, Ultralight C
+ * and NTAG213/215/216.  Authentication, NAKs sending the tag IDLE and the
+ * lack of FAST_READ on older tags are modelled, so a reader that skips a
+ * step or asks too much fails here as it would on a real tag.
+ *
+ * Every tag is written with NDEF messages of growing size and read back
+ * by the old readers kept in ndef_legacy.h and by MifareClassic and
+ * MifareUltralight.  Prints the commands sent to the tag, the bytes on
+ * the air and an estimated tap-to-result time per read.
+ * Exits non-zero if a message does not read back unchanged.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <MifareClassic.h>
+#include <MifareUltralight.h>
+#include "ndef_legacy.h"
+
+bool serialEcho = false;
+HardwareSerial Serial;
+
+// Rough costs of an InDataExchange over SPI: host frame, ACK and polling
+// for the response, then the exchange with the tag at 106 kbit/s.
+#define COMMAND_US      2000    // us per command, link overhead
+#define AIR_BYTE_US     90      // us per byte on the air, both ways
+#define AUTH_US         1500    // us more for the Crypto1 handshake
+
+//------------------------------------------------------------------------------
+// Tag stand-in
+
+class MockTag : public PN532Interface
+{
+public:
+    enum Kind { CLASSIC, TYPE2 };
+
+    MockTag(Kind kind, unsigned int pages, bool fastRead)
+        : kind(kind), pages(pages), fastRead(fastRead)
+    {
+        memset(memory, 0, sizeof(memory));
+        static const byte uid4[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+        static const byte uid7[] = { 0x04, 0x8A, 0x3C, 0x52, 0x61, 0x80, 0x80 };
+        uidLength = (kind == CLASSIC) ? 4 : 7;
+        memcpy(uid, (kind == CLASSIC) ? uid4 : uid7, uidLength);
+        reset();
+    }
+
+    void reset()
+    {
+        commands = airBytes = time = 0;
+        selected = true;
+        authSector = -1;
+    }
+
+    void begin() {}
+    void wakeup() {}
+
+    int8_t writeCommand(const uint8_t *header, uint8_t hlen, const uint8_t *body = 0, uint8_t blen = 0)
+    {
+        byte cmd[64];
+        memcpy(cmd, header, hlen);
+        if (blen)
+            memcpy(cmd + hlen, body, blen);
+
+        commands++;
+        time += COMMAND_US;
+        responseLength = 0;
+
+        if (cmd[0] == PN532_COMMAND_INLISTPASSIVETARGET)
+        {
+            selected = true;
+            authSector = -1;
+            const byte target[] = { 1, 1, 0x00, (byte)(kind == CLASSIC ? 0x04 : 0x44),
+                                    (byte)(kind == CLASSIC ? 0x08 : 0x00), uidLength };
+            memcpy(response, target, sizeof(target));
+            memcpy(response + sizeof(target), uid, uidLength);
+            responseLength = sizeof(target) + uidLength;
+            air(4, 5 + uidLength);
+        }
+        else if (cmd[0] == PN532_COMMAND_INDATAEXCHANGE)
+        {
+            air(hlen + blen - 2, 0);
+            if (!selected)
+                fail();
+            else if (kind == CLASSIC)
+                classic(cmd);
+            else
+                type2(cmd);
+        }
+        else
+        {
+            response[0] = 0;
+            responseLength = 1;
+        }
+        return 0;
+    }
+
+    int16_t readResponse(uint8_t buf[], uint8_t len, uint16_t = 1000)
+    {
+        if (responseLength > len)
+            return PN532_NO_SPACE;
+        memcpy(buf, response, responseLength);
+        return responseLength;
+    }
+
+    // Lays an NDEF Message TLV and a terminator in the data area, behind a
+    // Lock Control TLV on Type 2 tags when lockTlv is set.
+    void store(const byte *message, unsigned int length, bool lockTlv)
+    {
+        std::vector<byte> tlv;
+        if (lockTlv)
+        {
+            const byte lock[] = { 0x01, 0x03, 0xA0, 0x10, 0x44 };
+            tlv.insert(tlv.end(), lock, lock + sizeof(lock));
+        }
+        tlv.push_back(0x03);
+        if (length < 0xFF)
+        {
+            tlv.push_back(length);
+        }
+        else
+        {
+            tlv.push_back(0xFF);
+            tlv.push_back(length >> 8);
+            tlv.push_back(length & 0xFF);
+        }
+        tlv.insert(tlv.end(), message, message + length);
+        tlv.push_back(0xFE);
+
+        if (kind == TYPE2)
+        {
+            memset(memory, 0, sizeof(memory));
+            const byte cc[] = { 0xE1, 0x10, (byte)((pages - 4) * 4 / 8), 0x00 };
+            memcpy(&memory[12], cc, sizeof(cc));
+            memcpy(&memory[16], &tlv[0], tlv.size());
+            return;
+        }
+
+        memset(memory, 0, sizeof(memory));
+        unsigned int block = 4;
+        for (unsigned int i = 0; i < tlv.size(); i += 16, block++)
+        {
+            if (block % 4 == 3)
+                block++;
+            memcpy(&memory[block * 16], &tlv[i], tlv.size() - i < 16 ? tlv.size() - i : 16);
+        }
+        for (int sector = 0; sector < 16; sector++)
+        {
+            static const byte keyMad[] = { 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5 };
+            static const byte keyNdef[] = { 0xD3, 0xF7, 0xD3, 0xF7, 0xD3, 0xF7 };
+            memcpy(&memory[(sector * 4 + 3) * 16], sector ? keyNdef : keyMad, 6);
+        }
+    }
+
+    byte uid[7];
+    byte uidLength;
+    unsigned long commands;
+    unsigned long airBytes;
+    unsigned long time;
+
+private:
+    void air(unsigned int sent, unsigned int received)
+    {
+        airBytes += sent + received;
+        time += (sent + received) * AIR_BYTE_US;
+    }
+
+    void reply(const byte *data, unsigned int length)
+    {
+        response[0] = 0x00;
+        memcpy(response + 1, data, length);
+        responseLength = 1 + length;
+        air(0, length);
+    }
+
+    // NAK or no answer: the PN532 reports an error, the tag goes IDLE.
+    void fail()
+    {
+        response[0] = 0x01;
+        responseLength = 1;
+        selected = false;
+        authSector = -1;
+    }
+
+    void classic(const byte *cmd)
+    {
+        const int sector = cmd[3] / 4;
+        if (cmd[2] == MIFARE_CMD_AUTH_A)
+        {
+            time += AUTH_US;
+            if (memcmp(&cmd[4], &memory[(sector * 4 + 3) * 16], 6) != 0)
+            {
+                response[0] = 0x14;
+                responseLength = 1;
+                selected = false;
+                authSector = -1;
+                return;
+            }
+            authSector = sector;
+            reply(0, 0);
+        }
+        else if (cmd[2] == MIFARE_CMD_READ && sector == authSector && cmd[3] < 64)
+        {
+            reply(&memory[cmd[3] * 16], 16);
+        }
+        else
+        {
+            fail();
+        }
+    }
+
+    void type2(const byte *cmd)
+    {
+        byte data[64];
+        if (cmd[2] == MIFARE_CMD_READ && cmd[3] < pages)
+        {
+            for (int i = 0; i < 16; i++)
+                data[i] = memory[((cmd[3] * 4 + i) % (pages * 4))];
+            reply(data, 16);
+        }
+        else if (cmd[2] == MIFARE_CMD_FAST_READ && fastRead &&
+                 cmd[3] <= cmd[4] && cmd[4] < pages)
+        {
+            const unsigned int length = (cmd[4] - cmd[3] + 1) * 4;
+            std::vector<byte> pagesRead(&memory[cmd[3] * 4], &memory[cmd[3] * 4] + length);
+            if (length > sizeof(response) - 1)
+                fail();
+            else
+                reply(&pagesRead[0], length);
+        }
+        else
+        {
+            fail();
+        }
+    }
+
+    Kind kind;
+    unsigned int pages;
+    bool fastRead;
+    bool selected;
+    int authSector;
+    byte memory[1024];
+    byte response[80];
+    unsigned int responseLength;
+};
+
+//------------------------------------------------------------------------------
+
+struct TagModel
+{
+    const char *name;
+    MockTag::Kind kind;
+    unsigned int pages;     // Type 2 only
+    bool fastRead;
+    unsigned int capacity;  // NDEF bytes that fit
+    bool lockTlv;
+};
+
+static const TagModel models[] =
+{
+    { "Classic 1K",   MockTag::CLASSIC, 0,   false, 716, false },
+    { "Ultralight",   MockTag::TYPE2,   16,  false, 40,  false },
+    { "Ultralight C", MockTag::TYPE2,   40,  false, 130, true  },
+    { "NTAG213",      MockTag::TYPE2,   45,  true,  130, true  },
+    { "NTAG215",      MockTag::TYPE2,   135, true,  490, false },
+    { "NTAG216",      MockTag::TYPE2,   231, true,  860, false },
+};
+
+static const unsigned int sizes[] = { 20, 40, 100, 130, 240, 490, 700, 860 };
+
+static std::vector<byte> buildMessage(unsigned int size)
+{
+    // One text record padded to reach size bytes when encoded
+    NdefMessage m = NdefMessage();
+    std::string text(size > 7 ? size - 7 : 1, 'x');
+    for (unsigned int i = 0; i < text.size(); i++)
+        text[i] = 'a' + i % 26;
+    m.addTextRecord(text.c_str());
+    if (m.getEncodedSize() != (int)size)
+    {
+        // long records have a 4 byte payload length
+        text.resize(text.size() - (m.getEncodedSize() - size));
+        m = NdefMessage();
+        m.addTextRecord(text.c_str());
+    }
+    std::vector<byte> encoded(m.getEncodedSize());
+    m.encode(&encoded[0]);
+    return encoded;
+}
+
+static bool sameMessage(NfcTag& tag, const std::vector<byte>& expected)
+{
+    if (!tag.hasNdefMessage())
+        return false;
+    NdefMessage m = tag.getNdefMessage();
+    if (m.getEncodedSize() != (int)expected.size())
+        return false;
+    std::vector<byte> encoded(expected.size());
+    m.encode(&encoded[0]);
+    return encoded == expected;
+}
+
+int main(int argc, char **argv)
+{
+    serialEcho = argc > 1;
+    unsigned int errors = 0;
+    unsigned long oldCommands = 0, newCommands = 0;
+
+    printf("FAST_READ: %d pages\n", ULTRALIGHT_FAST_READ_PAGES);
+    printf("%-13s %5s  %23s  %23s\n", "tag", "bytes", "before: cmds  air    ms", "after: cmds  air    ms");
+
+    for (unsigned int t = 0; t < sizeof(models) / sizeof(models[0]); t++)
+    {
+        const TagModel& model = models[t];
+        for (unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        {
+            if (sizes[s] > model.capacity)
+                continue;
+
+            const std::vector<byte> message = buildMessage(sizes[s]);
+            MockTag tag(model.kind, model.pages, model.fastRead);
+            tag.store(&message[0], message.size(), model.lockTlv);
+            PN532 nfc(tag);
+
+            // Old readers: the Ultralight one only reaches page 63
+            // through an 8-bit index, and missed TLVs in front of the
+            // NDEF TLV other than a 5-byte Lock Control TLV.
+            char before[40];
+            NfcTag oldTag = (model.kind == MockTag::CLASSIC)
+                ? LegacyMifareClassic(nfc).read(tag.uid, tag.uidLength)
+                : LegacyMifareUltralight(nfc).read(tag.uid, tag.uidLength);
+            if (sameMessage(oldTag, message))
+            {
+                snprintf(before, sizeof(before), "%4lu %5lu %6.1f", tag.commands, tag.airBytes, tag.time / 1000.0);
+                oldCommands += tag.commands;
+            }
+            else
+            {
+                snprintf(before, sizeof(before), "%17s", "misread");
+            }
+
+            tag.reset();
+            NfcTag newTag = (model.kind == MockTag::CLASSIC)
+                ? MifareClassic(nfc).read(tag.uid, tag.uidLength)
+                : MifareUltralight(nfc).read(tag.uid, tag.uidLength);
+            const bool ok = sameMessage(newTag, message);
+            if (!ok)
+                errors++;
+            else if (before[strlen(before) - 1] != 'd')
+                newCommands += tag.commands;
+
+            printf("%-13s %5u  %23s  %4lu %5lu %6.1f %s\n", model.name, (unsigned)message.size(),
+                   before, tag.commands, tag.airBytes, tag.time / 1000.0, ok ? "" : "MISMATCH");
+        }
+    }
+
+    printf("commands where both read: %lu before, %lu after\n", oldCommands, newCommands);
+    printf("%u mismatches\n", errors);
+    return errors ? 1 : 0;
+}
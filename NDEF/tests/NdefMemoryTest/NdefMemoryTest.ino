@@ -21,6 +21,32 @@ void assertNoLeak(void (*callback)())
   assertEqual(0, (start - end));
 }
 
+// avr-libc heap bookkeeping
+extern char *__brkval;
+extern char __heap_start;
+struct __freelist { size_t sz; struct __freelist *nx; };
+extern struct __freelist *__flp;
+
+// bytes of heap in use, blocks on the free list excluded
+int heapUsed()
+{
+  int used = (__brkval ? __brkval : &__heap_start) - &__heap_start;
+  for (struct __freelist *fp = __flp; fp; fp = fp->nx)
+  {
+    used -= fp->sz + sizeof(size_t);
+  }
+  return used;
+}
+
+// Custom Assertion, for code that must not touch the heap at all
+// (unlike assertNoLeak, which passes if everything is freed afterwards)
+void assertNoAllocation(void (*callback)())
+{
+  int start = heapUsed();
+  (*callback)();
+  assertEqual(0, (heapUsed() - start));
+}
+
 void record()
 {
   NdefRecord* r = new NdefRecord();
@@ -141,6 +167,69 @@ void message120()
   //message.print();
 }
 
+// an encoded message, as read from a tag
+uint8_t tagBuffer[128];
+int tagBufferSize;
+int heapDuringRead;
+
+void encodeTagBuffer()
+{
+  NdefMessage message = NdefMessage();
+  message.addTextRecord("Hello, Arduino!");
+  message.addUriRecord("http://arduino.cc");
+  message.addMimeMediaRecord("text/plain", "view");
+  tagBufferSize = message.getEncodedSize();
+  message.encode(tagBuffer);
+}
+
+// reads every record the way a sketch iterates a message
+void readRecords(NdefMessage& message)
+{
+  for (int i = 0; i < message.getRecordCount(); i++)
+  {
+    NdefRecord record = message[i];
+    byte payload[record.getPayloadLength()];
+    record.getPayload(payload);
+    byte type[record.getTypeLength()];
+    record.getType(type);
+  }
+}
+
+void viewMessage()
+{
+  int start = heapUsed();
+  NdefMessage message = NdefMessage(tagBuffer, tagBufferSize, NDEF_VIEW);
+  readRecords(message);
+  NdefMessage copy = message;
+  heapDuringRead = heapUsed() - start;
+}
+
+void arenaMessage()
+{
+  int start = heapUsed();
+  byte arena[sizeof(tagBuffer)];
+  NdefMessage message = NdefMessage(tagBuffer, tagBufferSize, arena, sizeof(arena));
+  readRecords(message);
+  heapDuringRead = heapUsed() - start;
+}
+
+void copyMessage()
+{
+  int start = heapUsed();
+  NdefMessage message = NdefMessage(tagBuffer, tagBufferSize);
+  readRecords(message);
+  heapDuringRead = heapUsed() - start;
+}
+
+// changing a view record copies it to the heap, and frees it
+void viewRecordSetter()
+{
+  NdefMessage message = NdefMessage(tagBuffer, tagBufferSize, NDEF_VIEW);
+  NdefRecord record = message[0];
+  uint8_t id[] = { 0x1 };
+  record.setId(id, sizeof(id));
+}
+
 void setup() {
   Serial.begin(9600);
   Serial.println("\n");
@@ -188,6 +277,65 @@ test(messageOneBigRecord)
   //assertNoLeak(&message120);
 }
 
+test(viewMessageNoAllocation)
+{
+  encodeTagBuffer();
+  assertNoAllocation(&viewMessage);
+  assertEqual(0, heapDuringRead);
+  assertNoAllocation(&arenaMessage);
+  assertEqual(0, heapDuringRead);
+}
+
+test(copyMessageAllocates)
+{
+  encodeTagBuffer();
+  assertNoLeak(&copyMessage);
+  assertTrue(heapDuringRead > 0);
+  assertNoLeak(&viewRecordSetter);
+}
+
+test(viewMessageDecode)
+{
+  encodeTagBuffer();
+  NdefMessage view = NdefMessage(tagBuffer, tagBufferSize, NDEF_VIEW);
+  NdefMessage copy = NdefMessage(tagBuffer, tagBufferSize);
+  assertEqual(3, (int)view.getRecordCount());
+  assertTrue(view[0].isView());
+  assertTrue(!copy[0].isView());
+
+  uint8_t encoded[sizeof(tagBuffer)];
+  assertEqual(tagBufferSize, view.getEncodedSize());
+  view.encode(encoded);
+  for (int i = 0; i < tagBufferSize; i++)
+  {
+    assertEqual(tagBuffer[i], encoded[i]);
+  }
+}
+
+test(parseTime)
+{
+  encodeTagBuffer();
+  const int rounds = 20;
+
+  unsigned long start = micros();
+  for (int i = 0; i < rounds; i++)
+  {
+    copyMessage();
+  }
+  unsigned long copyTime = (micros() - start) / rounds;
+
+  start = micros();
+  for (int i = 0; i < rounds; i++)
+  {
+    viewMessage();
+  }
+  unsigned long viewTime = (micros() - start) / rounds;
+
+  Serial.print(F("Decode and read "));Serial.print(tagBufferSize);Serial.println(F(" bytes"));
+  Serial.print(F("  NDEF_COPY "));Serial.print(copyTime);Serial.println(F(" us"));
+  Serial.print(F("  NDEF_VIEW "));Serial.print(viewTime);Serial.println(F(" us"));
+}
+
 test(memoryKludgeStart)
 {
   Serial.println(F("---------"));
@@ -650,6 +650,90 @@ uint8_t PN532::mifareultralight_ReadPage (uint8_t page, uint8_t *buffer)
     return 1;
 }
 
+/**************************************************************************/
+/*!
+    Reads 16 bytes, four 4-bytes pages, starting at the specified address
+    with a single READ command.  Every Type 2 tag answers READ this way;
+    pages past the end of the tag wrap around to page 0.
+
+    @param  page        The first page number
+    @param  buffer      Pointer to the byte array that will hold the
+                        16 bytes retrieved (if any)
+
+    @returns 1 if everything executed properly, 0 for an error
+*/
+/**************************************************************************/
+uint8_t PN532::mifareultralight_ReadPages (uint8_t page, uint8_t *buffer)
+{
+    /* Prepare the command */
+    pn532_packetbuffer[0] = PN532_COMMAND_INDATAEXCHANGE;
+    pn532_packetbuffer[1] = 1;                   /* Card number */
+    pn532_packetbuffer[2] = MIFARE_CMD_READ;     /* Mifare Read command = 0x30 */
+    pn532_packetbuffer[3] = page;                /* First page number */
+
+    /* Send the command */
+    if (HAL(writeCommand)(pn532_packetbuffer, 4)) {
+        return 0;
+    }
+
+    /* Read the response packet */
+    int16_t status = HAL(readResponse)(pn532_packetbuffer, sizeof(pn532_packetbuffer));
+    if (status < 17 || pn532_packetbuffer[0] != 0x00) {
+        return 0;
+    }
+
+    memcpy (buffer, pn532_packetbuffer + 1, 16);
+    return 1;
+}
+
+/**************************************************************************/
+/*!
+    Reads the pages from startPage to endPage, both included, with a
+    single FAST_READ command.  FAST_READ is implemented by NTAG21x and
+    Ultralight EV1 tags; others answer with a NAK and go back to the IDLE
+    state, so the tag must be selected again after a failure.  The pages
+    must fit in the packet buffer: at most 15 pages, and less with an I2C
+    link that reads through a small Wire buffer.
+
+    @param  startPage   The first page number
+    @param  endPage     The last page number
+    @param  buffer      Pointer to the byte array that will hold the
+                        retrieved data (if any)
+
+    @returns 1 if everything executed properly, 0 for an error
+*/
+/**************************************************************************/
+uint8_t PN532::mifareultralight_FastRead (uint8_t startPage, uint8_t endPage, uint8_t *buffer)
+{
+    uint8_t length = (endPage - startPage + 1) * 4;
+
+    if (endPage < startPage || length > sizeof(pn532_packetbuffer) - 1) {
+        DMSG("Page range out of range\n");
+        return 0;
+    }
+
+    /* Prepare the command */
+    pn532_packetbuffer[0] = PN532_COMMAND_INDATAEXCHANGE;
+    pn532_packetbuffer[1] = 1;                       /* Card number */
+    pn532_packetbuffer[2] = MIFARE_CMD_FAST_READ;    /* Fast Read command = 0x3A */
+    pn532_packetbuffer[3] = startPage;
+    pn532_packetbuffer[4] = endPage;
+
+    /* Send the command */
+    if (HAL(writeCommand)(pn532_packetbuffer, 5)) {
+        return 0;
+    }
+
+    /* Read the response packet */
+    int16_t status = HAL(readResponse)(pn532_packetbuffer, sizeof(pn532_packetbuffer));
+    if (status < length + 1 || pn532_packetbuffer[0] != 0x00) {
+        return 0;
+    }
+
+    memcpy (buffer, pn532_packetbuffer + 1, length);
+    return 1;
+}
+
 /**************************************************************************/
 /*!
     Tries to write an entire 4-bytes data buffer at the specified page
@@ -58,6 +58,7 @@
 #define MIFARE_CMD_READ                     (0x30)
 #define MIFARE_CMD_WRITE                    (0xA0)
 #define MIFARE_CMD_WRITE_ULTRALIGHT         (0xA2)
+#define MIFARE_CMD_FAST_READ                (0x3A)
 #define MIFARE_CMD_TRANSFER                 (0xB0)
 #define MIFARE_CMD_DECREMENT                (0xC0)
 #define MIFARE_CMD_INCREMENT                (0xC1)
@@ -154,6 +155,8 @@ public:
 
     // Mifare Ultralight functions
     uint8_t mifareultralight_ReadPage (uint8_t page, uint8_t *buffer);
+    uint8_t mifareultralight_ReadPages (uint8_t page, uint8_t *buffer);
+    uint8_t mifareultralight_FastRead (uint8_t startPage, uint8_t endPage, uint8_t *buffer);
     uint8_t mifareultralight_WritePage (uint8_t page, uint8_t *buffer);
 
     // Help functions to display formatted text
@@ -584,6 +584,8 @@ void RF22::clearRxBuf()
 
 boolean RF22::available()
 {
+    if (_mode == RF22_MODE_TX)
+	return false; // Dont turn the transmitter off in the middle of a message
     if (!_rxBufValid)
 	setModeRx(); // Make sure we are receiving
     return _rxBufValid;
@@ -66,6 +66,13 @@
 /// from http://www.airspayce.com/mikem/arduino/RF22/RF22-1.40.zip
 /// You can find the latest version at http://www.airspayce.com/mikem/arduino/RF22
 ///
+/// \par Local additions
+/// This copy adds to release 1.40 and is not an upstream release:
+/// - RF22ReliableDatagram::sendtoWindow() and poll(), which keep up to RF22_WINDOW_SIZE 
+///   messages in flight with one ACK per burst, and RF22Router::sendtoWindow() and 
+///   RF22Mesh::sendtoWindow(), which forward them the same way at every hop.
+/// - available() no longer stops a transmission in progress.
+///
 /// You can also find online help and disussion at 
 /// http://groups.google.com/group/rf22-arduino
 /// Please use that group for all questions and discussions on this topic. 
@@ -1087,7 +1094,8 @@ public:
     boolean        setModemConfig(ModemConfigChoice index);
 
     /// Starts the receiver and checks whether a received message is available.
-    /// This can be called multiple times in a timeout loop
+    /// This can be called multiple times in a timeout loop.
+    /// Returns false without starting the receiver while a message is being transmitted.
     /// \return true if a complete, valid message has been received and is able to be retrieved by
     /// recv()
     boolean        available();
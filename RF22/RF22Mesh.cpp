@@ -45,6 +45,25 @@ uint8_t RF22Mesh::sendtoWait(uint8_t* buf, uint8_t len, uint8_t address)
     return RF22Router::sendtoWait(_tmpMessage, sizeof(RF22Mesh::MeshMessageHeader) + len, address);
 }
 
+#if RF22_WINDOW_SIZE
+////////////////////////////////////////////////////////////////////
+// Discovers a route to the destination (if necessary), and queues it for the next hop
+uint8_t RF22Mesh::sendtoWindow(uint8_t* buf, uint8_t len, uint8_t address)
+{
+    if (len > RF22_MESH_MAX_MESSAGE_LEN)
+	return RF22_ROUTER_ERROR_INVALID_LENGTH;
+
+    RoutingTableEntry* route = getRouteTo(address);
+    if (!route && !doArp(address))
+	return RF22_ROUTER_ERROR_NO_ROUTE;
+
+    MeshApplicationMessage* a = (MeshApplicationMessage*)&_tmpMessage;
+    a->header.msgType = RF22_MESH_MESSAGE_TYPE_APPLICATION;
+    memcpy(a->data, buf, len);
+    return RF22Router::sendtoWindow(_tmpMessage, sizeof(RF22Mesh::MeshMessageHeader) + len, address);
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////
 boolean RF22Mesh::doArp(uint8_t address)
 {
@@ -137,6 +156,26 @@ uint8_t RF22Mesh::route(RoutedMessage* message, uint8_t messageLen)
     return ret;
 }
 
+#if RF22_WINDOW_SIZE
+////////////////////////////////////////////////////////////////////
+// This is called when the next hop never acknowledged a windowed message
+void RF22Mesh::windowFailed(RoutedMessage* message, uint8_t messageLen)
+{
+    // As route() does when it cant deliver to the next hop. Delete the route
+    deleteRouteTo(message->header.dest);
+    if (message->header.source != _thisAddress)
+    {
+	// This was being proxied, so tell the originator about it. 
+	// message is in the RF22Router::_tmpMessage that sendtoWait() fills
+	MeshRouteFailureMessage p;
+	p.header.msgType = RF22_MESH_MESSAGE_TYPE_ROUTE_FAILURE;
+	p.dest = message->header.dest; // Who we were trying to deliver to
+	uint8_t source = message->header.source;
+	RF22Router::sendtoWait((uint8_t*)&p, sizeof(RF22Mesh::MeshMessageHeader) + 1, source);
+    }
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////
 // Subclasses may want to override
 boolean RF22Mesh::isPhysicalAddress(uint8_t* address, uint8_t addresslen)
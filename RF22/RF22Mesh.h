@@ -156,6 +156,21 @@ public:
     ///           (usually because it dod not acknowledge due to being off the air or out of range
     uint8_t sendtoWait(uint8_t* buf, uint8_t len, uint8_t dest);
 
+#if RF22_WINDOW_SIZE
+    /// Like sendtoWait(), but once the route is known, queues the message with 
+    /// RF22Router::sendtoWindow() instead of waiting for the ACK of the next hop.
+    /// Failures to deliver to the next hop, including those of windowed messages given up later, 
+    /// delete the route, and a router on the way tells the originator, as for sendtoWait().
+    /// \param [in] buf The application message data
+    /// \param [in] len Number of octets in the application message data. 0 is permitted
+    /// \param [in] dest The destination node address
+    /// \return The result code:
+    ///         - RF22_ROUTER_ERROR_NONE Message was queued for the next hop
+    ///         - RF22_ROUTER_ERROR_INVALID_LENGTH The message is too long
+    ///         - RF22_ROUTER_ERROR_NO_ROUTE There was no route for dest, and none could be discovered
+    uint8_t sendtoWindow(uint8_t* buf, uint8_t len, uint8_t dest);
+#endif
+
     /// Starts the receiver if it is not running already.
     /// If there is a valid application layer message available for this node (or RF22_BROADCAST_ADDRESS), 
     /// send an acknowledgement to the last hop
@@ -208,6 +223,14 @@ protected:
     /// \param [in] messageLen Length of message in octets
     virtual uint8_t route(RoutedMessage* message, uint8_t messageLen);
 
+#if RF22_WINDOW_SIZE
+    /// Called when the next hop never acknowledged a windowed message. As route() does on a failure,
+    /// deletes the route, and if the message is being proxied, tells the originator about it.
+    /// \param [in] message Pointer to the RF22Router message that was given up.
+    /// \param [in] messageLen Length of message in octets
+    virtual void windowFailed(RoutedMessage* message, uint8_t messageLen);
+#endif
+
     /// Try to resolve a route for the given address. Blocks while discovering the route
     /// which may take up to 4000 msec.
     /// Virtual so subclasses can override.
@@ -23,6 +23,25 @@ RF22ReliableDatagram::RF22ReliableDatagram(uint8_t thisAddress, uint8_t slaveSel
     _lastSequenceNumber = 0;
     _timeout = 200;
     _retries = 3;
+#if RF22_WINDOW_SIZE
+    // The windows of received messages start here too. Zero anyway for a global, but not on the stack
+    memset(_seenIds, 0, sizeof(_seenIds));
+    uint8_t i;
+    for (i = 0; i < RF22_WINDOW_SIZE; i++)
+	_window[i].state = WindowFree;
+    for (i = 0; i < RF22_WINDOW_PEERS; i++)
+    {
+	_windowPeers[i].inUse = false;
+	_windowReceipts[i].mask = 0;
+    }
+    _windowHead = 0;
+    _windowUsed = 0;
+    _windowState = WindowIdle;
+    _windowHeld = false;
+    _windowHoldOff = WindowNoHoldOff;
+    _windowFailures = 0;
+    _windowGivenUp = 0;
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -41,8 +60,13 @@ void RF22ReliableDatagram::setRetries(uint8_t retries)
 ////////////////////////////////////////////////////////////////////
 boolean RF22ReliableDatagram::sendtoWait(uint8_t* buf, uint8_t len, uint8_t address)
 {
+#if RF22_WINDOW_SIZE
+    // Messages queued by sendtoWindow() go first
+    waitWindowAcked();
+#endif
+
     // Assemble the message
-    uint8_t thisSequenceNumber = ++_lastSequenceNumber;
+    uint8_t thisSequenceNumber = nextSequenceNumber(address);
     uint8_t retries = 0;
     while (retries++ <= _retries)
     {
@@ -81,13 +105,11 @@ boolean RF22ReliableDatagram::sendtoWait(uint8_t* buf, uint8_t len, uint8_t addr
 		    // Its the ACK we are waiting for
 		    return true;
 		}
-		else if (   !(flags & RF22_FLAGS_ACK)
-			 && (id == _seenIds[from]))
+		else
 		{
-		    // This is a request we have already received. ACK it again
-		    acknowledge(id, from);
+		    // Discard it, but maybe ACK it again
+		    acknowledgeAgain();
 		}
-		// Else discard it
 	    }
 	    // Not the one we are waiting for, maybe keep waiting until timeout exhausted
 	}
@@ -103,31 +125,58 @@ boolean RF22ReliableDatagram::recvfromAck(uint8_t* buf, uint8_t* len, uint8_t* f
     uint8_t _to;
     uint8_t _id;
     uint8_t _flags;
+#if RF22_WINDOW_SIZE
+    // Move any windowed messages on, and collect their ACKs
+    poll();
+#endif
     // Get the message before its clobbered by the ACK (shared rx anfd tx buffer in RF22
     if (available() && recvfrom(buf, len, &_from, &_to, &_id, &_flags))
     {
 	// Never ACK an ACK
 	if (!(_flags & RF22_FLAGS_ACK))
 	{
-	    // Its a normal message for this node, not an ACK
-	    if (_to != RF22_BROADCAST_ADDRESS)
+#if RF22_WINDOW_SIZE
+	    if (_flags & RF22_FLAGS_WINDOW)
 	    {
-		// Its not a broadcast, so ACK it
-		// Acknowledge message with ACK set in flags and ID set to received ID
-		acknowledge(_id, _from);
+		// Sent by sendtoWindow(). ACKed only if it asks, and new only if it is not in the window
+		if (_to == RF22_BROADCAST_ADDRESS || !windowReceived(_from, _id, _flags))
+		    return false;
 	    }
-	    // If we have not seen this message before, then we are interested in it
-	    if (_id != _seenIds[_from])
+	    else
+#endif
 	    {
-		if (from)  *from =  _from;
-		if (to)    *to =    _to;
-		if (id)    *id =    _id;
-		if (flags) *flags = _flags;
+		// Its a normal message for this node, not an ACK
+		if (_to != RF22_BROADCAST_ADDRESS)
+		{
+		    // Its not a broadcast, so ACK it
+		    // Acknowledge message with ACK set in flags and ID set to received ID
+		    acknowledge(_id, _from);
+		}
+		// If we have seen this message before, just re-ack it and wait for a new one
+		if (_id == _seenIds[_from])
+		    return false;
 		_seenIds[_from] = _id;
-		return true;
+#if RF22_WINDOW_SIZE
+		// Any window from that node is over
+		WindowReceipt* r = windowReceipt(_from, false);
+		if (r)
+		    r->mask = 0;
+#endif
 	    }
-	    // Else just re-ack it and wait for a new one
+	    // We have not seen this message before, so we are interested in it
+	    if (from)  *from =  _from;
+	    if (to)    *to =    _to;
+	    if (id)    *id =    _id;
+	    if (flags) *flags = _flags;
+	    return true;
 	}
+#if RF22_WINDOW_SIZE
+	else if ((_flags & RF22_FLAGS_WINDOW) && _to == _thisAddress)
+	{
+	    // ACK of windowed messages that arrived after poll() looked
+	    windowAcknowledged(_from, _id, *len ? buf[0] : 0);
+	}
+#endif
     }
     // No message for us available
     return false;
@@ -161,3 +210,505 @@ void RF22ReliableDatagram::acknowledge(uint8_t id, uint8_t from)
     waitPacketSent();
 }
 
+
+////////////////////////////////////////////////////////////////////
+void RF22ReliableDatagram::acknowledgeAgain()
+{
+    uint8_t from = headerFrom();
+    uint8_t id = headerId();
+    uint8_t flags = headerFlags();
+    if (flags & RF22_FLAGS_ACK)
+	return;
+#if RF22_WINDOW_SIZE
+    if (flags & RF22_FLAGS_WINDOW)
+    {
+	// Tell the sender what we do have, so it sends again only the rest
+	if (headerTo() == _thisAddress && (flags & RF22_FLAGS_ACK_REQUEST))
+	    acknowledgeWindow(from);
+	return;
+    }
+#endif
+    if (id == _seenIds[from])
+    {
+	// This is a request we have already received. ACK it again
+	acknowledge(id, from);
+    }
+}
+
+#if RF22_WINDOW_SIZE
+////////////////////////////////////////////////////////////////////
+// Windowed sending
+boolean RF22ReliableDatagram::sendtoWindow(uint8_t* buf, uint8_t len, uint8_t address)
+{
+    if (   address == RF22_BROADCAST_ADDRESS
+	|| !len 
+	|| len > RF22_MAX_MESSAGE_LEN
+	|| !windowRoom(address))
+	return false;
+
+    WindowPeer* p = windowPeer(address);
+    if (!p)
+    {
+	// New node, or one we had forgotten. Start a window with a SYNC
+	p = windowNewPeer();
+	p->nextId = nextSequenceNumber(address);
+	p->address = address;
+	p->synced = false;
+	p->inUse = true;
+    }
+
+    uint8_t index = (_windowHead + _windowUsed++) % RF22_WINDOW_SIZE;
+    _windowGivenUp &= ~(1 << index);
+    WindowSlot* slot = &_window[index];
+    slot->address = address;
+    slot->id = p->nextId++;
+    slot->state = WindowPending;
+    slot->tries = 0;
+    slot->len = len;
+    memcpy(slot->data, buf, len);
+    poll();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////
+uint8_t RF22ReliableDatagram::poll()
+{
+    // The message to transmit would clobber a received one: they share the buffer
+    boolean held = available() && !windowAckReceived();
+    if (!held)
+	_windowHeld = false;
+    else if (!_windowHeld)
+    {
+	_windowHeld = true;
+	_windowHeldAt = millis();
+    }
+    if (!held && mode() == RF22_MODE_TX)
+	return windowInFlight(RF22_BROADCAST_ADDRESS);
+
+    if (_windowState == WindowLastSent)
+    {
+	// Timeout does not include the transmit time
+	_windowSentAt = millis();
+	_windowState = WindowWaiting;
+    }
+    if (_windowState == WindowWaiting)
+    {
+	if ((millis() - _windowSentAt) < _windowTimeout)
+	    return windowInFlight(RF22_BROADCAST_ADDRESS);
+	// No ACK. Send the whole burst again
+	windowRetry(_windowAddress);
+	_windowState = WindowIdle;
+    }
+
+    // Give recvfromAck() time to collect the message. After that, go on as if the messages
+    // that cannot be sent were lost, so they are given up in the end if it is never collected
+    if (held && (millis() - _windowHeldAt) < _timeout)
+	return windowInFlight(RF22_BROADCAST_ADDRESS);
+
+    uint8_t n;
+    WindowSlot* slot;
+    if (_windowState == WindowIdle)
+    {
+	// Let a burst to us finish before starting one of our own
+	if (_windowHoldOff && (millis() - _windowHoldOffAt) < _windowHoldOffTime)
+	    return windowInFlight(RF22_BROADCAST_ADDRESS);
+	_windowHoldOff = WindowNoHoldOff;
+	// The burst goes to the node of the oldest message waiting
+	for (n = 0; n < _windowUsed; n++)
+	{
+	    slot = &_window[(_windowHead + n) % RF22_WINDOW_SIZE];
+	    if (slot->state == WindowPending)
+	    {
+		_windowAddress = slot->address;
+		_windowState = WindowSending;
+		_windowBurstAt = millis();
+		break;
+	    }
+	}
+	if (_windowState == WindowIdle)
+	    return windowInFlight(RF22_BROADCAST_ADDRESS); // Nothing to send
+    }
+
+    // Find the next message of the burst, and whether it is the last
+    WindowPeer* p = windowPeer(_windowAddress);
+    WindowSlot* next = NULL;
+    boolean more = false;
+    for (n = 0; n < _windowUsed; n++)
+    {
+	slot = &_window[(_windowHead + n) % RF22_WINDOW_SIZE];
+	if (slot->state != WindowPending || slot->address != _windowAddress)
+	    continue;
+	if (next)
+	{
+	    more = true;
+	    break;
+	}
+	next = slot;
+	if (!p->synced)
+	    break; // The SYNC goes on its own
+    }
+    if (!next)
+    {
+	_windowState = WindowIdle;
+	return windowInFlight(RF22_BROADCAST_ADDRESS);
+    }
+
+    if (next->tries > _retries)
+    {
+	// Give it up. The receiver's window starts again after it
+	next->state = WindowFree;
+	windowTrim();
+	_windowFailures++;
+	_windowGivenUp |= 1 << (next - _window);
+	p->synced = false;
+	windowRetry(_windowAddress);
+	_windowState = WindowIdle;
+	return windowInFlight(RF22_BROADCAST_ADDRESS);
+    }
+
+    uint8_t flags = RF22_FLAGS_WINDOW;
+    if (!p->synced)
+	flags |= RF22_FLAGS_WINDOW_SYNC;
+    if (!more)
+    {
+	flags |= RF22_FLAGS_ACK_REQUEST;
+	_windowState = WindowLastSent;
+	// Random as for sendtoWait() the first time. Bursts are long, so the range doubles 
+	// each time this one is sent again, to keep bursts that collide from colliding again
+	uint8_t backoff = next->tries < 3 ? next->tries : 3;
+	_windowTimeout = _timeout + (((uint32_t)_timeout << backoff) * random(0, 256) / 256);
+    }
+    next->state = WindowSent;
+    if (held)
+    {
+	next->tries++;
+	return windowInFlight(RF22_BROADCAST_ADDRESS);
+    }
+    if (next->tries++)
+	_retransmissions++;
+    setHeaderId(next->id);
+    setHeaderFlags(flags);
+    sendto(next->data, next->len, next->address); // Does not wait for it to be sent
+    return windowInFlight(RF22_BROADCAST_ADDRESS);
+}
+
+////////////////////////////////////////////////////////////////////
+boolean RF22ReliableDatagram::waitWindowAcked()
+{
+    uint16_t failures = _windowFailures;
+    while (poll())
+    {
+	if (available() && !windowAckReceived())
+	{
+	    clearRxBuf(); // Not using recv, so clear it ourselves
+	    acknowledgeAgain();
+	}
+    }
+    return _windowFailures == failures;
+}
+
+////////////////////////////////////////////////////////////////////
+void RF22ReliableDatagram::waitWindowRoom(uint8_t address)
+{
+    while (!windowRoom(address))
+    {
+	poll();
+	if (available() && !windowAckReceived())
+	{
+	    clearRxBuf(); // Not using recv, so clear it ourselves
+	    acknowledgeAgain();
+	}
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+uint16_t RF22ReliableDatagram::windowFailures()
+{
+    return _windowFailures;
+}
+
+////////////////////////////////////////////////////////////////////
+// The data of a free slot stays as it was until sendtoWindow() takes the slot again
+boolean RF22ReliableDatagram::windowGivenUp(uint8_t* buf, uint8_t* len)
+{
+    for (uint8_t i = 0; i < RF22_WINDOW_SIZE; i++)
+    {
+	if (_windowGivenUp & (1 << i))
+	{
+	    _windowGivenUp &= ~(1 << i);
+	    if (*len > _window[i].len)
+		*len = _window[i].len;
+	    memcpy(buf, _window[i].data, *len);
+	    return true;
+	}
+    }
+    return false;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////
+uint8_t RF22ReliableDatagram::nextSequenceNumber(uint8_t address)
+{
+#if RF22_WINDOW_SIZE
+    uint8_t i = 0;
+    ++_lastSequenceNumber;
+    while (i < RF22_WINDOW_PEERS)
+    {
+	WindowPeer* p = &_windowPeers[i++];
+	if (!p->inUse || (address != RF22_BROADCAST_ADDRESS && address != p->address))
+	    continue;
+	// The receiver may hold any of the last RF22_WINDOW_SIZE+1 IDs as its last in order one, 
+	// and takes RF22_WINDOW_SPAN before that for duplicates
+	if ((uint8_t)(p->nextId - 1 - _lastSequenceNumber) <= RF22_WINDOW_SIZE + RF22_WINDOW_SPAN)
+	{
+	    _lastSequenceNumber = p->nextId;
+	    i = 0; // Check them all again
+	}
+    }
+    // This message replaces the window at the receiver: the next windowed one starts a new one
+    for (i = 0; i < RF22_WINDOW_PEERS; i++)
+    {
+	WindowPeer* p = &_windowPeers[i];
+	if (p->inUse && (address == RF22_BROADCAST_ADDRESS || address == p->address))
+	{
+	    p->nextId = _lastSequenceNumber + 1;
+	    p->synced = false;
+	}
+    }
+    return _lastSequenceNumber;
+#else
+    return ++_lastSequenceNumber;
+#endif
+}
+
+#if RF22_WINDOW_SIZE
+////////////////////////////////////////////////////////////////////
+RF22ReliableDatagram::WindowPeer* RF22ReliableDatagram::windowPeer(uint8_t address)
+{
+    uint8_t i;
+    for (i = 0; i < RF22_WINDOW_PEERS; i++)
+	if (_windowPeers[i].inUse && _windowPeers[i].address == address)
+	    return &_windowPeers[i];
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////
+RF22ReliableDatagram::WindowPeer* RF22ReliableDatagram::windowNewPeer()
+{
+    uint8_t i;
+    for (i = 0; i < RF22_WINDOW_PEERS; i++)
+	if (!_windowPeers[i].inUse)
+	    return &_windowPeers[i];
+    for (i = 0; i < RF22_WINDOW_PEERS; i++)
+	if (!windowInFlight(_windowPeers[i].address))
+	    return &_windowPeers[i];
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////
+boolean RF22ReliableDatagram::windowRoom(uint8_t address)
+{
+    return _windowUsed < RF22_WINDOW_SIZE && (windowPeer(address) || windowNewPeer());
+}
+
+////////////////////////////////////////////////////////////////////
+uint8_t RF22ReliableDatagram::windowInFlight(uint8_t address)
+{
+    uint8_t n, count = 0;
+    for (n = 0; n < _windowUsed; n++)
+    {
+	WindowSlot* slot = &_window[(_windowHead + n) % RF22_WINDOW_SIZE];
+	if (   slot->state != WindowFree 
+	    && (address == RF22_BROADCAST_ADDRESS || slot->address == address))
+	    count++;
+    }
+    return count;
+}
+
+////////////////////////////////////////////////////////////////////
+boolean RF22ReliableDatagram::windowAckReceived()
+{
+    uint8_t flags = headerFlags();
+    if (   (flags & (RF22_FLAGS_ACK | RF22_FLAGS_WINDOW)) != (RF22_FLAGS_ACK | RF22_FLAGS_WINDOW)
+	|| headerTo() != _thisAddress)
+	return false;
+    uint8_t from = headerFrom();
+    uint8_t id = headerId();
+    uint8_t mask = 0;
+    uint8_t len = sizeof(mask);
+    recv(&mask, &len); // Clears the Rx buffer
+    if (flags & RF22_FLAGS_WINDOW_BUSY)
+    {
+	// Give it time to forward our burst, and the node after it to forward it again
+	_windowHoldOff = WindowHoldOffBusy;
+	_windowHoldOffAt = millis();
+	_windowHoldOffTime = 2 * (_windowSentAt - _windowBurstAt) + _timeout;
+    }
+    windowAcknowledged(from, id, mask);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////
+void RF22ReliableDatagram::windowAcknowledged(uint8_t from, uint8_t cumulative, uint8_t mask)
+{
+    WindowPeer* p = windowPeer(from);
+    if (!p)
+	return;
+
+    uint8_t n;
+    WindowSlot* slot;
+    if (!p->synced)
+    {
+	// Only an ACK that covers the SYNC will do
+	for (n = 0; n < _windowUsed; n++)
+	{
+	    slot = &_window[(_windowHead + n) % RF22_WINDOW_SIZE];
+	    if (slot->state != WindowFree && slot->address == from)
+		break;
+	}
+	if (   n == _windowUsed 
+	    || slot->state != WindowSent
+	    || (uint8_t)(cumulative - slot->id) >= RF22_WINDOW_SPAN)
+	    return;
+	p->synced = true;
+    }
+
+    for (n = 0; n < _windowUsed; n++)
+    {
+	slot = &_window[(_windowHead + n) % RF22_WINDOW_SIZE];
+	if (slot->state == WindowFree || slot->address != from || !slot->tries)
+	    continue;
+	uint8_t ahead = slot->id - cumulative;
+	if (   (uint8_t)(cumulative - slot->id) < RF22_WINDOW_SPAN
+	    || (ahead <= RF22_WINDOW_SPAN && (mask & (1 << (ahead - 1)))))
+	    slot->state = WindowFree;
+    }
+    windowTrim();
+
+    if (   _windowAddress == from
+	&& (_windowState == WindowLastSent || _windowState == WindowWaiting))
+    {
+	// The ACK of the burst: it did not get the rest
+	windowRetry(from);
+	_windowState = WindowIdle;
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+void RF22ReliableDatagram::windowRetry(uint8_t address)
+{
+    uint8_t n;
+    for (n = 0; n < _windowUsed; n++)
+    {
+	WindowSlot* slot = &_window[(_windowHead + n) % RF22_WINDOW_SIZE];
+	if (slot->state == WindowSent && slot->address == address)
+	    slot->state = WindowPending;
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+void RF22ReliableDatagram::windowTrim()
+{
+    while (_windowUsed && _window[_windowHead].state == WindowFree)
+    {
+	_windowHead = (_windowHead + 1) % RF22_WINDOW_SIZE;
+	_windowUsed--;
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+// Windowed receiving
+RF22ReliableDatagram::WindowReceipt* RF22ReliableDatagram::windowReceipt(uint8_t from, boolean create)
+{
+    uint8_t i;
+    for (i = 0; i < RF22_WINDOW_PEERS; i++)
+	if (_windowReceipts[i].mask && _windowReceipts[i].address == from)
+	    return &_windowReceipts[i];
+    if (create)
+    {
+	for (i = 0; i < RF22_WINDOW_PEERS; i++)
+	{
+	    if (!_windowReceipts[i].mask)
+	    {
+		_windowReceipts[i].address = from;
+		return &_windowReceipts[i];
+	    }
+	}
+    }
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////
+boolean RF22ReliableDatagram::windowReceived(uint8_t from, uint8_t id, uint8_t flags)
+{
+    // _seenIds holds the last ID received in order
+    uint8_t cumulative = _seenIds[from];
+    WindowReceipt* r = windowReceipt(from, false);
+    uint8_t mask = r ? r->mask : 0;
+    uint8_t ahead = id - cumulative;
+    boolean isNew = false;
+
+    if ((uint8_t)(cumulative - id) < RF22_WINDOW_SPAN)
+    {
+	// Had it already
+    }
+    else if (ahead > RF22_WINDOW_SPAN && !(flags & RF22_FLAGS_WINDOW_SYNC))
+    {
+	// Not in the window. The sender will give up on it and start a new window
+    }
+    else
+    {
+	if (flags & RF22_FLAGS_WINDOW_SYNC)
+	{
+	    // The window starts here, skipping any the sender gave up
+	    mask = (ahead > RF22_WINDOW_SPAN) ? 0 : mask >> (ahead - 1);
+	    cumulative = id - 1;
+	    ahead = 1;
+	}
+	uint8_t bit = 1 << (ahead - 1);
+	// Out of order ones need a receipt. If there is none free, the sender will send it again
+	if (!(mask & bit) && (ahead == 1 || r || (r = windowReceipt(from, true))))
+	{
+	    mask |= bit;
+	    while (mask & 1)
+	    {
+		cumulative++;
+		mask >>= 1;
+	    }
+	    isNew = true;
+	}
+	_seenIds[from] = cumulative;
+	if (r)
+	    r->mask = mask;
+    }
+
+    // A hold-off for a busy node outlasts bursts from other nodes
+    if (flags & RF22_FLAGS_ACK_REQUEST)
+    {
+	if (_windowHoldOff == WindowHoldOffBurst)
+	    _windowHoldOff = WindowNoHoldOff;
+	acknowledgeWindow(from);
+    }
+    else if (   _windowHoldOff != WindowHoldOffBusy
+	     || (millis() - _windowHoldOffAt) >= _windowHoldOffTime)
+    {
+	// More of the burst is on its way, even if the next one is lost
+	_windowHoldOff = WindowHoldOffBurst;
+	_windowHoldOffAt = millis();
+	_windowHoldOffTime = 2 * _timeout;
+    }
+    return isNew;
+}
+
+////////////////////////////////////////////////////////////////////
+void RF22ReliableDatagram::acknowledgeWindow(uint8_t from)
+{
+    WindowReceipt* r = windowReceipt(from, false);
+    uint8_t mask = r ? r->mask : 0;
+    setHeaderId(_seenIds[from]);
+    setHeaderFlags(RF22_FLAGS_ACK | RF22_FLAGS_WINDOW | (windowInFlight(RF22_BROADCAST_ADDRESS) ? RF22_FLAGS_WINDOW_BUSY : 0));
+    sendto(&mask, sizeof(mask), from);
+    waitPacketSent();
+}
+#endif
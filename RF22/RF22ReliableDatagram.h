@@ -11,6 +11,36 @@
 
 // The acknowledgement bit in the FLAGS
 #define RF22_FLAGS_ACK 0x80
+// Set on messages sent by sendtoWindow() and on their acknowledgements
+#define RF22_FLAGS_WINDOW 0x40
+// Set by sendtoWindow() on the last message of a burst: only that one is acknowledged
+#define RF22_FLAGS_ACK_REQUEST 0x20
+// Set by sendtoWindow() on the first message to a node: the receiver's window starts at its ID
+#define RF22_FLAGS_WINDOW_SYNC 0x10
+// Set on a windowed ACK by a node with windowed messages of its own to send. Same bit as 
+// RF22_FLAGS_WINDOW_SYNC, which is never set on an ACK
+#define RF22_FLAGS_WINDOW_BUSY 0x10
+
+// The number of messages sendtoWindow() can have in flight. 
+// Each one costs RF22_MAX_MESSAGE_LEN+5 octets of RAM, and the rest of the window state about 
+// 40 more, in every RF22ReliableDatagram, RF22Router and RF22Mesh. 0, the default, leaves 
+// windowed sending out altogether. Set it here, as the library is compiled apart from the sketch, 
+// and on every node that sends or receives windowed messages
+#ifndef RF22_WINDOW_SIZE
+#define RF22_WINDOW_SIZE 0
+#endif
+
+// The number of nodes sendtoWindow() can have messages in flight to at once, and the number of 
+// nodes recvfromAck() can have out of order messages from at once. 6 octets each
+#ifndef RF22_WINDOW_PEERS
+#define RF22_WINDOW_PEERS 4
+#endif
+
+// The most messages a window can span: the receiver keeps one bit for each after its last in order ID
+#define RF22_WINDOW_SPAN 8
+#if RF22_WINDOW_SIZE < 0 || RF22_WINDOW_SIZE > RF22_WINDOW_SPAN
+#error RF22_WINDOW_SIZE must be from 0 to 8
+#endif
 
 /////////////////////////////////////////////////////////////////////
 /// \class RF22ReliableDatagram RF22ReliableDatagram.h <RF22ReliableDatagram.h>
@@ -36,6 +66,43 @@
 /// - ID set to the ID of the original message
 /// - FLAGS with the RF22_FLAGS_ACK bit set
 ///
+/// \par Windowed sending
+///
+/// Only when RF22_WINDOW_SIZE is set above 0 in this header.
+/// sendtoWait() is stop-and-wait: every message costs a full ACK turnaround before the next
+/// can be sent. sendtoWindow() instead queues the message and returns at once, so that up to 
+/// RF22_WINDOW_SIZE messages can be in flight. poll() sends them, one per call, as a burst to one node:
+/// only the last message of the burst has RF22_FLAGS_ACK_REQUEST set, and only it is acknowledged.
+/// The receiver acknowledges everything it has from the sender in that one ACK, so a lost message 
+/// costs only its own retransmission.
+/// Call poll() (or recvfromAck(), which calls it) often until it returns 0.
+///
+/// Windowed messages have the RF22_FLAGS_WINDOW bit set, and IDs numbered consecutively per 
+/// destination. The receiver keeps the last ID it has had from the sender in order in the same
+/// table as the last ID of other messages, and which of the next 8 IDs it has had out of order
+/// in a small table for up to RF22_WINDOW_PEERS senders. Messages are
+/// delivered by recvfromAck() as they arrive, so a retransmitted message can be delivered after one sent
+/// later. Duplicates are suppressed over the whole window.
+/// The first message to a node has RF22_FLAGS_WINDOW_SYNC set, and the receiver's 
+/// window starts at its ID. It is sent on its own, and the rest wait for its ACK.
+///
+/// A windowed ack consists of a message with:
+/// - ID set to the last ID received in order from the node it is sent to
+/// - FLAGS with the RF22_FLAGS_ACK and RF22_FLAGS_WINDOW bits set
+/// - 1 octet of data, bit n set if ID+n+1 has also been received
+///
+/// Messages that are still not acknowledged after all the retries are given up, and counted by 
+/// windowFailures(). The next message to that node is sent with RF22_FLAGS_WINDOW_SYNC again.
+/// A subclass can take the messages given up with windowGivenUp().
+/// Each time a burst is sent again, the random part of its ACK timeout doubles, up to 8 times _timeout,
+/// so that bursts that collide do not keep colliding.
+///
+/// Bursts are long, so poll() is careful about when to start one. It does not start one while 
+/// a burst to this node is still arriving. And a node that is itself forwarding windowed 
+/// messages sets RF22_FLAGS_WINDOW_BUSY in its ACK: poll() then holds off for twice as long as the 
+/// burst took, so that the node can forward it, and the node after it forward it again, 
+/// without collisions at the node in between, which both can hear.
+///
 /// Part of the Arduino RF22 library for operating with HopeRF RF22 compatible transceivers 
 /// (see http://www.hoperf.com)
 class RF22ReliableDatagram : public RF22Datagram
@@ -72,6 +139,37 @@ public:
     /// \return true if the message was transmitted and an acknowledgement was received.
     boolean sendtoWait(uint8_t* buf, uint8_t len, uint8_t address);
 
+#if RF22_WINDOW_SIZE
+    /// Queues the message to be sent by poll(), and calls poll() to start sending it.
+    /// Returns at once: the message is acknowledged, or given up, in later calls to poll().
+    /// Any messages sendtoWait() is called for after this one wait for this one to finish first.
+    /// \param[in] buf Pointer to the binary message to send. It is copied.
+    /// \param[in] len Number of octets to send
+    /// \param[in] address The address to send the message to. RF22_BROADCAST_ADDRESS is not permitted
+    /// \return true if the message was queued, false if the window is full or the message is too long
+    boolean sendtoWindow(uint8_t* buf, uint8_t len, uint8_t address);
+
+    /// Moves the messages queued by sendtoWindow() on: handles their acknowledgements, 
+    /// transmits the next one if the transmitter is free, and retransmits them when they time out.
+    /// Never blocks. Any other message received is left for recvfromAck(), and nothing is
+    /// transmitted until it has been collected. If it is still there after the timeout, each 
+    /// message that would have been transmitted meanwhile uses up a retry as if it had been lost,
+    /// so that even if the message is never collected, they are all given up in the end.
+    /// \return The number of messages in flight. sendtoWindow() has room for another if this is
+    /// less than RF22_WINDOW_SIZE
+    uint8_t poll();
+
+    /// Calls poll() until every message queued by sendtoWindow() has been acknowledged or given up.
+    /// Synchronous: any message other than an ACK received while waiting is discarded.
+    /// \return true if none of them was given up
+    boolean waitWindowAcked();
+
+    /// Returns the number of messages queued by sendtoWindow() and 
+    /// given up because they were not acknowledged
+    /// \return The number of messages given up since initialisation.
+    uint16_t windowFailures();
+#endif
+
     /// If there is a valid message available for this node, send an acknowledgement to the SRC
     /// address (blocking until this is complete), then copy the message to buf and return true
     /// else return false. 
@@ -117,12 +215,131 @@ protected:
     /// Blocks until the ACK has been sent
     void acknowledge(uint8_t id, uint8_t from);
 
+    /// Called for a message received and discarded while waiting for something else.
+    /// If it is one we have already received, ACKs it again, as the sender cannot have had our ACK.
+    /// If it is a windowed message asking for an ACK, sends a windowed ACK of what we do have.
+    void acknowledgeAgain();
+
     /// Checks whether the message currently in the Rx buffer is a new message, not previously received
     /// based on the from address and the sequence.  If it is new, it is acknowledged and returns true
     /// \return true if there is a message received and it is a new message
     boolean haveNewMessage();
 
+#if RF22_WINDOW_SIZE
+    /// Blocks until sendtoWindow() can queue a message to address, 
+    /// discarding any other message received meanwhile as sendtoWait() does
+    /// \param[in] address The address of the node to queue a message for
+    void waitWindowRoom(uint8_t address);
+
+    /// Returns true if sendtoWindow() can queue a message for address now
+    boolean windowRoom(uint8_t address);
+
+    /// Copies out a windowed message that poll() has given up, unless its slot has been 
+    /// taken by sendtoWindow() since. Each one is copied out once.
+    /// \param[in] buf Location to copy the message
+    /// \param[in,out] len Available space in buf. Set to the actual number of octets copied.
+    /// \return true if there was one
+    boolean windowGivenUp(uint8_t* buf, uint8_t* len);
+#endif
+
 private:
+#if RF22_WINDOW_SIZE
+    /// Values for the state of a message queued by sendtoWindow()
+    typedef enum
+    {
+	WindowFree = 0,        ///< Not in use
+	WindowPending,         ///< Waiting to be transmitted
+	WindowSent             ///< Transmitted, waiting for an ACK
+    } WindowSlotState;
+
+    /// A message queued by sendtoWindow()
+    typedef struct
+    {
+	uint8_t      address;  ///< Destination node address
+	uint8_t      id;       ///< ID, consecutive per destination
+	uint8_t      state;    ///< One of WindowSlotState
+	uint8_t      tries;    ///< Times transmitted so far
+	uint8_t      len;      ///< Number of octets in data
+	uint8_t      data[RF22_MAX_MESSAGE_LEN]; ///< Copy of the message
+    } WindowSlot;
+
+    /// A node that sendtoWindow() has sent messages to
+    typedef struct
+    {
+	uint8_t      address;  ///< Node address
+	uint8_t      nextId;   ///< ID of the next message queued for it
+	boolean      inUse;    ///< This entry is in use
+	boolean      synced;   ///< It has acknowledged the ID its window starts at
+    } WindowPeer;
+
+    /// A node that recvfromAck() has windowed messages from beyond the last in order one
+    typedef struct
+    {
+	uint8_t      address;  ///< Node address
+	uint8_t      mask;     ///< Bit n set if _seenIds[address]+n+1 has been received. 0 if not in use
+    } WindowReceipt;
+
+    /// States of poll()
+    typedef enum
+    {
+	WindowIdle = 0,        ///< Not sending, may start a burst
+	WindowSending,         ///< Sending a burst to _windowAddress
+	WindowLastSent,        ///< The last message of the burst is being transmitted
+	WindowWaiting          ///< Waiting for the ACK of the burst
+    } WindowState;
+
+    /// Why poll() is holding off
+    typedef enum
+    {
+	WindowNoHoldOff = 0,   ///< Free to start a burst
+	WindowHoldOffBurst,    ///< A burst to us is still arriving
+	WindowHoldOffBusy      ///< The node we sent our last burst to has its own to send
+    } WindowHoldOff;
+#endif
+
+    /// Returns a new ID for sendtoWait() or for the first windowed message to a node, which is not one
+    /// that address, or every node if address is RF22_BROADCAST_ADDRESS, 
+    /// could take for a duplicate of a windowed message
+    uint8_t nextSequenceNumber(uint8_t address);
+
+#if RF22_WINDOW_SIZE
+    /// Finds the peer entry for address, or NULL
+    WindowPeer* windowPeer(uint8_t address);
+
+    /// Finds a peer entry that is not in use, or has nothing in flight, or NULL
+    WindowPeer* windowNewPeer();
+
+    /// Returns the number of messages in flight to address, or to any node if address 
+    /// is RF22_BROADCAST_ADDRESS
+    uint8_t windowInFlight(uint8_t address);
+
+    /// If the message in the Rx buffer is an ACK of windowed messages, handles it and clears the buffer
+    /// \return true if it was
+    boolean windowAckReceived();
+
+    /// Frees the messages to from acknowledged by cumulative and mask, and if they are the ACK 
+    /// of the burst poll() is waiting for, marks the rest of the burst for retransmission
+    void windowAcknowledged(uint8_t from, uint8_t cumulative, uint8_t mask);
+
+    /// Marks every message in flight to address as waiting to be transmitted again
+    void windowRetry(uint8_t address);
+
+    /// Moves the head of the window past any free slots
+    void windowTrim();
+
+    /// Finds the receipt entry for windowed messages from from, or if create is true and
+    /// there is none, a free one for it, or NULL
+    WindowReceipt* windowReceipt(uint8_t from, boolean create);
+
+    /// Updates the window of received messages for a windowed message from from, and 
+    /// acknowledges it if it has RF22_FLAGS_ACK_REQUEST set
+    /// \return true if it is new, false if it is a duplicate or cannot be recorded
+    boolean windowReceived(uint8_t from, uint8_t id, uint8_t flags);
+
+    /// Send a windowed ACK of everything received from from
+    void acknowledgeWindow(uint8_t from);
+#endif
+
     /// Count of retransmissions we have had to send
     uint16_t _retransmissions;
 
@@ -144,6 +361,44 @@ private:
     /// received that message)
     uint8_t _seenIds[256];
 
+#if RF22_WINDOW_SIZE
+    /// Messages queued by sendtoWindow(), in order from _windowHead. _windowUsed slots from there 
+    /// are in use or are free ones after a message still in flight
+    WindowSlot    _window[RF22_WINDOW_SIZE];
+    uint8_t       _windowHead;
+    uint8_t       _windowUsed;
+
+    /// Nodes that sendtoWindow() has sent messages to
+    WindowPeer    _windowPeers[RF22_WINDOW_PEERS];
+
+    /// Nodes that recvfromAck() has out of order windowed messages from
+    WindowReceipt _windowReceipts[RF22_WINDOW_PEERS];
+
+    /// State of poll(), the node it is sending a burst to, and when the burst
+    /// was sent and how long to wait for its ACK
+    uint8_t       _windowState;
+    uint8_t       _windowAddress;
+    unsigned long _windowSentAt;
+    uint16_t      _windowTimeout;
+
+    /// Set while a received message that is not a windowed ACK holds the buffer, 
+    /// and when poll() first found it there
+    boolean       _windowHeld;
+    unsigned long _windowHeldAt;
+
+    /// Set when a windowed message is received with more of its burst to follow, or an ACK
+    /// with RF22_FLAGS_WINDOW_BUSY. poll() does not start a burst of its own for 
+    /// _windowHoldOffTime after that. _windowBurstAt is when the last burst started
+    uint8_t       _windowHoldOff;
+    unsigned long _windowHoldOffAt;
+    uint16_t      _windowHoldOffTime;
+    unsigned long _windowBurstAt;
+
+    /// Count of windowed messages given up, and the slots of those windowGivenUp() 
+    /// has not copied out, by bit
+    uint16_t      _windowFailures;
+    uint8_t       _windowGivenUp;
+#endif
 
 };
 
@@ -175,6 +175,32 @@ uint8_t RF22Router::sendtoWait(uint8_t* buf, uint8_t len, uint8_t dest, uint8_t
     return route(&_tmpMessage, sizeof(RoutedMessageHeader)+len);
 }
 
+#if RF22_WINDOW_SIZE
+////////////////////////////////////////////////////////////////////
+// Queues for delivery to the next hop
+uint8_t RF22Router::sendtoWindow(uint8_t* buf, uint8_t len, uint8_t dest)
+{
+    if (((uint16_t)len + sizeof(RoutedMessageHeader)) > RF22_MAX_MESSAGE_LEN)
+	return RF22_ROUTER_ERROR_INVALID_LENGTH;
+
+    // Wait for room before filling _tmpMessage, which a received message would clobber
+    RoutingTableEntry* hop = getRouteTo(dest);
+    if (hop && dest != RF22_BROADCAST_ADDRESS)
+	waitWindowRoom(hop->next_hop);
+    routeWindowFailures();
+
+    // Construct a RF22 RouterMessage message
+    _tmpMessage.header.source = _thisAddress;
+    _tmpMessage.header.dest = dest;
+    _tmpMessage.header.hops = 0;
+    _tmpMessage.header.id = _lastE2ESequenceNumber++;
+    _tmpMessage.header.flags = 0;
+    memcpy(_tmpMessage.data, buf, len);
+
+    return routeWindow(&_tmpMessage, sizeof(RoutedMessageHeader)+len);
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////
 uint8_t RF22Router::route(RoutedMessage* message, uint8_t messageLen)
 {
@@ -194,6 +220,41 @@ uint8_t RF22Router::route(RoutedMessage* message, uint8_t messageLen)
     return RF22_ROUTER_ERROR_NONE;
 }
 
+#if RF22_WINDOW_SIZE
+////////////////////////////////////////////////////////////////////
+// Subclasses may want to override this to handle failures as their route() does
+void RF22Router::windowFailed(RoutedMessage* message, uint8_t messageLen)
+{
+    // Default does nothing
+}
+
+////////////////////////////////////////////////////////////////////
+// Uses _tmpMessage
+void RF22Router::routeWindowFailures()
+{
+    uint8_t messageLen = sizeof(_tmpMessage);
+    while (windowGivenUp((uint8_t*)&_tmpMessage, &messageLen))
+    {
+	windowFailed(&_tmpMessage, messageLen);
+	messageLen = sizeof(_tmpMessage);
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+// Queues it for the next hop if there is room in the window. Anything else goes 
+// through route(), hop by hop, so it is never dropped here for lack of room, and 
+// failures are handled as for sendtoWait()
+uint8_t RF22Router::routeWindow(RoutedMessage* message, uint8_t messageLen)
+{
+    RoutingTableEntry* hop = NULL;
+    if (message->header.dest != RF22_BROADCAST_ADDRESS)
+	hop = getRouteTo(message->header.dest);
+    if (hop && RF22ReliableDatagram::sendtoWindow((uint8_t*)message, messageLen, hop->next_hop))
+	return RF22_ROUTER_ERROR_NONE;
+    return route(message, messageLen);
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////
 // Subclasses may want to override this to peek at messages going past
 void RF22Router::peekAtMessage(RoutedMessage* message, uint8_t messageLen)
@@ -209,6 +270,9 @@ boolean RF22Router::recvfromAck(uint8_t* buf, uint8_t* len, uint8_t* source, uin
     uint8_t _to;
     uint8_t _id;
     uint8_t _flags;
+#if RF22_WINDOW_SIZE
+    routeWindowFailures();
+#endif
     if (RF22ReliableDatagram::recvfromAck((uint8_t*)&_tmpMessage, &tmpMessageLen, &_from, &_to, &_id, &_flags))
     {
 	// Here we simulate networks with limited visibility between nodes
@@ -281,6 +345,12 @@ boolean RF22Router::recvfromAck(uint8_t* buf, uint8_t* len, uint8_t* source, uin
 	    // Maybe it has to be routed to the next hop
 	    // REVISIT: if it fails due to no route or unable to deliver to the next hop, 
 	    // tell the originator. BUT HOW?
+#if RF22_WINDOW_SIZE
+	    // Forward it the way it came
+	    if (_flags & RF22_FLAGS_WINDOW)
+		routeWindow(&_tmpMessage, tmpMessageLen);
+	    else
+#endif
 	    route(&_tmpMessage, tmpMessageLen);
 	}
 	// Discard it and maybe wait for another
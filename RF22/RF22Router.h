@@ -246,6 +246,25 @@ public:
     ///           (usually because it dod not acknowledge due to being off the air or out of range
     uint8_t sendtoWait(uint8_t* buf, uint8_t len, uint8_t dest, uint8_t source);
 
+#if RF22_WINDOW_SIZE
+    /// Like sendtoWait(), but queues the message with RF22ReliableDatagram::sendtoWindow()
+    /// instead of waiting for the ACK of the next hop, so that several messages can be in flight. 
+    /// Every router on the way forwards it the same way, so the hops work in parallel. A router 
+    /// whose own window to the next hop is full forwards it with sendtoWait() instead, so it is 
+    /// not dropped there.
+    /// If this node's window is already full, blocks until there is room, discarding any message received 
+    /// meanwhile. Broadcasts are sent with sendtoWait().
+    /// Call recvfromAck() or poll() often until poll() returns 0, to get the messages sent.
+    /// \param [in] buf The application message data
+    /// \param [in] len Number of octets in the application message data. 0 is permitted
+    /// \param [in] dest The destination node address
+    /// \return The result code:
+    ///         - RF22_ROUTER_ERROR_NONE Message was queued for the next hop
+    ///         - RF22_ROUTER_ERROR_INVALID_LENGTH The message is too long
+    ///         - RF22_ROUTER_ERROR_NO_ROUTE There was no route for dest in the local routing table
+    uint8_t sendtoWindow(uint8_t* buf, uint8_t len, uint8_t dest);
+#endif
+
     /// Starts the receiver if it is not running already.
     /// If there is a valid message available for this node (or RF22_BROADCAST_ADDRESS), 
     /// send an acknowledgement to the last hop
@@ -298,6 +317,28 @@ protected:
     /// \param [in] messageLen Length of message in octets
     virtual uint8_t route(RoutedMessage* message, uint8_t messageLen);
 
+#if RF22_WINDOW_SIZE
+    /// Finds the next-hop route and queues the message for it via RF22ReliableDatagram::sendtoWindow().
+    /// If there is no route, or the window to the next hop is full, calls route() instead, so the 
+    /// message goes on hop by hop and failures are handled as they are for sendtoWait().
+    /// Called by sendtoWindow(), and by recvfromAck() for messages to forward that arrived windowed.
+    /// \param [in] message Pointer to the RF22Router message to be sent.
+    /// \param [in] messageLen Length of message in octets
+    uint8_t routeWindow(RoutedMessage* message, uint8_t messageLen);
+
+    /// Called for a windowed message that the next hop never acknowledged, once poll() has given 
+    /// it up. Like a message that route() cannot deliver, it is lost: the originator's own are 
+    /// counted by windowFailures(). This default does nothing more. 
+    /// Virtual, so subclasses can handle it as their route() handles a failure.
+    /// \param [in] message Pointer to the RF22Router message that was given up.
+    /// \param [in] messageLen Length of message in octets
+    virtual void windowFailed(RoutedMessage* message, uint8_t messageLen);
+
+    /// Passes each windowed message given up since the last call to windowFailed(). 
+    /// Called by recvfromAck() and sendtoWindow() before they use _tmpMessage, as this does.
+    void routeWindowFailures();
+#endif
+
     /// Deletes a specific rout entry from therouting table
     /// \param [in] index The 0 based index of the routing table entry to delete
     void deleteRoute(uint8_t index);
@@ -0,0 +1,22 @@
+/*
+ * Minimal Arduino core for building the RF22 message classes on the host.
+ * millis() and random() are provided by the simulation, which runs every
+ * node as a coroutine on a virtual clock: millis() is where a node that is
+ * spinning lets the others run and the clock move on.
+ */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define SS 10
+
+unsigned long millis();
+long random(long howsmall, long howbig);
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Host stand-in for the RF22 driver, with the same interface and mode
+ * semantics as far as RF22Datagram and the classes above it use them:
+ *  - send() waits for any previous message, then transmits and returns;
+ *    the mode is RF22_MODE_TX until the message is off the air, then idle.
+ *  - available() returns false while transmitting, else starts the
+ *    receiver and returns true once a message has arrived.  The receiver
+ *    then goes idle, and hears nothing more, until it is cleared.
+ *  - The TO header is checked against the address written to
+ *    RF22_REG_3F_CHECK_HEADER3, broadcasts are always accepted.
+ * The radio channel itself is simulated by rf22_window_bench.cpp.
+ */
+#ifndef RF22_h
+#define RF22_h
+
+#include <Arduino.h>
+
+#define RF22_MAX_MESSAGE_LEN 50
+#define RF22_BROADCAST_ADDRESS 0xff
+
+#define RF22_MODE_IDLE         0
+#define RF22_MODE_RX           1
+#define RF22_MODE_TX           2
+
+#define RF22_REG_3F_CHECK_HEADER3 0x3f
+
+class RF22
+{
+public:
+    RF22(uint8_t slaveSelectPin = SS, uint8_t interrupt = 0);
+    boolean        init();
+    void           spiWrite(uint8_t reg, uint8_t val);
+
+    boolean        available();
+    void           waitAvailable();
+    bool           waitAvailableTimeout(uint16_t timeout);
+    boolean        recv(uint8_t* buf, uint8_t* len);
+    boolean        send(const uint8_t* data, uint8_t len);
+    void           waitPacketSent();
+    bool           waitPacketSent(uint16_t timeout);
+    void           clearRxBuf();
+
+    void           setModeIdle();
+    void           setModeRx();
+    void           setModeTx();
+    uint8_t        mode();
+
+    void           setHeaderTo(uint8_t to);
+    void           setHeaderFrom(uint8_t from);
+    void           setHeaderId(uint8_t id);
+    void           setHeaderFlags(uint8_t flags);
+    uint8_t        headerTo();
+    uint8_t        headerFrom();
+    uint8_t        headerId();
+    uint8_t        headerFlags();
+    void           setPromiscuous(boolean promiscuous);
+
+    // Simulation state, read and written by the channel
+    uint8_t        _txHeaders[4];        // TO, FROM, ID, FLAGS
+    uint8_t        _rxHeaders[4];
+    uint8_t        _checkHeader;
+    boolean        _promiscuous;
+    double         _rxSince;             // Virtual us the receiver has been on since
+    uint8_t        _buf[RF22_MAX_MESSAGE_LEN];
+    uint8_t        _bufLen;
+    volatile boolean _rxBufValid;
+    volatile uint8_t _mode;
+};
+
+#endif
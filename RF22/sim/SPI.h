@@ -0,0 +1,3 @@
+/*
+ * The RF22 stand-in in this folder has no SPI bus.
+ */
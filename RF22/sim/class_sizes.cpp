@@ -0,0 +1,16 @@
+/*
+ * Prints the RAM taken by each RF22 message class, as built with the
+ * RF22_WINDOW_SIZE given to the compiler, or the default 0.  On the host
+ * pointers and alignment make the sizes differ from an AVR's, but not by
+ * much: the window state is mostly octets.
+ */
+#include <stdio.h>
+#include "RF22Mesh.h"
+
+int main()
+{
+    printf("RF22_WINDOW_SIZE %d: RF22Datagram %u, RF22ReliableDatagram %u, RF22Router %u, RF22Mesh %u octets\n",
+	   RF22_WINDOW_SIZE, (unsigned)sizeof(RF22Datagram), (unsigned)sizeof(RF22ReliableDatagram),
+	   (unsigned)sizeof(RF22Router), (unsigned)sizeof(RF22Mesh));
+    return 0;
+}
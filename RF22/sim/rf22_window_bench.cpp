@@ -0,0 +1,718 @@
+/*
+ * Host test and benchmark for RF22ReliableDatagram::sendtoWindow()
+ *
+ * Runs each node as a coroutine on a virtual clock, with the RF22
+ * stand-in in this folder as its radio.  The nodes share one half-duplex
+ * channel at 2.4 kbps (FSK_Rb2_4Fd36, the default after init()): a
+ * message goes on the air 1 ms after send(), for its preamble, sync,
+ * headers, length, data and CRC, and a receiver gets it only if it was
+ * receiving from the first half of the preamble to the end, no other node
+ * it can hear was transmitting at the same time, and it is not lost at
+ * random.  A node runs until it calls millis(), available()
+ * or waits for its transmitter; the clock moves on 50 us each time every
+ * node has had a turn.
+ *
+ * Node 1 sends 200 messages of 40 octets, numbered, to node 2 one hop
+ * away, and to node 4 over the chain 1-2-3-4 with RF22Router and with
+ * RF22Mesh, with sendtoWait() and with sendtoWindow(), at 0% and 10%
+ * loss.  On the chain each node hears only its neighbours.  Checks that every message arrives intact and at most once, and
+ * with no loss, exactly once; that one hop, every message either arrives
+ * or is counted as failed; and that sendtoWait(), broadcasts and
+ * sendtoWindow() to the same node can be mixed; and that a sender that
+ * only calls poll() gives its messages up, rather than waiting for ever,
+ * once a message it never collects holds its receive buffer.  Prints the time and the
+ * throughput of each, and the throughput of sendtoWindow() over that of
+ * sendtoWait().
+ * Exits non-zero on any mismatch.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <ucontext.h>
+#include <functional>
+#include <vector>
+#include "RF22Mesh.h"
+
+//------------------------------------------------------------------------------
+// Virtual clock and coroutines
+
+static double simNow;                      // us
+static const double quantum = 50;
+static uint32_t randomState = 1;
+
+// The message buffers RF22Router and RF22Mesh keep as class statics.  Each
+// node has its own, as it would on its own processor
+extern "C" uint8_t _ZN10RF22Router11_tmpMessageE[];
+extern "C" uint8_t _ZN8RF22Mesh11_tmpMessageE[];
+static const size_t routerStaticsLen = sizeof(RF22Router::RoutedMessage);
+static const size_t meshStaticsLen = RF22_ROUTER_MAX_MESSAGE_LEN;
+
+struct Node
+{
+    RF22*                 radio;
+    std::function<void()> loop;
+    ucontext_t            context;
+    uint8_t               routerStatics[routerStaticsLen];
+    uint8_t               meshStatics[meshStaticsLen];
+    char                  stack[256 * 1024];
+};
+
+static std::vector<Node*> nodes;
+static Node *current;
+static ucontext_t scheduler;
+
+static void channelUpdate();
+
+static void simYield()
+{
+    if (current)
+	swapcontext(&current->context, &scheduler);
+    else
+    {
+	simNow += quantum;
+	channelUpdate();
+    }
+}
+
+unsigned long millis()
+{
+    simYield();
+    return (unsigned long)(simNow / 1000);
+}
+
+static uint32_t nextRandom()
+{
+    randomState = randomState * 1664525 + 1013904223;
+    return randomState >> 8;
+}
+
+long random(long howsmall, long howbig)
+{
+    return howsmall + nextRandom() % (howbig - howsmall);
+}
+
+static void nodeMain()
+{
+    for (;;)
+	current->loop();
+}
+
+static void addNode(RF22* radio, std::function<void()> loop)
+{
+    Node* node = new Node;
+    memset(node->routerStatics, 0, routerStaticsLen);
+    memset(node->meshStatics, 0, meshStaticsLen);
+    node->radio = radio;
+    node->loop = loop;
+    getcontext(&node->context);
+    node->context.uc_stack.ss_sp = node->stack;
+    node->context.uc_stack.ss_size = sizeof(node->stack);
+    node->context.uc_link = NULL;
+    makecontext(&node->context, nodeMain, 0);
+    nodes.push_back(node);
+}
+
+// Runs every node until done() or the time limit
+static void run(std::function<bool()> done, double seconds)
+{
+    while (!done() && simNow < seconds * 1e6)
+    {
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+	    current = nodes[i];
+	    memcpy(_ZN10RF22Router11_tmpMessageE, current->routerStatics, routerStaticsLen);
+	    memcpy(_ZN8RF22Mesh11_tmpMessageE, current->meshStatics, meshStaticsLen);
+	    swapcontext(&scheduler, &current->context);
+	    memcpy(current->routerStatics, _ZN10RF22Router11_tmpMessageE, routerStaticsLen);
+	    memcpy(current->meshStatics, _ZN8RF22Mesh11_tmpMessageE, meshStaticsLen);
+	}
+	current = NULL;
+	simNow += quantum;
+	channelUpdate();
+    }
+    for (size_t i = 0; i < nodes.size(); i++)
+	delete nodes[i];
+    nodes.clear();
+}
+
+//------------------------------------------------------------------------------
+// The channel
+
+static const double bitRate = 2400;
+static double lossRate;
+static bool links[8][8];                   // By node index
+static double lastTxEnd;
+static unsigned int cutOffs;               // Transmissions turned off before the end
+
+struct Transmission
+{
+    RF22*   from;
+    double  start, end;
+    uint8_t headers[4];
+    uint8_t data[RF22_MAX_MESSAGE_LEN];
+    uint8_t len;
+    bool    done;
+};
+
+static std::vector<Transmission> air;
+
+static int indexOf(RF22* radio)
+{
+    for (size_t i = 0; i < nodes.size(); i++)
+	if (nodes[i]->radio == radio)
+	    return i;
+    return -1;
+}
+
+static bool hears(RF22* receiver, RF22* sender)
+{
+    return links[indexOf(receiver)][indexOf(sender)];
+}
+
+static double airtime(uint8_t len)
+{
+    // 4 octets of preamble, 2 sync, 4 headers, length, data, 2 CRC
+    return (4 + 2 + 4 + 1 + len + 2) * 8 / bitRate * 1e6;
+}
+
+// Loading the FIFO over SPI and starting the transmitter
+static const double txStartup = 1000;
+
+// A receiver turned on in the first half of the preamble still gets the message
+static const double preambleMargin = 2 * 8 / bitRate * 1e6;
+
+static void channelUpdate()
+{
+    for (size_t k = 0; k < air.size(); k++)
+    {
+	Transmission& t = air[k];
+	if (t.done || t.end > simNow)
+	    continue;
+	t.done = true;
+	t.from->_mode = RF22_MODE_IDLE;
+	lastTxEnd = t.end;
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+	    RF22* n = nodes[i]->radio;
+	    if (   n == t.from || !hears(n, t.from)
+		|| n->mode() != RF22_MODE_RX || n->_rxSince > t.start + preambleMargin || n->_rxBufValid)
+		continue;
+	    bool collision = false;
+	    for (size_t j = 0; j < air.size(); j++)
+		if (   j != k && air[j].start < t.end && air[j].end > t.start
+		    && (air[j].from == n || hears(n, air[j].from)))
+		    collision = true;
+	    if (collision || nextRandom() % 10000 < lossRate * 10000)
+		continue;
+	    if (   !n->_promiscuous && t.headers[0] != n->_checkHeader
+		&& t.headers[0] != RF22_BROADCAST_ADDRESS)
+		continue;
+	    memcpy(n->_rxHeaders, t.headers, sizeof(t.headers));
+	    memcpy(n->_buf, t.data, t.len);
+	    n->_bufLen = t.len;
+	    n->_rxBufValid = true;
+	    n->setModeIdle();
+	}
+    }
+    // Forget the ones that can no longer overlap anything
+    size_t keep = 0;
+    for (size_t k = 0; k < air.size(); k++)
+	if (!air[k].done || air[k].end > simNow - 1e6)
+	    air[keep++] = air[k];
+    air.resize(keep);
+}
+
+//------------------------------------------------------------------------------
+// The RF22 stand-in
+
+RF22::RF22(uint8_t slaveSelectPin, uint8_t interrupt)
+{
+    memset(_txHeaders, 0, sizeof(_txHeaders));
+    memset(_rxHeaders, 0, sizeof(_rxHeaders));
+    _checkHeader = 0;
+    _promiscuous = false;
+    _rxSince = 0;
+    _bufLen = 0;
+    _rxBufValid = false;
+    _mode = RF22_MODE_IDLE;
+}
+
+boolean RF22::init()
+{
+    setModeIdle();
+    clearRxBuf();
+    return true;
+}
+
+void RF22::spiWrite(uint8_t reg, uint8_t val)
+{
+    if (reg == RF22_REG_3F_CHECK_HEADER3)
+	_checkHeader = val;
+}
+
+boolean RF22::available()
+{
+    simYield();
+    if (_mode == RF22_MODE_TX)
+	return false;
+    if (!_rxBufValid)
+	setModeRx();
+    return _rxBufValid;
+}
+
+void RF22::waitAvailable()
+{
+    while (!available())
+	;
+}
+
+bool RF22::waitAvailableTimeout(uint16_t timeout)
+{
+    unsigned long starttime = millis();
+    while ((millis() - starttime) < timeout)
+	if (available())
+	    return true;
+    return false;
+}
+
+boolean RF22::recv(uint8_t* buf, uint8_t* len)
+{
+    if (!available())
+	return false;
+    if (*len > _bufLen)
+	*len = _bufLen;
+    memcpy(buf, _buf, *len);
+    clearRxBuf();
+    return true;
+}
+
+boolean RF22::send(const uint8_t* data, uint8_t len)
+{
+    waitPacketSent();
+    // The real one clears the shared buffer but not _rxBufValid
+    _bufLen = 0;
+    if (!len || len > RF22_MAX_MESSAGE_LEN)
+	return false;
+    memcpy(_buf, data, len);
+    _bufLen = len;
+
+    Transmission t;
+    t.from = this;
+    t.start = simNow + txStartup;
+    t.end = t.start + airtime(len);
+    memcpy(t.headers, _txHeaders, sizeof(t.headers));
+    memcpy(t.data, data, len);
+    t.len = len;
+    t.done = false;
+    air.push_back(t);
+    _mode = RF22_MODE_TX;
+    return true;
+}
+
+void RF22::waitPacketSent()
+{
+    while (_mode == RF22_MODE_TX)
+	simYield();
+}
+
+bool RF22::waitPacketSent(uint16_t timeout)
+{
+    unsigned long starttime = millis();
+    while ((millis() - starttime) < timeout)
+	if (_mode != RF22_MODE_TX)
+	    return true;
+    return false;
+}
+
+void RF22::clearRxBuf()
+{
+    _bufLen = 0;
+    _rxBufValid = false;
+}
+
+// Turning the transmitter off cuts the message short: nobody gets it
+static void cutOff(RF22* radio)
+{
+    if (radio->mode() != RF22_MODE_TX)
+	return;
+    for (size_t k = 0; k < air.size(); k++)
+	if (air[k].from == radio && !air[k].done)
+	{
+	    air[k].done = true;
+	    cutOffs++;
+	}
+}
+
+void RF22::setModeIdle()
+{
+    cutOff(this);
+    _mode = RF22_MODE_IDLE;
+}
+
+void RF22::setModeRx()
+{
+    if (_mode == RF22_MODE_RX)
+	return;
+    cutOff(this);
+    _mode = RF22_MODE_RX;
+    _rxSince = simNow;
+}
+
+void RF22::setModeTx()
+{
+    _mode = RF22_MODE_TX;
+}
+
+uint8_t RF22::mode()                   { return _mode; }
+void RF22::setHeaderTo(uint8_t to)     { _txHeaders[0] = to; }
+void RF22::setHeaderFrom(uint8_t from) { _txHeaders[1] = from; }
+void RF22::setHeaderId(uint8_t id)     { _txHeaders[2] = id; }
+void RF22::setHeaderFlags(uint8_t f)   { _txHeaders[3] = f; }
+uint8_t RF22::headerTo()               { return _rxHeaders[0]; }
+uint8_t RF22::headerFrom()             { return _rxHeaders[1]; }
+uint8_t RF22::headerId()               { return _rxHeaders[2]; }
+uint8_t RF22::headerFlags()            { return _rxHeaders[3]; }
+void RF22::setPromiscuous(boolean p)   { _promiscuous = p; }
+
+//------------------------------------------------------------------------------
+// Scenarios
+
+static unsigned int errors;
+
+static const unsigned int messages = 200;
+static const uint8_t messageLen = 40;
+
+struct Result
+{
+    double       seconds;        // Until the last message arrived or was given up
+    double       bitsPerSecond;  // Delivered
+    unsigned int delivered;
+    unsigned int duplicates;
+    unsigned int corrupt;
+    unsigned int failures;       // Reported to the sender
+    unsigned int retransmissions;
+};
+
+// What the destination has received
+static unsigned int received[messages + 1];
+static Result result;
+static double senderDone, lastDelivery;
+static bool finished;
+
+static void startScenario(double loss)
+{
+    memset(received, 0, sizeof(received));
+    memset(links, 0, sizeof(links));
+    result = Result();
+    lossRate = loss;
+    senderDone = lastDelivery = lastTxEnd = 0;
+    finished = false;
+    cutOffs = 0;
+    air.clear();
+    simNow = 0;
+}
+
+static void link(int a, int b)
+{
+    links[a][b] = links[b][a] = true;
+}
+
+static void fill(uint8_t* buf, unsigned int number)
+{
+    buf[0] = number;
+    buf[1] = number >> 8;
+    for (int i = 2; i < messageLen; i++)
+	buf[i] = number * 7 + i;
+}
+
+static void deliver(uint8_t* buf, uint8_t len)
+{
+    unsigned int number = buf[0] | (buf[1] << 8);
+    uint8_t expected[messageLen];
+    fill(expected, number);
+    if (len != messageLen || number < 1 || number > messages || memcmp(buf, expected, len))
+    {
+	result.corrupt++;
+	return;
+    }
+    if (received[number]++)
+	result.duplicates++;
+    else
+	result.delivered++;
+    lastDelivery = simNow;
+}
+
+static void senderFinished(unsigned int failures, unsigned int retransmissions)
+{
+    result.failures = failures;
+    result.retransmissions = retransmissions;
+    senderDone = simNow;
+    finished = true;
+}
+
+// Until the sender is done and the channel has been quiet for 3 s
+static bool quiet()
+{
+    return finished && simNow > 3e6 + (lastTxEnd > senderDone ? lastTxEnd : senderDone);
+}
+
+static void finish(const char* name, double loss, bool checkFailures)
+{
+    run(quiet, 1000);
+    result.seconds = (lastDelivery > senderDone ? lastDelivery : senderDone) / 1e6;
+    if (result.seconds)
+	result.bitsPerSecond = result.delivered * messageLen * 8 / result.seconds;
+    printf("%-30s %3.0f%%  %5.1f s  %5.0f bit/s  %3u delivered  %2u failed  %3u retransmitted\n",
+	   name, loss * 100, result.seconds, result.bitsPerSecond, result.delivered, result.failures,
+	   result.retransmissions);
+    if (!finished || result.duplicates || result.corrupt || cutOffs)
+    {
+	printf("  %s, %u duplicates, %u corrupt, %u cut off\n",
+	       finished ? "finished" : "NOT FINISHED", result.duplicates, result.corrupt, cutOffs);
+	errors++;
+    }
+    if (loss == 0 && result.delivered != messages)
+    {
+	printf("  %u of %u delivered with no loss\n", result.delivered, messages);
+	errors++;
+    }
+    if (checkFailures && result.delivered + result.failures < messages)
+    {
+	printf("  %u delivered and %u failed of %u\n", result.delivered, result.failures, messages);
+	errors++;
+    }
+}
+
+// One hop, node 1 to node 2
+static double oneHop(double loss, bool windowed)
+{
+    startScenario(loss);
+    RF22ReliableDatagram sender(1), receiver(2);
+    sender.init();
+    receiver.init();
+    link(0, 1);
+    addNode(&sender, [&]()
+    {
+	uint8_t buf[messageLen];
+	unsigned int failures = 0;
+	for (unsigned int i = 1; i <= messages; i++)
+	{
+	    fill(buf, i);
+	    if (windowed)
+	    {
+		while (!sender.sendtoWindow(buf, messageLen, 2))
+		    sender.poll();
+	    }
+	    else if (!sender.sendtoWait(buf, messageLen, 2))
+		failures++;
+	}
+	if (windowed)
+	{
+	    sender.waitWindowAcked();
+	    failures = sender.windowFailures();
+	}
+	senderFinished(failures, sender.retransmissions());
+	for (;;)
+	    millis();
+    });
+    addNode(&receiver, [&]()
+    {
+	uint8_t buf[RF22_MAX_MESSAGE_LEN];
+	uint8_t len = sizeof(buf);
+	if (receiver.recvfromAck(buf, &len))
+	    deliver(buf, len);
+    });
+    finish(windowed ? "one hop, sendtoWindow()" : "one hop, sendtoWait()", loss, true);
+    return result.bitsPerSecond;
+}
+
+// sendtoWindow(), sendtoWait() and broadcasts to the same node, in turn
+static void mixed(double loss)
+{
+    startScenario(loss);
+    RF22ReliableDatagram sender(1), receiver(2);
+    sender.init();
+    receiver.init();
+    link(0, 1);
+    addNode(&sender, [&]()
+    {
+	uint8_t buf[messageLen];
+	unsigned int failures = 0;
+	for (unsigned int i = 1; i <= messages; i++)
+	{
+	    fill(buf, i);
+	    if (i % 10 == 3)
+	    {
+		if (!sender.sendtoWait(buf, messageLen, 2))
+		    failures++;
+	    }
+	    else if (i % 10 == 7)
+		sender.sendtoWait(buf, messageLen, RF22_BROADCAST_ADDRESS);
+	    else
+	    {
+		while (!sender.sendtoWindow(buf, messageLen, 2))
+		    sender.poll();
+	    }
+	}
+	sender.waitWindowAcked();
+	senderFinished(failures + sender.windowFailures(), sender.retransmissions());
+	for (;;)
+	    millis();
+    });
+    addNode(&receiver, [&]()
+    {
+	uint8_t buf[RF22_MAX_MESSAGE_LEN];
+	uint8_t len = sizeof(buf);
+	if (receiver.recvfromAck(buf, &len))
+	    deliver(buf, len);
+    });
+    // Broadcasts are not acknowledged, so may be lost without a failure
+    finish("one hop, mixed", loss, false);
+}
+
+// A sender that only calls poll(), and a broadcast from node 3 that it never collects.
+// Nothing can be sent, so it has to give its messages up rather than wait for ever
+static void stray()
+{
+    startScenario(0);
+    RF22ReliableDatagram sender(1), receiver(2), other(3);
+    sender.init();
+    receiver.init();
+    other.init();
+    link(0, 1);
+    link(0, 2);
+    addNode(&sender, [&]()
+    {
+	// The broadcast arrives first, so none of the messages can go out
+	while (!(sender.available() && sender.headerFrom() == 3))
+	    ;
+	uint8_t buf[messageLen];
+	for (unsigned int i = 1; i <= messages; i++)
+	{
+	    fill(buf, i);
+	    while (!sender.sendtoWindow(buf, messageLen, 2))
+		sender.poll();
+	}
+	while (sender.poll())
+	    ;
+	senderFinished(sender.windowFailures(), sender.retransmissions());
+	for (;;)
+	    millis();
+    });
+    addNode(&receiver, [&]()
+    {
+	uint8_t buf[RF22_MAX_MESSAGE_LEN];
+	uint8_t len = sizeof(buf);
+	uint8_t from;
+	if (receiver.recvfromAck(buf, &len, &from) && from == 1)
+	    deliver(buf, len);
+    });
+    addNode(&other, [&]()
+    {
+	// Again at random until the sender has it, as it may collide
+	uint8_t buf[1] = { '?' };
+	if (!(sender._rxBufValid && sender._rxHeaders[1] == 3))
+	    other.sendtoWait(buf, sizeof(buf), RF22_BROADCAST_ADDRESS);
+	unsigned long start = millis();
+	unsigned long wait = random(100, 1000);
+	while (millis() - start < wait)
+	    ;
+    });
+    run(quiet, 1000);
+    result.seconds = senderDone / 1e6;
+    printf("%-30s %3.0f%%  %5.1f s  %15s %3u delivered  %2u failed  %3u retransmitted\n",
+	   "one hop, stray message", 0.0, result.seconds, "", result.delivered, result.failures,
+	   result.retransmissions);
+    if (   !finished || result.duplicates || result.corrupt || cutOffs
+	|| result.delivered || result.failures != messages)
+    {
+	printf("  %s, %u duplicates, %u corrupt, %u cut off, %u delivered and %u failed of %u\n",
+	       finished ? "finished" : "NOT FINISHED", result.duplicates, result.corrupt, cutOffs,
+	       result.delivered, result.failures, messages);
+	errors++;
+    }
+}
+
+// Node 1 to node 4 over 1-2-3-4
+template <class T>
+static double chain(const char* name, double loss, bool windowed, bool routes)
+{
+    startScenario(loss);
+    T node1(1), node2(2), node3(3), node4(4);
+    T* all[] = { &node1, &node2, &node3, &node4 };
+    for (int i = 0; i < 4; i++)
+	all[i]->init();
+    if (routes)
+    {
+	node1.addRouteTo(4, 2);
+	node2.addRouteTo(4, 3);
+	node3.addRouteTo(4, 4);
+    }
+    link(0, 1);
+    link(1, 2);
+    link(2, 3);
+    addNode(&node1, [&]()
+    {
+	uint8_t buf[messageLen];
+	unsigned int failures = 0;
+	for (unsigned int i = 1; i <= messages; i++)
+	{
+	    fill(buf, i);
+	    uint8_t error = windowed ? node1.sendtoWindow(buf, messageLen, 4) : node1.sendtoWait(buf, messageLen, 4);
+	    if (error != RF22_ROUTER_ERROR_NONE)
+		failures++;
+	}
+	if (windowed)
+	    node1.waitWindowAcked();
+	senderFinished(failures + node1.windowFailures(), node1.retransmissions());
+	for (;;)
+	{
+	    uint8_t buf[RF22_MAX_MESSAGE_LEN];
+	    uint8_t len = sizeof(buf);
+	    node1.recvfromAck(buf, &len);
+	}
+    });
+    for (int i = 1; i < 3; i++)
+    {
+	T* router = all[i];
+	addNode(router, [router]()
+	{
+	    uint8_t buf[RF22_MAX_MESSAGE_LEN];
+	    uint8_t len = sizeof(buf);
+	    router->recvfromAck(buf, &len);
+	});
+    }
+    addNode(&node4, [&]()
+    {
+	uint8_t buf[RF22_MAX_MESSAGE_LEN];
+	uint8_t len = sizeof(buf);
+	if (node4.recvfromAck(buf, &len))
+	    deliver(buf, len);
+    });
+    finish(name, loss, false);
+    printf("%30s windowed messages given up on the way: %u, %u\n", "",
+	   node2.windowFailures(), node3.windowFailures());
+    return result.bitsPerSecond;
+}
+
+int main()
+{
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    const double losses[] = { 0, 0.1 };
+    for (int i = 0; i < 2; i++)
+    {
+	const double loss = losses[i];
+	double wait = oneHop(loss, false);
+	double window = oneHop(loss, true);
+	printf("%30s speedup %.2f\n", "", window / wait);
+	mixed(loss);
+	wait = chain<RF22Router>("3 hops, Router sendtoWait()", loss, false, true);
+	window = chain<RF22Router>("3 hops, Router sendtoWindow()", loss, true, true);
+	printf("%30s speedup %.2f\n", "", window / wait);
+	wait = chain<RF22Mesh>("3 hops, Mesh sendtoWait()", loss, false, false);
+	window = chain<RF22Mesh>("3 hops, Mesh sendtoWindow()", loss, true, false);
+	printf("%30s speedup %.2f\n", "", window / wait);
+    }
+    stray();
+    printf("checks: %s\n", errors ? "MISMATCH" : "ok");
+    return errors ? 1 : 0;
+}
@@ -33,6 +33,29 @@
  */
 #define ALLOW_DEPRECATED_FUNCTIONS 1
 //------------------------------------------------------------------------------
+/**
+ * Transfer runs of two or more whole contiguous blocks in SdFile::read()
+ * and SdFile::write() with the multiple block commands, CMD18 and CMD25,
+ * directly to or from the caller's buffer if non-zero.
+ */
+#ifndef USE_MULTI_BLOCK_SD_IO
+#define USE_MULTI_BLOCK_SD_IO 1
+#endif  // USE_MULTI_BLOCK_SD_IO
+//------------------------------------------------------------------------------
+/**
+ * Number of 512 byte blocks in the SdVolume cache.
+ *
+ * With three or more blocks, one holds FAT blocks, one holds directory
+ * blocks and the rest hold file data, least recently used first out, so
+ * appending to a file does not re-read the FAT and directory blocks.
+ * With one block all access shares it.  Each extra block costs 522 bytes
+ * of RAM, so the default is one block.  Set it to three here on
+ * processors with RAM to spare.
+ */
+#ifndef SD_CACHE_SIZE
+#define SD_CACHE_SIZE 1
+#endif  // SD_CACHE_SIZE
+//------------------------------------------------------------------------------
 // forward declaration since SdVolume is used in SdFile
 class SdVolume;
 //==============================================================================
@@ -392,6 +415,8 @@ class SdFile : public Print {
   uint8_t addCluster(void);
   uint8_t addDirCluster(void);
   dir_t* cacheDirEntry(uint8_t action);
+  uint8_t contiguousBlocks(uint8_t blockOfCluster,
+    uint32_t maxBlocks, uint8_t grow, uint32_t* count);
   static void (*dateTime_)(uint16_t* date, uint16_t* time);
   static uint8_t make83Name(const char* str, uint8_t* name);
   uint8_t openCachedEntry(uint8_t cacheIndex, uint8_t oflags);
@@ -430,8 +455,18 @@ class SdVolume {
    */
   static uint8_t* cacheClear(void) {
     cacheFlush();
-    cacheBlockNumber_ = 0XFFFFFFFF;
-    return cacheBuffer_.data;
+    cacheDiscard(0, 0XFFFFFFFF);
+    return cacheBuffer_[0].data;
+  }
+  /** \return The number of block requests found in the cache. */
+  static uint32_t cacheHits(void) {return cacheHits_;}
+  /** \return The number of block requests that read or replaced a block. */
+  static uint32_t cacheMisses(void) {return cacheMisses_;}
+  /** \return The number of dirty blocks written back from the cache. */
+  static uint32_t cacheFlushes(void) {return cacheFlushes_;}
+  /** Set the cache hit, miss and flush counts to zero. */
+  static void cacheClearCounts(void) {
+    cacheHits_ = cacheMisses_ = cacheFlushes_ = 0;
   }
   /**
    * Initialize a FAT volume.  Try partition one first then try super
@@ -491,12 +526,33 @@ class SdVolume {
   static uint8_t const CACHE_FOR_READ = 0;
   // value for action argument in cacheRawBlock to indicate cache dirty
   static uint8_t const CACHE_FOR_WRITE = 1;
+  // action bit for cacheRawBlock to skip the read of a block not in cache
+  static uint8_t const CACHE_OPTION_NO_READ = 2;
+  // action for cacheRawBlock to assign a block that will be fully written
+  static uint8_t const CACHE_RESERVE_FOR_WRITE =
+    CACHE_FOR_WRITE | CACHE_OPTION_NO_READ;
+
+  // value for use argument in cacheRawBlock - cache slot for FAT blocks
+  static uint8_t const CACHE_FAT = 0;
+  // value for use argument in cacheRawBlock - cache slot for directory blocks
+  static uint8_t const CACHE_DIR = SD_CACHE_SIZE > 1 ? 1 : 0;
+  // value for use argument in cacheRawBlock - first cache slot for file data
+  static uint8_t const CACHE_DATA = SD_CACHE_SIZE > 2 ? 2 : SD_CACHE_SIZE - 1;
 
-  static cache_t cacheBuffer_;        // 512 byte cache for device blocks
-  static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
+  static cache_t cacheBuffer_[SD_CACHE_SIZE];  // 512 byte device blocks
+  // Logical number of block in each cache slot
+  static uint32_t cacheBlockNumber_[SD_CACHE_SIZE];
+  // cacheFlush() will write block if true
+  static uint8_t cacheDirty_[SD_CACHE_SIZE];
+  // block number for mirror FAT
+  static uint32_t cacheMirrorBlock_[SD_CACHE_SIZE];
+  // accesses since last use, saturates at 255, for least recently used slot
+  static uint8_t cacheAge_[SD_CACHE_SIZE];
+  static uint8_t cacheCurrent_;       // slot used by the last access
+  static uint32_t cacheHits_;         // requests found in cache
+  static uint32_t cacheMisses_;       // requests that read or replaced a block
+  static uint32_t cacheFlushes_;      // dirty blocks written
   static Sd2Card* sdCard_;            // Sd2Card object for cache
-  static uint8_t cacheDirty_;         // cacheFlush() will write block if true
-  static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
 //
   uint32_t allocSearchStart_;   // start cluster for alloc search
   uint8_t blocksPerCluster_;    // cluster size in blocks
@@ -517,10 +573,21 @@ class SdVolume {
            return dataStartBlock_ + ((cluster - 2) << clusterSizeShift_);}
   uint32_t blockNumber(uint32_t cluster, uint32_t position) const {
            return clusterStartBlock(cluster) + blockOfCluster(position);}
+  static cache_t* cacheCurrent(void) {return &cacheBuffer_[cacheCurrent_];}
+  static uint32_t cacheCurrentBlock(void) {
+    return cacheBlockNumber_[cacheCurrent_];
+  }
+  static void cacheDiscard(uint32_t blockNumber, uint32_t count);
+  static int8_t cacheFind(uint32_t blockNumber);
   static uint8_t cacheFlush(void);
-  static uint8_t cacheRawBlock(uint32_t blockNumber, uint8_t action);
-  static void cacheSetDirty(void) {cacheDirty_ |= CACHE_FOR_WRITE;}
-  static uint8_t cacheZeroBlock(uint32_t blockNumber);
+  static uint8_t cacheFlush(uint32_t blockNumber, uint32_t count);
+  static uint8_t cacheFlushSlot(uint8_t slot);
+  static cache_t* cacheRawBlock(uint32_t blockNumber,
+    uint8_t action, uint8_t use);
+  static void cacheSetDirty(void) {
+    cacheDirty_[cacheCurrent_] |= CACHE_FOR_WRITE;
+  }
+  static cache_t* cacheZeroBlock(uint32_t blockNumber, uint8_t use);
   uint8_t chainSize(uint32_t beginCluster, uint32_t* size) const;
   uint8_t fatGet(uint32_t cluster, uint32_t* value) const;
   uint8_t fatPut(uint32_t cluster, uint32_t value);
@@ -537,8 +604,16 @@ class SdVolume {
     uint16_t count, uint8_t* dst) {
       return sdCard_->readData(block, offset, count, dst);
   }
+  uint8_t readStart(uint32_t block) {return sdCard_->readStart(block);}
+  uint8_t readData(uint8_t* dst) {return sdCard_->readData(dst);}
+  uint8_t readStop(void) {return sdCard_->readStop();}
   uint8_t writeBlock(uint32_t block, const uint8_t* dst) {
     return sdCard_->writeBlock(block, dst);
   }
+  uint8_t writeStart(uint32_t block, uint32_t eraseCount) {
+    return sdCard_->writeStart(block, eraseCount);
+  }
+  uint8_t writeData(const uint8_t* src) {return sdCard_->writeData(src);}
+  uint8_t writeStop(void) {return sdCard_->writeStop();}
 };
 #endif  // SdFat_h
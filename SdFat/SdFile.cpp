@@ -49,7 +49,9 @@ uint8_t SdFile::addDirCluster(void) {
   // zero data in cluster insure first cluster is in cache
   uint32_t block = vol_->clusterStartBlock(curCluster_);
   for (uint8_t i = vol_->blocksPerCluster_; i != 0; i--) {
-    if (!SdVolume::cacheZeroBlock(block + i - 1)) return false;
+    if (!SdVolume::cacheZeroBlock(block + i - 1, SdVolume::CACHE_DIR)) {
+      return false;
+    }
   }
   // Increase directory file size by cluster size
   fileSize_ += 512UL << vol_->clusterSizeShift_;
@@ -59,8 +61,10 @@ uint8_t SdFile::addDirCluster(void) {
 // cache a file's directory entry
 // return pointer to cached entry or null for failure
 dir_t* SdFile::cacheDirEntry(uint8_t action) {
-  if (!SdVolume::cacheRawBlock(dirBlock_, action)) return NULL;
-  return SdVolume::cacheBuffer_.dir + dirIndex_;
+  cache_t* pc = SdVolume::cacheRawBlock(dirBlock_,
+    action, SdVolume::CACHE_DIR);
+  if (!pc) return NULL;
+  return pc->dir + dirIndex_;
 }
 //------------------------------------------------------------------------------
 /**
@@ -77,6 +81,35 @@ uint8_t SdFile::close(void) {
   return true;
 }
 //------------------------------------------------------------------------------
+// Count the blocks, up to maxBlocks, in the run that starts at blockOfCluster
+// in curCluster_ and is contiguous on the volume.  Moves curCluster_ to the
+// cluster that holds the last block counted.  If grow is true and the run
+// reaches the end of the chain, free clusters that directly follow it are
+// added to the file.
+uint8_t SdFile::contiguousBlocks(uint8_t blockOfCluster,
+  uint32_t maxBlocks, uint8_t grow, uint32_t* count) {
+  uint32_t n = vol_->blocksPerCluster_ - blockOfCluster;
+  while (n < maxBlocks) {
+    uint32_t next;
+    if (!vol_->fatGet(curCluster_, &next)) return false;
+    if (next == curCluster_ + 1) {
+      curCluster_ = next;
+    } else if (grow && vol_->isEOC(next) &&
+      curCluster_ <= vol_->clusterCount_) {
+      // allocation starts at curCluster_ + 1 so only add it if it is free
+      uint32_t f;
+      if (!vol_->fatGet(curCluster_ + 1, &f)) return false;
+      if (f != 0) break;
+      if (!addCluster()) return false;
+    } else {
+      break;
+    }
+    n += vol_->blocksPerCluster_;
+  }
+  *count = n < maxBlocks ? n : maxBlocks;
+  return true;
+}
+//------------------------------------------------------------------------------
 /**
  * Check for contiguous file and return its raw block range.
  *
@@ -311,10 +344,12 @@ uint8_t SdFile::makeDir(SdFile* dir, const char* dirName) {
 
   // cache block for '.'  and '..'
   uint32_t block = vol_->clusterStartBlock(firstCluster_);
-  if (!SdVolume::cacheRawBlock(block, SdVolume::CACHE_FOR_WRITE)) return false;
+  cache_t* pc = SdVolume::cacheRawBlock(block,
+    SdVolume::CACHE_FOR_WRITE, SdVolume::CACHE_DIR);
+  if (!pc) return false;
 
   // copy '.' to block
-  memcpy(&SdVolume::cacheBuffer_.dir[0], &d, sizeof(d));
+  memcpy(&pc->dir[0], &d, sizeof(d));
 
   // make entry for '..'
   d.name[1] = '.';
@@ -326,7 +361,7 @@ uint8_t SdFile::makeDir(SdFile* dir, const char* dirName) {
     d.firstClusterHigh = dir->firstCluster_ >> 16;
   }
   // copy '..' to block
-  memcpy(&SdVolume::cacheBuffer_.dir[1], &d, sizeof(d));
+  memcpy(&pc->dir[1], &d, sizeof(d));
 
   // set position after '..'
   curPosition_ = 2 * sizeof(d);
@@ -406,7 +441,7 @@ uint8_t SdFile::open(SdFile* dirFile, const char* fileName, uint8_t oflag) {
       if (!emptyFound) {
         emptyFound = true;
         dirIndex_ = index;
-        dirBlock_ = SdVolume::cacheBlockNumber_;
+        dirBlock_ = SdVolume::cacheCurrentBlock();
       }
       // done if no entries follow
       if (p->name[0] == DIR_NAME_FREE) break;
@@ -433,7 +468,7 @@ uint8_t SdFile::open(SdFile* dirFile, const char* fileName, uint8_t oflag) {
 
     // use first entry in cluster
     dirIndex_ = 0;
-    p = SdVolume::cacheBuffer_.dir;
+    p = SdVolume::cacheCurrent()->dir;
   }
   // initialize as empty file
   memset(p, 0, sizeof(dir_t));
@@ -501,7 +536,7 @@ uint8_t SdFile::open(SdFile* dirFile, uint16_t index, uint8_t oflag) {
 // open a cached directory entry. Assumes vol_ is initializes
 uint8_t SdFile::openCachedEntry(uint8_t dirIndex, uint8_t oflag) {
   // location of entry in cache
-  dir_t* p = SdVolume::cacheBuffer_.dir + dirIndex;
+  dir_t* p = SdVolume::cacheCurrent()->dir + dirIndex;
 
   // write or truncate is an error for a directory or read-only file
   if (p->attributes & (DIR_ATT_READ_ONLY | DIR_ATT_DIRECTORY)) {
@@ -509,7 +544,7 @@ uint8_t SdFile::openCachedEntry(uint8_t dirIndex, uint8_t oflag) {
   }
   // remember location of directory entry on SD
   dirIndex_ = dirIndex;
-  dirBlock_ = SdVolume::cacheBlockNumber_;
+  dirBlock_ = SdVolume::cacheCurrentBlock();
 
   // copy first cluster number for directory fields
   firstCluster_ = (uint32_t)p->firstClusterHigh << 16;
@@ -692,15 +727,32 @@ int16_t SdFile::read(void* buf, uint16_t nbyte) {
     // amount to be read from current block
     if (n > (512 - offset)) n = 512 - offset;
 
-    // no buffering needed if n == 512 or user requests no buffering
-    if ((unbufferedRead() || n == 512) &&
-      block != SdVolume::cacheBlockNumber_) {
+    if (USE_MULTI_BLOCK_SD_IO && offset == 0 && toRead >= 1024 &&
+      type_ != FAT_FILE_TYPE_ROOT16) {
+      // read the run of whole blocks directly into the caller's buffer
+      uint32_t nb;
+      if (!contiguousBlocks(vol_->blockOfCluster(curPosition_),
+        toRead >> 9, false, &nb)) return -1;
+
+      // the cache may hold newer data for a block in the run
+      if (!SdVolume::cacheFlush(block, nb)) return -1;
+      if (!vol_->readStart(block)) return -1;
+      for (uint32_t i = 0; i < nb; i++) {
+        if (!vol_->readData(dst)) return -1;
+        dst += 512;
+      }
+      if (!vol_->readStop()) return -1;
+      n = nb << 9;
+    } else if ((unbufferedRead() || n == 512) &&
+      SdVolume::cacheFind(block) < 0) {
       if (!vol_->readData(block, offset, n, dst)) return -1;
       dst += n;
     } else {
       // read block to cache and copy data to caller
-      if (!SdVolume::cacheRawBlock(block, SdVolume::CACHE_FOR_READ)) return -1;
-      uint8_t* src = SdVolume::cacheBuffer_.data + offset;
+      cache_t* pc = SdVolume::cacheRawBlock(block, SdVolume::CACHE_FOR_READ,
+        isDir() ? SdVolume::CACHE_DIR : SdVolume::CACHE_DATA);
+      if (!pc) return -1;
+      uint8_t* src = pc->data + offset;
       uint8_t* end = src + n;
       while (src != end) *dst++ = *src++;
     }
@@ -754,7 +806,7 @@ dir_t* SdFile::readDirCache(void) {
   curPosition_ += 31;
 
   // return pointer to entry
-  return (SdVolume::cacheBuffer_.dir + i);
+  return (SdVolume::cacheCurrent()->dir + i);
 }
 //------------------------------------------------------------------------------
 /**
@@ -1167,27 +1219,40 @@ int16_t SdFile::write(const void* buf, uint16_t nbyte) {
 
     // block for data write
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
-    if (n == 512) {
+    if (USE_MULTI_BLOCK_SD_IO && blockOffset == 0 && nToWrite >= 1024) {
+      // write the run of whole blocks directly from the caller's buffer
+      uint32_t nb;
+      if (!contiguousBlocks(blockOfCluster, nToWrite >> 9, true, &nb)) {
+        goto writeErrorReturn;
+      }
+      // discard cached blocks that will be replaced
+      SdVolume::cacheDiscard(block, nb);
+      if (!vol_->writeStart(block, nb)) goto writeErrorReturn;
+      for (uint32_t i = 0; i < nb; i++) {
+        if (!vol_->writeData(src)) goto writeErrorReturn;
+        src += 512;
+      }
+      if (!vol_->writeStop()) goto writeErrorReturn;
+      n = nb << 9;
+    } else if (n == 512) {
       // full block - don't need to use cache
       // invalidate cache if block is in cache
-      if (SdVolume::cacheBlockNumber_ == block) {
-        SdVolume::cacheBlockNumber_ = 0XFFFFFFFF;
-      }
+      SdVolume::cacheDiscard(block, 1);
       if (!vol_->writeBlock(block, src)) goto writeErrorReturn;
       src += 512;
     } else {
+      cache_t* pc;
       if (blockOffset == 0 && curPosition_ >= fileSize_) {
         // start of new block don't need to read into cache
-        if (!SdVolume::cacheFlush()) goto writeErrorReturn;
-        SdVolume::cacheBlockNumber_ = block;
-        SdVolume::cacheSetDirty();
+        pc = SdVolume::cacheRawBlock(block,
+          SdVolume::CACHE_RESERVE_FOR_WRITE, SdVolume::CACHE_DATA);
       } else {
         // rewrite part of block
-        if (!SdVolume::cacheRawBlock(block, SdVolume::CACHE_FOR_WRITE)) {
-          goto writeErrorReturn;
-        }
+        pc = SdVolume::cacheRawBlock(block,
+          SdVolume::CACHE_FOR_WRITE, SdVolume::CACHE_DATA);
       }
-      uint8_t* dst = SdVolume::cacheBuffer_.data + blockOffset;
+      if (!pc) goto writeErrorReturn;
+      uint8_t* dst = pc->data + blockOffset;
       uint8_t* end = dst + n;
       while (dst != end) *dst++ = *src++;
     }
@@ -20,12 +20,17 @@
 #include <SdFat.h>
 //------------------------------------------------------------------------------
 // raw block cache
-// init cacheBlockNumber_to invalid SD block number
-uint32_t SdVolume::cacheBlockNumber_ = 0XFFFFFFFF;
-cache_t  SdVolume::cacheBuffer_;     // 512 byte cache for Sd2Card
-Sd2Card* SdVolume::sdCard_;          // pointer to SD card object
-uint8_t  SdVolume::cacheDirty_ = 0;  // cacheFlush() will write block if true
-uint32_t SdVolume::cacheMirrorBlock_ = 0;  // mirror  block for second FAT
+cache_t  SdVolume::cacheBuffer_[SD_CACHE_SIZE];  // 512 byte blocks for Sd2Card
+// blocks in cache - set to invalid SD block number by init()
+uint32_t SdVolume::cacheBlockNumber_[SD_CACHE_SIZE];
+uint8_t  SdVolume::cacheDirty_[SD_CACHE_SIZE];  // cacheFlush() will write
+uint32_t SdVolume::cacheMirrorBlock_[SD_CACHE_SIZE];  // blocks for second FAT
+uint8_t  SdVolume::cacheAge_[SD_CACHE_SIZE];  // accesses since last use
+uint8_t  SdVolume::cacheCurrent_ = 0;   // slot used by last access
+uint32_t SdVolume::cacheHits_ = 0;      // requests found in cache
+uint32_t SdVolume::cacheMisses_ = 0;    // requests that read or replaced a block
+uint32_t SdVolume::cacheFlushes_ = 0;   // dirty blocks written
+Sd2Card* SdVolume::sdCard_;             // pointer to SD card object
 //------------------------------------------------------------------------------
 // find a contiguous group of clusters
 uint8_t SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
@@ -96,44 +101,106 @@ uint8_t SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
   return true;
 }
 //------------------------------------------------------------------------------
+// drop cached blocks in the range without writing them
+void SdVolume::cacheDiscard(uint32_t blockNumber, uint32_t count) {
+  for (uint8_t i = 0; i < SD_CACHE_SIZE; i++) {
+    if ((cacheBlockNumber_[i] - blockNumber) < count) {
+      cacheBlockNumber_[i] = 0XFFFFFFFF;
+      cacheDirty_[i] = 0;
+      cacheMirrorBlock_[i] = 0;
+    }
+  }
+}
+//------------------------------------------------------------------------------
+// return the slot that holds a block or -1 if the block is not in the cache
+int8_t SdVolume::cacheFind(uint32_t blockNumber) {
+  for (uint8_t i = 0; i < SD_CACHE_SIZE; i++) {
+    if (cacheBlockNumber_[i] == blockNumber) return i;
+  }
+  return -1;
+}
+//------------------------------------------------------------------------------
+// write all dirty blocks
 uint8_t SdVolume::cacheFlush(void) {
-  if (cacheDirty_) {
-    if (!sdCard_->writeBlock(cacheBlockNumber_, cacheBuffer_.data)) {
+  for (uint8_t i = 0; i < SD_CACHE_SIZE; i++) {
+    if (!cacheFlushSlot(i)) return false;
+  }
+  return true;
+}
+//------------------------------------------------------------------------------
+// write dirty blocks in the range
+uint8_t SdVolume::cacheFlush(uint32_t blockNumber, uint32_t count) {
+  for (uint8_t i = 0; i < SD_CACHE_SIZE; i++) {
+    if ((cacheBlockNumber_[i] - blockNumber) < count) {
+      if (!cacheFlushSlot(i)) return false;
+    }
+  }
+  return true;
+}
+//------------------------------------------------------------------------------
+uint8_t SdVolume::cacheFlushSlot(uint8_t slot) {
+  if (cacheDirty_[slot]) {
+    if (!sdCard_->writeBlock(cacheBlockNumber_[slot],
+      cacheBuffer_[slot].data)) {
       return false;
     }
     // mirror FAT tables
-    if (cacheMirrorBlock_) {
-      if (!sdCard_->writeBlock(cacheMirrorBlock_, cacheBuffer_.data)) {
+    if (cacheMirrorBlock_[slot]) {
+      if (!sdCard_->writeBlock(cacheMirrorBlock_[slot],
+        cacheBuffer_[slot].data)) {
         return false;
       }
-      cacheMirrorBlock_ = 0;
+      cacheMirrorBlock_[slot] = 0;
     }
-    cacheDirty_ = 0;
+    cacheDirty_[slot] = 0;
+    cacheFlushes_++;
   }
   return true;
 }
 //------------------------------------------------------------------------------
-uint8_t SdVolume::cacheRawBlock(uint32_t blockNumber, uint8_t action) {
-  if (cacheBlockNumber_ != blockNumber) {
-    if (!cacheFlush()) return false;
-    if (!sdCard_->readBlock(blockNumber, cacheBuffer_.data)) return false;
-    cacheBlockNumber_ = blockNumber;
+// Return a pointer to the cached block.  A block not in the cache replaces
+// the block in the slot for use, or for CACHE_DATA the least recently used
+// data slot.
+cache_t* SdVolume::cacheRawBlock(uint32_t blockNumber,
+  uint8_t action, uint8_t use) {
+  int8_t slot = cacheFind(blockNumber);
+  if (slot >= 0) {
+    cacheHits_++;
+  } else {
+    cacheMisses_++;
+    slot = use;
+    if (use >= CACHE_DATA) {
+      for (uint8_t i = CACHE_DATA + 1; i < SD_CACHE_SIZE; i++) {
+        if (cacheAge_[i] > cacheAge_[slot]) slot = i;
+      }
+    }
+    if (!cacheFlushSlot(slot)) return NULL;
+    if (!(action & CACHE_OPTION_NO_READ) &&
+      !sdCard_->readBlock(blockNumber, cacheBuffer_[slot].data)) {
+      cacheBlockNumber_[slot] = 0XFFFFFFFF;
+      return NULL;
+    }
+    cacheBlockNumber_[slot] = blockNumber;
   }
-  cacheDirty_ |= action;
-  return true;
+  for (uint8_t i = CACHE_DATA; i < SD_CACHE_SIZE; i++) {
+    if (cacheAge_[i] != 0XFF) cacheAge_[i]++;
+  }
+  cacheAge_[slot] = 0;
+  cacheDirty_[slot] |= action & CACHE_FOR_WRITE;
+  cacheCurrent_ = slot;
+  return &cacheBuffer_[slot];
 }
 //------------------------------------------------------------------------------
 // cache a zero block for blockNumber
-uint8_t SdVolume::cacheZeroBlock(uint32_t blockNumber) {
-  if (!cacheFlush()) return false;
+cache_t* SdVolume::cacheZeroBlock(uint32_t blockNumber, uint8_t use) {
+  cache_t* pc = cacheRawBlock(blockNumber, CACHE_RESERVE_FOR_WRITE, use);
+  if (!pc) return NULL;
 
-  // loop take less flash than memset(cacheBuffer_.data, 0, 512);
+  // loop take less flash than memset(pc->data, 0, 512);
   for (uint16_t i = 0; i < 512; i++) {
-    cacheBuffer_.data[i] = 0;
+    pc->data[i] = 0;
   }
-  cacheBlockNumber_ = blockNumber;
-  cacheSetDirty();
-  return true;
+  return pc;
 }
 //------------------------------------------------------------------------------
 // return the size in bytes of a cluster chain
@@ -152,13 +219,12 @@ uint8_t SdVolume::fatGet(uint32_t cluster, uint32_t* value) const {
   if (cluster > (clusterCount_ + 1)) return false;
   uint32_t lba = fatStartBlock_;
   lba += fatType_ == 16 ? cluster >> 8 : cluster >> 7;
-  if (lba != cacheBlockNumber_) {
-    if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
-  }
+  cache_t* pc = cacheRawBlock(lba, CACHE_FOR_READ, CACHE_FAT);
+  if (!pc) return false;
   if (fatType_ == 16) {
-    *value = cacheBuffer_.fat16[cluster & 0XFF];
+    *value = pc->fat16[cluster & 0XFF];
   } else {
-    *value = cacheBuffer_.fat32[cluster & 0X7F] & FAT32MASK;
+    *value = pc->fat32[cluster & 0X7F] & FAT32MASK;
   }
   return true;
 }
@@ -175,19 +241,17 @@ uint8_t SdVolume::fatPut(uint32_t cluster, uint32_t value) {
   uint32_t lba = fatStartBlock_;
   lba += fatType_ == 16 ? cluster >> 8 : cluster >> 7;
 
-  if (lba != cacheBlockNumber_) {
-    if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
-  }
+  cache_t* pc = cacheRawBlock(lba, CACHE_FOR_WRITE, CACHE_FAT);
+  if (!pc) return false;
+
   // store entry
   if (fatType_ == 16) {
-    cacheBuffer_.fat16[cluster & 0XFF] = value;
+    pc->fat16[cluster & 0XFF] = value;
   } else {
-    cacheBuffer_.fat32[cluster & 0X7F] = value;
+    pc->fat32[cluster & 0X7F] = value;
   }
-  cacheSetDirty();
-
   // mirror second FAT
-  if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+  if (fatCount_ > 1) cacheMirrorBlock_[cacheCurrent_] = lba + blocksPerFat_;
   return true;
 }
 //------------------------------------------------------------------------------
@@ -226,13 +290,19 @@ uint8_t SdVolume::freeChain(uint32_t cluster) {
  */
 uint8_t SdVolume::init(Sd2Card* dev, uint8_t part) {
   uint32_t volumeStartBlock = 0;
+  cache_t* pc;
+  // write any dirty blocks to the card they came from, then
+  // drop them all: blocks cached from a previous card are not valid
+  if (!cacheFlush()) return false;
+  cacheDiscard(0, 0XFFFFFFFF);
   sdCard_ = dev;
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
   if (part) {
     if (part > 4)return false;
-    if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-    part_t* p = &cacheBuffer_.mbr.part[part-1];
+    pc = cacheRawBlock(volumeStartBlock, CACHE_FOR_READ, CACHE_DATA);
+    if (!pc) return false;
+    part_t* p = &pc->mbr.part[part-1];
     if ((p->boot & 0X7F) !=0  ||
       p->totalSectors < 100 ||
       p->firstSector == 0) {
@@ -241,8 +311,9 @@ uint8_t SdVolume::init(Sd2Card* dev, uint8_t part) {
     }
     volumeStartBlock = p->firstSector;
   }
-  if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-  bpb_t* bpb = &cacheBuffer_.fbs.bpb;
+  pc = cacheRawBlock(volumeStartBlock, CACHE_FOR_READ, CACHE_DATA);
+  if (!pc) return false;
+  bpb_t* bpb = &pc->fbs.bpb;
   if (bpb->bytesPerSector != 512 ||
     bpb->fatCount == 0 ||
     bpb->reservedSectorCount == 0 ||
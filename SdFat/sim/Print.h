@@ -0,0 +1,51 @@
+/* Arduino SdFat Library
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+/**
+ * \file
+ * Host stand-in for the pre-1.0 Arduino Print class used by SdFile.
+ */
+#ifndef sim_Print_h
+#define sim_Print_h
+#include <stdint.h>
+#include <stdio.h>
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual void write(uint8_t) = 0;
+  virtual void write(const char* str) {
+    while (*str) write((uint8_t)*str++);
+  }
+  void print(char c) {write((uint8_t)c);}
+  void print(const char* str) {write(str);}
+  void print(unsigned long n) {
+    char buf[12];
+    snprintf(buf, sizeof(buf), "%lu", n);
+    write(buf);
+  }
+  void print(long n) {
+    char buf[12];
+    snprintf(buf, sizeof(buf), "%ld", n);
+    write(buf);
+  }
+  void print(unsigned int n) {print((unsigned long)n);}
+  void print(int n) {print((long)n);}
+  void println(void) {write("\r\n");}
+};
+#endif  // sim_Print_h
@@ -0,0 +1,51 @@
+/* Arduino SdFat Library
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+/**
+ * \file
+ * Host stand-in for the pre-1.0 Arduino core used by SdFat.
+ *
+ * millis() follows the virtual clock of the emulated SPI bus, and
+ * the chip select pin is wired to the emulated card.
+ */
+#ifndef sim_WProgram_h
+#define sim_WProgram_h
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/io.h>
+#include "Print.h"
+
+#define HIGH 1
+#define LOW  0
+#define INPUT  0
+#define OUTPUT 1
+
+inline void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t value);
+unsigned long millis(void);
+
+/** Serial port that prints to stdout */
+class HardwareSerial : public Print {
+ public:
+  void write(uint8_t b) {putchar(b);}
+  using Print::write;
+};
+extern HardwareSerial Serial;
+#endif  // sim_WProgram_h
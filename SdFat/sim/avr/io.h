@@ -0,0 +1,56 @@
+/* Arduino SdFat Library
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+/**
+ * \file
+ * Host stand-in for the AVR registers used by Sd2Card and Sd2PinMap.h
+ *
+ * Port registers are plain memory.  A write to SPDR clocks one byte
+ * through the emulated SD card in sd_card_sim.cpp, and reading SPDR
+ * returns the byte the card sent back.  SPSR always reports the
+ * transfer as complete.
+ */
+#ifndef sim_avr_io_h
+#define sim_avr_io_h
+#include <stdint.h>
+
+extern volatile uint8_t DDRB, PINB, PORTB;
+extern volatile uint8_t DDRC, PINC, PORTC;
+extern volatile uint8_t DDRD, PIND, PORTD;
+
+/** SPI data register connected to the emulated card */
+class SimSpiData {
+ public:
+  SimSpiData& operator=(uint8_t b);
+  operator uint8_t() const {return rx_;}
+ private:
+  uint8_t rx_;
+};
+extern SimSpiData SPDR;
+extern volatile uint8_t SPCR;
+extern volatile uint8_t SPSR;
+
+// SPCR bits
+#define SPR0 0
+#define SPR1 1
+#define MSTR 4
+#define SPE  6
+// SPSR bits
+#define SPI2X 0
+#define SPIF  7
+#endif  // sim_avr_io_h
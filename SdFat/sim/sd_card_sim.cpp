@@ -0,0 +1,350 @@
+/* Arduino SdFat Library
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+/**
+ * \file
+ * File-backed SD card emulator on the SPI bus
+ */
+#include <stdio.h>
+#include <string.h>
+#include <WProgram.h>
+#include <Sd2Card.h>
+#include "sd_card_sim.h"
+
+// AVR port and SPI registers
+volatile uint8_t DDRB, PINB, PORTB;
+volatile uint8_t DDRC, PINC, PORTC;
+volatile uint8_t DDRD, PIND, PORTD;
+volatile uint8_t SPCR;
+volatile uint8_t SPSR = 1 << SPIF;
+SimSpiData SPDR;
+HardwareSerial Serial;
+
+// tokens and responses not defined in SdInfo.h
+static uint8_t const R1_OK = 0X00;
+static uint8_t const DATA_ACCEPTED = 0XE5;
+
+// card states
+enum SimState {
+  SIM_IDLE,          // waiting for a command
+  SIM_READ_MULTI,    // sending blocks for CMD18
+  SIM_WRITE_SINGLE,  // waiting for the data token of CMD24
+  SIM_WRITE_MULTI,   // waiting for a data or stop token of CMD25
+  SIM_WRITE_DATA     // receiving a data block
+};
+
+static FILE* image;
+static uint32_t imageBlocks;
+static SdSimStats stats;
+static SdSimTiming timing = {200, 20, 1500, 150, 1000};
+static uint64_t clockNs;
+
+static uint8_t selected;
+static uint8_t initialized;
+static uint8_t appCmd;
+static SimState state;
+static SimState writeReturn;    // state after a data block is received
+static uint32_t address;        // next block to read or write
+
+static uint8_t cmd[6];          // command being received
+static uint8_t cmdLen;
+
+static uint8_t block[514];      // data block with crc
+static uint16_t blockLen;
+
+// bytes the card sends next
+static uint8_t out[2048];
+static uint16_t outHead;
+static uint16_t outTail;
+// the card holds MISO low until this time after a write
+static uint64_t busyUntilNs;
+//------------------------------------------------------------------------------
+// nanoseconds to shift one byte at the SCK rate in SPCR and SPSR
+static uint32_t byteNs(void) {
+  static uint8_t const div[] = {4, 16, 64, 128};
+  uint32_t d = div[SPCR & 3];
+  if (SPSR & (1 << SPI2X)) d /= 2;
+  // 8 clocks at F_CPU/d with F_CPU = 16 MHz
+  return d * 500;
+}
+// bus bytes that last us microseconds
+static uint32_t usToBytes(uint32_t us) {
+  return (uint64_t)us * 1000 / byteNs();
+}
+static void send(uint8_t b) {
+  out[outTail++] = b;
+}
+static void sendFill(uint8_t b, uint32_t n) {
+  // leave room for a block
+  if (n > sizeof(out) - 520) n = sizeof(out) - 520;
+  while (n--) send(b);
+}
+static void sendBlock(void) {
+  if (!sdSimReadBlock(address, block)) {
+    // data error token - address out of range
+    send(0X08);
+    state = SIM_IDLE;
+    return;
+  }
+  send(DATA_START_BLOCK);
+  for (uint16_t i = 0; i < 512; i++) send(block[i]);
+  // crc is not checked in SPI mode
+  send(0XFF);
+  send(0XFF);
+  stats.blocksRead++;
+  address++;
+}
+//------------------------------------------------------------------------------
+// byte the card drives on MISO for this transfer
+static uint8_t nextOut(void) {
+  if (outHead == outTail) {
+    outHead = outTail = 0;
+    if (clockNs < busyUntilNs) return 0;
+    if (state != SIM_READ_MULTI) return 0XFF;
+    sendFill(0XFF, usToBytes(timing.streamGap));
+    sendBlock();
+    if (outHead == outTail) return 0XFF;
+  }
+  return out[outHead++];
+}
+//------------------------------------------------------------------------------
+static void command(void) {
+  uint8_t index = cmd[0] & 0X3F;
+  uint32_t arg = (uint32_t)cmd[1] << 24 | (uint32_t)cmd[2] << 16
+                 | (uint32_t)cmd[3] << 8 | cmd[4];
+  uint8_t acmd = appCmd;
+  appCmd = 0;
+
+  // a command ends a CMD18 sequence and drops the rest of the block
+  outHead = outTail = 0;
+  if (state == SIM_READ_MULTI) state = SIM_IDLE;
+
+  // CMD12 has a stuff byte right after the command.  It is not 0XFF
+  // here, so the host would take it for R1 if it did not skip it
+  if (index == CMD12) send(0X3F);
+
+  // Ncr - one byte before the response
+  send(0XFF);
+  uint8_t r1 = initialized ? R1_OK : R1_IDLE_STATE;
+  if (acmd) {
+    if (index == ACMD41) {
+      initialized = 1;
+      send(R1_OK);
+    } else {
+      send(r1);
+    }
+    return;
+  }
+  switch (index) {
+    case CMD0:
+      initialized = 0;
+      send(R1_IDLE_STATE);
+      break;
+
+    case CMD8:
+      send(r1);
+      send(0X00);
+      send(0X00);
+      send(0X01);
+      send(arg & 0XFF);
+      break;
+
+    case CMD12:
+      // stuff byte sent above
+      send(R1_OK);
+      stats.cmd12++;
+      break;
+
+    case CMD13:
+      // second byte of R2
+      send(R1_OK);
+      send(0X00);
+      break;
+
+    case CMD17:
+    case CMD18:
+      address = arg;
+      if (address >= imageBlocks) {
+        send(0X40);  // address error
+        break;
+      }
+      send(R1_OK);
+      sendFill(0XFF, usToBytes(timing.readAccess));
+      if (index == CMD17) {
+        stats.cmd17++;
+        sendBlock();
+      } else {
+        stats.cmd18++;
+        sendBlock();
+        state = SIM_READ_MULTI;
+      }
+      break;
+
+    case CMD24:
+    case CMD25:
+      address = arg;
+      if (address >= imageBlocks) {
+        send(0X40);  // address error
+        break;
+      }
+      send(R1_OK);
+      if (index == CMD24) {
+        stats.cmd24++;
+        state = SIM_WRITE_SINGLE;
+      } else {
+        stats.cmd25++;
+        state = SIM_WRITE_MULTI;
+      }
+      break;
+
+    case CMD55:
+      appCmd = 1;
+      send(r1);
+      break;
+
+    case CMD58:
+      // OCR with power up done and CCS set - an SDHC card
+      send(R1_OK);
+      send(0XC0);
+      send(0XFF);
+      send(0X80);
+      send(0X00);
+      break;
+
+    default:
+      send(r1 | R1_ILLEGAL_COMMAND);
+      break;
+  }
+}
+//------------------------------------------------------------------------------
+// byte the host drives on MOSI for this transfer
+static void receive(uint8_t b) {
+  switch (state) {
+    case SIM_WRITE_SINGLE:
+    case SIM_WRITE_MULTI:
+      if (b == (state == SIM_WRITE_SINGLE ?
+                DATA_START_BLOCK : WRITE_MULTIPLE_TOKEN)) {
+        writeReturn = state == SIM_WRITE_SINGLE ? SIM_IDLE : SIM_WRITE_MULTI;
+        state = SIM_WRITE_DATA;
+        blockLen = 0;
+      } else if (b == STOP_TRAN_TOKEN && state == SIM_WRITE_MULTI) {
+        // Nbr - one byte before busy
+        send(0XFF);
+        busyUntilNs = clockNs + 1000ULL * timing.writeStop;
+        state = SIM_IDLE;
+      }
+      return;
+
+    case SIM_WRITE_DATA:
+      block[blockLen++] = b;
+      if (blockLen < sizeof(block)) return;
+      if (!sdSimWriteBlock(address, block)) {
+        send(0XED);  // write error
+        state = SIM_IDLE;
+        return;
+      }
+      stats.blocksWritten++;
+      address++;
+      send(DATA_ACCEPTED);
+      state = writeReturn;
+      busyUntilNs = clockNs + 1000ULL *
+        (state == SIM_IDLE ? timing.writeBlock : timing.writeStream);
+      return;
+
+    default:
+      break;
+  }
+  // collect a command - start bit zero, transmission bit one
+  if (cmdLen || (b & 0XC0) == 0X40) {
+    cmd[cmdLen++] = b;
+    if (cmdLen == sizeof(cmd)) {
+      cmdLen = 0;
+      command();
+    }
+  }
+}
+//------------------------------------------------------------------------------
+SimSpiData& SimSpiData::operator=(uint8_t b) {
+  clockNs += byteNs();
+  if (!selected) {
+    rx_ = 0XFF;
+    return *this;
+  }
+  stats.busBytes++;
+  rx_ = nextOut();
+  receive(b);
+  return *this;
+}
+//------------------------------------------------------------------------------
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (pin == SD_CHIP_SELECT_PIN) selected = value == LOW;
+}
+//------------------------------------------------------------------------------
+unsigned long millis(void) {
+  return clockNs / 1000000;
+}
+//------------------------------------------------------------------------------
+/** Open or create the card image with \a blockCount blocks. */
+bool sdSimOpen(const char* path, uint32_t blockCount) {
+  image = fopen(path, "w+b");
+  if (!image) return false;
+  imageBlocks = blockCount;
+  // extend the file so unwritten blocks read as zero
+  if (fseek(image, (long)blockCount * 512 - 1, SEEK_SET) ||
+    fputc(0, image) == EOF) {
+    sdSimClose();
+    return false;
+  }
+  return true;
+}
+//------------------------------------------------------------------------------
+void sdSimClose(void) {
+  if (image) fclose(image);
+  image = 0;
+}
+//------------------------------------------------------------------------------
+/** Read a block from the image without going through the bus. */
+bool sdSimReadBlock(uint32_t blockNumber, uint8_t* dst) {
+  return blockNumber < imageBlocks &&
+    fseek(image, (long)blockNumber * 512, SEEK_SET) == 0 &&
+    fread(dst, 1, 512, image) == 512;
+}
+//------------------------------------------------------------------------------
+/** Write a block to the image without going through the bus. */
+bool sdSimWriteBlock(uint32_t blockNumber, const uint8_t* src) {
+  return blockNumber < imageBlocks &&
+    fseek(image, (long)blockNumber * 512, SEEK_SET) == 0 &&
+    fwrite(src, 1, 512, image) == 512;
+}
+//------------------------------------------------------------------------------
+/** \return Virtual time in microseconds. */
+uint64_t sdSimMicros(void) {
+  return clockNs / 1000;
+}
+//------------------------------------------------------------------------------
+void sdSimResetStats(void) {
+  memset(&stats, 0, sizeof(stats));
+}
+//------------------------------------------------------------------------------
+SdSimStats* sdSimStats(void) {
+  return &stats;
+}
+//------------------------------------------------------------------------------
+SdSimTiming* sdSimTiming(void) {
+  return &timing;
+}
@@ -0,0 +1,63 @@
+/* Arduino SdFat Library
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+/**
+ * \file
+ * File-backed SD card emulator on the SPI bus
+ *
+ * The card answers the SPI mode commands Sd2Card uses and keeps its
+ * blocks in a host image file.  Every byte on the bus advances a virtual
+ * clock by the time the selected SCK rate takes to shift it, and the
+ * card holds the bus busy for the access and programming delays below,
+ * so the elapsed virtual time is the time an AVR at 16 MHz would spend.
+ */
+#ifndef sd_card_sim_h
+#define sd_card_sim_h
+#include <stdint.h>
+
+/** Card access and programming delays in microseconds.  The defaults are
+ *  representative values, set them to model a particular card. */
+struct SdSimTiming {
+  uint32_t readAccess;    // CMD17 or CMD18 to first data token
+  uint32_t streamGap;     // between blocks of a CMD18 sequence
+  uint32_t writeBlock;    // programming after a CMD24 block
+  uint32_t writeStream;   // busy after each block of a CMD25 sequence
+  uint32_t writeStop;     // programming after the stop tran token
+};
+
+/** Bus and command counters */
+struct SdSimStats {
+  uint32_t cmd12;         // STOP_TRANSMISSION
+  uint32_t cmd17;         // READ_BLOCK
+  uint32_t cmd18;         // READ_MULTIPLE_BLOCK
+  uint32_t cmd24;         // WRITE_BLOCK
+  uint32_t cmd25;         // WRITE_MULTIPLE_BLOCK
+  uint32_t blocksRead;
+  uint32_t blocksWritten;
+  uint32_t busBytes;      // bytes shifted with the card selected
+};
+
+bool sdSimOpen(const char* path, uint32_t blockCount);
+void sdSimClose(void);
+bool sdSimReadBlock(uint32_t block, uint8_t* dst);
+bool sdSimWriteBlock(uint32_t block, const uint8_t* src);
+uint64_t sdSimMicros(void);
+void sdSimResetStats(void);
+SdSimStats* sdSimStats(void);
+SdSimTiming* sdSimTiming(void);
+#endif  // sd_card_sim_h
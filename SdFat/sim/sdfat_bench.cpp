@@ -0,0 +1,164 @@
+/* Arduino SdFat Library
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+/**
+ * \file
+ * Data logging throughput benchmark for SdFile on the emulated SD card
+ *
+ * Formats a FAT16 image, then writes and reads back a file with a range
+ * of transfer sizes and reports the virtual time an AVR at 16 MHz with a
+ * full speed SPI bus would take, along with the SD commands issued and
+ * the SdVolume cache counts.
+ * Exits non-zero if a file reads back with the wrong contents.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <SdFat.h>
+#include "sd_card_sim.h"
+
+#define IMAGE_PATH   "sdcard.img"
+#define IMAGE_BLOCKS 131072UL  // 64 MB
+#define CLUSTER_SIZE 8         // blocks - 4 KB clusters
+#define FAT_BLOCKS   64
+#define ROOT_ENTRIES 512
+#define FILE_SIZE    (2UL << 20)
+
+static Sd2Card card;
+static SdVolume volume;
+static SdFile root;
+
+static uint8_t buf[16384];
+static const uint16_t chunkSizes[] = {100, 512, 1024, 4096, 5000, 16384};
+//------------------------------------------------------------------------------
+// write a super floppy FAT16 volume to the image
+static bool format(void) {
+  cache_t b;
+  memset(&b, 0, sizeof(b));
+  bpb_t* bpb = &b.fbs.bpb;
+  b.fbs.jmpToBootCode[0] = 0XEB;
+  memcpy(b.fbs.oemName, "SDFATSIM", 8);
+  bpb->bytesPerSector = 512;
+  bpb->sectorsPerCluster = CLUSTER_SIZE;
+  bpb->reservedSectorCount = 1;
+  bpb->fatCount = 2;
+  bpb->rootDirEntryCount = ROOT_ENTRIES;
+  bpb->mediaType = 0XF8;
+  bpb->sectorsPerFat16 = FAT_BLOCKS;
+  bpb->totalSectors32 = IMAGE_BLOCKS;
+  b.fbs.bootSectorSig0 = 0X55;
+  b.fbs.bootSectorSig1 = 0XAA;
+  if (!sdSimWriteBlock(0, b.data)) return false;
+
+  // reserved FAT entries 0 and 1
+  memset(&b, 0, sizeof(b));
+  b.fat16[0] = 0XFFF8;
+  b.fat16[1] = 0XFFFF;
+  for (uint8_t i = 0; i < 2; i++) {
+    if (!sdSimWriteBlock(1 + i * FAT_BLOCKS, b.data)) return false;
+  }
+  return true;
+}
+//------------------------------------------------------------------------------
+static uint8_t pattern(uint32_t pos) {
+  return (pos >> 9) ^ pos;
+}
+//------------------------------------------------------------------------------
+static void report(const char* op, uint16_t chunk, uint64_t us) {
+  SdSimStats* s = sdSimStats();
+  printf("%-5s %5u: %6.1f KB/s  CMD17 %5lu  CMD18 %4lu  CMD24 %5lu"
+         "  CMD25 %4lu  cache hit %6lu miss %5lu flush %5lu\n",
+         op, chunk, us ? FILE_SIZE * 1e6 / 1024 / us : 0.0,
+         (unsigned long)s->cmd17, (unsigned long)s->cmd18,
+         (unsigned long)s->cmd24, (unsigned long)s->cmd25,
+         (unsigned long)SdVolume::cacheHits(),
+         (unsigned long)SdVolume::cacheMisses(),
+         (unsigned long)SdVolume::cacheFlushes());
+}
+//------------------------------------------------------------------------------
+static bool logFile(const char* name, uint16_t chunk) {
+  SdFile file;
+  if (!file.open(&root, name, O_CREAT | O_TRUNC | O_WRITE)) return false;
+  sdSimResetStats();
+  SdVolume::cacheClearCounts();
+  uint64_t t0 = sdSimMicros();
+  for (uint32_t pos = 0; pos < FILE_SIZE; pos += chunk) {
+    uint16_t n = FILE_SIZE - pos < chunk ? FILE_SIZE - pos : chunk;
+    for (uint16_t i = 0; i < n; i++) buf[i] = pattern(pos + i);
+    if (file.write(buf, n) != n) return false;
+  }
+  if (!file.close()) return false;
+  report("write", chunk, sdSimMicros() - t0);
+  return true;
+}
+//------------------------------------------------------------------------------
+static bool readFile(const char* name, uint16_t chunk) {
+  SdFile file;
+  if (!file.open(&root, name, O_READ)) return false;
+  sdSimResetStats();
+  SdVolume::cacheClearCounts();
+  uint64_t t0 = sdSimMicros();
+  for (uint32_t pos = 0; pos < FILE_SIZE; pos += chunk) {
+    uint16_t n = FILE_SIZE - pos < chunk ? FILE_SIZE - pos : chunk;
+    if (file.read(buf, n) != n) return false;
+    for (uint16_t i = 0; i < n; i++) {
+      if (buf[i] != pattern(pos + i)) {
+        printf("%s: bad data at %lu\n", name, (unsigned long)(pos + i));
+        return false;
+      }
+    }
+  }
+  report("read", chunk, sdSimMicros() - t0);
+  return file.close();
+}
+//------------------------------------------------------------------------------
+int main(void) {
+  if (!sdSimOpen(IMAGE_PATH, IMAGE_BLOCKS) || !format()) {
+    printf("can't create %s\n", IMAGE_PATH);
+    return 1;
+  }
+  if (!card.init(SPI_FULL_SPEED)) {
+    printf("card.init failed: %02X\n", card.errorCode());
+    return 1;
+  }
+  if (!volume.init(&card) || !root.openRoot(&volume)) {
+    printf("volume.init failed\n");
+    return 1;
+  }
+  printf("USE_MULTI_BLOCK_SD_IO %d, SD_CACHE_SIZE %d, FAT%d,"
+         " %u byte clusters, %lu byte file, chunk size:\n",
+         USE_MULTI_BLOCK_SD_IO, SD_CACHE_SIZE, volume.fatType(),
+         volume.blocksPerCluster() * 512, FILE_SIZE);
+  for (uint8_t i = 0; i < sizeof(chunkSizes)/sizeof(chunkSizes[0]); i++) {
+    char name[13];
+    snprintf(name, sizeof(name), "LOG%05u.BIN", chunkSizes[i]);
+    if (!logFile(name, chunkSizes[i])) {
+      printf("%s: write failed: %02X\n", name, card.errorCode());
+      return 1;
+    }
+  }
+  for (uint8_t i = 0; i < sizeof(chunkSizes)/sizeof(chunkSizes[0]); i++) {
+    char name[13];
+    snprintf(name, sizeof(name), "LOG%05u.BIN", chunkSizes[i]);
+    if (!readFile(name, chunkSizes[i])) {
+      printf("%s: read failed: %02X\n", name, card.errorCode());
+      return 1;
+    }
+  }
+  sdSimClose();
+  return 0;
+}
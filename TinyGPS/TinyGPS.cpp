@@ -22,8 +22,42 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "TinyGPS.h"
 
-#define _GPRMC_TERM   "GPRMC"
-#define _GPGGA_TERM   "GPGGA"
+// Sentences the parser knows, after the talker, in _GPS_SENTENCE_ order
+static const char _gps_sentences[] PROGMEM = "GGARMCGSAGSVVTG";
+
+// Talkers: GPS, GLONASS, Galileo, BeiDou and combined GNSS receivers
+static const char _gps_talkers[] PROGMEM = "PLABN";
+
+// What each term of a known sentence holds
+enum {
+  _GPS_FIELD_NONE, _GPS_FIELD_TIME, _GPS_FIELD_STATUS, _GPS_FIELD_LAT, _GPS_FIELD_NS,
+  _GPS_FIELD_LON, _GPS_FIELD_EW, _GPS_FIELD_SPEED, _GPS_FIELD_COURSE, _GPS_FIELD_DATE,
+  _GPS_FIELD_QUALITY, _GPS_FIELD_SATS, _GPS_FIELD_HDOP, _GPS_FIELD_ALT, _GPS_FIELD_FIX_MODE,
+  _GPS_FIELD_PDOP, _GPS_FIELD_VDOP, _GPS_FIELD_IN_VIEW, _GPS_FIELD_VTG_SPEED, _GPS_FIELD_VTG_MODE
+};
+
+#define _GPS_MAX_TERMS 18
+
+// Field of each term, by sentence type and term number
+static const byte _gps_fields[][_GPS_MAX_TERMS] PROGMEM = {
+  // GGA: time, latitude, N/S, longitude, E/W, fix quality, satellites, HDOP, altitude
+  { _GPS_FIELD_NONE, _GPS_FIELD_TIME, _GPS_FIELD_LAT, _GPS_FIELD_NS, _GPS_FIELD_LON,
+    _GPS_FIELD_EW, _GPS_FIELD_QUALITY, _GPS_FIELD_SATS, _GPS_FIELD_HDOP, _GPS_FIELD_ALT },
+  // RMC: time, status, latitude, N/S, longitude, E/W, speed, course, date
+  { _GPS_FIELD_NONE, _GPS_FIELD_TIME, _GPS_FIELD_STATUS, _GPS_FIELD_LAT, _GPS_FIELD_NS,
+    _GPS_FIELD_LON, _GPS_FIELD_EW, _GPS_FIELD_SPEED, _GPS_FIELD_COURSE, _GPS_FIELD_DATE },
+  // GSA: selection mode, fix mode, 12 satellites used, PDOP, HDOP, VDOP
+  { _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_FIX_MODE,
+    _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE,
+    _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE,
+    _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE,
+    _GPS_FIELD_PDOP, _GPS_FIELD_HDOP, _GPS_FIELD_VDOP },
+  // GSV: messages, message number, satellites in view, then 4 terms per satellite
+  { _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_IN_VIEW },
+  // VTG: true course, T, magnetic course, M, speed in knots, N, km/h, K, mode
+  { _GPS_FIELD_NONE, _GPS_FIELD_COURSE, _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE,
+    _GPS_FIELD_VTG_SPEED, _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_NONE, _GPS_FIELD_VTG_MODE }
+};
 
 TinyGPS::TinyGPS()
   :  _time(GPS_INVALID_TIME)
@@ -35,11 +69,15 @@ TinyGPS::TinyGPS()
   ,  _course(GPS_INVALID_ANGLE)
   ,  _hdop(GPS_INVALID_HDOP)
   ,  _numsats(GPS_INVALID_SATELLITES)
+  ,  _pdop(GPS_INVALID_DOP)
+  ,  _vdop(GPS_INVALID_DOP)
+  ,  _fix_mode(GPS_INVALID_FIX_MODE)
   ,  _last_time_fix(GPS_INVALID_FIX_TIME)
   ,  _last_position_fix(GPS_INVALID_FIX_TIME)
   ,  _parity(0)
   ,  _is_checksum_term(false)
   ,  _sentence_type(_GPS_SENTENCE_OTHER)
+  ,  _talker(0)
   ,  _term_number(0)
   ,  _term_offset(0)
   ,  _gps_data_good(false)
@@ -50,6 +88,8 @@ TinyGPS::TinyGPS()
 #endif
 {
   _term[0] = '\0';
+  for (byte i=0; i<_GPS_TALKERS; ++i)
+    _sats_in_view[i] = GPS_INVALID_SATELLITES;
 }
 
 //
@@ -98,6 +138,21 @@ bool TinyGPS::encode(char c)
   return valid_sentence;
 }
 
+unsigned short TinyGPS::satellites_in_view()
+{
+  unsigned short sats = 0;
+  bool seen = false;
+  for (byte i=0; i<_GPS_TALKERS; ++i)
+  {
+    if (_sats_in_view[i] != GPS_INVALID_SATELLITES)
+    {
+      sats += _sats_in_view[i];
+      seen = true;
+    }
+  }
+  return seen ? sats : GPS_INVALID_SATELLITES;
+}
+
 #ifndef _GPS_NO_STATS
 void TinyGPS::stats(unsigned long *chars, unsigned short *sentences, unsigned short *failed_cs)
 {
@@ -157,7 +212,26 @@ unsigned long TinyGPS::parse_degrees()
   return (left / 100) * 100000 + tenk_minutes / 6;
 }
 
-#define COMBINE(sentence_type, term_number) (((unsigned)(sentence_type) << 5) | term_number)
+// Finds the sentence type and the talker from the first term
+byte TinyGPS::sentence_type()
+{
+  // "GPRMC" and the like: G, the constellation, then the sentence
+  if (_term_offset != 5 || _term[0] != 'G')
+    return _GPS_SENTENCE_OTHER;
+  for (_talker = 0; _talker < _GPS_TALKERS; ++_talker)
+    if (_term[1] == (char)pgm_read_byte(&_gps_talkers[_talker]))
+      break;
+  if (_talker == _GPS_TALKERS)
+    return _GPS_SENTENCE_OTHER;
+
+  const char *id = _gps_sentences;
+  for (byte type = 0; type < _GPS_SENTENCE_OTHER; ++type, id += 3)
+    if (_term[2] == (char)pgm_read_byte(id) &&
+        _term[3] == (char)pgm_read_byte(id + 1) &&
+        _term[4] == (char)pgm_read_byte(id + 2))
+      return type;
+  return _GPS_SENTENCE_OTHER;
+}
 
 // Processes a just-completed term
 // Returns true if new sentence has just passed checksum test and is validated
@@ -173,12 +247,11 @@ bool TinyGPS::term_complete()
 #ifndef _GPS_NO_STATS
         ++_good_sentences;
 #endif
-        _last_time_fix = _new_time_fix;
-        _last_position_fix = _new_position_fix;
-
         switch(_sentence_type)
         {
-        case _GPS_SENTENCE_GPRMC:
+        case _GPS_SENTENCE_RMC:
+          _last_time_fix = _new_time_fix;
+          _last_position_fix = _new_position_fix;
           _time      = _new_time;
           _date      = _new_date;
           _latitude  = _new_latitude;
@@ -186,7 +259,9 @@ bool TinyGPS::term_complete()
           _speed     = _new_speed;
           _course    = _new_course;
           break;
-        case _GPS_SENTENCE_GPGGA:
+        case _GPS_SENTENCE_GGA:
+          _last_time_fix = _new_time_fix;
+          _last_position_fix = _new_position_fix;
           _altitude  = _new_altitude;
           _time      = _new_time;
           _latitude  = _new_latitude;
@@ -194,6 +269,19 @@ bool TinyGPS::term_complete()
           _numsats   = _new_numsats;
           _hdop      = _new_hdop;
           break;
+        case _GPS_SENTENCE_GSA:
+          _fix_mode  = _new_fix_mode;
+          _pdop      = _new_pdop;
+          _hdop      = _new_hdop;
+          _vdop      = _new_vdop;
+          break;
+        case _GPS_SENTENCE_GSV:
+          _sats_in_view[_talker] = _new_sats_in_view;
+          break;
+        case _GPS_SENTENCE_VTG:
+          _speed     = _new_speed;
+          _course    = _new_course;
+          break;
         }
 
         return true;
@@ -210,66 +298,87 @@ bool TinyGPS::term_complete()
   // the first term determines the sentence type
   if (_term_number == 0)
   {
-    if (!gpsstrcmp(_term, _GPRMC_TERM))
-      _sentence_type = _GPS_SENTENCE_GPRMC;
-    else if (!gpsstrcmp(_term, _GPGGA_TERM))
-      _sentence_type = _GPS_SENTENCE_GPGGA;
-    else
-      _sentence_type = _GPS_SENTENCE_OTHER;
+    _sentence_type = sentence_type();
+    if (_sentence_type == _GPS_SENTENCE_GSA)
+    {
+      // valid with or without a fix, the DOPs are empty without one
+      _new_fix_mode = GPS_INVALID_FIX_MODE;
+      _new_pdop = _new_hdop = _new_vdop = GPS_INVALID_DOP;
+      _gps_data_good = true;
+    }
+    else if (_sentence_type == _GPS_SENTENCE_GSV)
+    {
+      _gps_data_good = true;
+    }
     return false;
   }
 
-  if (_sentence_type != _GPS_SENTENCE_OTHER && _term[0])
-    switch(COMBINE(_sentence_type, _term_number))
+  if (_sentence_type != _GPS_SENTENCE_OTHER && _term[0] && _term_number < _GPS_MAX_TERMS)
+    switch(pgm_read_byte(&_gps_fields[_sentence_type][_term_number]))
   {
-    case COMBINE(_GPS_SENTENCE_GPRMC, 1): // Time in both sentences
-    case COMBINE(_GPS_SENTENCE_GPGGA, 1):
+    case _GPS_FIELD_TIME:
       _new_time = parse_decimal();
       _new_time_fix = millis();
       break;
-    case COMBINE(_GPS_SENTENCE_GPRMC, 2): // GPRMC validity
+    case _GPS_FIELD_STATUS: // RMC validity
       _gps_data_good = _term[0] == 'A';
       break;
-    case COMBINE(_GPS_SENTENCE_GPRMC, 3): // Latitude
-    case COMBINE(_GPS_SENTENCE_GPGGA, 2):
+    case _GPS_FIELD_LAT:
       _new_latitude = parse_degrees();
       _new_position_fix = millis();
       break;
-    case COMBINE(_GPS_SENTENCE_GPRMC, 4): // N/S
-    case COMBINE(_GPS_SENTENCE_GPGGA, 3):
+    case _GPS_FIELD_NS:
       if (_term[0] == 'S')
         _new_latitude = -_new_latitude;
       break;
-    case COMBINE(_GPS_SENTENCE_GPRMC, 5): // Longitude
-    case COMBINE(_GPS_SENTENCE_GPGGA, 4):
+    case _GPS_FIELD_LON:
       _new_longitude = parse_degrees();
       break;
-    case COMBINE(_GPS_SENTENCE_GPRMC, 6): // E/W
-    case COMBINE(_GPS_SENTENCE_GPGGA, 5):
+    case _GPS_FIELD_EW:
       if (_term[0] == 'W')
         _new_longitude = -_new_longitude;
       break;
-    case COMBINE(_GPS_SENTENCE_GPRMC, 7): // Speed (GPRMC)
+    case _GPS_FIELD_VTG_SPEED: // VTG is valid when it has a speed
+      _gps_data_good = true;
+      // fall through
+    case _GPS_FIELD_SPEED:
       _new_speed = parse_decimal();
       break;
-    case COMBINE(_GPS_SENTENCE_GPRMC, 8): // Course (GPRMC)
+    case _GPS_FIELD_COURSE:
       _new_course = parse_decimal();
       break;
-    case COMBINE(_GPS_SENTENCE_GPRMC, 9): // Date (GPRMC)
+    case _GPS_FIELD_DATE:
       _new_date = gpsatol(_term);
       break;
-    case COMBINE(_GPS_SENTENCE_GPGGA, 6): // Fix data (GPGGA)
+    case _GPS_FIELD_QUALITY: // GGA validity
       _gps_data_good = _term[0] > '0';
       break;
-    case COMBINE(_GPS_SENTENCE_GPGGA, 7): // Satellites used (GPGGA)
+    case _GPS_FIELD_SATS:
       _new_numsats = (unsigned char)atoi(_term);
       break;
-    case COMBINE(_GPS_SENTENCE_GPGGA, 8): // HDOP
+    case _GPS_FIELD_HDOP:
       _new_hdop = parse_decimal();
       break;
-    case COMBINE(_GPS_SENTENCE_GPGGA, 9): // Altitude (GPGGA)
+    case _GPS_FIELD_ALT:
       _new_altitude = parse_decimal();
       break;
+    case _GPS_FIELD_FIX_MODE:
+      if (_term[0] >= '1' && _term[0] <= '3')
+        _new_fix_mode = _term[0] - '0';
+      break;
+    case _GPS_FIELD_PDOP:
+      _new_pdop = parse_decimal();
+      break;
+    case _GPS_FIELD_VDOP:
+      _new_vdop = parse_decimal();
+      break;
+    case _GPS_FIELD_IN_VIEW:
+      _new_sats_in_view = (byte)gpsatol(_term);
+      break;
+    case _GPS_FIELD_VTG_MODE: // NMEA 2.3 mode, N when not valid
+      if (_term[0] == 'N')
+        _gps_data_good = false;
+      break;
   }
 
   return false;
@@ -283,12 +392,6 @@ long TinyGPS::gpsatol(const char *str)
   return ret;
 }
 
-int TinyGPS::gpsstrcmp(const char *str1, const char *str2)
-{
-  while (*str1 && *str1 == *str2)
-    ++str1, ++str2;
-  return *str1;
-}
 
 /* static */
 float TinyGPS::distance_between (float lat1, float long1, float lat2, float long2) 
@@ -344,6 +447,135 @@ const char *TinyGPS::cardinal (float course)
   return directions[direction % 16];
 }
 
+// Cosine in 65536ths for every whole degree from 0 to 90
+static const unsigned short _gps_cos[91] PROGMEM = {
+  65535, 65526, 65496, 65446, 65376, 65287, 65177, 65048, 64898, 64729,
+  64540, 64332, 64104, 63856, 63589, 63303, 62997, 62672, 62328, 61966,
+  61584, 61183, 60764, 60326, 59870, 59396, 58903, 58393, 57865, 57319,
+  56756, 56175, 55578, 54963, 54332, 53684, 53020, 52339, 51643, 50931,
+  50203, 49461, 48703, 47930, 47143, 46341, 45525, 44695, 43852, 42995,
+  42126, 41243, 40348, 39441, 38521, 37590, 36647, 35693, 34729, 33754,
+  32768, 31772, 30767, 29753, 28729, 27697, 26656, 25607, 24550, 23486,
+  22415, 21336, 20252, 19161, 18064, 16962, 15855, 14742, 13626, 12505,
+  11380, 10252, 9121, 7987, 6850, 5712, 4572, 3430, 2287, 1144,
+  0
+};
+
+// Arctangent of i/32 in 100ths of a degree, for i from 0 to 32
+static const unsigned short _gps_atan[33] PROGMEM = {
+  0, 179, 358, 536, 713, 888, 1062, 1234, 1404, 1571, 1735,
+  1897, 2056, 2211, 2363, 2511, 2657, 2798, 2936, 3070, 3201, 3327,
+  3451, 3571, 3687, 3800, 3909, 4016, 4119, 4218, 4315, 4409, 4500
+};
+
+static unsigned long gpsisqrt(unsigned long n)
+{
+  unsigned long root = 0, bit = 1UL << 30;
+  while (bit > n)
+    bit >>= 2;
+  while (bit)
+  {
+    if (n >= root + bit)
+    {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+      root >>= 1;
+    bit >>= 2;
+  }
+  return root;
+}
+
+// Projects position 2 onto a flat map centered on position 1, with the
+// longitude scaled by the cosine of the mean latitude of the two: x east and
+// y north in hundred thousandths of a degree of latitude, scaled by 2^-shift
+// so that the larger of the two has 15 bits. Returns the shift.
+int TinyGPS::equirectangular(long lat1, long long1, long lat2, long long2, long *x, long *y)
+{
+  long dlon = long2 - long1;
+  if (dlon > 18000000L)
+    dlon -= 36000000L;
+  else if (dlon < -18000000L)
+    dlon += 36000000L;
+  long dlat = lat2 - lat1;
+
+  unsigned long east = labs(dlon), north = labs(dlat);
+  int shift = 0;
+  if (east || north)
+  {
+    while (east >= 32768 || north >= 32768)
+    {
+      east >>= 1;
+      north >>= 1;
+      ++shift;
+    }
+    while (east < 16384 && north < 16384)
+    {
+      east <<= 1;
+      north <<= 1;
+      --shift;
+    }
+  }
+
+  // cosine of the mean latitude, between the whole degrees around it
+  unsigned long lat = labs(lat1 + lat2) / 2;
+  byte deg = lat / 100000;
+  unsigned long cosine = pgm_read_word(&_gps_cos[deg]);
+  if (deg < 90)
+    cosine -= (cosine - pgm_read_word(&_gps_cos[deg + 1])) * (lat - deg * 100000UL) / 100000;
+  east = (east * cosine) >> 16;
+
+  *x = dlon < 0 ? -(long)east : (long)east;
+  *y = dlat < 0 ? -(long)north : (long)north;
+  return shift;
+}
+
+/* static */
+unsigned long TinyGPS::distance_between_fixed (long lat1, long long1, long lat2, long long2)
+{
+  // returns distance in meters between two positions in hundred thousandths
+  // of a degree, on the sphere distance_between() uses. Flattens the sphere
+  // around the mean latitude, so the error grows with the distance.
+  long x, y;
+  int shift = equirectangular(lat1, long1, lat2, long2, &x, &y);
+  // 1.112263 m per hundred thousandth of a degree, in 65536ths
+  unsigned long meters = gpsisqrt(x * x + y * y) * 72893UL;
+  if (shift >= 0)
+    return ((meters + 0x8000) >> 16) << shift;
+  return (meters + (1UL << (15 - shift))) >> (16 - shift);
+}
+
+/* static */
+unsigned short TinyGPS::course_to_fixed (long lat1, long long1, long lat2, long long2)
+{
+  // returns course in 100ths of a degree (North=0, West=27000) from position 1
+  // to position 2, both in hundred thousandths of a degree. The course at the
+  // mean latitude, as distance_between_fixed() flattens the sphere there.
+  long x, y;
+  equirectangular(lat1, long1, lat2, long2, &x, &y);
+  unsigned long ax = labs(x), ay = labs(y);
+  if (ax == 0 && ay == 0)
+    return 0;
+
+  // angle off the north-south axis, from the arctangent of the smaller
+  // side over the larger
+  bool steep = ax > ay;
+  unsigned long ratio = steep ? (ay << 16) / ax : (ax << 16) / ay;
+  byte i = ratio >> 11;
+  unsigned short course = pgm_read_word(&_gps_atan[i]);
+  if (i < 32)
+    course += ((pgm_read_word(&_gps_atan[i + 1]) - course) * (ratio & 0x7FF)) >> 11;
+  if (steep)
+    course = 9000 - course;
+
+  if (y < 0)
+    course = 18000 - course;
+  if (x < 0)
+    course = 36000 - course;
+  return course == 36000 ? 0 : course;
+}
+
 // lat/long in hundred thousandths of a degree and age of fix in milliseconds
 void TinyGPS::get_position(long *latitude, long *longitude, unsigned long *fix_age)
 {
@@ -29,12 +29,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "WProgram.h"
 #endif
 
-#define _GPS_VERSION 12 // software version of this library
+#define _GPS_VERSION 13 // software version of this library
 #define _GPS_MPH_PER_KNOT 1.15077945
 #define _GPS_MPS_PER_KNOT 0.51444444
 #define _GPS_KMPH_PER_KNOT 1.852
 #define _GPS_MILES_PER_METER 0.00062137112
 #define _GPS_KM_PER_METER 0.001
+#define _GPS_TALKERS 5 // GP, GL, GA, GB and GN talkers, for satellites in view
 // #define _GPS_NO_STATS
 
 class TinyGPS
@@ -45,7 +46,9 @@ public:
     GPS_INVALID_ALTITUDE = 999999999,  GPS_INVALID_DATE = 0,
     GPS_INVALID_TIME = 0xFFFFFFFF,		 GPS_INVALID_SPEED = 999999999, 
     GPS_INVALID_FIX_TIME = 0xFFFFFFFF, GPS_INVALID_SATELLITES = 0xFF,
-    GPS_INVALID_HDOP = 0xFFFFFFFF
+    GPS_INVALID_HDOP = 0xFFFFFFFF,     GPS_INVALID_DOP = 0xFFFFFFFF,
+    GPS_INVALID_FIX_MODE = 0,          GPS_FIX_NONE = 1,
+    GPS_FIX_2D = 2,                    GPS_FIX_3D = 3
   };
 
   static const float GPS_INVALID_F_ANGLE, GPS_INVALID_F_ALTITUDE, GPS_INVALID_F_SPEED;
@@ -60,21 +63,31 @@ public:
   // date as ddmmyy, time as hhmmsscc, and age in milliseconds
   void get_datetime(unsigned long *date, unsigned long *time, unsigned long *age = 0);
 
-  // signed altitude in centimeters (from GPGGA sentence)
+  // signed altitude in centimeters (from GGA sentence)
   inline long altitude() { return _altitude; }
 
-  // course in last full GPRMC sentence in 100th of a degree
+  // course in last full RMC or VTG sentence in 100th of a degree
   inline unsigned long course() { return _course; }
 
-  // speed in last full GPRMC sentence in 100ths of a knot
+  // speed in last full RMC or VTG sentence in 100ths of a knot
   inline unsigned long speed() { return _speed; }
 
-  // satellites used in last full GPGGA sentence
+  // satellites used in last full GGA sentence
   inline unsigned short satellites() { return _numsats; }
 
-  // horizontal dilution of precision in 100ths
+  // satellites in view, summed over the constellations seen in GSV sentences
+  unsigned short satellites_in_view();
+
+  // horizontal dilution of precision in 100ths (from GGA or GSA)
   inline unsigned long hdop() { return _hdop; }
 
+  // position and vertical dilution of precision in 100ths (from GSA)
+  inline unsigned long pdop() { return _pdop; }
+  inline unsigned long vdop() { return _vdop; }
+
+  // GPS_FIX_NONE, GPS_FIX_2D or GPS_FIX_3D (from GSA)
+  inline byte fix_mode() { return _fix_mode; }
+
   void f_get_position(float *latitude, float *longitude, unsigned long *fix_age = 0);
   void crack_datetime(int *year, byte *month, byte *day, 
     byte *hour, byte *minute, byte *second, byte *hundredths = 0, unsigned long *fix_age = 0);
@@ -91,12 +104,25 @@ public:
   static float course_to (float lat1, float long1, float lat2, float long2);
   static const char *cardinal(float course);
 
+  // distance in meters and course in 100ths of a degree between positions
+  // in hundred thousandths of a degree, as get_position() returns them.
+  // Integer only, on a flat projection at the mean latitude.  For use up to
+  // about 100 km: the distance is within 1 m or 0.06% of the great circle
+  // there, but 1.1% off at 1000 km.  The course is the one at the mean
+  // latitude, not the one setting out: up to 0.13 degrees off at 10 km,
+  // 1.1 at 100 km and 12.4 at 1000 km.  Further than that, use
+  // distance_between() and course_to().
+  static unsigned long distance_between_fixed(long lat1, long long1, long lat2, long long2);
+  static unsigned short course_to_fixed(long lat1, long long1, long lat2, long long2);
+
 #ifndef _GPS_NO_STATS
   void stats(unsigned long *chars, unsigned short *good_sentences, unsigned short *failed_cs);
 #endif
 
 private:
-  enum {_GPS_SENTENCE_GPGGA, _GPS_SENTENCE_GPRMC, _GPS_SENTENCE_OTHER};
+  // in the order of the sentence table in TinyGPS.cpp
+  enum {_GPS_SENTENCE_GGA, _GPS_SENTENCE_RMC, _GPS_SENTENCE_GSA,
+        _GPS_SENTENCE_GSV, _GPS_SENTENCE_VTG, _GPS_SENTENCE_OTHER};
 
   // properties
   unsigned long _time, _new_time;
@@ -108,6 +134,10 @@ private:
   unsigned long  _course, _new_course;
   unsigned long  _hdop, _new_hdop;
   unsigned short _numsats, _new_numsats;
+  unsigned long  _pdop, _new_pdop;
+  unsigned long  _vdop, _new_vdop;
+  byte _fix_mode, _new_fix_mode;
+  byte _sats_in_view[_GPS_TALKERS], _new_sats_in_view;
 
   unsigned long _last_time_fix, _new_time_fix;
   unsigned long _last_position_fix, _new_position_fix;
@@ -117,6 +147,7 @@ private:
   bool _is_checksum_term;
   char _term[15];
   byte _sentence_type;
+  byte _talker;
   byte _term_number;
   byte _term_offset;
   bool _gps_data_good;
@@ -136,7 +167,8 @@ private:
   bool term_complete();
   bool gpsisdigit(char c) { return c >= '0' && c <= '9'; }
   long gpsatol(const char *str);
-  int gpsstrcmp(const char *str1, const char *str2);
+  byte sentence_type();
+  static int equirectangular(long lat1, long long1, long lat2, long long2, long *x, long *y);
 };
 
 #if !defined(ARDUINO) 
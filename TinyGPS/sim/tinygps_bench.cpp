@@ -0,0 +1,557 @@
+/*
+ * Host checks and replay benchmark for the TinyGPS sentence parser
+ *
+ * Generates NMEA logs for two receivers: a GPS-only one sending $GPRMC,
+ * $GPGGA, $GPGSA and $GPGSV, and a GPS+GLONASS one sending $GNRMC,
+ * $GNVTG, $GNGGA, two $GNGSA, $GPGSV, $GLGSV and $GNGLL, with a few
+ * epochs without a fix and some corrupted checksums.  Every value
+ * TinyGPS reports is checked against the generator after each epoch,
+ * and after every sentence of the GPS-only log against the old parser
+ * kept in tinygps_legacy.h.  A few hand-written sentences cover the odd
+ * cases.  Then checks distance_between_fixed() and course_to_fixed()
+ * against a double precision great circle, next to the float versions.
+ *
+ * Replays the logs to print sentences per second and nanoseconds per
+ * character, before and after; a recorded log given as argument is
+ * replayed as well.  Exits non-zero on any mismatch.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <TinyGPS.h>
+#include "tinygps_legacy.h"
+
+unsigned long simMillis;
+
+static unsigned int errors;
+
+#define CHECK(name, got, expected) check(name, (long)(got), (long)(expected))
+
+static void check(const char *name, long got, long expected)
+{
+    if (got != expected)
+    {
+        if (errors < 20)
+            printf("%-28s %ld, expected %ld\n", name, got, expected);
+        errors++;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Log generator
+
+static std::string sentence(const char *body, bool corrupt = false)
+{
+    byte parity = 0;
+    for (const char *p = body; *p; p++)
+        parity ^= *p;
+    char tail[8];
+    snprintf(tail, sizeof(tail), "*%02X\r\n", corrupt ? parity ^ 0x10 : parity);
+    return std::string("$") + body + tail;
+}
+
+// Angles in ten thousandths of a minute, as the receivers print them
+static std::string angle(long tenk, int degreeDigits)
+{
+    char s[32];
+    tenk = labs(tenk);
+    snprintf(s, sizeof(s), "%0*ld%02ld.%04ld", degreeDigits, tenk / 600000,
+             (tenk % 600000) / 10000, tenk % 10000);
+    return s;
+}
+
+// The same angle in hundred thousandths of a degree
+static long fixed(long tenk)
+{
+    long a = labs(tenk);
+    a = (a / 600000) * 100000 + (a % 600000) / 6;
+    return tenk < 0 ? -a : a;
+}
+
+struct Truth
+{
+    long lat, lon, altitude;
+    unsigned long time, date, speed, course, hdop, pdop, vdop;
+    unsigned short sats, inView;
+    byte fixMode;
+    bool fix;
+};
+
+struct Epoch
+{
+    std::string text;
+    Truth truth;
+};
+
+static std::vector<Epoch> generate(bool gnss, int epochs)
+{
+    std::vector<Epoch> log;
+    const char *t = gnss ? "GN" : "GP";
+    // Sydney for the GNSS receiver, Austin for the GPS one
+    long lat = gnss ? -(33 * 600000L + 523456L) : 30 * 600000L + 145527L;
+    long lon = gnss ? 151 * 600000L + 123456L : -(97 * 600000L + 495808L);
+    srand(gnss ? 2 : 1);
+
+    for (int e = 0; e < epochs; e++)
+    {
+        Epoch ep;
+        Truth& tr = ep.truth;
+        char b[200], gsa[120];
+        const int noFix = gnss ? 4 : 2;
+        tr.fix = e >= noFix;
+
+        lat += rand() % 61 - 30;
+        lon += rand() % 61 - 30;
+        tr.lat = fixed(lat);
+        tr.lon = fixed(lon);
+        const unsigned long s = 12 * 3600 + e;
+        tr.time = (s / 3600) * 1000000 + (s / 60 % 60) * 10000 + s % 60 * 100;
+        tr.date = 150326;
+        tr.speed = rand() % 6000;
+        tr.course = rand() % 36000;
+        tr.altitude = (rand() % 20000 - 2000) * 10;
+        tr.sats = 4 + rand() % 12;
+        tr.hdop = 60 + rand() % 200;
+        tr.pdop = tr.hdop + 30 + rand() % 100;
+        tr.vdop = 50 + rand() % 200;
+        tr.fixMode = tr.fix ? (e % 7 ? TinyGPS::GPS_FIX_3D : TinyGPS::GPS_FIX_2D) : TinyGPS::GPS_FIX_NONE;
+        tr.inView = gnss ? 11 + 7 : 10;
+
+        const std::string la = angle(lat, 2), lo = angle(lon, 3);
+        const char ns = lat < 0 ? 'S' : 'N', ew = lon < 0 ? 'W' : 'E';
+        char hms[16];
+        snprintf(hms, sizeof(hms), "%02lu%02lu%02lu.00", s / 3600, s / 60 % 60, s % 60);
+
+        if (tr.fix)
+            snprintf(b, sizeof(b), "%sRMC,%s,A,%s,%c,%s,%c,%lu.%02lu,%lu.%02lu,150326,,,A", t, hms,
+                     la.c_str(), ns, lo.c_str(), ew, tr.speed / 100, tr.speed % 100,
+                     tr.course / 100, tr.course % 100);
+        else
+            snprintf(b, sizeof(b), "%sRMC,%s,V,,,,,,,150326,,,N", t, hms);
+        ep.text += sentence(b, e == 9);
+
+        if (gnss)
+        {
+            if (tr.fix)
+                snprintf(b, sizeof(b), "GNVTG,%lu.%02lu,T,,M,%lu.%02lu,N,%lu.%02lu,K,A",
+                         tr.course / 100, tr.course % 100, tr.speed / 100, tr.speed % 100,
+                         tr.speed * 1852 / 100000, tr.speed * 1852 / 1000 % 100);
+            else
+                snprintf(b, sizeof(b), "GNVTG,,T,,M,,N,,K,N");
+            ep.text += sentence(b);
+        }
+
+        if (tr.fix)
+            snprintf(b, sizeof(b), "%sGGA,%s,%s,%c,%s,%c,1,%02u,%lu.%02lu,%s%ld.%ld,M,-22.5,M,,", t, hms,
+                     la.c_str(), ns, lo.c_str(), ew, tr.sats, tr.hdop / 100, tr.hdop % 100,
+                     tr.altitude < 0 ? "-" : "", labs(tr.altitude) / 100, labs(tr.altitude) / 10 % 10);
+        else
+            snprintf(b, sizeof(b), "%sGGA,%s,,,,,0,00,99.99,,,,,,", t, hms);
+        ep.text += sentence(b, e == 13);
+
+        // One GSA per constellation on the GNSS receiver, with the
+        // NMEA 4.1 system ID at the end
+        for (int c = 0; c < (gnss ? 2 : 1); c++)
+        {
+            if (tr.fix)
+                snprintf(gsa, sizeof(gsa), "%sGSA,A,%u,%s,%lu.%02lu,%lu.%02lu,%lu.%02lu%s", t,
+                         tr.fixMode, c ? "65,72,81,82,88,,,,,,," : "05,13,15,18,20,24,29,,,,,",
+                         tr.pdop / 100, tr.pdop % 100, tr.hdop / 100, tr.hdop % 100,
+                         tr.vdop / 100, tr.vdop % 100, gnss ? (c ? ",2" : ",1") : "");
+            else
+                snprintf(gsa, sizeof(gsa), "%sGSA,A,1,,,,,,,,,,,,,,,%s", t, gnss ? (c ? ",2" : ",1") : "");
+            ep.text += sentence(gsa);
+        }
+
+        static const char *gpgsv[] = {
+            "GPGSV,3,1,%u,05,58,097,45,13,21,182,38,15,38,295,41,18,64,022,47",
+            "GPGSV,3,2,%u,20,12,134,30,24,45,273,44,29,17,310,35,26,04,040,",
+            "GPGSV,3,3,%u,10,02,205,,12,08,355,",
+        };
+        static const char *glgsv[] = {
+            "GLGSV,2,1,%u,65,40,080,40,72,22,310,36,81,55,150,42,82,31,210,39",
+            "GLGSV,2,2,%u,88,18,020,33,66,03,120,,73,07,290,",
+        };
+        for (int i = 0; i < 3; i++)
+        {
+            snprintf(b, sizeof(b), gpgsv[i], gnss ? 11 : 10);
+            ep.text += sentence(b);
+        }
+        if (gnss)
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                snprintf(b, sizeof(b), glgsv[i], 7);
+                ep.text += sentence(b);
+            }
+            snprintf(b, sizeof(b), "GNGLL,%s,%c,%s,%c,%s,A,A", la.c_str(), ns, lo.c_str(), ew, hms);
+            ep.text += sentence(b);
+        }
+        log.push_back(ep);
+    }
+    return log;
+}
+
+//------------------------------------------------------------------------------
+// Checks
+
+static void feed(TinyGPS& gps, const std::string& text)
+{
+    for (size_t i = 0; i < text.size(); i++)
+        gps.encode(text[i]);
+}
+
+static void checkEpochs(bool gnss)
+{
+    const std::vector<Epoch> log = generate(gnss, 60);
+    TinyGPS gps;
+    Truth last = log[0].truth;
+    bool haveFix = false;
+
+    for (size_t e = 0; e < log.size(); e++)
+    {
+        const Truth& tr = log[e].truth;
+        feed(gps, log[e].text);
+
+        // The corrupted sentences leave the values of the epoch before
+        const bool rmcLost = e == 9, ggaLost = e == 13;
+        long lat, lon;
+        unsigned long date, time;
+        gps.get_position(&lat, &lon);
+        gps.get_datetime(&date, &time);
+        if (tr.fix)
+        {
+            haveFix = true;
+            CHECK("latitude", lat, tr.lat);
+            CHECK("longitude", lon, tr.lon);
+            CHECK("time", time, tr.time);
+            if (!rmcLost)
+            {
+                CHECK("date", date, tr.date);
+                CHECK("speed", gps.speed(), tr.speed);
+                CHECK("course", gps.course(), tr.course);
+            }
+            CHECK("altitude", gps.altitude(), ggaLost ? last.altitude : tr.altitude);
+            CHECK("satellites", gps.satellites(), ggaLost ? last.sats : tr.sats);
+            CHECK("pdop", gps.pdop(), tr.pdop);
+            CHECK("hdop", gps.hdop(), tr.hdop);
+            CHECK("vdop", gps.vdop(), tr.vdop);
+            last = tr;
+        }
+        else if (!haveFix)
+        {
+            CHECK("no fix latitude", lat, TinyGPS::GPS_INVALID_ANGLE);
+            CHECK("no fix speed", gps.speed(), TinyGPS::GPS_INVALID_SPEED);
+            CHECK("no fix pdop", gps.pdop(), TinyGPS::GPS_INVALID_DOP);
+            CHECK("no fix hdop", gps.hdop(), TinyGPS::GPS_INVALID_DOP);
+        }
+        CHECK("fix mode", gps.fix_mode(), tr.fixMode);
+        CHECK("satellites in view", gps.satellites_in_view(), tr.inView);
+    }
+
+    unsigned long chars;
+    unsigned short good, failed;
+    gps.stats(&chars, &good, &failed);
+    CHECK("failed checksums", failed, 2);
+}
+
+// Old and new parser agree on every value the old one has, sentence by
+// sentence, on the log it understands.
+static void checkAgainstLegacy()
+{
+    const std::vector<Epoch> log = generate(false, 60);
+    TinyGPS gps;
+    LegacyTinyGPS legacy;
+
+    for (size_t e = 0; e < log.size(); e++)
+    {
+        const std::string& text = log[e].text;
+        for (size_t i = 0; i < text.size(); i++)
+        {
+            simMillis = e * 1000 + i;
+            const bool a = gps.encode(text[i]);
+            const bool b = legacy.encode(text[i]);
+            // GSA and GSV are new sentences
+            if (b)
+                CHECK("legacy sentence", a, b);
+            if (text[i] != '\n')
+                continue;
+
+            long lat1, lon1, lat2, lon2;
+            unsigned long d1, t1, d2, t2, age1, age2;
+            gps.get_position(&lat1, &lon1, &age1);
+            legacy.get_position(&lat2, &lon2, &age2);
+            CHECK("legacy latitude", lat1, lat2);
+            CHECK("legacy longitude", lon1, lon2);
+            CHECK("legacy position age", age1, age2);
+            gps.get_datetime(&d1, &t1, &age1);
+            legacy.get_datetime(&d2, &t2, &age2);
+            CHECK("legacy date", d1, d2);
+            CHECK("legacy time", t1, t2);
+            CHECK("legacy time age", age1, age2);
+            CHECK("legacy altitude", gps.altitude(), legacy.altitude());
+            CHECK("legacy speed", gps.speed(), legacy.speed());
+            CHECK("legacy course", gps.course(), legacy.course());
+            CHECK("legacy satellites", gps.satellites(), legacy.satellites());
+            // except HDOP, which the GSA after the corrupted GGA brings
+            // until the next GGA
+            if (e != 13 && e != 14)
+                CHECK("legacy hdop", gps.hdop(), legacy.hdop());
+        }
+    }
+
+    unsigned long c1, c2;
+    unsigned short g1, g2, f1, f2;
+    gps.stats(&c1, &g1, &f1);
+    legacy.stats(&c2, &g2, &f2);
+    CHECK("legacy failed checksums", f1, f2);
+}
+
+static void checkSentences()
+{
+    {
+        // Old NMEA VTG without mode, then one that is not valid
+        TinyGPS gps;
+        feed(gps, sentence("GPVTG,054.7,T,034.4,M,005.5,N,010.2,K"));
+        CHECK("VTG course", gps.course(), 5470);
+        CHECK("VTG speed", gps.speed(), 550);
+        feed(gps, sentence("GPVTG,100.0,T,,M,1.00,N,1.85,K,N"));
+        CHECK("VTG mode N course", gps.course(), 5470);
+    }
+    {
+        // Galileo and BeiDou talkers add to the view, an unknown one does not
+        TinyGPS gps;
+        CHECK("no GSV yet", gps.satellites_in_view(), TinyGPS::GPS_INVALID_SATELLITES);
+        feed(gps, sentence("GAGSV,1,1,03,02,45,100,40,11,30,200,38,25,60,300,44,7"));
+        feed(gps, sentence("GBGSV,1,1,02,06,45,100,40,19,30,200,38"));
+        feed(gps, sentence("GQGSV,1,1,01,193,45,100,40"));
+        CHECK("GA+GB in view", gps.satellites_in_view(), 5);
+        feed(gps, sentence("GAGSV,1,1,01,02,45,100,40,7"));
+        CHECK("GA updated in view", gps.satellites_in_view(), 3);
+    }
+    {
+        // Proprietary and unknown sentences are ignored, so is a talker
+        // that only looks like one
+        TinyGPS gps;
+        CHECK("PUBX", gps.encode('x'), 0);
+        feed(gps, sentence("PUBX,00,081350.00,4717.113210,N,00833.915187,E,546.589,G3,2.1,2.0,0.007,77.52,0.007,,0.92,1.19,0.77,9,0,0"));
+        feed(gps, sentence("GPZDA,201530.00,04,07,2002,00,00"));
+        feed(gps, sentence("GXRMC,201547.000,A,3014.5527,N,09749.5808,W,0.24,163.05,040109,,"));
+        feed(gps, sentence("GPRMCX,201547.000,A,3014.5527,N,09749.5808,W,0.24,163.05,040109,,"));
+        long lat, lon;
+        gps.get_position(&lat, &lon);
+        CHECK("ignored sentences", lat, TinyGPS::GPS_INVALID_ANGLE);
+        unsigned long chars;
+        unsigned short good, failed;
+        gps.stats(&chars, &good, &failed);
+        CHECK("ignored sentences good", good, 0);
+        CHECK("ignored sentences failed", failed, 0);
+    }
+    {
+        // GLONASS-only position and a 2D GSA
+        TinyGPS gps;
+        feed(gps, sentence("GLGGA,201548.000,3014.5529,S,09749.5808,E,1,07,1.5,225.6,M,-22.5,M,18.8,0000"));
+        feed(gps, sentence("GLGSA,A,2,65,72,81,,,,,,,,,,3.10,2.50,"));
+        long lat, lon;
+        gps.get_position(&lat, &lon);
+        CHECK("GLGGA latitude", lat, -3024254);
+        CHECK("GLGGA longitude", lon, 9782634);
+        CHECK("GLGSA fix mode", gps.fix_mode(), TinyGPS::GPS_FIX_2D);
+        CHECK("GLGSA pdop", gps.pdop(), 310);
+        CHECK("GLGSA hdop", gps.hdop(), 250);
+        CHECK("GLGSA vdop", gps.vdop(), TinyGPS::GPS_INVALID_DOP);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Distance and course
+
+static double refDistance(double lat1, double lon1, double lat2, double lon2)
+{
+    const double r = M_PI / 180;
+    const double a = sin((lat2 - lat1) * r / 2), b = sin((lon2 - lon1) * r / 2);
+    const double h = a * a + cos(lat1 * r) * cos(lat2 * r) * b * b;
+    return 2 * 6372795 * asin(sqrt(h));
+}
+
+static double refCourse(double lat1, double lon1, double lat2, double lon2)
+{
+    const double r = M_PI / 180;
+    const double y = sin((lon2 - lon1) * r) * cos(lat2 * r);
+    const double x = cos(lat1 * r) * sin(lat2 * r) - sin(lat1 * r) * cos(lat2 * r) * cos((lon2 - lon1) * r);
+    const double c = atan2(y, x) / r;
+    return c < 0 ? c + 360 : c;
+}
+
+static double angleError(double a, double b)
+{
+    double d = fabs(a - b);
+    return d > 180 ? 360 - d : d;
+}
+
+struct Pair
+{
+    long lat1, lon1, lat2, lon2;
+};
+
+static std::vector<Pair> pairs(double range, int count)
+{
+    std::vector<Pair> v;
+    for (int i = 0; i < count; i++)
+    {
+        const double lat = (rand() / (double)RAND_MAX - 0.5) * 140;
+        const double lon = (rand() / (double)RAND_MAX - 0.5) * 360;
+        const double d = range * (0.1 + 0.9 * rand() / (double)RAND_MAX) / 6372795;
+        const double c = rand() / (double)RAND_MAX * 2 * M_PI;
+        const double r = M_PI / 180;
+        const double lat2 = asin(sin(lat * r) * cos(d) + cos(lat * r) * sin(d) * cos(c)) / r;
+        double lon2 = lon + atan2(sin(c) * sin(d) * cos(lat * r), cos(d) - sin(lat * r) * sin(lat2 * r)) / r;
+        if (lon2 > 180)
+            lon2 -= 360;
+        else if (lon2 < -180)
+            lon2 += 360;
+        Pair p = { lround(lat * 1e5), lround(lon * 1e5), lround(lat2 * 1e5), lround(lon2 * 1e5) };
+        v.push_back(p);
+    }
+    return v;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static double seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static volatile unsigned long sink;
+
+static void benchDistance()
+{
+    static const double ranges[] = { 1e3, 1e4, 1e5, 1e6 };
+    printf("%-9s %-32s %-32s\n", "distance", "float: max error       course", "fixed: max error       course");
+    srand(3);
+    for (unsigned int r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++)
+    {
+        const std::vector<Pair> v = pairs(ranges[r], 20000);
+        double floatErr = 0, fixedErr = 0, floatMeters = 0, fixedMeters = 0, floatCourse = 0, fixedCourse = 0;
+        for (size_t i = 0; i < v.size(); i++)
+        {
+            const Pair& p = v[i];
+            const float f1 = p.lat1 / 100000.0, g1 = p.lon1 / 100000.0;
+            const float f2 = p.lat2 / 100000.0, g2 = p.lon2 / 100000.0;
+            const double ref = refDistance(p.lat1 / 1e5, p.lon1 / 1e5, p.lat2 / 1e5, p.lon2 / 1e5);
+            const double course = refCourse(p.lat1 / 1e5, p.lon1 / 1e5, p.lat2 / 1e5, p.lon2 / 1e5);
+            const double m1 = fabs(TinyGPS::distance_between(f1, g1, f2, g2) - ref);
+            const double m2 = fabs(TinyGPS::distance_between_fixed(p.lat1, p.lon1, p.lat2, p.lon2) - ref);
+            const double c1 = angleError(TinyGPS::course_to(f1, g1, f2, g2), course);
+            const double c2 = angleError(TinyGPS::course_to_fixed(p.lat1, p.lon1, p.lat2, p.lon2) / 100.0, course);
+            floatMeters = m1 > floatMeters ? m1 : floatMeters;
+            fixedMeters = m2 > fixedMeters ? m2 : fixedMeters;
+            floatErr = m1 / ref > floatErr ? m1 / ref : floatErr;
+            fixedErr = m2 / ref > fixedErr ? m2 / ref : fixedErr;
+            floatCourse = c1 > floatCourse ? c1 : floatCourse;
+            fixedCourse = c2 > fixedCourse ? c2 : fixedCourse;
+        }
+        printf("%6.0f km %8.1f m %7.3f%% %7.3f deg  %8.1f m %7.3f%% %7.3f deg\n", ranges[r] / 1e3,
+               floatMeters, floatErr * 100, floatCourse, fixedMeters, fixedErr * 100, fixedCourse);
+    }
+
+    const std::vector<Pair> v = pairs(1e4, 1000);
+    const int rounds = 1000;
+    Clock::time_point start = Clock::now();
+    for (int n = 0; n < rounds; n++)
+        for (size_t i = 0; i < v.size(); i++)
+        {
+            const Pair& p = v[i];
+            sink += TinyGPS::distance_between(p.lat1 / 100000.0f, p.lon1 / 100000.0f,
+                                              p.lat2 / 100000.0f, p.lon2 / 100000.0f);
+            sink += TinyGPS::course_to(p.lat1 / 100000.0f, p.lon1 / 100000.0f,
+                                       p.lat2 / 100000.0f, p.lon2 / 100000.0f);
+        }
+    const double before = rounds * v.size() / seconds(start);
+
+    start = Clock::now();
+    for (int n = 0; n < rounds; n++)
+        for (size_t i = 0; i < v.size(); i++)
+        {
+            const Pair& p = v[i];
+            sink += TinyGPS::distance_between_fixed(p.lat1, p.lon1, p.lat2, p.lon2);
+            sink += TinyGPS::course_to_fixed(p.lat1, p.lon1, p.lat2, p.lon2);
+        }
+    const double after = rounds * v.size() / seconds(start);
+    printf("distance+course: float %.2f M/s   fixed %.2f M/s\n", before / 1e6, after / 1e6);
+}
+
+//------------------------------------------------------------------------------
+// Replay
+
+template <class GPS>
+static void replay(const char *name, const std::string& text)
+{
+    unsigned long sentences = 0;
+    for (size_t i = 0; i < text.size(); i++)
+        sentences += text[i] == '$';
+
+    const int rounds = 20000000 / text.size() + 1;
+    unsigned long valid = 0;
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        GPS gps;
+        for (size_t i = 0; i < text.size(); i++)
+            valid += gps.encode(text[i]);
+    }
+    const double s = seconds(start);
+    sink += valid;
+    printf("%-22s %8.0f sentences/s  %6.2f ns/char  %lu of %lu sentences used\n", name,
+           rounds * sentences / s, s * 1e9 / rounds / text.size(), valid / rounds, sentences);
+}
+
+static std::string joined(const std::vector<Epoch>& log)
+{
+    std::string text;
+    for (size_t e = 0; e < log.size(); e++)
+        text += log[e].text;
+    return text;
+}
+
+int main(int argc, char **argv)
+{
+    checkSentences();
+    checkEpochs(false);
+    checkEpochs(true);
+    checkAgainstLegacy();
+    printf("parser checks: %s   sizeof LegacyTinyGPS %u, TinyGPS %u\n", errors ? "MISMATCH" : "ok",
+           (unsigned)sizeof(LegacyTinyGPS), (unsigned)sizeof(TinyGPS));
+
+    const std::string gps = joined(generate(false, 600));
+    const std::string gnss = joined(generate(true, 600));
+    replay<LegacyTinyGPS>("before, GPS log", gps);
+    replay<TinyGPS>("after, GPS log", gps);
+    replay<LegacyTinyGPS>("before, GNSS log", gnss);
+    replay<TinyGPS>("after, GNSS log", gnss);
+
+    for (int i = 1; i < argc; i++)
+    {
+        FILE *f = fopen(argv[i], "rb");
+        if (!f)
+        {
+            printf("%s: cannot open\n", argv[i]);
+            return 2;
+        }
+        std::string text;
+        char buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            text.append(buf, n);
+        fclose(f);
+        replay<LegacyTinyGPS>("before, recorded", text);
+        replay<TinyGPS>("after, recorded", text);
+    }
+
+    benchDistance();
+    return errors ? 1 : 0;
+}
@@ -323,9 +323,19 @@
 // majority of RAM that Grbl uses is based on this buffer size. Only increase if there is extra 
 // available RAM, like when re-compiling for a Mega or Sanguino. Or decrease if the Arduino
 // begins to crash due to the lack of available RAM or if the CPU is having trouble keeping
-// up with planning new incoming motions as they are executed. 
+// up with planning new incoming motions as they are executed. Each block uses about 45 bytes.
+// On a Mega2560, up to 128 blocks fit and let dense, short-segment programs run near their
+// programmed feed rates. Must be 255 or less.
 // #define BLOCK_BUFFER_SIZE 18  // Uncomment to override default in planner.h.
 
+// Stores the planner block speeds as unsigned integers in (mm/min)^2, rather than as floats. The
+// planner look-ahead passes, which run over the whole buffer each time a block is added, then only
+// use integer adds and compares instead of AVR soft-float routines. The per-block junction and
+// unit vector calculations remain floating point. The velocity profiles differ from the floating
+// point planner only by rounding, but feed rates are limited to 65535 mm/min and block memory
+// increases by 4 bytes each. Useful when streaming dense, short-segment g-code programs.
+// #define PLANNER_FIXED_POINT // Default disabled. Uncomment to enable.
+
 // Governs the size of the intermediary step segment buffer between the step execution algorithm
 // and the planner blocks. Each segment is set of steps executed at a constant velocity over a
 // fixed time defined by ACCELERATION_TICKS_PER_SECOND. They are computed such that the planner
@@ -343,6 +353,15 @@
 // support up to 256 characters. In future versions, this default will be increased, when 
 // we know how much extra memory space we can re-invest into this.
 // #define LINE_BUFFER_SIZE 80  // Uncomment to override default in protocol.h
+
+// Pre-lexes the incoming lines that follow the executing line into g-code words and values,
+// while the main program waits on a full planner buffer. When the planner frees a block, the next
+// line is then executed without parsing its numbers, which shortens the time to refill the planner
+// when streaming dense, short-segment programs. Responses are still sent in order as each line is
+// executed. Uses PRELEX_BUFFER_LINES*(LINE_BUFFER_SIZE+1) bytes of RAM, which is more than the 
+// Arduino Uno has available. Lines are stored unlexed with REPORT_ECHO_LINE_RECEIVED enabled.
+// #define GCODE_PRELEXER // Default disabled. Uncomment to enable.
+// #define PRELEX_BUFFER_LINES 4 // Uncomment to override default in protocol.h
   
 // Serial send and receive buffer size. The receive buffer is often used as another streaming
 // buffer to store incoming blocks to be processed by Grbl when its ready. Most streaming
@@ -65,13 +65,56 @@ static uint8_t gc_check_same_position(float *pos_a, float *pos_b)
   }
   return(true);
 }
+
+
+// Imports the next g-code word from the line, expecting a letter followed by a value. Returns
+// STATUS_OK or the word format error. Shared by the parser and the pre-lexer.
+static uint8_t gc_read_word(char *line, uint8_t *char_counter, char *letter, float *value)
+{
+  *letter = line[*char_counter];
+  if((*letter < 'A') || (*letter > 'Z')) { FAIL(STATUS_EXPECTED_COMMAND_LETTER); } // [Expected word letter]
+  (*char_counter)++;
+  if (!read_float(line, char_counter, value)) { FAIL(STATUS_BAD_NUMBER_FORMAT); } // [Expected word value]
+  return(STATUS_OK);
+}
+
+
+#ifdef GCODE_PRELEXER
+// Pre-lexes one line, formatted as for gc_execute_line(), into a sequence of words for 
+// gc_execute_words(). Each word is stored as its letter followed by its float value, and the 
+// sequence ends with a zero byte. Returns the number of bytes written, or zero if the line has
+// a word format error or does not fit in size bytes. The line is then executed as text, so any
+// error is reported when the line is executed.
+uint8_t gc_lex_line(char *line, uint8_t *words, uint8_t size)
+{
+  uint8_t char_counter = 0;
+  uint8_t count = 0;
+  char letter;
+  float value;
+  while (line[char_counter] != 0) {
+    if (count+1+sizeof(float) >= size) { return(0); } // Leave room for the end byte.
+    if (gc_read_word(line, &char_counter, &letter, &value)) { return(0); }
+    words[count++] = letter;
+    memcpy(&words[count], &value, sizeof(float));
+    count += sizeof(float);
+  }
+  words[count++] = 0;
+  return(count);
+}
+#endif
+
          
 // Executes one line of 0-terminated G-Code. The line is assumed to contain only uppercase
 // characters and signed floating point values (no whitespace). Comments and block delete
 // characters have been removed. In this function, all units and positions are converted and 
 // exported to grbl's internal functions in terms of (mm, mm/min) and absolute machine 
-// coordinates, respectively.
-uint8_t gc_execute_line(char *line) 
+// coordinates, respectively. With the pre-lexer enabled, the block is either a text line or
+// the pre-lexed words of one.
+#ifdef GCODE_PRELEXER
+  static uint8_t gc_execute_block(char *line, uint8_t *words)
+#else
+  uint8_t gc_execute_line(char *line) 
+#endif
 {
   /* -------------------------------------------------------------------------------------
      STEP 1: Initialize parser block struct and copy current g-code state modes. The parser
@@ -108,14 +151,25 @@ uint8_t gc_execute_line(char *line)
   float value;
   uint8_t int_value = 0;
   uint16_t mantissa = 0;
+  uint8_t word_status;
 
-  while (line[char_counter] != 0) { // Loop until no more g-code words in line.
+  for (;;) { // Loop until no more g-code words in line.
     
     // Import the next g-code word, expecting a letter followed by a value. Otherwise, error out.
-    letter = line[char_counter];
-    if((letter < 'A') || (letter > 'Z')) { FAIL(STATUS_EXPECTED_COMMAND_LETTER); } // [Expected word letter]
-    char_counter++;
-    if (!read_float(line, &char_counter, &value)) { FAIL(STATUS_BAD_NUMBER_FORMAT); } // [Expected word value]
+    #ifdef GCODE_PRELEXER
+      if (words != NULL) {
+        // Pre-lexed word. Letter and value format already checked by gc_lex_line().
+        letter = *words++;
+        if (letter == 0) { break; }
+        memcpy(&value, words, sizeof(float));
+        words += sizeof(float);
+      } else
+    #endif
+    {
+      if (line[char_counter] == 0) { break; }
+      word_status = gc_read_word(line, &char_counter, &letter, &value);
+      if (word_status) { FAIL(word_status); }
+    }
 
     // Convert values to smaller uint8 significand and mantissa values for parsing this word.
     // NOTE: Mantissa is multiplied by 100 to catch non-integer command values. This is more 
@@ -1071,6 +1125,13 @@ uint8_t gc_execute_line(char *line)
   // TODO: % to denote start of program.
   return(STATUS_OK);
 }
+
+
+#ifdef GCODE_PRELEXER
+  uint8_t gc_execute_line(char *line) { return(gc_execute_block(line, NULL)); }
+
+  uint8_t gc_execute_words(uint8_t *words) { return(gc_execute_block(NULL, words)); }
+#endif
         
 
 /* 
@@ -206,6 +206,12 @@ void gc_init();
 // Execute one block of rs275/ngc/g-code
 uint8_t gc_execute_line(char *line);
 
+#ifdef GCODE_PRELEXER
+  // Pre-lex one line into words, and execute the pre-lexed words as one block
+  uint8_t gc_lex_line(char *line, uint8_t *words, uint8_t size);
+  uint8_t gc_execute_words(uint8_t *words);
+#endif
+
 // Set g-code parser position. Input in steps.
 void gc_sync_position(); 
 
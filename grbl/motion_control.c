@@ -62,8 +62,12 @@
   do {
     protocol_execute_realtime(); // Check for any run-time commands
     if (sys.abort) { return; } // Bail, if system abort.
-    if ( plan_check_full_buffer() ) { protocol_auto_cycle_start(); } // Auto-cycle start when buffer is full.
-    else { break; }
+    if ( plan_check_full_buffer() ) { 
+      protocol_auto_cycle_start(); // Auto-cycle start when buffer is full.
+      #ifdef GCODE_PRELEXER
+        protocol_prelex(); // Pre-lex the following lines while waiting.
+      #endif
+    } else { break; }
   } while (1);
 
   // Plan and queue motion into planner buffer
@@ -157,6 +161,9 @@
     uint16_t i;
     uint8_t count = 0;
   
+    // The segments all have the same length and junction angle, except for the last. The planner
+    // computes the junction speed once for the arc, rather than for every segment.
+    plan_arc_begin();
     for (i = 1; i<segments; i++) { // Increment (segments-1).
       
       if (count < N_ARC_CORRECTION) {
@@ -189,6 +196,7 @@
       // Bail mid-circle on system abort. Runtime command check already performed by mc_line.
       if (sys.abort) { return; }
     }
+    plan_arc_end();
   }
   // Ensure last segment arrives at target location.
   #ifdef USE_LINE_NUMBERS
@@ -24,6 +24,11 @@
 
 #define MAX_INT_DIGITS 8 // Maximum number of digits in int32 (and float)
 
+// Negative powers of ten, indexed by the number of decimal digits read. Lets read_float() apply
+// the decimal with a single multiplication, since digits past MAX_INT_DIGITS are dropped.
+static const float pow10_neg[MAX_INT_DIGITS+1] PROGMEM = 
+  { 1.0, 1.0e-1, 1.0e-2, 1.0e-3, 1.0e-4, 1.0e-5, 1.0e-6, 1.0e-7, 1.0e-8 };
+
 
 // Extracts a floating point value from a string. The following code is based loosely on
 // the avr-libc strtod() function by Michael Stumpf and Dmitry Xmelkov and many freely
@@ -79,15 +84,11 @@ uint8_t read_float(char *line, uint8_t *char_counter, float *float_ptr)
   float fval;
   fval = (float)intval;
   
-  // Apply decimal. Should perform no more than two floating point multiplications for the
-  // expected range of E0 to E-4.
+  // Apply decimal. Performs a single floating point multiplication for any number of decimal
+  // digits. Integer values, like most command words, skip this entirely.
   if (fval != 0) {
-    while (exp <= -2) {
-      fval *= 0.01; 
-      exp += 2;
-    }
     if (exp < 0) { 
-      fval *= 0.1; 
+      fval *= pgm_read_float(&pow10_neg[-exp]); 
     } else if (exp > 0) {
       do {
         fval *= 10.0;
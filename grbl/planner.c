@@ -31,17 +31,68 @@ static uint8_t block_buffer_head;     // Index of the next block to be pushed
 static uint8_t next_buffer_head;      // Index of the next buffer head
 static uint8_t block_buffer_planned;  // Index of the optimally planned block
 
+// Define arc junction states. Arc segments all share the same junction angle, so the junction speed 
+// factor is computed at the first junction between two segments and reused for the rest of the arc.
+#define PLAN_ARC_NONE       0 // Not streaming an arc. Junctions are computed for every block.
+#define PLAN_ARC_START      1 // Next block is the first arc segment. Junction to the previous motion.
+#define PLAN_ARC_JUNCTION   2 // Next junction is between arc segments. Computed and cached.
+#define PLAN_ARC_CACHED     3 // Arc junction factor cached for the remaining arc segments.
+
 // Define planner variables
 typedef struct {
   int32_t position[N_AXIS];          // The planner position of the tool in absolute steps. Kept separate
                                      // from g-code position for movements requiring multiple line motions,
                                      // i.e. arcs, canned cycles, and backlash compensation.
   float previous_unit_vec[N_AXIS];   // Unit vector of previous path line segment
-  float previous_nominal_speed_sqr;  // Nominal speed of previous path line segment
+  plan_speed_sqr_t previous_nominal_speed_sqr;  // Nominal speed of previous path line segment
+  uint8_t arc_junction;              // Arc junction state. See PLAN_ARC defines.
+  float arc_junction_factor;         // Cached junction speed factor of arc segments in (mm)
 } planner_t;
 static planner_t pl;
 
 
+// Returns the maximum squared speed change over a block at full acceleration. With fixed-point
+// enabled, this is precomputed when the block is added, so the look-ahead passes only add.
+#ifdef PLANNER_FIXED_POINT
+  #define plan_block_speed_sqr_delta(block) ((block)->speed_sqr_delta)
+#else
+  #define plan_block_speed_sqr_delta(block) (2*(block)->acceleration*(block)->millimeters)
+#endif
+
+
+#ifdef PLANNER_FIXED_POINT
+  // Converts a (mm/min)^2 value to a rounded, saturated integer. Negative values are zero.
+  plan_speed_sqr_t plan_speed_sqr_from_float(float speed_sqr)
+  {
+    if (speed_sqr <= 0.0) { return(0); }
+    if (speed_sqr >= (float)PLAN_SPEED_SQR_MAX) { return(PLAN_SPEED_SQR_MAX); }
+    return((plan_speed_sqr_t)(speed_sqr+0.5));
+  }
+
+  // Adds two squared speeds, saturating instead of overflowing.
+  static plan_speed_sqr_t plan_speed_sqr_add(plan_speed_sqr_t a, plan_speed_sqr_t b)
+  {
+    if (a > PLAN_SPEED_SQR_MAX-b) { return(PLAN_SPEED_SQR_MAX); }
+    return(a+b);
+  }
+#else
+  #define plan_speed_sqr_add(a,b) ((a)+(b))
+#endif
+
+
+// Notifies the stepper that the executing tail block has been replanned. The stepper resets the
+// block entry speed to its current speed. With fixed-point enabled, the precomputed speed change 
+// is also refreshed, since the stepper has consumed part of the block distance.
+static void plan_update_exec_block_parameters()
+{
+  st_update_plan_block_parameters();
+  #ifdef PLANNER_FIXED_POINT
+    plan_block_t *block = &block_buffer[block_buffer_tail];
+    block->speed_sqr_delta = plan_speed_sqr_from_float(2*block->acceleration*block->millimeters);
+  #endif
+}
+
+
 // Returns the index of the next block in the ring buffer. Also called by stepper segment buffer.
 uint8_t plan_next_block_index(uint8_t block_index) 
 {
@@ -121,11 +172,13 @@ static uint8_t plan_prev_block_index(uint8_t block_index)
   motion(s) distance per block to a desired tolerance. The more combined distance the planner has to use,
   the faster it can go. (3) Maximize the planner buffer size. This also will increase the combined distance
   for the planner to compute over. It also increases the number of computations the planner has to perform
-  to compute an optimal plan, so select carefully. The Arduino 328p memory is already maxed out, but future
-  ARM versions should have enough memory and speed for look-ahead blocks numbering up to a hundred or more.
+  to compute an optimal plan, so select carefully. The Arduino 328p memory is already maxed out, but the
+  Mega2560 and future ARM versions have enough memory for look-ahead blocks numbering up to a hundred or
+  more. To keep deep buffers fast, the reverse pass also stops at the first block whose entry speed is not
+  changed by the new block, and the forward pass resumes from there.
 
 */
-static void planner_recalculate() 
+static void planner_recalculate(uint8_t replan_all) 
 {   
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = plan_prev_block_index(block_buffer_head);
@@ -136,42 +189,45 @@ static void planner_recalculate()
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
   // NOTE: Forward pass will later refine and correct the reverse pass to create an optimal plan.
-  float entry_speed_sqr;
+  plan_speed_sqr_t entry_speed_sqr;
   plan_block_t *next;
   plan_block_t *current = &block_buffer[block_index];
 
   // Calculate maximum entry speed for last block in buffer, where the exit speed is always zero.
-  current->entry_speed_sqr = min( current->max_entry_speed_sqr, 2*current->acceleration*current->millimeters);
+  current->entry_speed_sqr = min( current->max_entry_speed_sqr, plan_block_speed_sqr_delta(current));
   
   block_index = plan_prev_block_index(block_index);
   if (block_index == block_buffer_planned) { // Only two plannable blocks in buffer. Reverse pass complete.
     // Check if the first block is the tail. If so, notify stepper to update its current parameters.
-    if (block_index == block_buffer_tail) { st_update_plan_block_parameters(); }
+    if (block_index == block_buffer_tail) { plan_update_exec_block_parameters(); }
   } else { // Three or more plan-able blocks
     while (block_index != block_buffer_planned) { 
       next = current;
       current = &block_buffer[block_index];
+
+      // Compute maximum entry speed decelerating over the current block from its exit speed.
+      entry_speed_sqr = plan_speed_sqr_add(next->entry_speed_sqr, plan_block_speed_sqr_delta(current));
+      if (entry_speed_sqr > current->max_entry_speed_sqr) { entry_speed_sqr = current->max_entry_speed_sqr; }
+
+      // A new block can only raise the reverse-planned speeds. If this entry speed is unchanged, it
+      // was not lowered by the last forward pass either, so the blocks before it can't change. Stop
+      // here and begin the forward pass from this block. Keeps the cost of each new block limited
+      // to the blocks it changes, rather than the whole unplanned buffer, for deep planner buffers.
+      // Not valid when the executing block speed has been altered by a feed hold.
+      if ((entry_speed_sqr == current->entry_speed_sqr) && !replan_all) { break; }
+      current->entry_speed_sqr = entry_speed_sqr;
       block_index = plan_prev_block_index(block_index);
 
       // Check if next block is the tail block(=planned block). If so, update current stepper parameters.
-      if (block_index == block_buffer_tail) { st_update_plan_block_parameters(); } 
-
-      // Compute maximum entry speed decelerating over the current block from its exit speed.
-      if (current->entry_speed_sqr != current->max_entry_speed_sqr) {
-        entry_speed_sqr = next->entry_speed_sqr + 2*current->acceleration*current->millimeters;
-        if (entry_speed_sqr < current->max_entry_speed_sqr) {
-          current->entry_speed_sqr = entry_speed_sqr;
-        } else {
-          current->entry_speed_sqr = current->max_entry_speed_sqr;
-        }
-      }
+      if (block_index == block_buffer_tail) { plan_update_exec_block_parameters(); } 
     }
   }    
 
-  // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
-  // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
-  next = &block_buffer[block_buffer_planned]; // Begin at buffer planned pointer
-  block_index = plan_next_block_index(block_buffer_planned); 
+  // Forward Pass: Forward plan the acceleration curve from the planned pointer, or the block where
+  // the reverse pass stopped, onward. Also scans for optimal plan breakpoints and appropriately 
+  // updates the planned pointer.
+  next = &block_buffer[block_index]; // Begin at buffer planned pointer or unchanged block
+  block_index = plan_next_block_index(block_index); 
   while (block_index != block_buffer_head) {
     current = next;
     next = &block_buffer[block_index];
@@ -180,7 +236,7 @@ static void planner_recalculate()
     // pointer forward, since everything before this is all optimal. In other words, nothing
     // can improve the plan from the buffer tail to the planned pointer by logic.
     if (current->entry_speed_sqr < next->entry_speed_sqr) {
-      entry_speed_sqr = current->entry_speed_sqr + 2*current->acceleration*current->millimeters;
+      entry_speed_sqr = plan_speed_sqr_add(current->entry_speed_sqr, plan_block_speed_sqr_delta(current));
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (entry_speed_sqr < next->entry_speed_sqr) {
         next->entry_speed_sqr = entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
@@ -230,7 +286,7 @@ float plan_get_exec_block_exit_speed()
 {
   uint8_t block_index = plan_next_block_index(block_buffer_tail);
   if (block_index == block_buffer_head) { return( 0.0 ); }
-  return( sqrt( block_buffer[block_index].entry_speed_sqr ) ); 
+  return( sqrt( plan_speed_sqr_to_float(block_buffer[block_index].entry_speed_sqr) ) ); 
 }
 
 
@@ -314,8 +370,12 @@ uint8_t plan_check_full_buffer()
   }
   block->millimeters = sqrt(block->millimeters); // Complete millimeters calculation with sqrt()
   
-  // Bail if this is a zero-length block. Highly unlikely to occur.
-  if (block->step_event_count == 0) { return; } 
+  // Bail if this is a zero-length block. Highly unlikely to occur. Arc segments following a dropped
+  // segment no longer share the cached junction angle, so compute their junctions in full.
+  if (block->step_event_count == 0) { 
+    pl.arc_junction = PLAN_ARC_NONE;
+    return; 
+  } 
   
   // Adjust feed_rate value to mm/min depending on type of rate input (normal, inverse time, or rapids)
   // TODO: Need to distinguish a rapids vs feed move for overrides. Some flag of some sort.
@@ -350,8 +410,8 @@ uint8_t plan_check_full_buffer()
   if (block_buffer_head == block_buffer_tail) {
   
     // Initialize block entry speed as zero. Assume it will be starting from rest. Planner will correct this later.
-    block->entry_speed_sqr = 0.0;
-    block->max_junction_speed_sqr = 0.0; // Starting from rest. Enforce start from zero velocity.
+    block->entry_speed_sqr = 0;
+    block->max_junction_speed_sqr = 0; // Starting from rest. Enforce start from zero velocity.
   
   } else {
     /* 
@@ -378,23 +438,37 @@ uint8_t plan_check_full_buffer()
        change the overall maximum entry speed conditions of all blocks.
     */
     // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
-    if (junction_cos_theta > 0.999999) {
+    if (pl.arc_junction == PLAN_ARC_CACHED) {
+      // Junction between two arc segments. Same angle as the first, so only scale by the acceleration.
+      block->max_junction_speed_sqr = plan_speed_sqr_from_float( max( MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED,
+                                   block->acceleration * pl.arc_junction_factor ) );
+    } else if (junction_cos_theta > 0.999999) {
       //  For a 0 degree acute junction, just set minimum junction speed. 
-      block->max_junction_speed_sqr = MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED;
+      block->max_junction_speed_sqr = plan_speed_sqr_from_float(MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED);
+      if (pl.arc_junction == PLAN_ARC_JUNCTION) {
+        pl.arc_junction_factor = 0.0;
+        pl.arc_junction = PLAN_ARC_CACHED;
+      }
     } else {
       junction_cos_theta = max(junction_cos_theta,-0.999999); // Check for numerical round-off to avoid divide by zero.
       float sin_theta_d2 = sqrt(0.5*(1.0-junction_cos_theta)); // Trig half angle identity. Always positive.
 
       // TODO: Technically, the acceleration used in calculation needs to be limited by the minimum of the
       // two junctions. However, this shouldn't be a significant problem except in extreme circumstances.
-      block->max_junction_speed_sqr = max( MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED,
-                                   (block->acceleration * settings.junction_deviation * sin_theta_d2)/(1.0-sin_theta_d2) );
-
+      block->max_junction_speed_sqr = plan_speed_sqr_from_float( max( MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED,
+                                   (block->acceleration * settings.junction_deviation * sin_theta_d2)/(1.0-sin_theta_d2) ) );
+      if (pl.arc_junction == PLAN_ARC_JUNCTION) {
+        pl.arc_junction_factor = (settings.junction_deviation * sin_theta_d2)/(1.0-sin_theta_d2);
+        pl.arc_junction = PLAN_ARC_CACHED;
+      }
     }
   }
 
   // Store block nominal speed
-  block->nominal_speed_sqr = feed_rate*feed_rate; // (mm/min). Always > 0
+  block->nominal_speed_sqr = plan_speed_sqr_from_float(feed_rate*feed_rate); // (mm/min). Always > 0
+  #ifdef PLANNER_FIXED_POINT
+    block->speed_sqr_delta = plan_speed_sqr_from_float(2*block->acceleration*block->millimeters);
+  #endif
   
   // Compute the junction maximum entry based on the minimum of the junction speed and neighboring nominal speeds.
   block->max_entry_speed_sqr = min(block->max_junction_speed_sqr, 
@@ -403,6 +477,7 @@ uint8_t plan_check_full_buffer()
   // Update previous path unit_vector and nominal speed (squared)
   memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec)); // pl.previous_unit_vec[] = unit_vec[]
   pl.previous_nominal_speed_sqr = block->nominal_speed_sqr;
+  if (pl.arc_junction == PLAN_ARC_START) { pl.arc_junction = PLAN_ARC_JUNCTION; } // First arc segment planned.
     
   // Update planner position
   memcpy(pl.position, target_steps, sizeof(target_steps)); // pl.position[] = target_steps[]
@@ -412,7 +487,7 @@ uint8_t plan_check_full_buffer()
   next_buffer_head = plan_next_block_index(block_buffer_head);
   
   // Finish up by recalculating the plan with the new block.
-  planner_recalculate();
+  planner_recalculate(false);
 }
 
 
@@ -438,6 +513,20 @@ void plan_sync_position()
 }
 
 
+// Marks the following blocks as the segments of an arc with equal lengths and junction angles.
+void plan_arc_begin()
+{
+  pl.arc_junction = PLAN_ARC_START;
+}
+
+
+// Ends the arc segments. Called before the last segment, which is shorter than the others.
+void plan_arc_end()
+{
+  pl.arc_junction = PLAN_ARC_NONE;
+}
+
+
 // Returns the number of active blocks are in the planner buffer.
 uint8_t plan_get_block_buffer_count()
 {
@@ -451,7 +540,7 @@ uint8_t plan_get_block_buffer_count()
 void plan_cycle_reinitialize()
 {
   // Re-plan from a complete stop. Reset planner entry speeds and buffer planned pointer.
-  st_update_plan_block_parameters();
+  plan_update_exec_block_parameters();
   block_buffer_planned = block_buffer_tail;
-  planner_recalculate();  
+  planner_recalculate(true);  
 }
@@ -31,6 +31,24 @@
     #define BLOCK_BUFFER_SIZE 18
   #endif
 #endif
+#if (BLOCK_BUFFER_SIZE > 255)
+  #error "BLOCK_BUFFER_SIZE must be 255 or less. Planner buffer indices are 8-bit."
+#endif
+
+// Define the representation of squared speeds in the planner. The look-ahead passes in
+// planner_recalculate() compare and add these values for every block in the buffer, each time 
+// a block is added. With PLANNER_FIXED_POINT enabled, they are unsigned integers in (mm/min)^2,
+// which avoids soft-float math in the passes on the AVR. Values saturate at PLAN_SPEED_SQR_MAX,
+// limiting feed rates to 65535 mm/min.
+#ifdef PLANNER_FIXED_POINT
+  typedef uint32_t plan_speed_sqr_t;
+  #define PLAN_SPEED_SQR_MAX 0xFFFFFFFF
+  #define plan_speed_sqr_to_float(speed_sqr) ((float)(speed_sqr))
+#else
+  typedef float plan_speed_sqr_t;
+  #define plan_speed_sqr_to_float(speed_sqr) (speed_sqr)
+  #define plan_speed_sqr_from_float(speed_sqr) (speed_sqr)
+#endif
 
 // This struct stores a linear movement of a g-code block motion with its critical "nominal" values
 // are as specified in the source g-code. 
@@ -42,13 +60,16 @@ typedef struct {
   uint32_t step_event_count; // The maximum step axis count and number of steps required to complete this block. 
 
   // Fields used by the motion planner to manage acceleration
-  float entry_speed_sqr;         // The current planned entry speed at block junction in (mm/min)^2
-  float max_entry_speed_sqr;     // Maximum allowable entry speed based on the minimum of junction limit and 
-                                 //   neighboring nominal speeds with overrides in (mm/min)^2
-  float max_junction_speed_sqr;  // Junction entry speed limit based on direction vectors in (mm/min)^2
-  float nominal_speed_sqr;       // Axis-limit adjusted nominal speed for this block in (mm/min)^2
+  plan_speed_sqr_t entry_speed_sqr;         // The current planned entry speed at block junction in (mm/min)^2
+  plan_speed_sqr_t max_entry_speed_sqr;     // Maximum allowable entry speed based on the minimum of junction limit and 
+                                            //   neighboring nominal speeds with overrides in (mm/min)^2
+  plan_speed_sqr_t max_junction_speed_sqr;  // Junction entry speed limit based on direction vectors in (mm/min)^2
+  plan_speed_sqr_t nominal_speed_sqr;       // Axis-limit adjusted nominal speed for this block in (mm/min)^2
   float acceleration;            // Axis-limit adjusted line acceleration in (mm/min^2)
   float millimeters;             // The remaining distance for this block to be executed in (mm)
+  #ifdef PLANNER_FIXED_POINT
+    plan_speed_sqr_t speed_sqr_delta; // Squared speed change over the block at full acceleration (2*a*d)
+  #endif
   // uint8_t max_override;       // Maximum override value based on axis speed limits
 
   #ifdef USE_LINE_NUMBERS
@@ -82,12 +103,21 @@ uint8_t plan_next_block_index(uint8_t block_index);
 // Called by step segment buffer when computing executing block velocity profile.
 float plan_get_exec_block_exit_speed();
 
+// Converts a (mm/min)^2 value to the planner squared speed representation.
+#ifdef PLANNER_FIXED_POINT
+  plan_speed_sqr_t plan_speed_sqr_from_float(float speed_sqr);
+#endif
+
 // Reset the planner position vector (in steps)
 void plan_sync_position();
 
 // Reinitialize plan with a partially completed block
 void plan_cycle_reinitialize();
 
+// Streams arc segments, reusing the junction speed of the first segment junction for the rest
+void plan_arc_begin();
+void plan_arc_end();
+
 // Returns the number of active blocks are in the planner buffer.
 uint8_t plan_get_block_buffer_count();
 
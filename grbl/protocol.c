@@ -26,8 +26,28 @@
 #define COMMENT_TYPE_PARENTHESES 1
 #define COMMENT_TYPE_SEMICOLON 2
 
+// Define line status returned by protocol_read_char().
+#define LINE_INCOMPLETE 0
+#define LINE_COMPLETE 1
+#define LINE_OVERFLOW 2
+
+#ifdef GCODE_PRELEXER
+  // Define pre-lexed line types, stored in the first byte of each pre-lexer buffer line.
+  #define PRELEX_TEXT 0     // Text line. System commands, empty lines, and lines with format errors.
+  #define PRELEX_WORDS 1    // G-code words pre-lexed by gc_lex_line()
+  #define PRELEX_OVERFLOW 2 // Line exceeded the line buffer. Reports the overflow in order.
+
+  // Ring buffer of the incoming lines following the executing line. The tail line is the one
+  // executing, which must not be overwritten until it completes.
+  static uint8_t prelex_buffer[PRELEX_BUFFER_LINES][LINE_BUFFER_SIZE+1];
+  static uint8_t prelex_head;
+  static uint8_t prelex_tail;
+#endif
+
 
 static char line[LINE_BUFFER_SIZE]; // Line to be executed. Zero-terminated.
+static uint8_t comment;             // Comment type of the line being read
+static uint8_t char_counter;        // Length of the line being read
 
 
 // Directs and executes one line of formatted input from protocol_process. While mostly
@@ -61,6 +81,126 @@ static void protocol_execute_line(char *line)
 }
 
 
+// Processes one character of incoming serial data into the line buffer. Performs an initial
+// filtering by removing spaces and comments and capitalizing all letters. Returns LINE_COMPLETE
+// when the end of the line is reached, and LINE_OVERFLOW when the line buffer is exceeded.
+  
+// NOTE: While comment, spaces, and block delete(if supported) handling should technically 
+// be done in the g-code parser, doing it here helps compress the incoming data into Grbl's
+// line buffer, which is limited in size. The g-code standard actually states a line can't
+// exceed 256 characters, but the Arduino Uno does not have the memory space for this.
+// With a better processor, it would be very easy to pull this initial parsing out as a 
+// seperate task to be shared by the g-code parser and Grbl's system commands.
+static uint8_t protocol_read_char(uint8_t c)
+{
+  if ((c == '\n') || (c == '\r')) { // End of line reached
+    line[char_counter] = 0; // Set string termination character.
+    comment = COMMENT_NONE;
+    char_counter = 0;
+    return(LINE_COMPLETE);
+  } 
+  if (comment != COMMENT_NONE) {
+    // Throw away all comment characters
+    if (c == ')') {
+      // End of comment. Resume line. But, not if semicolon type comment.
+      if (comment == COMMENT_TYPE_PARENTHESES) { comment = COMMENT_NONE; }
+    }
+  } else {
+    if (c <= ' ') { 
+      // Throw away whitepace and control characters  
+    } else if (c == '/') { 
+      // Block delete NOT SUPPORTED. Ignore character.
+      // NOTE: If supported, would simply need to check the system if block delete is enabled.
+    } else if (c == '(') {
+      // Enable comments flag and ignore all characters until ')' or EOL.
+      // NOTE: This doesn't follow the NIST definition exactly, but is good enough for now.
+      // In the future, we could simply remove the items within the comments, but retain the
+      // comment control characters, so that the g-code parser can error-check it.
+      comment = COMMENT_TYPE_PARENTHESES;
+    } else if (c == ';') {
+      // NOTE: ';' comment to EOL is a LinuxCNC definition. Not NIST.
+      comment = COMMENT_TYPE_SEMICOLON;
+      
+    // TODO: Install '%' feature 
+    // } else if (c == '%') {
+      // Program start-end percent sign NOT SUPPORTED.
+      // NOTE: This maybe installed to tell Grbl when a program is running vs manual input,
+      // where, during a program, the system auto-cycle start will continue to execute 
+      // everything until the next '%' sign. This will help fix resuming issues with certain
+      // functions that empty the planner buffer to execute its task on-time.
+
+    } else if (char_counter >= (LINE_BUFFER_SIZE-1)) {
+      // Detect line buffer overflow. Report error and reset line buffer.
+      comment = COMMENT_NONE;
+      char_counter = 0;
+      return(LINE_OVERFLOW);
+    } else if (c >= 'a' && c <= 'z') { // Upcase lowercase
+      line[char_counter++] = c-'a'+'A';
+    } else {
+      line[char_counter++] = c;
+    }
+  }
+  return(LINE_INCOMPLETE);
+}
+
+
+#ifdef GCODE_PRELEXER
+// Reads incoming serial data into the pre-lexer buffer, until it is full or no data is left.
+// G-code lines are pre-lexed into words, so their number formats are already parsed when they 
+// are executed. Called by the main loop and while the main program waits on a full planner 
+// buffer, where this work would otherwise be done between the planner freeing a block and the
+// next block being added.
+void protocol_prelex()
+{
+  uint8_t c;
+  uint8_t next_head;
+  uint8_t *prelexed;
+  for (;;) {
+    next_head = prelex_head + 1;
+    if (next_head == PRELEX_BUFFER_LINES) { next_head = 0; }
+    if (next_head == prelex_tail) { return; } // Buffer full.
+    if ((c = serial_read()) == SERIAL_NO_DATA) { return; }
+
+    prelexed = prelex_buffer[prelex_head];
+    switch (protocol_read_char(c)) {
+      case LINE_INCOMPLETE: continue;
+      case LINE_COMPLETE:
+        // Keep lines that are not g-code, or fail to lex, as text for protocol_execute_line().
+        prelexed[0] = PRELEX_WORDS;
+        #ifdef REPORT_ECHO_LINE_RECEIVED
+          prelexed[0] = PRELEX_TEXT; // Echo requires the received text.
+        #else
+          if ((line[0] == 0) || (line[0] == '$') || !gc_lex_line(line, prelexed+1, LINE_BUFFER_SIZE)) {
+            prelexed[0] = PRELEX_TEXT;
+          }
+        #endif
+        if (prelexed[0] == PRELEX_TEXT) { strcpy((char*)prelexed+1, line); }
+        break;
+      case LINE_OVERFLOW: prelexed[0] = PRELEX_OVERFLOW; break;
+    }
+    prelex_head = next_head;
+  }
+}
+
+
+// Executes one line from the pre-lexer buffer, as protocol_execute_line() does for text lines.
+static void protocol_execute_prelexed(uint8_t *prelexed)
+{
+  switch (prelexed[0]) {
+    case PRELEX_TEXT: protocol_execute_line((char*)prelexed+1); break;
+    case PRELEX_OVERFLOW: report_status_message(STATUS_OVERFLOW); break;
+    case PRELEX_WORDS:
+      protocol_execute_realtime(); // Runtime command check point.
+      if (sys.abort) { return; } // Bail to calling function upon system abort  
+      // Pre-lexed lines are always g-code. Block if in alarm mode.
+      if (sys.state == STATE_ALARM) { report_status_message(STATUS_ALARM_LOCK); }
+      else { report_status_message(gc_execute_words(prelexed+1)); }
+      break;
+  }
+}
+#endif
+
+
 /* 
   GRBL PRIMARY LOOP:
 */
@@ -70,6 +210,14 @@ void protocol_main_loop()
   // Complete initialization procedures upon a power-up or reset.
   // ------------------------------------------------------------
   
+  // Reset incoming line processing.
+  comment = COMMENT_NONE;
+  char_counter = 0;
+  #ifdef GCODE_PRELEXER
+    prelex_head = 0;
+    prelex_tail = 0;
+  #endif
+
   // Print welcome message   
   report_init_message();
 
@@ -84,78 +232,44 @@ void protocol_main_loop()
     } else {
       sys.state = STATE_IDLE; // Set system to ready. Clear all state flags.
     } 
-    system_execute_startup(line); // Execute startup script.
+    #ifdef GCODE_PRELEXER
+      // Execute the startup script from the first pre-lexer line, as the executing line. The
+      // line buffer is in use by the pre-lexer, if incoming lines are read while it waits.
+      prelex_head = 1;
+      system_execute_startup((char*)prelex_buffer[0]);
+      prelex_tail = 1;
+    #else
+      system_execute_startup(line); // Execute startup script.
+    #endif
   }
     
   // ---------------------------------------------------------------------------------  
   // Primary loop! Upon a system abort, this exits back to main() to reset the system. 
   // ---------------------------------------------------------------------------------  
   
-  uint8_t comment = COMMENT_NONE;
-  uint8_t char_counter = 0;
-  uint8_t c;
+  #ifndef GCODE_PRELEXER
+    uint8_t c;
+  #endif
   for (;;) {
 
-    // Process one line of incoming serial data, as the data becomes available. Performs an
-    // initial filtering by removing spaces and comments and capitalizing all letters.
-    
-    // NOTE: While comment, spaces, and block delete(if supported) handling should technically 
-    // be done in the g-code parser, doing it here helps compress the incoming data into Grbl's
-    // line buffer, which is limited in size. The g-code standard actually states a line can't
-    // exceed 256 characters, but the Arduino Uno does not have the memory space for this.
-    // With a better processor, it would be very easy to pull this initial parsing out as a 
-    // seperate task to be shared by the g-code parser and Grbl's system commands.
-    
-    while((c = serial_read()) != SERIAL_NO_DATA) {
-      if ((c == '\n') || (c == '\r')) { // End of line reached
-        line[char_counter] = 0; // Set string termination character.
-        protocol_execute_line(line); // Line is complete. Execute it!
-        comment = COMMENT_NONE;
-        char_counter = 0;
-      } else {
-        if (comment != COMMENT_NONE) {
-          // Throw away all comment characters
-          if (c == ')') {
-            // End of comment. Resume line. But, not if semicolon type comment.
-            if (comment == COMMENT_TYPE_PARENTHESES) { comment = COMMENT_NONE; }
-          }
-        } else {
-          if (c <= ' ') { 
-            // Throw away whitepace and control characters  
-          } else if (c == '/') { 
-            // Block delete NOT SUPPORTED. Ignore character.
-            // NOTE: If supported, would simply need to check the system if block delete is enabled.
-          } else if (c == '(') {
-            // Enable comments flag and ignore all characters until ')' or EOL.
-            // NOTE: This doesn't follow the NIST definition exactly, but is good enough for now.
-            // In the future, we could simply remove the items within the comments, but retain the
-            // comment control characters, so that the g-code parser can error-check it.
-            comment = COMMENT_TYPE_PARENTHESES;
-          } else if (c == ';') {
-            // NOTE: ';' comment to EOL is a LinuxCNC definition. Not NIST.
-            comment = COMMENT_TYPE_SEMICOLON;
-            
-          // TODO: Install '%' feature 
-          // } else if (c == '%') {
-            // Program start-end percent sign NOT SUPPORTED.
-            // NOTE: This maybe installed to tell Grbl when a program is running vs manual input,
-            // where, during a program, the system auto-cycle start will continue to execute 
-            // everything until the next '%' sign. This will help fix resuming issues with certain
-            // functions that empty the planner buffer to execute its task on-time.
-
-          } else if (char_counter >= (LINE_BUFFER_SIZE-1)) {
-            // Detect line buffer overflow. Report error and reset line buffer.
-            report_status_message(STATUS_OVERFLOW);
-            comment = COMMENT_NONE;
-            char_counter = 0;
-          } else if (c >= 'a' && c <= 'z') { // Upcase lowercase
-            line[char_counter++] = c-'a'+'A';
-          } else {
-            line[char_counter++] = c;
-          }
+    // Process one line of incoming serial data, as the data becomes available.
+    #ifdef GCODE_PRELEXER
+      // Execute the pre-lexed lines in order. The lines after each are pre-lexed while it waits.
+      protocol_prelex();
+      while (prelex_tail != prelex_head) {
+        protocol_execute_prelexed(prelex_buffer[prelex_tail]);
+        if (sys.abort) { return; } // Bail to main() program loop to reset system.
+        if (++prelex_tail == PRELEX_BUFFER_LINES) { prelex_tail = 0; }
+        protocol_prelex();
+      }
+    #else
+      while((c = serial_read()) != SERIAL_NO_DATA) {
+        switch (protocol_read_char(c)) {
+          case LINE_COMPLETE: protocol_execute_line(line); break; // Line is complete. Execute it!
+          case LINE_OVERFLOW: report_status_message(STATUS_OVERFLOW); break;
         }
       }
-    }
+    #endif
     
     // If there are no more characters in the serial read buffer to be processed and executed,
     // this indicates that g-code streaming has either filled the planner buffer or has 
@@ -32,6 +32,12 @@
   #define LINE_BUFFER_SIZE 80
 #endif
 
+// Number of lines in the g-code pre-lexer buffer, including the executing line. Each line uses
+// LINE_BUFFER_SIZE+1 bytes of RAM. Must be 2 or more.
+#ifndef PRELEX_BUFFER_LINES
+  #define PRELEX_BUFFER_LINES 4
+#endif
+
 // Starts Grbl main loop. It handles all incoming characters from the serial port and executes
 // them as they complete. It is also responsible for finishing the initialization procedures.
 void protocol_main_loop();
@@ -39,6 +45,11 @@ void protocol_main_loop();
 // Checks and executes a realtime command at various stop points in main program
 void protocol_execute_realtime();
 
+#ifdef GCODE_PRELEXER
+  // Reads and pre-lexes incoming lines following the executing line, while it waits
+  void protocol_prelex();
+#endif
+
 // Notify the stepper subsystem to start executing the g-code program in buffer.
 // void protocol_cycle_start();
 
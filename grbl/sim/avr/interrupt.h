@@ -0,0 +1,33 @@
+/*
+  avr/interrupt.h - host stand-in for AVR interrupt handling used by the Grbl simulator
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef sim_avr_interrupt_h
+#define sim_avr_interrupt_h
+
+// Interrupt service routines become plain functions named interrupt_<vector>, which the
+// simulator calls directly at their virtual trigger times. The extra macro level expands
+// cpu_map aliases, i.e. ISR(SERIAL_RX) defines interrupt_USART_RX_vect().
+#define ISR(vector, ...) SIM_ISR(vector)
+#define SIM_ISR(vector) void interrupt_ ## vector(void)
+
+// The simulator executes interrupts synchronously from the main program, so there is
+// nothing to enable or mask.
+#define sei()
+#define cli()
+
+#endif
@@ -0,0 +1,130 @@
+/*
+  avr/io.h - host stand-in for the AVR register file used by the Grbl simulator
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Every peripheral register referenced by the Grbl sources and cpu_map files is modeled as a
+// plain memory variable. Writes are simply stored and reads return the last written value,
+// except for the PINx input registers, which the simulator initializes to an idle (pulled-up)
+// state. The simulator inspects the timer, port, and interrupt mask registers to decide when 
+// to fire the stepper interrupts and to record the step/direction pulse stream.
+
+#ifndef sim_avr_io_h
+#define sim_avr_io_h
+
+#include <stdint.h>
+
+#define SIM_REGISTERS_8 \
+  X(PORTA) X(DDRA) X(PINA) X(PORTB) X(DDRB) X(PINB) X(PORTC) X(DDRC) X(PINC) \
+  X(PORTD) X(DDRD) X(PIND) X(PORTE) X(DDRE) X(PINE) X(PORTH) X(DDRH) X(PINH) \
+  X(PORTK) X(DDRK) X(PINK) X(PORTL) X(DDRL) X(PINL) \
+  X(TCCR0A) X(TCCR0B) X(TCNT0) X(OCR0A) X(OCR0B) X(TIMSK0) X(TIFR0) \
+  X(TCCR1A) X(TCCR1B) X(TCCR1C) X(TIMSK1) X(TIFR1) \
+  X(TCCR2A) X(TCCR2B) X(TCNT2) X(OCR2A) X(OCR2B) X(TIMSK2) \
+  X(TCCR4A) X(TCCR4B) X(TIMSK4) \
+  X(PCICR) X(PCIFR) X(PCMSK0) X(PCMSK1) X(PCMSK2) \
+  X(UCSR0A) X(UCSR0B) X(UCSR0C) X(UBRR0H) X(UBRR0L) X(UDR0) \
+  X(EECR) X(EEDR) X(SPMCSR) X(WDTCSR) X(MCUSR) X(SREG)
+
+#define SIM_REGISTERS_16 \
+  X(TCNT1) X(OCR1A) X(OCR1B) X(TCNT4) X(OCR4A) X(OCR4B) X(EEAR)
+
+#define X(reg) extern volatile uint8_t reg;
+SIM_REGISTERS_8
+#undef X
+#define X(reg) extern volatile uint16_t reg;
+SIM_REGISTERS_16
+#undef X
+
+// Timer/Counter 0
+#define CS00   0
+#define CS01   1
+#define CS02   2
+#define WGM00  0
+#define WGM01  1
+#define WGM02  3
+#define TOIE0  0
+#define OCIE0A 1
+#define OCIE0B 2
+
+// Timer/Counter 1
+#define CS10   0
+#define CS11   1
+#define CS12   2
+#define WGM10  0
+#define WGM11  1
+#define WGM12  3
+#define WGM13  4
+#define COM1B0 4
+#define COM1B1 5
+#define COM1A0 6
+#define COM1A1 7
+#define TOIE1  0
+#define OCIE1A 1
+#define OCIE1B 2
+
+// Timer/Counter 2 (328p spindle PWM)
+#define CS20   0
+#define CS21   1
+#define CS22   2
+#define WGM20  0
+#define WGM21  1
+#define WGM22  3
+#define WGM23  4
+#define COM2B0 4
+#define COM2B1 5
+#define COM2A0 6
+#define COM2A1 7
+
+// Timer/Counter 4 (2560 spindle PWM)
+#define CS40   0
+#define CS41   1
+#define CS42   2
+#define WGM40  0
+#define WGM41  1
+#define WGM42  3
+#define WGM43  4
+#define COM4B0 4
+#define COM4B1 5
+#define COM4A0 6
+#define COM4A1 7
+
+// Pin change interrupts
+#define PCIE0  0
+#define PCIE1  1
+#define PCIE2  2
+
+// USART0
+#define U2X0   1
+#define UDRIE0 5
+#define TXEN0  3
+#define RXEN0  4
+#define RXCIE0 7
+
+// EEPROM
+#define EERE   0
+#define EEPE   1
+#define EEMPE  2
+#define SELFPRGEN 0
+
+// Watchdog
+#define WDP0   0
+#define WDP1   1
+#define WDP2   2
+#define WDE    3
+#define WDIE   6
+
+#endif
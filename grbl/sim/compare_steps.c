@@ -0,0 +1,139 @@
+/*
+  compare_steps.c - compares two simulator step logs of the same g-code program
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Checks that a planner variant traces the same path with the same velocity profile as the
+  reference build. Both step logs, as written by 'grbl_sim -s', must contain the identical
+  sequence of step pulses. Only the pulse times may differ. The feed rate is then compared over
+  windows of consecutive pulses, and must agree within the tolerance at every window.
+
+  Usage: compare_steps [-w pulses] [-p steps_per_mm] [-t percent] [-a mm_per_min] ref_log test_log
+    -w  Pulses per feed rate window. Default 64.
+    -p  Steps per mm, for reporting feed rates in mm/min. Default 250.
+    -t  Relative feed rate tolerance in percent. Default 1.
+    -a  Absolute feed rate tolerance in mm/min, for slow windows near a stop. Default 1.
+  Exits with status 1 when the logs differ beyond the tolerance.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct {
+  FILE *file;
+  const char *name;
+  unsigned long line;
+  double usec;
+  int delta[3];
+} step_log_t;
+
+
+// Reads the next step pulse. Returns 0 at the end of the log.
+static int read_pulse(step_log_t *log)
+{
+  if (fscanf(log->file, "%lf %d %d %d", &log->usec,
+             &log->delta[0], &log->delta[1], &log->delta[2]) != 4) { return(0); }
+  log->line++;
+  return(1);
+}
+
+
+static FILE *open_log(const char *name)
+{
+  FILE *file = fopen(name, "r");
+  if (!file) { perror(name); exit(2); }
+  return(file);
+}
+
+
+int main(int argc, char *argv[])
+{
+  unsigned long window = 64;
+  double steps_per_mm = 250.0;
+  double tolerance = 1.0;
+  double abs_tolerance = 1.0;
+  int opt;
+  while ((opt = getopt(argc, argv, "w:p:t:a:")) != -1) {
+    switch (opt) {
+      case 'w': window = strtoul(optarg, NULL, 10); break;
+      case 'p': steps_per_mm = atof(optarg); break;
+      case 't': tolerance = atof(optarg); break;
+      case 'a': abs_tolerance = atof(optarg); break;
+      default:
+        fprintf(stderr, "Usage: %s [-w pulses] [-p steps_per_mm] [-t percent] [-a mm_per_min] "
+                        "ref_log test_log\n", argv[0]);
+        return(2);
+    }
+  }
+  if (argc-optind != 2 || window == 0 || steps_per_mm <= 0.0) {
+    fprintf(stderr, "%s: expected two step logs\n", argv[0]);
+    return(2);
+  }
+
+  step_log_t ref = { open_log(argv[optind]), argv[optind] };
+  step_log_t test = { open_log(argv[optind+1]), argv[optind+1] };
+
+  double ref_start = 0.0, test_start = 0.0, window_mm = 0.0;
+  double max_error = 0.0, max_error_feed = 0.0, max_error_usec = 0.0;
+  unsigned long pulses = 0, failures = 0;
+  int ref_ok, test_ok;
+  while (1) {
+    ref_ok = read_pulse(&ref);
+    test_ok = read_pulse(&test);
+    if (!ref_ok || !test_ok) { break; }
+    if (ref.delta[0] != test.delta[0] || ref.delta[1] != test.delta[1] ||
+        ref.delta[2] != test.delta[2]) {
+      printf("%s: step pulse %lu differs from %s\n", test.name, test.line, ref.name);
+      return(1);
+    }
+    if (pulses++ % window == 0) {
+      ref_start = ref.usec;
+      test_start = test.usec;
+      window_mm = 0.0;
+    }
+    window_mm += sqrt(ref.delta[0]*ref.delta[0] + ref.delta[1]*ref.delta[1] +
+                      ref.delta[2]*ref.delta[2])/steps_per_mm;
+    if (pulses % window == 0 && ref.usec > ref_start && test.usec > test_start) {
+      // Feed rate between the first and last pulse of the window in mm/min.
+      double ref_feed = 6e7*window_mm/(ref.usec-ref_start);
+      double test_feed = 6e7*window_mm/(test.usec-test_start);
+      double error = fabs(test_feed-ref_feed);
+      if (error > abs_tolerance && error > 0.01*tolerance*ref_feed) { failures++; }
+      if (error > max_error) {
+        max_error = error;
+        max_error_feed = ref_feed;
+        max_error_usec = ref.usec;
+      }
+    }
+  }
+  if (ref_ok || test_ok) {
+    printf("%s: %lu step pulses, %s has more\n", test.name, pulses, ref_ok ? ref.name : test.name);
+    return(1);
+  }
+
+  printf("%s: %lu pulses, %.3f s vs %.3f s, max feed error %.2f mm/min at %.1f mm/min (%.3f s)",
+         test.name, pulses, 1e-6*ref.usec, 1e-6*test.usec, max_error, max_error_feed,
+         1e-6*max_error_usec);
+  if (failures) {
+    printf(", %lu windows out of tolerance\n", failures);
+    return(1);
+  }
+  printf(", ok\n");
+  return(0);
+}
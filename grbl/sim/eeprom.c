@@ -0,0 +1,70 @@
+/*
+  eeprom.c - simulator replacement for the EEPROM access functions
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "grbl.h"
+
+// Size of the EEPROM on the largest supported processor (Atmega2560).
+#define SIM_EEPROM_SIZE 4096
+
+// The EEPROM starts erased on every run, so Grbl restores its default settings at power-up and
+// every benchmark starts from the same machine configuration. Settings may still be changed
+// with '$x=val' lines in the streamed g-code.
+static unsigned char sim_eeprom[SIM_EEPROM_SIZE];
+static uint8_t sim_eeprom_initialized = false;
+
+
+unsigned char eeprom_get_char( unsigned int addr )
+{
+  if (!sim_eeprom_initialized) {
+    memset(sim_eeprom, 0xff, sizeof(sim_eeprom));
+    sim_eeprom_initialized = true;
+  }
+  if (addr >= SIM_EEPROM_SIZE) { return(0xff); }
+  return(sim_eeprom[addr]);
+}
+
+
+void eeprom_put_char( unsigned int addr, unsigned char new_value )
+{
+  eeprom_get_char(addr); // Ensure erased state is initialized.
+  if (addr < SIM_EEPROM_SIZE) { sim_eeprom[addr] = new_value; }
+}
+
+
+// Extensions added as part of Grbl. Identical to the firmware, including the checksum.
+
+void memcpy_to_eeprom_with_checksum(unsigned int destination, char *source, unsigned int size) {
+  unsigned char checksum = 0;
+  for(; size > 0; size--) { 
+    checksum = (checksum << 1) || (checksum >> 7);
+    checksum += *source;
+    eeprom_put_char(destination++, *(source++)); 
+  }
+  eeprom_put_char(destination, checksum);
+}
+
+int memcpy_from_eeprom_with_checksum(char *destination, unsigned int source, unsigned int size) {
+  unsigned char data, checksum = 0;
+  for(; size > 0; size--) { 
+    data = eeprom_get_char(source++);
+    checksum = (checksum << 1) || (checksum >> 7);
+    checksum += data;    
+    *(destination++) = data; 
+  }
+  return(checksum == eeprom_get_char(source));
+}
@@ -0,0 +1,67 @@
+/*
+  gcode_hooks.c - simulator instrumentation of the g-code parser
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// The unmodified g-code parser is compiled as part of this file, so each executed line can be
+// timed without the planner, segment generation, and simulated waits that it calls into.
+#include "grbl.h"
+#include "simulator.h"
+
+#define gc_execute_line gc_execute_line_firmware
+#ifdef GCODE_PRELEXER
+  #define gc_execute_words gc_execute_words_firmware
+  #define gc_lex_line gc_lex_line_firmware
+#endif
+#include "../gcode.c"
+#undef gc_execute_line
+#undef gc_execute_words
+#undef gc_lex_line
+
+
+uint8_t gc_execute_line(char *line)
+{
+  uint64_t hooked_ns = sim.hooked_ns;
+  uint64_t start = sim_host_ns();
+  uint8_t status = gc_execute_line_firmware(line);
+  sim_record_line(sim_host_ns()-start-(sim.hooked_ns-hooked_ns));
+  return(status);
+}
+
+
+#ifdef GCODE_PRELEXER
+  uint8_t gc_execute_words(uint8_t *words)
+  {
+    uint64_t hooked_ns = sim.hooked_ns;
+    uint64_t start = sim_host_ns();
+    uint8_t status = gc_execute_words_firmware(words);
+    sim_record_line(sim_host_ns()-start-(sim.hooked_ns-hooked_ns));
+    return(status);
+  }
+
+
+  // Times pre-lexing. It runs ahead of the line execution, mostly while waiting on the planner.
+  uint8_t gc_lex_line(char *line, uint8_t *words, uint8_t size)
+  {
+    uint64_t start = sim_host_ns();
+    uint8_t count = gc_lex_line_firmware(line, words, size);
+    uint64_t ns = sim_host_ns()-start;
+    sim.hooked_ns += ns;
+    sim.prelex_count++;
+    sim.prelex_ns += ns;
+    return(count);
+  }
+#endif
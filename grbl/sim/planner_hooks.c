@@ -0,0 +1,51 @@
+/*
+  planner_hooks.c - simulator instrumentation of the motion planner
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// The unmodified planner source is compiled as part of this file, so the instrumentation has
+// access to the block buffer without exporting any planner internals in the firmware.
+#include "grbl.h"
+#include "simulator.h"
+
+#define plan_buffer_line plan_buffer_line_firmware
+#include "../planner.c"
+#undef plan_buffer_line
+
+
+// Times each planned block and records its distance and nominal feed rate.
+#ifdef USE_LINE_NUMBERS
+  void plan_buffer_line(float *target, float feed_rate, uint8_t invert_feed_rate, int32_t line_number)
+#else
+  void plan_buffer_line(float *target, float feed_rate, uint8_t invert_feed_rate)
+#endif
+{
+  uint8_t block_index = block_buffer_head;
+  uint64_t start = sim_host_ns();
+  #ifdef USE_LINE_NUMBERS
+    plan_buffer_line_firmware(target, feed_rate, invert_feed_rate, line_number);
+  #else
+    plan_buffer_line_firmware(target, feed_rate, invert_feed_rate);
+  #endif
+  uint64_t ns = sim_host_ns()-start;
+  sim.hooked_ns += ns;
+
+  if (block_index != block_buffer_head) { // Zero-length blocks are not queued.
+    plan_block_t *block = &block_buffer[block_index];
+    sim_record_block(block->millimeters, sqrt(plan_speed_sqr_to_float(block->nominal_speed_sqr)), ns);
+  }
+  sim.progress = true;
+}
@@ -0,0 +1,34 @@
+/*
+  protocol_hooks.c - simulator access to the protocol module
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// The unmodified protocol source is compiled as part of this file, so the simulator can tell
+// whether pre-lexed lines are still waiting to be executed at the end of the input.
+#include "grbl.h"
+#include "simulator.h"
+
+#include "../protocol.c"
+
+
+uint8_t sim_get_prelex_pending()
+{
+  #ifdef GCODE_PRELEXER
+    return(prelex_head != prelex_tail);
+  #else
+    return(false);
+  #endif
+}
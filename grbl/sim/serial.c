@@ -0,0 +1,99 @@
+/*
+  serial.c - simulator replacement for the low level serial port functions
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "grbl.h"
+#include "simulator.h"
+
+// The receive buffer is kept exactly as on the AVR, so the streaming behavior and the realtime
+// command pick-off match the firmware. The streaming host is modeled as always keeping the
+// buffer topped off. The transmit side writes straight through to the response file.
+static uint8_t serial_rx_buffer[RX_BUFFER_SIZE];
+static uint8_t serial_rx_buffer_head = 0;
+static uint8_t serial_rx_buffer_tail = 0;
+
+
+uint8_t serial_get_rx_buffer_count()
+{
+  if (serial_rx_buffer_head >= serial_rx_buffer_tail) { return(serial_rx_buffer_head-serial_rx_buffer_tail); }
+  return (RX_BUFFER_SIZE - (serial_rx_buffer_tail-serial_rx_buffer_head));
+}
+
+
+uint8_t serial_get_tx_buffer_count() { return(0); }
+
+
+void serial_init() { }
+
+
+void serial_write(uint8_t data)
+{
+  if (sim.output) { fputc(data, sim.output); }
+}
+
+
+// Equivalent of the SERIAL_RX interrupt for each byte the streaming host can send.
+void sim_serial_rx_fill()
+{
+  uint8_t next_head;
+  int data;
+  while (!sim.input_done) {
+    next_head = serial_rx_buffer_head + 1;
+    if (next_head == RX_BUFFER_SIZE) { next_head = 0; }
+    if (next_head == serial_rx_buffer_tail) { return; } // Buffer full. Host waits.
+
+    data = fgetc(sim.input);
+    if (data == EOF) { 
+      sim.input_done = true; 
+      return;
+    }
+    switch (data) {
+      case CMD_STATUS_REPORT: bit_true_atomic(sys_rt_exec_state, EXEC_STATUS_REPORT); break;
+      case CMD_CYCLE_START:   bit_true_atomic(sys_rt_exec_state, EXEC_CYCLE_START); break;
+      case CMD_FEED_HOLD:     bit_true_atomic(sys_rt_exec_state, EXEC_FEED_HOLD); break;
+      case CMD_SAFETY_DOOR:   bit_true_atomic(sys_rt_exec_state, EXEC_SAFETY_DOOR); break;
+      case CMD_RESET:         mc_reset(); break;
+      default:
+        serial_rx_buffer[serial_rx_buffer_head] = data;
+        serial_rx_buffer_head = next_head;
+    }
+  }
+}
+
+
+uint8_t serial_read()
+{
+  if (serial_rx_buffer_head == serial_rx_buffer_tail) { sim_serial_rx_fill(); }
+  if (serial_rx_buffer_head == serial_rx_buffer_tail) {
+    // Streaming complete. End the simulation once all queued motion has been executed.
+    if (sim.input_done && (plan_get_current_block() == NULL) && !(TIMSK1 & (1<<OCIE1A)) &&
+        !(sys.state & (STATE_CYCLE | STATE_HOMING)) && !sim_get_prelex_pending()) { 
+      sim_finish("complete"); 
+    }
+    return SERIAL_NO_DATA;
+  }
+  uint8_t data = serial_rx_buffer[serial_rx_buffer_tail];
+  if (++serial_rx_buffer_tail == RX_BUFFER_SIZE) { serial_rx_buffer_tail = 0; }
+  sim.progress = true;
+  return data;
+}
+
+
+void serial_reset_read_buffer() 
+{
+  serial_rx_buffer_tail = serial_rx_buffer_head;
+}
@@ -0,0 +1,250 @@
+/*
+  simulator.c - host-native Grbl simulator and step-timing benchmark harness
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  The simulator runs the unmodified Grbl core on a Linux host. The AVR peripherals are replaced
+  by the stand-in headers in avr/ and util/, serial.c and eeprom.c in this directory, and a
+  virtual clock counting CPU cycles at F_CPU. The stepper interrupts are not asynchronous on the
+  host. Instead, the main program is given unlimited CPU time and the virtual clock only advances
+  while the main program waits on the stepper subsystem, i.e. when the planner buffer is full,
+  during a buffer synchronize, or after the end of the streamed input. The Timer1 and Timer0
+  interrupts are then fired in order at their programmed compare times.
+
+  This isolates the motion behavior from the CPU speed of the host: the achieved feed rates
+  reflect what the planner and step segment generator command, given the machine settings and
+  the look-ahead in the planner buffer. The host cost of the planner and segment generator is
+  measured separately, so changes to either can be compared before flashing a machine.
+
+  Usage: grbl_sim [-s step_file] [-r response_file] [gcode_file]
+    -s  Records every step pulse as "<usec> <x> <y> <z>" with +1/-1/0 per axis.
+    -r  Writes Grbl's serial responses to a file. Defaults to stdout. Use /dev/null to discard.
+  Without a g-code file, the input is read from stdin. The benchmark report is printed to stderr
+  when the input is exhausted and the machine is idle.
+*/
+
+#include "grbl.h"
+#include "simulator.h"
+#include <time.h>
+#include <unistd.h>
+
+
+// Define the simulated peripheral registers declared in avr/io.h
+#define X(reg) volatile uint8_t reg;
+SIM_REGISTERS_8
+#undef X
+#define X(reg) volatile uint16_t reg;
+SIM_REGISTERS_16
+#undef X
+
+// Stepper interrupts defined by stepper.c
+void interrupt_TIMER1_COMPA_vect(void);
+void interrupt_TIMER0_OVF_vect(void);
+#ifdef STEP_PULSE_DELAY
+  void interrupt_TIMER0_COMPA_vect(void);
+#endif
+
+sim_t sim;
+
+
+uint64_t sim_host_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return((uint64_t)ts.tv_sec*1000000000ULL + ts.tv_nsec);
+}
+
+
+void sim_delay_us(double us)
+{
+  sim.cycles += (uint64_t)(us*TICKS_PER_MICROSECOND);
+}
+
+
+void sim_record_block(float millimeters, float nominal_speed, uint64_t ns)
+{
+  sim.block_count++;
+  sim.block_ns += ns;
+  sim.block_mm += millimeters;
+  sim.block_min += millimeters/nominal_speed;
+}
+
+
+void sim_record_segments(uint8_t n_segments, uint64_t ns)
+{
+  sim.segment_count += n_segments;
+  sim.segment_ns += ns;
+}
+
+
+void sim_record_line(uint64_t ns)
+{
+  sim.line_count++;
+  sim.line_ns += ns;
+}
+
+
+// Returns the Timer1 clock prescaler selected by the CS1x bits.
+static uint16_t sim_timer1_prescaler()
+{
+  switch (TCCR1B & (0x07<<CS10)) {
+    case 2: return(8);
+    case 3: return(64);
+    case 4: return(256);
+    case 5: return(1024);
+    default: return(1);
+  }
+}
+
+
+// Records the step pulses output on the step port at the current virtual time.
+static void sim_record_step_pulse()
+{
+  uint8_t step_bits = (STEP_PORT ^ sim_get_step_port_invert_mask()) & STEP_MASK;
+  if (!step_bits) { return; }
+  uint8_t dir_bits = (DIRECTION_PORT ^ sim_get_dir_port_invert_mask()) & DIRECTION_MASK;
+
+  int8_t delta[N_AXIS];
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) {
+    delta[idx] = 0;
+    if (step_bits & get_step_pin_mask(idx)) {
+      // Direction bit enabled always means direction is negative.
+      if (dir_bits & get_direction_pin_mask(idx)) { delta[idx] = -1; }
+      else { delta[idx] = 1; }
+      sim.steps[idx] += delta[idx];
+    }
+  }
+  if (sim.step_log) {
+    fprintf(sim.step_log, "%.3f %d %d %d\n", (double)sim.cycles/TICKS_PER_MICROSECOND,
+            delta[X_AXIS], delta[Y_AXIS], delta[Z_AXIS]);
+  }
+}
+
+
+// Executes one Stepper Driver Interrupt at its compare match time, followed by the Stepper
+// Port Reset Interrupt that completes the step pulse.
+static void sim_stepper_tick()
+{
+  uint64_t period = (uint64_t)(OCR1A+1)*sim_timer1_prescaler(); // CTC mode period.
+  sim.cycles += period;
+  sim.motion_cycles += period;
+
+  interrupt_TIMER1_COMPA_vect();
+
+  // The Timer0 pulse reset interrupt always fires before the next Timer1 tick.
+  if (TCCR0B) {
+    #ifdef STEP_PULSE_DELAY
+      interrupt_TIMER0_COMPA_vect();
+    #endif
+    sim_record_step_pulse();
+    interrupt_TIMER0_OVF_vect();
+  }
+}
+
+
+void sim_main_program_wait()
+{
+  if (sim.progress) {
+    // Main program is still busy parsing and planning. No virtual time passes.
+    sim.progress = false;
+    return;
+  }
+
+  sim_serial_rx_fill(); // Deliver any pending realtime commands.
+
+  if (TIMSK1 & (1<<OCIE1A)) {
+    // Run the stepper interrupt until a step segment has been consumed or the cycle ends. The
+    // main program then gets a chance to refill the segment buffer, as it would on hardware.
+    uint8_t segment_tail = sim_get_segment_buffer_tail();
+    do {
+      sim_stepper_tick();
+    } while ((TIMSK1 & (1<<OCIE1A)) && (segment_tail == sim_get_segment_buffer_tail()));
+    sim.stall_count = 0;
+  } else {
+    sim.cycles += SIM_IDLE_CYCLES;
+    if (sim.input_done) {
+      if (++sim.stall_count > SIM_STALL_LIMIT) { sim_finish("stalled"); }
+    }
+  }
+}
+
+
+void sim_finish(const char *reason)
+{
+  if (sim.output) { fflush(sim.output); }
+  if (sim.step_log) { fclose(sim.step_log); }
+
+  double motion_sec = (double)sim.motion_cycles/F_CPU;
+  fprintf(stderr, "[grbl_sim] %s (%s)\n", sim.input_name, reason);
+  fprintf(stderr, "  g-code parser : %lu lines, %.2f us/line, %.0f lines/s\n",
+          (unsigned long)sim.line_count,
+          sim.line_count ? 1e-3*sim.line_ns/sim.line_count : 0.0,
+          sim.line_ns ? 1e9*sim.line_count/sim.line_ns : 0.0);
+  if (sim.prelex_count) {
+    fprintf(stderr, "  pre-lexer     : %lu lines, %.2f us/line, ahead of execution\n",
+            (unsigned long)sim.prelex_count, 1e-3*sim.prelex_ns/sim.prelex_count);
+  }
+  fprintf(stderr, "  planner       : %lu blocks, %.2f us/block, %.0f blocks/s\n",
+          (unsigned long)sim.block_count,
+          sim.block_count ? 1e-3*sim.block_ns/sim.block_count : 0.0,
+          sim.block_ns ? 1e9*sim.block_count/sim.block_ns : 0.0);
+  fprintf(stderr, "  st_prep_buffer: %lu segments, %.2f us/segment\n",
+          (unsigned long)sim.segment_count,
+          sim.segment_count ? 1e-3*sim.segment_ns/sim.segment_count : 0.0);
+  fprintf(stderr, "  motion        : %.3f mm, %.3f s virtual, %.3f s at commanded feed\n",
+          sim.block_mm, motion_sec, 60.0*sim.block_min);
+  fprintf(stderr, "  feed rate     : %.1f mm/min commanded, %.1f mm/min achieved (%.1f%%)\n",
+          sim.block_min > 0 ? sim.block_mm/sim.block_min : 0.0,
+          motion_sec > 0 ? 60.0*sim.block_mm/motion_sec : 0.0,
+          motion_sec > 0 ? 100.0*sim.block_min*60.0/motion_sec : 0.0);
+  fprintf(stderr, "  steps         : x %ld, y %ld, z %ld\n",
+          (long)sim.steps[X_AXIS], (long)sim.steps[Y_AXIS], (long)sim.steps[Z_AXIS]);
+  exit(0);
+}
+
+
+int main(int argc, char *argv[])
+{
+  int opt;
+  sim.input = stdin;
+  sim.input_name = "stdin";
+  sim.output = stdout;
+  while ((opt = getopt(argc, argv, "s:r:")) != -1) {
+    switch (opt) {
+      case 's':
+        if (!(sim.step_log = fopen(optarg, "w"))) { perror(optarg); return(1); }
+        break;
+      case 'r':
+        if (!(sim.output = fopen(optarg, "w"))) { perror(optarg); return(1); }
+        break;
+      default:
+        fprintf(stderr, "Usage: %s [-s step_file] [-r response_file] [gcode_file]\n", argv[0]);
+        return(1);
+    }
+  }
+  if (optind < argc) {
+    sim.input_name = argv[optind];
+    if (!(sim.input = fopen(sim.input_name, "r"))) { perror(sim.input_name); return(1); }
+  }
+
+  // Input pins idle high with the internal pull-ups enabled. No limits, probe, or control
+  // switches are engaged.
+  PINA = PINB = PINC = PIND = PINE = PINH = PINK = PINL = 0xff;
+
+  return(grbl_main());
+}
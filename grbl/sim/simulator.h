@@ -0,0 +1,91 @@
+/*
+  simulator.h - host-native Grbl simulator and step-timing benchmark harness
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef simulator_h
+#define simulator_h
+
+#include <stdio.h>
+
+// Virtual time granted to the main program when it waits on an idle machine.
+#define SIM_IDLE_CYCLES (F_CPU/1000) // 1 msec
+
+// Number of consecutive idle waits after the end of input before the simulation is declared
+// stalled, i.e. Grbl is waiting in a feed hold or alarm that no input can clear.
+#define SIM_STALL_LIMIT 60000 // 60 sec virtual
+
+// Define simulator state and benchmark statistics.
+typedef struct {
+  FILE *input;                 // Streamed g-code source
+  const char *input_name;
+  FILE *output;                // Grbl serial responses. NULL discards.
+  FILE *step_log;              // Step/direction pulse stream. NULL disables.
+  uint8_t input_done;          // End of g-code source reached
+  uint8_t progress;            // Main program consumed input or planned a block since the last wait.
+  uint32_t stall_count;
+
+  uint64_t cycles;             // Virtual clock in CPU cycles (F_CPU)
+  uint64_t motion_cycles;      // Virtual time spent with the stepper interrupt enabled
+
+  uint32_t block_count;        // Blocks added to the planner
+  uint64_t block_ns;           // Host time spent in plan_buffer_line()
+  float block_mm;              // Total planned distance (mm)
+  float block_min;             // Total time at the nominal block feed rates (min)
+
+  uint32_t segment_count;      // Step segments generated by st_prep_buffer()
+  uint64_t segment_ns;         // Host time spent in st_prep_buffer() calls that generated segments
+
+  uint32_t line_count;         // G-code lines executed by the parser
+  uint64_t line_ns;            // Host time executing g-code lines, excluding the timed hooks below
+  uint32_t prelex_count;       // G-code lines pre-lexed ahead of execution
+  uint64_t prelex_ns;          // Host time spent in gc_lex_line()
+  uint64_t hooked_ns;          // Host time in the planner, stepper and pre-lexer hooks, including waits
+
+  int32_t steps[N_AXIS];       // Step pulses emitted per axis
+} sim_t;
+extern sim_t sim;
+
+// Grbl firmware entry point. main.c is compiled with main renamed.
+int grbl_main(void);
+
+// Returns a monotonic host timestamp in nanoseconds. Used for the cost measurements.
+uint64_t sim_host_ns();
+
+// Called by the hooked st_prep_buffer() each time the main program polls the stepper
+// subsystem. Advances the virtual clock only when the main program is waiting.
+void sim_main_program_wait();
+
+// Moves streamed input into the serial receive buffer, as the USART receive interrupt would.
+void sim_serial_rx_fill();
+
+// Records statistics from the hooked planner and stepper entry points.
+void sim_record_block(float millimeters, float nominal_speed, uint64_t ns);
+void sim_record_segments(uint8_t n_segments, uint64_t ns);
+void sim_record_line(uint64_t ns);
+
+// Accessors into the stepper module internals. Defined in stepper_hooks.c.
+uint8_t sim_get_segment_buffer_tail();
+uint8_t sim_get_step_port_invert_mask();
+uint8_t sim_get_dir_port_invert_mask();
+
+// Returns true if pre-lexed lines are waiting to be executed. Defined in protocol_hooks.c.
+uint8_t sim_get_prelex_pending();
+
+// Prints the benchmark report and exits the simulator.
+void sim_finish(const char *reason);
+
+#endif
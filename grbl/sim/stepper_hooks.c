@@ -0,0 +1,48 @@
+/*
+  stepper_hooks.c - simulator instrumentation of the stepper subsystem
+  Part of Grbl
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// The unmodified stepper source, including its interrupt routines, is compiled as part of this
+// file, so the simulator can observe the segment buffer without changes to the firmware.
+#include "grbl.h"
+#include "simulator.h"
+
+#define st_prep_buffer st_prep_buffer_firmware
+#include "../stepper.c"
+#undef st_prep_buffer
+
+
+uint8_t sim_get_segment_buffer_tail() { return(segment_buffer_tail); }
+uint8_t sim_get_step_port_invert_mask() { return(step_port_invert_mask); }
+uint8_t sim_get_dir_port_invert_mask() { return(dir_port_invert_mask); }
+
+
+// Times segment generation. Every call is also a point where the main program polls the
+// stepper subsystem, which is where the simulator lets virtual time pass.
+void st_prep_buffer()
+{
+  uint8_t segment_head = segment_buffer_head;
+  uint64_t start = sim_host_ns();
+  st_prep_buffer_firmware();
+  uint64_t ns = sim_host_ns()-start;
+
+  uint8_t n_segments = (segment_buffer_head+SEGMENT_BUFFER_SIZE-segment_head) % SEGMENT_BUFFER_SIZE;
+  if (n_segments) { sim_record_segments(n_segments, ns); }
+
+  sim_main_program_wait();
+  sim.hooked_ns += sim_host_ns()-start;
+}
@@ -0,0 +1,3621 @@
+(3D relief carving raster, 30x6 mm, 0.1 mm XYZ segments)
+G21 G90
+G0 Z2.000
+G0 X0.000 Y0.000
+G1 Z0.000 F200
+F450
+X0.000 Y0.000 Z-1.000
+X0.100 Y0.000 Z-0.972
+X0.200 Y0.000 Z-0.944
+X0.300 Y0.000 Z-0.916
+X0.400 Y0.000 Z-0.888
+X0.500 Y0.000 Z-0.861
+X0.600 Y0.000 Z-0.833
+X0.700 Y0.000 Z-0.806
+X0.800 Y0.000 Z-0.779
+X0.900 Y0.000 Z-0.752
+X1.000 Y0.000 Z-0.726
+X1.100 Y0.000 Z-0.700
+X1.200 Y0.000 Z-0.674
+X1.300 Y0.000 Z-0.648
+X1.400 Y0.000 Z-0.623
+X1.500 Y0.000 Z-0.599
+X1.600 Y0.000 Z-0.575
+X1.700 Y0.000 Z-0.552
+X1.800 Y0.000 Z-0.529
+X1.900 Y0.000 Z-0.506
+X2.000 Y0.000 Z-0.485
+X2.100 Y0.000 Z-0.464
+X2.200 Y0.000 Z-0.443
+X2.300 Y0.000 Z-0.423
+X2.400 Y0.000 Z-0.404
+X2.500 Y0.000 Z-0.386
+X2.600 Y0.000 Z-0.368
+X2.700 Y0.000 Z-0.352
+X2.800 Y0.000 Z-0.336
+X2.900 Y0.000 Z-0.320
+X3.000 Y0.000 Z-0.306
+X3.100 Y0.000 Z-0.293
+X3.200 Y0.000 Z-0.280
+X3.300 Y0.000 Z-0.268
+X3.400 Y0.000 Z-0.257
+X3.500 Y0.000 Z-0.247
+X3.600 Y0.000 Z-0.238
+X3.700 Y0.000 Z-0.230
+X3.800 Y0.000 Z-0.223
+X3.900 Y0.000 Z-0.217
+X4.000 Y0.000 Z-0.212
+X4.100 Y0.000 Z-0.207
+X4.200 Y0.000 Z-0.204
+X4.300 Y0.000 Z-0.202
+X4.400 Y0.000 Z-0.200
+X4.500 Y0.000 Z-0.200
+X4.600 Y0.000 Z-0.201
+X4.700 Y0.000 Z-0.202
+X4.800 Y0.000 Z-0.205
+X4.900 Y0.000 Z-0.208
+X5.000 Y0.000 Z-0.213
+X5.100 Y0.000 Z-0.218
+X5.200 Y0.000 Z-0.225
+X5.300 Y0.000 Z-0.232
+X5.400 Y0.000 Z-0.240
+X5.500 Y0.000 Z-0.250
+X5.600 Y0.000 Z-0.260
+X5.700 Y0.000 Z-0.271
+X5.800 Y0.000 Z-0.283
+X5.900 Y0.000 Z-0.296
+X6.000 Y0.000 Z-0.309
+X6.100 Y0.000 Z-0.324
+X6.200 Y0.000 Z-0.339
+X6.300 Y0.000 Z-0.356
+X6.400 Y0.000 Z-0.373
+X6.500 Y0.000 Z-0.390
+X6.600 Y0.000 Z-0.409
+X6.700 Y0.000 Z-0.428
+X6.800 Y0.000 Z-0.448
+X6.900 Y0.000 Z-0.469
+X7.000 Y0.000 Z-0.490
+X7.100 Y0.000 Z-0.512
+X7.200 Y0.000 Z-0.534
+X7.300 Y0.000 Z-0.557
+X7.400 Y0.000 Z-0.581
+X7.500 Y0.000 Z-0.605
+X7.600 Y0.000 Z-0.629
+X7.700 Y0.000 Z-0.654
+X7.800 Y0.000 Z-0.680
+X7.900 Y0.000 Z-0.706
+X8.000 Y0.000 Z-0.732
+X8.100 Y0.000 Z-0.759
+X8.200 Y0.000 Z-0.785
+X8.300 Y0.000 Z-0.812
+X8.400 Y0.000 Z-0.840
+X8.500 Y0.000 Z-0.867
+X8.600 Y0.000 Z-0.895
+X8.700 Y0.000 Z-0.923
+X8.800 Y0.000 Z-0.951
+X8.900 Y0.000 Z-0.979
+X9.000 Y0.000 Z-1.007
+X9.100 Y0.000 Z-1.035
+X9.200 Y0.000 Z-1.063
+X9.300 Y0.000 Z-1.091
+X9.400 Y0.000 Z-1.118
+X9.500 Y0.000 Z-1.146
+X9.600 Y0.000 Z-1.173
+X9.700 Y0.000 Z-1.201
+X9.800 Y0.000 Z-1.228
+X9.900 Y0.000 Z-1.254
+X10.000 Y0.000 Z-1.281
+X10.100 Y0.000 Z-1.307
+X10.200 Y0.000 Z-1.332
+X10.300 Y0.000 Z-1.358
+X10.400 Y0.000 Z-1.382
+X10.500 Y0.000 Z-1.407
+X10.600 Y0.000 Z-1.431
+X10.700 Y0.000 Z-1.454
+X10.800 Y0.000 Z-1.477
+X10.900 Y0.000 Z-1.499
+X11.000 Y0.000 Z-1.521
+X11.100 Y0.000 Z-1.541
+X11.200 Y0.000 Z-1.562
+X11.300 Y0.000 Z-1.581
+X11.400 Y0.000 Z-1.600
+X11.500 Y0.000 Z-1.618
+X11.600 Y0.000 Z-1.636
+X11.700 Y0.000 Z-1.652
+X11.800 Y0.000 Z-1.668
+X11.900 Y0.000 Z-1.683
+X12.000 Y0.000 Z-1.697
+X12.100 Y0.000 Z-1.711
+X12.200 Y0.000 Z-1.723
+X12.300 Y0.000 Z-1.735
+X12.400 Y0.000 Z-1.745
+X12.500 Y0.000 Z-1.755
+X12.600 Y0.000 Z-1.764
+X12.700 Y0.000 Z-1.772
+X12.800 Y0.000 Z-1.778
+X12.900 Y0.000 Z-1.784
+X13.000 Y0.000 Z-1.789
+X13.100 Y0.000 Z-1.794
+X13.200 Y0.000 Z-1.797
+X13.300 Y0.000 Z-1.799
+X13.400 Y0.000 Z-1.800
+X13.500 Y0.000 Z-1.800
+X13.600 Y0.000 Z-1.799
+X13.700 Y0.000 Z-1.797
+X13.800 Y0.000 Z-1.794
+X13.900 Y0.000 Z-1.791
+X14.000 Y0.000 Z-1.786
+X14.100 Y0.000 Z-1.780
+X14.200 Y0.000 Z-1.774
+X14.300 Y0.000 Z-1.766
+X14.400 Y0.000 Z-1.757
+X14.500 Y0.000 Z-1.748
+X14.600 Y0.000 Z-1.738
+X14.700 Y0.000 Z-1.726
+X14.800 Y0.000 Z-1.714
+X14.900 Y0.000 Z-1.701
+X15.000 Y0.000 Z-1.687
+X15.100 Y0.000 Z-1.672
+X15.200 Y0.000 Z-1.657
+X15.300 Y0.000 Z-1.640
+X15.400 Y0.000 Z-1.623
+X15.500 Y0.000 Z-1.605
+X15.600 Y0.000 Z-1.587
+X15.700 Y0.000 Z-1.567
+X15.800 Y0.000 Z-1.547
+X15.900 Y0.000 Z-1.526
+X16.000 Y0.000 Z-1.505
+X16.100 Y0.000 Z-1.483
+X16.200 Y0.000 Z-1.460
+X16.300 Y0.000 Z-1.437
+X16.400 Y0.000 Z-1.413
+X16.500 Y0.000 Z-1.389
+X16.600 Y0.000 Z-1.365
+X16.700 Y0.000 Z-1.339
+X16.800 Y0.000 Z-1.314
+X16.900 Y0.000 Z-1.288
+X17.000 Y0.000 Z-1.262
+X17.100 Y0.000 Z-1.235
+X17.200 Y0.000 Z-1.208
+X17.300 Y0.000 Z-1.181
+X17.400 Y0.000 Z-1.154
+X17.500 Y0.000 Z-1.126
+X17.600 Y0.000 Z-1.098
+X17.700 Y0.000 Z-1.070
+X17.800 Y0.000 Z-1.043
+X17.900 Y0.000 Z-1.015
+X18.000 Y0.000 Z-0.987
+X18.100 Y0.000 Z-0.959
+X18.200 Y0.000 Z-0.931
+X18.300 Y0.000 Z-0.903
+X18.400 Y0.000 Z-0.875
+X18.500 Y0.000 Z-0.847
+X18.600 Y0.000 Z-0.820
+X18.700 Y0.000 Z-0.793
+X18.800 Y0.000 Z-0.766
+X18.900 Y0.000 Z-0.739
+X19.000 Y0.000 Z-0.713
+X19.100 Y0.000 Z-0.687
+X19.200 Y0.000 Z-0.662
+X19.300 Y0.000 Z-0.636
+X19.400 Y0.000 Z-0.612
+X19.500 Y0.000 Z-0.587
+X19.600 Y0.000 Z-0.564
+X19.700 Y0.000 Z-0.541
+X19.800 Y0.000 Z-0.518
+X19.900 Y0.000 Z-0.496
+X20.000 Y0.000 Z-0.474
+X20.100 Y0.000 Z-0.454
+X20.200 Y0.000 Z-0.434
+X20.300 Y0.000 Z-0.414
+X20.400 Y0.000 Z-0.395
+X20.500 Y0.000 Z-0.377
+X20.600 Y0.000 Z-0.360
+X20.700 Y0.000 Z-0.344
+X20.800 Y0.000 Z-0.328
+X20.900 Y0.000 Z-0.313
+X21.000 Y0.000 Z-0.299
+X21.100 Y0.000 Z-0.286
+X21.200 Y0.000 Z-0.274
+X21.300 Y0.000 Z-0.263
+X21.400 Y0.000 Z-0.252
+X21.500 Y0.000 Z-0.243
+X21.600 Y0.000 Z-0.234
+X21.700 Y0.000 Z-0.227
+X21.800 Y0.000 Z-0.220
+X21.900 Y0.000 Z-0.214
+X22.000 Y0.000 Z-0.209
+X22.100 Y0.000 Z-0.206
+X22.200 Y0.000 Z-0.203
+X22.300 Y0.000 Z-0.201
+X22.400 Y0.000 Z-0.200
+X22.500 Y0.000 Z-0.200
+X22.600 Y0.000 Z-0.201
+X22.700 Y0.000 Z-0.203
+X22.800 Y0.000 Z-0.206
+X22.900 Y0.000 Z-0.210
+X23.000 Y0.000 Z-0.215
+X23.100 Y0.000 Z-0.221
+X23.200 Y0.000 Z-0.228
+X23.300 Y0.000 Z-0.236
+X23.400 Y0.000 Z-0.245
+X23.500 Y0.000 Z-0.254
+X23.600 Y0.000 Z-0.265
+X23.700 Y0.000 Z-0.277
+X23.800 Y0.000 Z-0.289
+X23.900 Y0.000 Z-0.302
+X24.000 Y0.000 Z-0.316
+X24.100 Y0.000 Z-0.331
+X24.200 Y0.000 Z-0.347
+X24.300 Y0.000 Z-0.364
+X24.400 Y0.000 Z-0.381
+X24.500 Y0.000 Z-0.399
+X24.600 Y0.000 Z-0.418
+X24.700 Y0.000 Z-0.438
+X24.800 Y0.000 Z-0.458
+X24.900 Y0.000 Z-0.479
+X25.000 Y0.000 Z-0.500
+X25.100 Y0.000 Z-0.522
+X25.200 Y0.000 Z-0.545
+X25.300 Y0.000 Z-0.568
+X25.400 Y0.000 Z-0.592
+X25.500 Y0.000 Z-0.617
+X25.600 Y0.000 Z-0.641
+X25.700 Y0.000 Z-0.667
+X25.800 Y0.000 Z-0.692
+X25.900 Y0.000 Z-0.718
+X26.000 Y0.000 Z-0.745
+X26.100 Y0.000 Z-0.771
+X26.200 Y0.000 Z-0.798
+X26.300 Y0.000 Z-0.826
+X26.400 Y0.000 Z-0.853
+X26.500 Y0.000 Z-0.881
+X26.600 Y0.000 Z-0.908
+X26.700 Y0.000 Z-0.936
+X26.800 Y0.000 Z-0.964
+X26.900 Y0.000 Z-0.992
+X27.000 Y0.000 Z-1.020
+X27.100 Y0.000 Z-1.048
+X27.200 Y0.000 Z-1.076
+X27.300 Y0.000 Z-1.104
+X27.400 Y0.000 Z-1.132
+X27.500 Y0.000 Z-1.159
+X27.600 Y0.000 Z-1.186
+X27.700 Y0.000 Z-1.214
+X27.800 Y0.000 Z-1.240
+X27.900 Y0.000 Z-1.267
+X28.000 Y0.000 Z-1.293
+X28.100 Y0.000 Z-1.319
+X28.200 Y0.000 Z-1.345
+X28.300 Y0.000 Z-1.370
+X28.400 Y0.000 Z-1.394
+X28.500 Y0.000 Z-1.418
+X28.600 Y0.000 Z-1.442
+X28.700 Y0.000 Z-1.465
+X28.800 Y0.000 Z-1.487
+X28.900 Y0.000 Z-1.509
+X29.000 Y0.000 Z-1.531
+X29.100 Y0.000 Z-1.551
+X29.200 Y0.000 Z-1.571
+X29.300 Y0.000 Z-1.590
+X29.400 Y0.000 Z-1.609
+X29.500 Y0.000 Z-1.627
+X29.600 Y0.000 Z-1.644
+X29.700 Y0.000 Z-1.660
+X29.800 Y0.000 Z-1.675
+X29.900 Y0.000 Z-1.690
+X30.000 Y0.000 Z-1.704
+X30.000 Y0.500 Z-1.672
+X29.900 Y0.500 Z-1.659
+X29.800 Y0.500 Z-1.645
+X29.700 Y0.500 Z-1.631
+X29.600 Y0.500 Z-1.615
+X29.500 Y0.500 Z-1.599
+X29.400 Y0.500 Z-1.582
+X29.300 Y0.500 Z-1.564
+X29.200 Y0.500 Z-1.546
+X29.100 Y0.500 Z-1.527
+X29.000 Y0.500 Z-1.507
+X28.900 Y0.500 Z-1.487
+X28.800 Y0.500 Z-1.466
+X28.700 Y0.500 Z-1.444
+X28.600 Y0.500 Z-1.422
+X28.500 Y0.500 Z-1.400
+X28.400 Y0.500 Z-1.377
+X28.300 Y0.500 Z-1.353
+X28.200 Y0.500 Z-1.329
+X28.100 Y0.500 Z-1.305
+X28.000 Y0.500 Z-1.280
+X27.900 Y0.500 Z-1.255
+X27.800 Y0.500 Z-1.230
+X27.700 Y0.500 Z-1.204
+X27.600 Y0.500 Z-1.178
+X27.500 Y0.500 Z-1.152
+X27.400 Y0.500 Z-1.126
+X27.300 Y0.500 Z-1.099
+X27.200 Y0.500 Z-1.073
+X27.100 Y0.500 Z-1.046
+X27.000 Y0.500 Z-1.019
+X26.900 Y0.500 Z-0.993
+X26.800 Y0.500 Z-0.966
+X26.700 Y0.500 Z-0.939
+X26.600 Y0.500 Z-0.912
+X26.500 Y0.500 Z-0.886
+X26.400 Y0.500 Z-0.860
+X26.300 Y0.500 Z-0.833
+X26.200 Y0.500 Z-0.807
+X26.100 Y0.500 Z-0.782
+X26.000 Y0.500 Z-0.756
+X25.900 Y0.500 Z-0.731
+X25.800 Y0.500 Z-0.706
+X25.700 Y0.500 Z-0.682
+X25.600 Y0.500 Z-0.657
+X25.500 Y0.500 Z-0.634
+X25.400 Y0.500 Z-0.610
+X25.300 Y0.500 Z-0.588
+X25.200 Y0.500 Z-0.565
+X25.100 Y0.500 Z-0.544
+X25.000 Y0.500 Z-0.523
+X24.900 Y0.500 Z-0.502
+X24.800 Y0.500 Z-0.482
+X24.700 Y0.500 Z-0.463
+X24.600 Y0.500 Z-0.444
+X24.500 Y0.500 Z-0.426
+X24.400 Y0.500 Z-0.409
+X24.300 Y0.500 Z-0.392
+X24.200 Y0.500 Z-0.376
+X24.100 Y0.500 Z-0.361
+X24.000 Y0.500 Z-0.347
+X23.900 Y0.500 Z-0.333
+X23.800 Y0.500 Z-0.321
+X23.700 Y0.500 Z-0.309
+X23.600 Y0.500 Z-0.298
+X23.500 Y0.500 Z-0.288
+X23.400 Y0.500 Z-0.278
+X23.300 Y0.500 Z-0.270
+X23.200 Y0.500 Z-0.263
+X23.100 Y0.500 Z-0.256
+X23.000 Y0.500 Z-0.250
+X22.900 Y0.500 Z-0.246
+X22.800 Y0.500 Z-0.242
+X22.700 Y0.500 Z-0.239
+X22.600 Y0.500 Z-0.237
+X22.500 Y0.500 Z-0.236
+X22.400 Y0.500 Z-0.236
+X22.300 Y0.500 Z-0.237
+X22.200 Y0.500 Z-0.238
+X22.100 Y0.500 Z-0.241
+X22.000 Y0.500 Z-0.245
+X21.900 Y0.500 Z-0.249
+X21.800 Y0.500 Z-0.255
+X21.700 Y0.500 Z-0.261
+X21.600 Y0.500 Z-0.269
+X21.500 Y0.500 Z-0.277
+X21.400 Y0.500 Z-0.286
+X21.300 Y0.500 Z-0.296
+X21.200 Y0.500 Z-0.307
+X21.100 Y0.500 Z-0.318
+X21.000 Y0.500 Z-0.331
+X20.900 Y0.500 Z-0.344
+X20.800 Y0.500 Z-0.358
+X20.700 Y0.500 Z-0.373
+X20.600 Y0.500 Z-0.389
+X20.500 Y0.500 Z-0.405
+X20.400 Y0.500 Z-0.422
+X20.300 Y0.500 Z-0.440
+X20.200 Y0.500 Z-0.459
+X20.100 Y0.500 Z-0.478
+X20.000 Y0.500 Z-0.498
+X19.900 Y0.500 Z-0.518
+X19.800 Y0.500 Z-0.539
+X19.700 Y0.500 Z-0.561
+X19.600 Y0.500 Z-0.583
+X19.500 Y0.500 Z-0.606
+X19.400 Y0.500 Z-0.629
+X19.300 Y0.500 Z-0.653
+X19.200 Y0.500 Z-0.677
+X19.100 Y0.500 Z-0.701
+X19.000 Y0.500 Z-0.726
+X18.900 Y0.500 Z-0.751
+X18.800 Y0.500 Z-0.776
+X18.700 Y0.500 Z-0.802
+X18.600 Y0.500 Z-0.828
+X18.500 Y0.500 Z-0.854
+X18.400 Y0.500 Z-0.881
+X18.300 Y0.500 Z-0.907
+X18.200 Y0.500 Z-0.934
+X18.100 Y0.500 Z-0.960
+X18.000 Y0.500 Z-0.987
+X17.900 Y0.500 Z-1.014
+X17.800 Y0.500 Z-1.041
+X17.700 Y0.500 Z-1.067
+X17.600 Y0.500 Z-1.094
+X17.500 Y0.500 Z-1.120
+X17.400 Y0.500 Z-1.147
+X17.300 Y0.500 Z-1.173
+X17.200 Y0.500 Z-1.199
+X17.100 Y0.500 Z-1.225
+X17.000 Y0.500 Z-1.250
+X16.900 Y0.500 Z-1.275
+X16.800 Y0.500 Z-1.300
+X16.700 Y0.500 Z-1.324
+X16.600 Y0.500 Z-1.348
+X16.500 Y0.500 Z-1.372
+X16.400 Y0.500 Z-1.395
+X16.300 Y0.500 Z-1.418
+X16.200 Y0.500 Z-1.440
+X16.100 Y0.500 Z-1.461
+X16.000 Y0.500 Z-1.482
+X15.900 Y0.500 Z-1.503
+X15.800 Y0.500 Z-1.523
+X15.700 Y0.500 Z-1.542
+X15.600 Y0.500 Z-1.560
+X15.500 Y0.500 Z-1.578
+X15.400 Y0.500 Z-1.595
+X15.300 Y0.500 Z-1.612
+X15.200 Y0.500 Z-1.627
+X15.100 Y0.500 Z-1.642
+X15.000 Y0.500 Z-1.656
+X14.900 Y0.500 Z-1.670
+X14.800 Y0.500 Z-1.682
+X14.700 Y0.500 Z-1.694
+X14.600 Y0.500 Z-1.705
+X14.500 Y0.500 Z-1.715
+X14.400 Y0.500 Z-1.724
+X14.300 Y0.500 Z-1.732
+X14.200 Y0.500 Z-1.739
+X14.100 Y0.500 Z-1.745
+X14.000 Y0.500 Z-1.751
+X13.900 Y0.500 Z-1.755
+X13.800 Y0.500 Z-1.759
+X13.700 Y0.500 Z-1.762
+X13.600 Y0.500 Z-1.763
+X13.500 Y0.500 Z-1.764
+X13.400 Y0.500 Z-1.764
+X13.300 Y0.500 Z-1.763
+X13.200 Y0.500 Z-1.761
+X13.100 Y0.500 Z-1.758
+X13.000 Y0.500 Z-1.754
+X12.900 Y0.500 Z-1.749
+X12.800 Y0.500 Z-1.744
+X12.700 Y0.500 Z-1.737
+X12.600 Y0.500 Z-1.730
+X12.500 Y0.500 Z-1.721
+X12.400 Y0.500 Z-1.712
+X12.300 Y0.500 Z-1.702
+X12.200 Y0.500 Z-1.691
+X12.100 Y0.500 Z-1.679
+X12.000 Y0.500 Z-1.666
+X11.900 Y0.500 Z-1.653
+X11.800 Y0.500 Z-1.638
+X11.700 Y0.500 Z-1.623
+X11.600 Y0.500 Z-1.607
+X11.500 Y0.500 Z-1.591
+X11.400 Y0.500 Z-1.573
+X11.300 Y0.500 Z-1.555
+X11.200 Y0.500 Z-1.537
+X11.100 Y0.500 Z-1.517
+X11.000 Y0.500 Z-1.497
+X10.900 Y0.500 Z-1.477
+X10.800 Y0.500 Z-1.455
+X10.700 Y0.500 Z-1.434
+X10.600 Y0.500 Z-1.411
+X10.500 Y0.500 Z-1.389
+X10.400 Y0.500 Z-1.365
+X10.300 Y0.500 Z-1.342
+X10.200 Y0.500 Z-1.317
+X10.100 Y0.500 Z-1.293
+X10.000 Y0.500 Z-1.268
+X9.900 Y0.500 Z-1.243
+X9.800 Y0.500 Z-1.217
+X9.700 Y0.500 Z-1.192
+X9.600 Y0.500 Z-1.166
+X9.500 Y0.500 Z-1.139
+X9.400 Y0.500 Z-1.113
+X9.300 Y0.500 Z-1.086
+X9.200 Y0.500 Z-1.060
+X9.100 Y0.500 Z-1.033
+X9.000 Y0.500 Z-1.006
+X8.900 Y0.500 Z-0.980
+X8.800 Y0.500 Z-0.953
+X8.700 Y0.500 Z-0.926
+X8.600 Y0.500 Z-0.900
+X8.500 Y0.500 Z-0.873
+X8.400 Y0.500 Z-0.847
+X8.300 Y0.500 Z-0.821
+X8.200 Y0.500 Z-0.795
+X8.100 Y0.500 Z-0.769
+X8.000 Y0.500 Z-0.744
+X7.900 Y0.500 Z-0.719
+X7.800 Y0.500 Z-0.694
+X7.700 Y0.500 Z-0.670
+X7.600 Y0.500 Z-0.646
+X7.500 Y0.500 Z-0.623
+X7.400 Y0.500 Z-0.599
+X7.300 Y0.500 Z-0.577
+X7.200 Y0.500 Z-0.555
+X7.100 Y0.500 Z-0.533
+X7.000 Y0.500 Z-0.513
+X6.900 Y0.500 Z-0.492
+X6.800 Y0.500 Z-0.473
+X6.700 Y0.500 Z-0.454
+X6.600 Y0.500 Z-0.435
+X6.500 Y0.500 Z-0.418
+X6.400 Y0.500 Z-0.401
+X6.300 Y0.500 Z-0.384
+X6.200 Y0.500 Z-0.369
+X6.100 Y0.500 Z-0.354
+X6.000 Y0.500 Z-0.340
+X5.900 Y0.500 Z-0.327
+X5.800 Y0.500 Z-0.315
+X5.700 Y0.500 Z-0.303
+X5.600 Y0.500 Z-0.293
+X5.500 Y0.500 Z-0.283
+X5.400 Y0.500 Z-0.274
+X5.300 Y0.500 Z-0.266
+X5.200 Y0.500 Z-0.259
+X5.100 Y0.500 Z-0.253
+X5.000 Y0.500 Z-0.248
+X4.900 Y0.500 Z-0.244
+X4.800 Y0.500 Z-0.240
+X4.700 Y0.500 Z-0.238
+X4.600 Y0.500 Z-0.236
+X4.500 Y0.500 Z-0.236
+X4.400 Y0.500 Z-0.236
+X4.300 Y0.500 Z-0.237
+X4.200 Y0.500 Z-0.240
+X4.100 Y0.500 Z-0.243
+X4.000 Y0.500 Z-0.247
+X3.900 Y0.500 Z-0.252
+X3.800 Y0.500 Z-0.258
+X3.700 Y0.500 Z-0.265
+X3.600 Y0.500 Z-0.272
+X3.500 Y0.500 Z-0.281
+X3.400 Y0.500 Z-0.290
+X3.300 Y0.500 Z-0.301
+X3.200 Y0.500 Z-0.312
+X3.100 Y0.500 Z-0.324
+X3.000 Y0.500 Z-0.337
+X2.900 Y0.500 Z-0.351
+X2.800 Y0.500 Z-0.365
+X2.700 Y0.500 Z-0.381
+X2.600 Y0.500 Z-0.397
+X2.500 Y0.500 Z-0.413
+X2.400 Y0.500 Z-0.431
+X2.300 Y0.500 Z-0.449
+X2.200 Y0.500 Z-0.468
+X2.100 Y0.500 Z-0.487
+X2.000 Y0.500 Z-0.508
+X1.900 Y0.500 Z-0.528
+X1.800 Y0.500 Z-0.550
+X1.700 Y0.500 Z-0.572
+X1.600 Y0.500 Z-0.594
+X1.500 Y0.500 Z-0.617
+X1.400 Y0.500 Z-0.640
+X1.300 Y0.500 Z-0.664
+X1.200 Y0.500 Z-0.688
+X1.100 Y0.500 Z-0.713
+X1.000 Y0.500 Z-0.738
+X0.900 Y0.500 Z-0.763
+X0.800 Y0.500 Z-0.789
+X0.700 Y0.500 Z-0.815
+X0.600 Y0.500 Z-0.841
+X0.500 Y0.500 Z-0.867
+X0.400 Y0.500 Z-0.893
+X0.300 Y0.500 Z-0.920
+X0.200 Y0.500 Z-0.947
+X0.100 Y0.500 Z-0.973
+X0.000 Y0.500 Z-1.000
+X0.000 Y1.000 Z-1.000
+X0.100 Y1.000 Z-0.977
+X0.200 Y1.000 Z-0.954
+X0.300 Y1.000 Z-0.931
+X0.400 Y1.000 Z-0.908
+X0.500 Y1.000 Z-0.885
+X0.600 Y1.000 Z-0.862
+X0.700 Y1.000 Z-0.840
+X0.800 Y1.000 Z-0.818
+X0.900 Y1.000 Z-0.795
+X1.000 Y1.000 Z-0.774
+X1.100 Y1.000 Z-0.752
+X1.200 Y1.000 Z-0.731
+X1.300 Y1.000 Z-0.710
+X1.400 Y1.000 Z-0.689
+X1.500 Y1.000 Z-0.669
+X1.600 Y1.000 Z-0.649
+X1.700 Y1.000 Z-0.630
+X1.800 Y1.000 Z-0.611
+X1.900 Y1.000 Z-0.593
+X2.000 Y1.000 Z-0.575
+X2.100 Y1.000 Z-0.557
+X2.200 Y1.000 Z-0.540
+X2.300 Y1.000 Z-0.524
+X2.400 Y1.000 Z-0.508
+X2.500 Y1.000 Z-0.493
+X2.600 Y1.000 Z-0.479
+X2.700 Y1.000 Z-0.465
+X2.800 Y1.000 Z-0.452
+X2.900 Y1.000 Z-0.439
+X3.000 Y1.000 Z-0.427
+X3.100 Y1.000 Z-0.416
+X3.200 Y1.000 Z-0.406
+X3.300 Y1.000 Z-0.396
+X3.400 Y1.000 Z-0.387
+X3.500 Y1.000 Z-0.379
+X3.600 Y1.000 Z-0.371
+X3.700 Y1.000 Z-0.365
+X3.800 Y1.000 Z-0.359
+X3.900 Y1.000 Z-0.354
+X4.000 Y1.000 Z-0.349
+X4.100 Y1.000 Z-0.346
+X4.200 Y1.000 Z-0.343
+X4.300 Y1.000 Z-0.341
+X4.400 Y1.000 Z-0.340
+X4.500 Y1.000 Z-0.340
+X4.600 Y1.000 Z-0.340
+X4.700 Y1.000 Z-0.342
+X4.800 Y1.000 Z-0.344
+X4.900 Y1.000 Z-0.347
+X5.000 Y1.000 Z-0.350
+X5.100 Y1.000 Z-0.355
+X5.200 Y1.000 Z-0.360
+X5.300 Y1.000 Z-0.366
+X5.400 Y1.000 Z-0.373
+X5.500 Y1.000 Z-0.381
+X5.600 Y1.000 Z-0.389
+X5.700 Y1.000 Z-0.398
+X5.800 Y1.000 Z-0.408
+X5.900 Y1.000 Z-0.419
+X6.000 Y1.000 Z-0.430
+X6.100 Y1.000 Z-0.442
+X6.200 Y1.000 Z-0.455
+X6.300 Y1.000 Z-0.468
+X6.400 Y1.000 Z-0.482
+X6.500 Y1.000 Z-0.497
+X6.600 Y1.000 Z-0.512
+X6.700 Y1.000 Z-0.528
+X6.800 Y1.000 Z-0.544
+X6.900 Y1.000 Z-0.561
+X7.000 Y1.000 Z-0.579
+X7.100 Y1.000 Z-0.597
+X7.200 Y1.000 Z-0.616
+X7.300 Y1.000 Z-0.635
+X7.400 Y1.000 Z-0.654
+X7.500 Y1.000 Z-0.674
+X7.600 Y1.000 Z-0.694
+X7.700 Y1.000 Z-0.715
+X7.800 Y1.000 Z-0.736
+X7.900 Y1.000 Z-0.757
+X8.000 Y1.000 Z-0.779
+X8.100 Y1.000 Z-0.801
+X8.200 Y1.000 Z-0.823
+X8.300 Y1.000 Z-0.845
+X8.400 Y1.000 Z-0.868
+X8.500 Y1.000 Z-0.891
+X8.600 Y1.000 Z-0.913
+X8.700 Y1.000 Z-0.936
+X8.800 Y1.000 Z-0.959
+X8.900 Y1.000 Z-0.982
+X9.000 Y1.000 Z-1.006
+X9.100 Y1.000 Z-1.029
+X9.200 Y1.000 Z-1.052
+X9.300 Y1.000 Z-1.075
+X9.400 Y1.000 Z-1.098
+X9.500 Y1.000 Z-1.120
+X9.600 Y1.000 Z-1.143
+X9.700 Y1.000 Z-1.166
+X9.800 Y1.000 Z-1.188
+X9.900 Y1.000 Z-1.210
+X10.000 Y1.000 Z-1.232
+X10.100 Y1.000 Z-1.253
+X10.200 Y1.000 Z-1.274
+X10.300 Y1.000 Z-1.295
+X10.400 Y1.000 Z-1.316
+X10.500 Y1.000 Z-1.336
+X10.600 Y1.000 Z-1.355
+X10.700 Y1.000 Z-1.375
+X10.800 Y1.000 Z-1.393
+X10.900 Y1.000 Z-1.412
+X11.000 Y1.000 Z-1.430
+X11.100 Y1.000 Z-1.447
+X11.200 Y1.000 Z-1.464
+X11.300 Y1.000 Z-1.480
+X11.400 Y1.000 Z-1.495
+X11.500 Y1.000 Z-1.510
+X11.600 Y1.000 Z-1.525
+X11.700 Y1.000 Z-1.538
+X11.800 Y1.000 Z-1.551
+X11.900 Y1.000 Z-1.564
+X12.000 Y1.000 Z-1.575
+X12.100 Y1.000 Z-1.586
+X12.200 Y1.000 Z-1.597
+X12.300 Y1.000 Z-1.606
+X12.400 Y1.000 Z-1.615
+X12.500 Y1.000 Z-1.623
+X12.600 Y1.000 Z-1.630
+X12.700 Y1.000 Z-1.637
+X12.800 Y1.000 Z-1.643
+X12.900 Y1.000 Z-1.647
+X13.000 Y1.000 Z-1.652
+X13.100 Y1.000 Z-1.655
+X13.200 Y1.000 Z-1.657
+X13.300 Y1.000 Z-1.659
+X13.400 Y1.000 Z-1.660
+X13.500 Y1.000 Z-1.660
+X13.600 Y1.000 Z-1.660
+X13.700 Y1.000 Z-1.658
+X13.800 Y1.000 Z-1.656
+X13.900 Y1.000 Z-1.653
+X14.000 Y1.000 Z-1.649
+X14.100 Y1.000 Z-1.644
+X14.200 Y1.000 Z-1.638
+X14.300 Y1.000 Z-1.632
+X14.400 Y1.000 Z-1.625
+X14.500 Y1.000 Z-1.617
+X14.600 Y1.000 Z-1.609
+X14.700 Y1.000 Z-1.599
+X14.800 Y1.000 Z-1.589
+X14.900 Y1.000 Z-1.579
+X15.000 Y1.000 Z-1.567
+X15.100 Y1.000 Z-1.555
+X15.200 Y1.000 Z-1.542
+X15.300 Y1.000 Z-1.529
+X15.400 Y1.000 Z-1.514
+X15.500 Y1.000 Z-1.500
+X15.600 Y1.000 Z-1.484
+X15.700 Y1.000 Z-1.468
+X15.800 Y1.000 Z-1.452
+X15.900 Y1.000 Z-1.434
+X16.000 Y1.000 Z-1.417
+X16.100 Y1.000 Z-1.399
+X16.200 Y1.000 Z-1.380
+X16.300 Y1.000 Z-1.361
+X16.400 Y1.000 Z-1.341
+X16.500 Y1.000 Z-1.321
+X16.600 Y1.000 Z-1.301
+X16.700 Y1.000 Z-1.280
+X16.800 Y1.000 Z-1.259
+X16.900 Y1.000 Z-1.238
+X17.000 Y1.000 Z-1.216
+X17.100 Y1.000 Z-1.194
+X17.200 Y1.000 Z-1.172
+X17.300 Y1.000 Z-1.149
+X17.400 Y1.000 Z-1.127
+X17.500 Y1.000 Z-1.104
+X17.600 Y1.000 Z-1.081
+X17.700 Y1.000 Z-1.058
+X17.800 Y1.000 Z-1.035
+X17.900 Y1.000 Z-1.012
+X18.000 Y1.000 Z-0.989
+X18.100 Y1.000 Z-0.966
+X18.200 Y1.000 Z-0.943
+X18.300 Y1.000 Z-0.920
+X18.400 Y1.000 Z-0.897
+X18.500 Y1.000 Z-0.874
+X18.600 Y1.000 Z-0.852
+X18.700 Y1.000 Z-0.829
+X18.800 Y1.000 Z-0.807
+X18.900 Y1.000 Z-0.785
+X19.000 Y1.000 Z-0.763
+X19.100 Y1.000 Z-0.742
+X19.200 Y1.000 Z-0.721
+X19.300 Y1.000 Z-0.700
+X19.400 Y1.000 Z-0.680
+X19.500 Y1.000 Z-0.660
+X19.600 Y1.000 Z-0.640
+X19.700 Y1.000 Z-0.621
+X19.800 Y1.000 Z-0.602
+X19.900 Y1.000 Z-0.584
+X20.000 Y1.000 Z-0.566
+X20.100 Y1.000 Z-0.549
+X20.200 Y1.000 Z-0.532
+X20.300 Y1.000 Z-0.516
+X20.400 Y1.000 Z-0.501
+X20.500 Y1.000 Z-0.486
+X20.600 Y1.000 Z-0.472
+X20.700 Y1.000 Z-0.458
+X20.800 Y1.000 Z-0.446
+X20.900 Y1.000 Z-0.433
+X21.000 Y1.000 Z-0.422
+X21.100 Y1.000 Z-0.411
+X21.200 Y1.000 Z-0.401
+X21.300 Y1.000 Z-0.392
+X21.400 Y1.000 Z-0.383
+X21.500 Y1.000 Z-0.375
+X21.600 Y1.000 Z-0.368
+X21.700 Y1.000 Z-0.362
+X21.800 Y1.000 Z-0.356
+X21.900 Y1.000 Z-0.351
+X22.000 Y1.000 Z-0.348
+X22.100 Y1.000 Z-0.344
+X22.200 Y1.000 Z-0.342
+X22.300 Y1.000 Z-0.341
+X22.400 Y1.000 Z-0.340
+X22.500 Y1.000 Z-0.340
+X22.600 Y1.000 Z-0.341
+X22.700 Y1.000 Z-0.342
+X22.800 Y1.000 Z-0.345
+X22.900 Y1.000 Z-0.348
+X23.000 Y1.000 Z-0.352
+X23.100 Y1.000 Z-0.357
+X23.200 Y1.000 Z-0.363
+X23.300 Y1.000 Z-0.369
+X23.400 Y1.000 Z-0.377
+X23.500 Y1.000 Z-0.385
+X23.600 Y1.000 Z-0.393
+X23.700 Y1.000 Z-0.403
+X23.800 Y1.000 Z-0.413
+X23.900 Y1.000 Z-0.424
+X24.000 Y1.000 Z-0.436
+X24.100 Y1.000 Z-0.448
+X24.200 Y1.000 Z-0.461
+X24.300 Y1.000 Z-0.475
+X24.400 Y1.000 Z-0.489
+X24.500 Y1.000 Z-0.504
+X24.600 Y1.000 Z-0.520
+X24.700 Y1.000 Z-0.536
+X24.800 Y1.000 Z-0.552
+X24.900 Y1.000 Z-0.570
+X25.000 Y1.000 Z-0.588
+X25.100 Y1.000 Z-0.606
+X25.200 Y1.000 Z-0.625
+X25.300 Y1.000 Z-0.644
+X25.400 Y1.000 Z-0.663
+X25.500 Y1.000 Z-0.684
+X25.600 Y1.000 Z-0.704
+X25.700 Y1.000 Z-0.725
+X25.800 Y1.000 Z-0.746
+X25.900 Y1.000 Z-0.768
+X26.000 Y1.000 Z-0.789
+X26.100 Y1.000 Z-0.811
+X26.200 Y1.000 Z-0.834
+X26.300 Y1.000 Z-0.856
+X26.400 Y1.000 Z-0.879
+X26.500 Y1.000 Z-0.901
+X26.600 Y1.000 Z-0.924
+X26.700 Y1.000 Z-0.947
+X26.800 Y1.000 Z-0.970
+X26.900 Y1.000 Z-0.994
+X27.000 Y1.000 Z-1.017
+X27.100 Y1.000 Z-1.040
+X27.200 Y1.000 Z-1.063
+X27.300 Y1.000 Z-1.086
+X27.400 Y1.000 Z-1.109
+X27.500 Y1.000 Z-1.131
+X27.600 Y1.000 Z-1.154
+X27.700 Y1.000 Z-1.176
+X27.800 Y1.000 Z-1.198
+X27.900 Y1.000 Z-1.220
+X28.000 Y1.000 Z-1.242
+X28.100 Y1.000 Z-1.263
+X28.200 Y1.000 Z-1.284
+X28.300 Y1.000 Z-1.305
+X28.400 Y1.000 Z-1.325
+X28.500 Y1.000 Z-1.345
+X28.600 Y1.000 Z-1.365
+X28.700 Y1.000 Z-1.384
+X28.800 Y1.000 Z-1.402
+X28.900 Y1.000 Z-1.420
+X29.000 Y1.000 Z-1.438
+X29.100 Y1.000 Z-1.455
+X29.200 Y1.000 Z-1.471
+X29.300 Y1.000 Z-1.487
+X29.400 Y1.000 Z-1.503
+X29.500 Y1.000 Z-1.517
+X29.600 Y1.000 Z-1.531
+X29.700 Y1.000 Z-1.545
+X29.800 Y1.000 Z-1.557
+X29.900 Y1.000 Z-1.569
+X30.000 Y1.000 Z-1.581
+X30.000 Y1.500 Z-1.437
+X29.900 Y1.500 Z-1.429
+X29.800 Y1.500 Z-1.420
+X29.700 Y1.500 Z-1.410
+X29.600 Y1.500 Z-1.400
+X29.500 Y1.500 Z-1.390
+X29.400 Y1.500 Z-1.379
+X29.300 Y1.500 Z-1.367
+X29.200 Y1.500 Z-1.355
+X29.100 Y1.500 Z-1.343
+X29.000 Y1.500 Z-1.330
+X28.900 Y1.500 Z-1.317
+X28.800 Y1.500 Z-1.303
+X28.700 Y1.500 Z-1.289
+X28.600 Y1.500 Z-1.275
+X28.500 Y1.500 Z-1.260
+X28.400 Y1.500 Z-1.245
+X28.300 Y1.500 Z-1.230
+X28.200 Y1.500 Z-1.214
+X28.100 Y1.500 Z-1.198
+X28.000 Y1.500 Z-1.182
+X27.900 Y1.500 Z-1.166
+X27.800 Y1.500 Z-1.149
+X27.700 Y1.500 Z-1.133
+X27.600 Y1.500 Z-1.116
+X27.500 Y1.500 Z-1.099
+X27.400 Y1.500 Z-1.082
+X27.300 Y1.500 Z-1.065
+X27.200 Y1.500 Z-1.047
+X27.100 Y1.500 Z-1.030
+X27.000 Y1.500 Z-1.013
+X26.900 Y1.500 Z-0.995
+X26.800 Y1.500 Z-0.978
+X26.700 Y1.500 Z-0.960
+X26.600 Y1.500 Z-0.943
+X26.500 Y1.500 Z-0.926
+X26.400 Y1.500 Z-0.909
+X26.300 Y1.500 Z-0.892
+X26.200 Y1.500 Z-0.875
+X26.100 Y1.500 Z-0.858
+X26.000 Y1.500 Z-0.841
+X25.900 Y1.500 Z-0.825
+X25.800 Y1.500 Z-0.809
+X25.700 Y1.500 Z-0.793
+X25.600 Y1.500 Z-0.777
+X25.500 Y1.500 Z-0.762
+X25.400 Y1.500 Z-0.747
+X25.300 Y1.500 Z-0.732
+X25.200 Y1.500 Z-0.717
+X25.100 Y1.500 Z-0.703
+X25.000 Y1.500 Z-0.689
+X24.900 Y1.500 Z-0.676
+X24.800 Y1.500 Z-0.663
+X24.700 Y1.500 Z-0.650
+X24.600 Y1.500 Z-0.638
+X24.500 Y1.500 Z-0.626
+X24.400 Y1.500 Z-0.615
+X24.300 Y1.500 Z-0.604
+X24.200 Y1.500 Z-0.594
+X24.100 Y1.500 Z-0.584
+X24.000 Y1.500 Z-0.575
+X23.900 Y1.500 Z-0.566
+X23.800 Y1.500 Z-0.558
+X23.700 Y1.500 Z-0.550
+X23.600 Y1.500 Z-0.543
+X23.500 Y1.500 Z-0.537
+X23.400 Y1.500 Z-0.531
+X23.300 Y1.500 Z-0.525
+X23.200 Y1.500 Z-0.520
+X23.100 Y1.500 Z-0.516
+X23.000 Y1.500 Z-0.512
+X22.900 Y1.500 Z-0.509
+X22.800 Y1.500 Z-0.507
+X22.700 Y1.500 Z-0.505
+X22.600 Y1.500 Z-0.503
+X22.500 Y1.500 Z-0.503
+X22.400 Y1.500 Z-0.503
+X22.300 Y1.500 Z-0.503
+X22.200 Y1.500 Z-0.504
+X22.100 Y1.500 Z-0.506
+X22.000 Y1.500 Z-0.509
+X21.900 Y1.500 Z-0.512
+X21.800 Y1.500 Z-0.515
+X21.700 Y1.500 Z-0.519
+X21.600 Y1.500 Z-0.524
+X21.500 Y1.500 Z-0.529
+X21.400 Y1.500 Z-0.535
+X21.300 Y1.500 Z-0.542
+X21.200 Y1.500 Z-0.549
+X21.100 Y1.500 Z-0.556
+X21.000 Y1.500 Z-0.565
+X20.900 Y1.500 Z-0.573
+X20.800 Y1.500 Z-0.582
+X20.700 Y1.500 Z-0.592
+X20.600 Y1.500 Z-0.602
+X20.500 Y1.500 Z-0.613
+X20.400 Y1.500 Z-0.624
+X20.300 Y1.500 Z-0.636
+X20.200 Y1.500 Z-0.648
+X20.100 Y1.500 Z-0.660
+X20.000 Y1.500 Z-0.673
+X19.900 Y1.500 Z-0.687
+X19.800 Y1.500 Z-0.700
+X19.700 Y1.500 Z-0.714
+X19.600 Y1.500 Z-0.729
+X19.500 Y1.500 Z-0.744
+X19.400 Y1.500 Z-0.759
+X19.300 Y1.500 Z-0.774
+X19.200 Y1.500 Z-0.790
+X19.100 Y1.500 Z-0.806
+X19.000 Y1.500 Z-0.822
+X18.900 Y1.500 Z-0.838
+X18.800 Y1.500 Z-0.855
+X18.700 Y1.500 Z-0.871
+X18.600 Y1.500 Z-0.888
+X18.500 Y1.500 Z-0.905
+X18.400 Y1.500 Z-0.922
+X18.300 Y1.500 Z-0.940
+X18.200 Y1.500 Z-0.957
+X18.100 Y1.500 Z-0.974
+X18.000 Y1.500 Z-0.992
+X17.900 Y1.500 Z-1.009
+X17.800 Y1.500 Z-1.026
+X17.700 Y1.500 Z-1.044
+X17.600 Y1.500 Z-1.061
+X17.500 Y1.500 Z-1.078
+X17.400 Y1.500 Z-1.095
+X17.300 Y1.500 Z-1.112
+X17.200 Y1.500 Z-1.129
+X17.100 Y1.500 Z-1.146
+X17.000 Y1.500 Z-1.163
+X16.900 Y1.500 Z-1.179
+X16.800 Y1.500 Z-1.195
+X16.700 Y1.500 Z-1.211
+X16.600 Y1.500 Z-1.227
+X16.500 Y1.500 Z-1.242
+X16.400 Y1.500 Z-1.257
+X16.300 Y1.500 Z-1.272
+X16.200 Y1.500 Z-1.286
+X16.100 Y1.500 Z-1.300
+X16.000 Y1.500 Z-1.314
+X15.900 Y1.500 Z-1.327
+X15.800 Y1.500 Z-1.340
+X15.700 Y1.500 Z-1.353
+X15.600 Y1.500 Z-1.365
+X15.500 Y1.500 Z-1.376
+X15.400 Y1.500 Z-1.387
+X15.300 Y1.500 Z-1.398
+X15.200 Y1.500 Z-1.408
+X15.100 Y1.500 Z-1.418
+X15.000 Y1.500 Z-1.427
+X14.900 Y1.500 Z-1.436
+X14.800 Y1.500 Z-1.444
+X14.700 Y1.500 Z-1.451
+X14.600 Y1.500 Z-1.458
+X14.500 Y1.500 Z-1.465
+X14.400 Y1.500 Z-1.471
+X14.300 Y1.500 Z-1.476
+X14.200 Y1.500 Z-1.481
+X14.100 Y1.500 Z-1.485
+X14.000 Y1.500 Z-1.489
+X13.900 Y1.500 Z-1.492
+X13.800 Y1.500 Z-1.494
+X13.700 Y1.500 Z-1.496
+X13.600 Y1.500 Z-1.497
+X13.500 Y1.500 Z-1.497
+X13.400 Y1.500 Z-1.497
+X13.300 Y1.500 Z-1.496
+X13.200 Y1.500 Z-1.495
+X13.100 Y1.500 Z-1.493
+X13.000 Y1.500 Z-1.491
+X12.900 Y1.500 Z-1.488
+X12.800 Y1.500 Z-1.484
+X12.700 Y1.500 Z-1.480
+X12.600 Y1.500 Z-1.475
+X12.500 Y1.500 Z-1.469
+X12.400 Y1.500 Z-1.463
+X12.300 Y1.500 Z-1.457
+X12.200 Y1.500 Z-1.449
+X12.100 Y1.500 Z-1.442
+X12.000 Y1.500 Z-1.433
+X11.900 Y1.500 Z-1.425
+X11.800 Y1.500 Z-1.415
+X11.700 Y1.500 Z-1.405
+X11.600 Y1.500 Z-1.395
+X11.500 Y1.500 Z-1.384
+X11.400 Y1.500 Z-1.373
+X11.300 Y1.500 Z-1.361
+X11.200 Y1.500 Z-1.349
+X11.100 Y1.500 Z-1.337
+X11.000 Y1.500 Z-1.324
+X10.900 Y1.500 Z-1.310
+X10.800 Y1.500 Z-1.296
+X10.700 Y1.500 Z-1.282
+X10.600 Y1.500 Z-1.268
+X10.500 Y1.500 Z-1.253
+X10.400 Y1.500 Z-1.238
+X10.300 Y1.500 Z-1.222
+X10.200 Y1.500 Z-1.207
+X10.100 Y1.500 Z-1.191
+X10.000 Y1.500 Z-1.174
+X9.900 Y1.500 Z-1.158
+X9.800 Y1.500 Z-1.141
+X9.700 Y1.500 Z-1.125
+X9.600 Y1.500 Z-1.108
+X9.500 Y1.500 Z-1.091
+X9.400 Y1.500 Z-1.074
+X9.300 Y1.500 Z-1.056
+X9.200 Y1.500 Z-1.039
+X9.100 Y1.500 Z-1.022
+X9.000 Y1.500 Z-1.004
+X8.900 Y1.500 Z-0.987
+X8.800 Y1.500 Z-0.969
+X8.700 Y1.500 Z-0.952
+X8.600 Y1.500 Z-0.935
+X8.500 Y1.500 Z-0.918
+X8.400 Y1.500 Z-0.900
+X8.300 Y1.500 Z-0.883
+X8.200 Y1.500 Z-0.867
+X8.100 Y1.500 Z-0.850
+X8.000 Y1.500 Z-0.833
+X7.900 Y1.500 Z-0.817
+X7.800 Y1.500 Z-0.801
+X7.700 Y1.500 Z-0.785
+X7.600 Y1.500 Z-0.770
+X7.500 Y1.500 Z-0.754
+X7.400 Y1.500 Z-0.739
+X7.300 Y1.500 Z-0.725
+X7.200 Y1.500 Z-0.710
+X7.100 Y1.500 Z-0.696
+X7.000 Y1.500 Z-0.683
+X6.900 Y1.500 Z-0.670
+X6.800 Y1.500 Z-0.657
+X6.700 Y1.500 Z-0.644
+X6.600 Y1.500 Z-0.633
+X6.500 Y1.500 Z-0.621
+X6.400 Y1.500 Z-0.610
+X6.300 Y1.500 Z-0.599
+X6.200 Y1.500 Z-0.589
+X6.100 Y1.500 Z-0.580
+X6.000 Y1.500 Z-0.571
+X5.900 Y1.500 Z-0.562
+X5.800 Y1.500 Z-0.554
+X5.700 Y1.500 Z-0.547
+X5.600 Y1.500 Z-0.540
+X5.500 Y1.500 Z-0.534
+X5.400 Y1.500 Z-0.528
+X5.300 Y1.500 Z-0.523
+X5.200 Y1.500 Z-0.518
+X5.100 Y1.500 Z-0.514
+X5.000 Y1.500 Z-0.511
+X4.900 Y1.500 Z-0.508
+X4.800 Y1.500 Z-0.506
+X4.700 Y1.500 Z-0.504
+X4.600 Y1.500 Z-0.503
+X4.500 Y1.500 Z-0.503
+X4.400 Y1.500 Z-0.503
+X4.300 Y1.500 Z-0.504
+X4.200 Y1.500 Z-0.505
+X4.100 Y1.500 Z-0.507
+X4.000 Y1.500 Z-0.510
+X3.900 Y1.500 Z-0.513
+X3.800 Y1.500 Z-0.517
+X3.700 Y1.500 Z-0.522
+X3.600 Y1.500 Z-0.527
+X3.500 Y1.500 Z-0.532
+X3.400 Y1.500 Z-0.538
+X3.300 Y1.500 Z-0.545
+X3.200 Y1.500 Z-0.552
+X3.100 Y1.500 Z-0.560
+X3.000 Y1.500 Z-0.569
+X2.900 Y1.500 Z-0.578
+X2.800 Y1.500 Z-0.587
+X2.700 Y1.500 Z-0.597
+X2.600 Y1.500 Z-0.607
+X2.500 Y1.500 Z-0.618
+X2.400 Y1.500 Z-0.630
+X2.300 Y1.500 Z-0.642
+X2.200 Y1.500 Z-0.654
+X2.100 Y1.500 Z-0.667
+X2.000 Y1.500 Z-0.680
+X1.900 Y1.500 Z-0.693
+X1.800 Y1.500 Z-0.707
+X1.700 Y1.500 Z-0.721
+X1.600 Y1.500 Z-0.736
+X1.500 Y1.500 Z-0.751
+X1.400 Y1.500 Z-0.766
+X1.300 Y1.500 Z-0.781
+X1.200 Y1.500 Z-0.797
+X1.100 Y1.500 Z-0.813
+X1.000 Y1.500 Z-0.829
+X0.900 Y1.500 Z-0.846
+X0.800 Y1.500 Z-0.863
+X0.700 Y1.500 Z-0.879
+X0.600 Y1.500 Z-0.896
+X0.500 Y1.500 Z-0.913
+X0.400 Y1.500 Z-0.931
+X0.300 Y1.500 Z-0.948
+X0.200 Y1.500 Z-0.965
+X0.100 Y1.500 Z-0.983
+X0.000 Y1.500 Z-1.000
+X0.000 Y2.000 Z-1.000
+X0.100 Y2.000 Z-0.990
+X0.200 Y2.000 Z-0.980
+X0.300 Y2.000 Z-0.970
+X0.400 Y2.000 Z-0.960
+X0.500 Y2.000 Z-0.950
+X0.600 Y2.000 Z-0.940
+X0.700 Y2.000 Z-0.930
+X0.800 Y2.000 Z-0.920
+X0.900 Y2.000 Z-0.910
+X1.000 Y2.000 Z-0.901
+X1.100 Y2.000 Z-0.891
+X1.200 Y2.000 Z-0.882
+X1.300 Y2.000 Z-0.873
+X1.400 Y2.000 Z-0.864
+X1.500 Y2.000 Z-0.855
+X1.600 Y2.000 Z-0.846
+X1.700 Y2.000 Z-0.838
+X1.800 Y2.000 Z-0.829
+X1.900 Y2.000 Z-0.821
+X2.000 Y2.000 Z-0.813
+X2.100 Y2.000 Z-0.806
+X2.200 Y2.000 Z-0.798
+X2.300 Y2.000 Z-0.791
+X2.400 Y2.000 Z-0.784
+X2.500 Y2.000 Z-0.777
+X2.600 Y2.000 Z-0.771
+X2.700 Y2.000 Z-0.765
+X2.800 Y2.000 Z-0.759
+X2.900 Y2.000 Z-0.754
+X3.000 Y2.000 Z-0.749
+X3.100 Y2.000 Z-0.744
+X3.200 Y2.000 Z-0.739
+X3.300 Y2.000 Z-0.735
+X3.400 Y2.000 Z-0.731
+X3.500 Y2.000 Z-0.727
+X3.600 Y2.000 Z-0.724
+X3.700 Y2.000 Z-0.721
+X3.800 Y2.000 Z-0.718
+X3.900 Y2.000 Z-0.716
+X4.000 Y2.000 Z-0.714
+X4.100 Y2.000 Z-0.713
+X4.200 Y2.000 Z-0.712
+X4.300 Y2.000 Z-0.711
+X4.400 Y2.000 Z-0.710
+X4.500 Y2.000 Z-0.710
+X4.600 Y2.000 Z-0.710
+X4.700 Y2.000 Z-0.711
+X4.800 Y2.000 Z-0.712
+X4.900 Y2.000 Z-0.713
+X5.000 Y2.000 Z-0.715
+X5.100 Y2.000 Z-0.717
+X5.200 Y2.000 Z-0.719
+X5.300 Y2.000 Z-0.722
+X5.400 Y2.000 Z-0.725
+X5.500 Y2.000 Z-0.728
+X5.600 Y2.000 Z-0.732
+X5.700 Y2.000 Z-0.736
+X5.800 Y2.000 Z-0.740
+X5.900 Y2.000 Z-0.745
+X6.000 Y2.000 Z-0.750
+X6.100 Y2.000 Z-0.755
+X6.200 Y2.000 Z-0.761
+X6.300 Y2.000 Z-0.766
+X6.400 Y2.000 Z-0.773
+X6.500 Y2.000 Z-0.779
+X6.600 Y2.000 Z-0.786
+X6.700 Y2.000 Z-0.793
+X6.800 Y2.000 Z-0.800
+X6.900 Y2.000 Z-0.807
+X7.000 Y2.000 Z-0.815
+X7.100 Y2.000 Z-0.823
+X7.200 Y2.000 Z-0.831
+X7.300 Y2.000 Z-0.840
+X7.400 Y2.000 Z-0.848
+X7.500 Y2.000 Z-0.857
+X7.600 Y2.000 Z-0.866
+X7.700 Y2.000 Z-0.875
+X7.800 Y2.000 Z-0.884
+X7.900 Y2.000 Z-0.893
+X8.000 Y2.000 Z-0.903
+X8.100 Y2.000 Z-0.913
+X8.200 Y2.000 Z-0.922
+X8.300 Y2.000 Z-0.932
+X8.400 Y2.000 Z-0.942
+X8.500 Y2.000 Z-0.952
+X8.600 Y2.000 Z-0.962
+X8.700 Y2.000 Z-0.972
+X8.800 Y2.000 Z-0.982
+X8.900 Y2.000 Z-0.992
+X9.000 Y2.000 Z-1.002
+X9.100 Y2.000 Z-1.013
+X9.200 Y2.000 Z-1.023
+X9.300 Y2.000 Z-1.033
+X9.400 Y2.000 Z-1.043
+X9.500 Y2.000 Z-1.053
+X9.600 Y2.000 Z-1.063
+X9.700 Y2.000 Z-1.073
+X9.800 Y2.000 Z-1.082
+X9.900 Y2.000 Z-1.092
+X10.000 Y2.000 Z-1.102
+X10.100 Y2.000 Z-1.111
+X10.200 Y2.000 Z-1.120
+X10.300 Y2.000 Z-1.130
+X10.400 Y2.000 Z-1.139
+X10.500 Y2.000 Z-1.147
+X10.600 Y2.000 Z-1.156
+X10.700 Y2.000 Z-1.164
+X10.800 Y2.000 Z-1.173
+X10.900 Y2.000 Z-1.181
+X11.000 Y2.000 Z-1.189
+X11.100 Y2.000 Z-1.196
+X11.200 Y2.000 Z-1.204
+X11.300 Y2.000 Z-1.211
+X11.400 Y2.000 Z-1.217
+X11.500 Y2.000 Z-1.224
+X11.600 Y2.000 Z-1.230
+X11.700 Y2.000 Z-1.236
+X11.800 Y2.000 Z-1.242
+X11.900 Y2.000 Z-1.248
+X12.000 Y2.000 Z-1.253
+X12.100 Y2.000 Z-1.257
+X12.200 Y2.000 Z-1.262
+X12.300 Y2.000 Z-1.266
+X12.400 Y2.000 Z-1.270
+X12.500 Y2.000 Z-1.274
+X12.600 Y2.000 Z-1.277
+X12.700 Y2.000 Z-1.280
+X12.800 Y2.000 Z-1.282
+X12.900 Y2.000 Z-1.284
+X13.000 Y2.000 Z-1.286
+X13.100 Y2.000 Z-1.288
+X13.200 Y2.000 Z-1.289
+X13.300 Y2.000 Z-1.289
+X13.400 Y2.000 Z-1.290
+X13.500 Y2.000 Z-1.290
+X13.600 Y2.000 Z-1.290
+X13.700 Y2.000 Z-1.289
+X13.800 Y2.000 Z-1.288
+X13.900 Y2.000 Z-1.287
+X14.000 Y2.000 Z-1.285
+X14.100 Y2.000 Z-1.283
+X14.200 Y2.000 Z-1.280
+X14.300 Y2.000 Z-1.278
+X14.400 Y2.000 Z-1.274
+X14.500 Y2.000 Z-1.271
+X14.600 Y2.000 Z-1.267
+X14.700 Y2.000 Z-1.263
+X14.800 Y2.000 Z-1.259
+X14.900 Y2.000 Z-1.254
+X15.000 Y2.000 Z-1.249
+X15.100 Y2.000 Z-1.244
+X15.200 Y2.000 Z-1.238
+X15.300 Y2.000 Z-1.232
+X15.400 Y2.000 Z-1.226
+X15.500 Y2.000 Z-1.219
+X15.600 Y2.000 Z-1.213
+X15.700 Y2.000 Z-1.206
+X15.800 Y2.000 Z-1.198
+X15.900 Y2.000 Z-1.191
+X16.000 Y2.000 Z-1.183
+X16.100 Y2.000 Z-1.175
+X16.200 Y2.000 Z-1.167
+X16.300 Y2.000 Z-1.158
+X16.400 Y2.000 Z-1.150
+X16.500 Y2.000 Z-1.141
+X16.600 Y2.000 Z-1.132
+X16.700 Y2.000 Z-1.123
+X16.800 Y2.000 Z-1.114
+X16.900 Y2.000 Z-1.104
+X17.000 Y2.000 Z-1.095
+X17.100 Y2.000 Z-1.085
+X17.200 Y2.000 Z-1.075
+X17.300 Y2.000 Z-1.066
+X17.400 Y2.000 Z-1.056
+X17.500 Y2.000 Z-1.046
+X17.600 Y2.000 Z-1.036
+X17.700 Y2.000 Z-1.026
+X17.800 Y2.000 Z-1.015
+X17.900 Y2.000 Z-1.005
+X18.000 Y2.000 Z-0.995
+X18.100 Y2.000 Z-0.985
+X18.200 Y2.000 Z-0.975
+X18.300 Y2.000 Z-0.965
+X18.400 Y2.000 Z-0.955
+X18.500 Y2.000 Z-0.945
+X18.600 Y2.000 Z-0.935
+X18.700 Y2.000 Z-0.925
+X18.800 Y2.000 Z-0.915
+X18.900 Y2.000 Z-0.906
+X19.000 Y2.000 Z-0.896
+X19.100 Y2.000 Z-0.887
+X19.200 Y2.000 Z-0.877
+X19.300 Y2.000 Z-0.868
+X19.400 Y2.000 Z-0.859
+X19.500 Y2.000 Z-0.851
+X19.600 Y2.000 Z-0.842
+X19.700 Y2.000 Z-0.834
+X19.800 Y2.000 Z-0.825
+X19.900 Y2.000 Z-0.817
+X20.000 Y2.000 Z-0.810
+X20.100 Y2.000 Z-0.802
+X20.200 Y2.000 Z-0.795
+X20.300 Y2.000 Z-0.788
+X20.400 Y2.000 Z-0.781
+X20.500 Y2.000 Z-0.774
+X20.600 Y2.000 Z-0.768
+X20.700 Y2.000 Z-0.762
+X20.800 Y2.000 Z-0.757
+X20.900 Y2.000 Z-0.751
+X21.000 Y2.000 Z-0.746
+X21.100 Y2.000 Z-0.741
+X21.200 Y2.000 Z-0.737
+X21.300 Y2.000 Z-0.733
+X21.400 Y2.000 Z-0.729
+X21.500 Y2.000 Z-0.726
+X21.600 Y2.000 Z-0.723
+X21.700 Y2.000 Z-0.720
+X21.800 Y2.000 Z-0.717
+X21.900 Y2.000 Z-0.715
+X22.000 Y2.000 Z-0.714
+X22.100 Y2.000 Z-0.712
+X22.200 Y2.000 Z-0.711
+X22.300 Y2.000 Z-0.710
+X22.400 Y2.000 Z-0.710
+X22.500 Y2.000 Z-0.710
+X22.600 Y2.000 Z-0.711
+X22.700 Y2.000 Z-0.711
+X22.800 Y2.000 Z-0.712
+X22.900 Y2.000 Z-0.714
+X23.000 Y2.000 Z-0.716
+X23.100 Y2.000 Z-0.718
+X23.200 Y2.000 Z-0.720
+X23.300 Y2.000 Z-0.723
+X23.400 Y2.000 Z-0.726
+X23.500 Y2.000 Z-0.730
+X23.600 Y2.000 Z-0.734
+X23.700 Y2.000 Z-0.738
+X23.800 Y2.000 Z-0.742
+X23.900 Y2.000 Z-0.747
+X24.000 Y2.000 Z-0.752
+X24.100 Y2.000 Z-0.758
+X24.200 Y2.000 Z-0.763
+X24.300 Y2.000 Z-0.769
+X24.400 Y2.000 Z-0.776
+X24.500 Y2.000 Z-0.782
+X24.600 Y2.000 Z-0.789
+X24.700 Y2.000 Z-0.796
+X24.800 Y2.000 Z-0.804
+X24.900 Y2.000 Z-0.811
+X25.000 Y2.000 Z-0.819
+X25.100 Y2.000 Z-0.827
+X25.200 Y2.000 Z-0.835
+X25.300 Y2.000 Z-0.844
+X25.400 Y2.000 Z-0.852
+X25.500 Y2.000 Z-0.861
+X25.600 Y2.000 Z-0.870
+X25.700 Y2.000 Z-0.879
+X25.800 Y2.000 Z-0.889
+X25.900 Y2.000 Z-0.898
+X26.000 Y2.000 Z-0.907
+X26.100 Y2.000 Z-0.917
+X26.200 Y2.000 Z-0.927
+X26.300 Y2.000 Z-0.937
+X26.400 Y2.000 Z-0.947
+X26.500 Y2.000 Z-0.957
+X26.600 Y2.000 Z-0.967
+X26.700 Y2.000 Z-0.977
+X26.800 Y2.000 Z-0.987
+X26.900 Y2.000 Z-0.997
+X27.000 Y2.000 Z-1.007
+X27.100 Y2.000 Z-1.017
+X27.200 Y2.000 Z-1.028
+X27.300 Y2.000 Z-1.038
+X27.400 Y2.000 Z-1.048
+X27.500 Y2.000 Z-1.058
+X27.600 Y2.000 Z-1.068
+X27.700 Y2.000 Z-1.077
+X27.800 Y2.000 Z-1.087
+X27.900 Y2.000 Z-1.097
+X28.000 Y2.000 Z-1.106
+X28.100 Y2.000 Z-1.116
+X28.200 Y2.000 Z-1.125
+X28.300 Y2.000 Z-1.134
+X28.400 Y2.000 Z-1.143
+X28.500 Y2.000 Z-1.152
+X28.600 Y2.000 Z-1.160
+X28.700 Y2.000 Z-1.168
+X28.800 Y2.000 Z-1.177
+X28.900 Y2.000 Z-1.185
+X29.000 Y2.000 Z-1.192
+X29.100 Y2.000 Z-1.200
+X29.200 Y2.000 Z-1.207
+X29.300 Y2.000 Z-1.214
+X29.400 Y2.000 Z-1.221
+X29.500 Y2.000 Z-1.227
+X29.600 Y2.000 Z-1.233
+X29.700 Y2.000 Z-1.239
+X29.800 Y2.000 Z-1.245
+X29.900 Y2.000 Z-1.250
+X30.000 Y2.000 Z-1.255
+X30.000 Y2.500 Z-1.050
+X29.900 Y2.500 Z-1.049
+X29.800 Y2.500 Z-1.048
+X29.700 Y2.500 Z-1.047
+X29.600 Y2.500 Z-1.046
+X29.500 Y2.500 Z-1.044
+X29.400 Y2.500 Z-1.043
+X29.300 Y2.500 Z-1.042
+X29.200 Y2.500 Z-1.040
+X29.100 Y2.500 Z-1.039
+X29.000 Y2.500 Z-1.038
+X28.900 Y2.500 Z-1.036
+X28.800 Y2.500 Z-1.034
+X28.700 Y2.500 Z-1.033
+X28.600 Y2.500 Z-1.031
+X28.500 Y2.500 Z-1.030
+X28.400 Y2.500 Z-1.028
+X28.300 Y2.500 Z-1.026
+X28.200 Y2.500 Z-1.024
+X28.100 Y2.500 Z-1.023
+X28.000 Y2.500 Z-1.021
+X27.900 Y2.500 Z-1.019
+X27.800 Y2.500 Z-1.017
+X27.700 Y2.500 Z-1.015
+X27.600 Y2.500 Z-1.013
+X27.500 Y2.500 Z-1.011
+X27.400 Y2.500 Z-1.009
+X27.300 Y2.500 Z-1.007
+X27.200 Y2.500 Z-1.005
+X27.100 Y2.500 Z-1.003
+X27.000 Y2.500 Z-1.001
+X26.900 Y2.500 Z-0.999
+X26.800 Y2.500 Z-0.997
+X26.700 Y2.500 Z-0.995
+X26.600 Y2.500 Z-0.994
+X26.500 Y2.500 Z-0.992
+X26.400 Y2.500 Z-0.990
+X26.300 Y2.500 Z-0.988
+X26.200 Y2.500 Z-0.986
+X26.100 Y2.500 Z-0.984
+X26.000 Y2.500 Z-0.982
+X25.900 Y2.500 Z-0.980
+X25.800 Y2.500 Z-0.978
+X25.700 Y2.500 Z-0.976
+X25.600 Y2.500 Z-0.975
+X25.500 Y2.500 Z-0.973
+X25.400 Y2.500 Z-0.971
+X25.300 Y2.500 Z-0.969
+X25.200 Y2.500 Z-0.968
+X25.100 Y2.500 Z-0.966
+X25.000 Y2.500 Z-0.965
+X24.900 Y2.500 Z-0.963
+X24.800 Y2.500 Z-0.962
+X24.700 Y2.500 Z-0.960
+X24.600 Y2.500 Z-0.959
+X24.500 Y2.500 Z-0.957
+X24.400 Y2.500 Z-0.956
+X24.300 Y2.500 Z-0.955
+X24.200 Y2.500 Z-0.954
+X24.100 Y2.500 Z-0.953
+X24.000 Y2.500 Z-0.952
+X23.900 Y2.500 Z-0.951
+X23.800 Y2.500 Z-0.950
+X23.700 Y2.500 Z-0.949
+X23.600 Y2.500 Z-0.948
+X23.500 Y2.500 Z-0.947
+X23.400 Y2.500 Z-0.947
+X23.300 Y2.500 Z-0.946
+X23.200 Y2.500 Z-0.945
+X23.100 Y2.500 Z-0.945
+X23.000 Y2.500 Z-0.944
+X22.900 Y2.500 Z-0.944
+X22.800 Y2.500 Z-0.944
+X22.700 Y2.500 Z-0.944
+X22.600 Y2.500 Z-0.943
+X22.500 Y2.500 Z-0.943
+X22.400 Y2.500 Z-0.943
+X22.300 Y2.500 Z-0.943
+X22.200 Y2.500 Z-0.944
+X22.100 Y2.500 Z-0.944
+X22.000 Y2.500 Z-0.944
+X21.900 Y2.500 Z-0.944
+X21.800 Y2.500 Z-0.945
+X21.700 Y2.500 Z-0.945
+X21.600 Y2.500 Z-0.946
+X21.500 Y2.500 Z-0.946
+X21.400 Y2.500 Z-0.947
+X21.300 Y2.500 Z-0.948
+X21.200 Y2.500 Z-0.949
+X21.100 Y2.500 Z-0.950
+X21.000 Y2.500 Z-0.950
+X20.900 Y2.500 Z-0.951
+X20.800 Y2.500 Z-0.952
+X20.700 Y2.500 Z-0.954
+X20.600 Y2.500 Z-0.955
+X20.500 Y2.500 Z-0.956
+X20.400 Y2.500 Z-0.957
+X20.300 Y2.500 Z-0.959
+X20.200 Y2.500 Z-0.960
+X20.100 Y2.500 Z-0.961
+X20.000 Y2.500 Z-0.963
+X19.900 Y2.500 Z-0.964
+X19.800 Y2.500 Z-0.966
+X19.700 Y2.500 Z-0.967
+X19.600 Y2.500 Z-0.969
+X19.500 Y2.500 Z-0.971
+X19.400 Y2.500 Z-0.973
+X19.300 Y2.500 Z-0.974
+X19.200 Y2.500 Z-0.976
+X19.100 Y2.500 Z-0.978
+X19.000 Y2.500 Z-0.980
+X18.900 Y2.500 Z-0.982
+X18.800 Y2.500 Z-0.983
+X18.700 Y2.500 Z-0.985
+X18.600 Y2.500 Z-0.987
+X18.500 Y2.500 Z-0.989
+X18.400 Y2.500 Z-0.991
+X18.300 Y2.500 Z-0.993
+X18.200 Y2.500 Z-0.995
+X18.100 Y2.500 Z-0.997
+X18.000 Y2.500 Z-0.999
+X17.900 Y2.500 Z-1.001
+X17.800 Y2.500 Z-1.003
+X17.700 Y2.500 Z-1.005
+X17.600 Y2.500 Z-1.007
+X17.500 Y2.500 Z-1.009
+X17.400 Y2.500 Z-1.011
+X17.300 Y2.500 Z-1.013
+X17.200 Y2.500 Z-1.015
+X17.100 Y2.500 Z-1.017
+X17.000 Y2.500 Z-1.019
+X16.900 Y2.500 Z-1.020
+X16.800 Y2.500 Z-1.022
+X16.700 Y2.500 Z-1.024
+X16.600 Y2.500 Z-1.026
+X16.500 Y2.500 Z-1.028
+X16.400 Y2.500 Z-1.029
+X16.300 Y2.500 Z-1.031
+X16.200 Y2.500 Z-1.033
+X16.100 Y2.500 Z-1.034
+X16.000 Y2.500 Z-1.036
+X15.900 Y2.500 Z-1.037
+X15.800 Y2.500 Z-1.039
+X15.700 Y2.500 Z-1.040
+X15.600 Y2.500 Z-1.041
+X15.500 Y2.500 Z-1.043
+X15.400 Y2.500 Z-1.044
+X15.300 Y2.500 Z-1.045
+X15.200 Y2.500 Z-1.046
+X15.100 Y2.500 Z-1.048
+X15.000 Y2.500 Z-1.049
+X14.900 Y2.500 Z-1.050
+X14.800 Y2.500 Z-1.051
+X14.700 Y2.500 Z-1.051
+X14.600 Y2.500 Z-1.052
+X14.500 Y2.500 Z-1.053
+X14.400 Y2.500 Z-1.054
+X14.300 Y2.500 Z-1.054
+X14.200 Y2.500 Z-1.055
+X14.100 Y2.500 Z-1.055
+X14.000 Y2.500 Z-1.056
+X13.900 Y2.500 Z-1.056
+X13.800 Y2.500 Z-1.056
+X13.700 Y2.500 Z-1.056
+X13.600 Y2.500 Z-1.057
+X13.500 Y2.500 Z-1.057
+X13.400 Y2.500 Z-1.057
+X13.300 Y2.500 Z-1.056
+X13.200 Y2.500 Z-1.056
+X13.100 Y2.500 Z-1.056
+X13.000 Y2.500 Z-1.056
+X12.900 Y2.500 Z-1.055
+X12.800 Y2.500 Z-1.055
+X12.700 Y2.500 Z-1.055
+X12.600 Y2.500 Z-1.054
+X12.500 Y2.500 Z-1.053
+X12.400 Y2.500 Z-1.053
+X12.300 Y2.500 Z-1.052
+X12.200 Y2.500 Z-1.051
+X12.100 Y2.500 Z-1.050
+X12.000 Y2.500 Z-1.049
+X11.900 Y2.500 Z-1.048
+X11.800 Y2.500 Z-1.047
+X11.700 Y2.500 Z-1.046
+X11.600 Y2.500 Z-1.045
+X11.500 Y2.500 Z-1.044
+X11.400 Y2.500 Z-1.042
+X11.300 Y2.500 Z-1.041
+X11.200 Y2.500 Z-1.040
+X11.100 Y2.500 Z-1.038
+X11.000 Y2.500 Z-1.037
+X10.900 Y2.500 Z-1.035
+X10.800 Y2.500 Z-1.034
+X10.700 Y2.500 Z-1.032
+X10.600 Y2.500 Z-1.030
+X10.500 Y2.500 Z-1.029
+X10.400 Y2.500 Z-1.027
+X10.300 Y2.500 Z-1.025
+X10.200 Y2.500 Z-1.024
+X10.100 Y2.500 Z-1.022
+X10.000 Y2.500 Z-1.020
+X9.900 Y2.500 Z-1.018
+X9.800 Y2.500 Z-1.016
+X9.700 Y2.500 Z-1.014
+X9.600 Y2.500 Z-1.012
+X9.500 Y2.500 Z-1.010
+X9.400 Y2.500 Z-1.008
+X9.300 Y2.500 Z-1.006
+X9.200 Y2.500 Z-1.004
+X9.100 Y2.500 Z-1.002
+X9.000 Y2.500 Z-1.000
+X8.900 Y2.500 Z-0.998
+X8.800 Y2.500 Z-0.997
+X8.700 Y2.500 Z-0.995
+X8.600 Y2.500 Z-0.993
+X8.500 Y2.500 Z-0.991
+X8.400 Y2.500 Z-0.989
+X8.300 Y2.500 Z-0.987
+X8.200 Y2.500 Z-0.985
+X8.100 Y2.500 Z-0.983
+X8.000 Y2.500 Z-0.981
+X7.900 Y2.500 Z-0.979
+X7.800 Y2.500 Z-0.977
+X7.700 Y2.500 Z-0.976
+X7.600 Y2.500 Z-0.974
+X7.500 Y2.500 Z-0.972
+X7.400 Y2.500 Z-0.970
+X7.300 Y2.500 Z-0.969
+X7.200 Y2.500 Z-0.967
+X7.100 Y2.500 Z-0.965
+X7.000 Y2.500 Z-0.964
+X6.900 Y2.500 Z-0.962
+X6.800 Y2.500 Z-0.961
+X6.700 Y2.500 Z-0.960
+X6.600 Y2.500 Z-0.958
+X6.500 Y2.500 Z-0.957
+X6.400 Y2.500 Z-0.956
+X6.300 Y2.500 Z-0.954
+X6.200 Y2.500 Z-0.953
+X6.100 Y2.500 Z-0.952
+X6.000 Y2.500 Z-0.951
+X5.900 Y2.500 Z-0.950
+X5.800 Y2.500 Z-0.949
+X5.700 Y2.500 Z-0.948
+X5.600 Y2.500 Z-0.948
+X5.500 Y2.500 Z-0.947
+X5.400 Y2.500 Z-0.946
+X5.300 Y2.500 Z-0.946
+X5.200 Y2.500 Z-0.945
+X5.100 Y2.500 Z-0.945
+X5.000 Y2.500 Z-0.944
+X4.900 Y2.500 Z-0.944
+X4.800 Y2.500 Z-0.944
+X4.700 Y2.500 Z-0.944
+X4.600 Y2.500 Z-0.943
+X4.500 Y2.500 Z-0.943
+X4.400 Y2.500 Z-0.943
+X4.300 Y2.500 Z-0.944
+X4.200 Y2.500 Z-0.944
+X4.100 Y2.500 Z-0.944
+X4.000 Y2.500 Z-0.944
+X3.900 Y2.500 Z-0.945
+X3.800 Y2.500 Z-0.945
+X3.700 Y2.500 Z-0.946
+X3.600 Y2.500 Z-0.946
+X3.500 Y2.500 Z-0.947
+X3.400 Y2.500 Z-0.947
+X3.300 Y2.500 Z-0.948
+X3.200 Y2.500 Z-0.949
+X3.100 Y2.500 Z-0.950
+X3.000 Y2.500 Z-0.951
+X2.900 Y2.500 Z-0.952
+X2.800 Y2.500 Z-0.953
+X2.700 Y2.500 Z-0.954
+X2.600 Y2.500 Z-0.955
+X2.500 Y2.500 Z-0.957
+X2.400 Y2.500 Z-0.958
+X2.300 Y2.500 Z-0.959
+X2.200 Y2.500 Z-0.961
+X2.100 Y2.500 Z-0.962
+X2.000 Y2.500 Z-0.964
+X1.900 Y2.500 Z-0.965
+X1.800 Y2.500 Z-0.967
+X1.700 Y2.500 Z-0.968
+X1.600 Y2.500 Z-0.970
+X1.500 Y2.500 Z-0.972
+X1.400 Y2.500 Z-0.973
+X1.300 Y2.500 Z-0.975
+X1.200 Y2.500 Z-0.977
+X1.100 Y2.500 Z-0.979
+X1.000 Y2.500 Z-0.981
+X0.900 Y2.500 Z-0.982
+X0.800 Y2.500 Z-0.984
+X0.700 Y2.500 Z-0.986
+X0.600 Y2.500 Z-0.988
+X0.500 Y2.500 Z-0.990
+X0.400 Y2.500 Z-0.992
+X0.300 Y2.500 Z-0.994
+X0.200 Y2.500 Z-0.996
+X0.100 Y2.500 Z-0.998
+X0.000 Y2.500 Z-1.000
+X0.000 Y3.000 Z-1.000
+X0.100 Y3.000 Z-1.006
+X0.200 Y3.000 Z-1.013
+X0.300 Y3.000 Z-1.019
+X0.400 Y3.000 Z-1.025
+X0.500 Y3.000 Z-1.032
+X0.600 Y3.000 Z-1.038
+X0.700 Y3.000 Z-1.044
+X0.800 Y3.000 Z-1.050
+X0.900 Y3.000 Z-1.056
+X1.000 Y3.000 Z-1.062
+X1.100 Y3.000 Z-1.068
+X1.200 Y3.000 Z-1.074
+X1.300 Y3.000 Z-1.080
+X1.400 Y3.000 Z-1.086
+X1.500 Y3.000 Z-1.091
+X1.600 Y3.000 Z-1.097
+X1.700 Y3.000 Z-1.102
+X1.800 Y3.000 Z-1.107
+X1.900 Y3.000 Z-1.112
+X2.000 Y3.000 Z-1.117
+X2.100 Y3.000 Z-1.122
+X2.200 Y3.000 Z-1.127
+X2.300 Y3.000 Z-1.131
+X2.400 Y3.000 Z-1.135
+X2.500 Y3.000 Z-1.140
+X2.600 Y3.000 Z-1.144
+X2.700 Y3.000 Z-1.147
+X2.800 Y3.000 Z-1.151
+X2.900 Y3.000 Z-1.154
+X3.000 Y3.000 Z-1.158
+X3.100 Y3.000 Z-1.161
+X3.200 Y3.000 Z-1.164
+X3.300 Y3.000 Z-1.166
+X3.400 Y3.000 Z-1.169
+X3.500 Y3.000 Z-1.171
+X3.600 Y3.000 Z-1.173
+X3.700 Y3.000 Z-1.175
+X3.800 Y3.000 Z-1.177
+X3.900 Y3.000 Z-1.178
+X4.000 Y3.000 Z-1.179
+X4.100 Y3.000 Z-1.180
+X4.200 Y3.000 Z-1.181
+X4.300 Y3.000 Z-1.181
+X4.400 Y3.000 Z-1.182
+X4.500 Y3.000 Z-1.182
+X4.600 Y3.000 Z-1.182
+X4.700 Y3.000 Z-1.181
+X4.800 Y3.000 Z-1.181
+X4.900 Y3.000 Z-1.180
+X5.000 Y3.000 Z-1.179
+X5.100 Y3.000 Z-1.178
+X5.200 Y3.000 Z-1.176
+X5.300 Y3.000 Z-1.174
+X5.400 Y3.000 Z-1.173
+X5.500 Y3.000 Z-1.170
+X5.600 Y3.000 Z-1.168
+X5.700 Y3.000 Z-1.166
+X5.800 Y3.000 Z-1.163
+X5.900 Y3.000 Z-1.160
+X6.000 Y3.000 Z-1.157
+X6.100 Y3.000 Z-1.154
+X6.200 Y3.000 Z-1.150
+X6.300 Y3.000 Z-1.146
+X6.400 Y3.000 Z-1.143
+X6.500 Y3.000 Z-1.139
+X6.600 Y3.000 Z-1.134
+X6.700 Y3.000 Z-1.130
+X6.800 Y3.000 Z-1.125
+X6.900 Y3.000 Z-1.121
+X7.000 Y3.000 Z-1.116
+X7.100 Y3.000 Z-1.111
+X7.200 Y3.000 Z-1.106
+X7.300 Y3.000 Z-1.101
+X7.400 Y3.000 Z-1.095
+X7.500 Y3.000 Z-1.090
+X7.600 Y3.000 Z-1.084
+X7.700 Y3.000 Z-1.079
+X7.800 Y3.000 Z-1.073
+X7.900 Y3.000 Z-1.067
+X8.000 Y3.000 Z-1.061
+X8.100 Y3.000 Z-1.055
+X8.200 Y3.000 Z-1.049
+X8.300 Y3.000 Z-1.043
+X8.400 Y3.000 Z-1.036
+X8.500 Y3.000 Z-1.030
+X8.600 Y3.000 Z-1.024
+X8.700 Y3.000 Z-1.018
+X8.800 Y3.000 Z-1.011
+X8.900 Y3.000 Z-1.005
+X9.000 Y3.000 Z-0.998
+X9.100 Y3.000 Z-0.992
+X9.200 Y3.000 Z-0.986
+X9.300 Y3.000 Z-0.979
+X9.400 Y3.000 Z-0.973
+X9.500 Y3.000 Z-0.967
+X9.600 Y3.000 Z-0.961
+X9.700 Y3.000 Z-0.954
+X9.800 Y3.000 Z-0.948
+X9.900 Y3.000 Z-0.942
+X10.000 Y3.000 Z-0.936
+X10.100 Y3.000 Z-0.930
+X10.200 Y3.000 Z-0.924
+X10.300 Y3.000 Z-0.919
+X10.400 Y3.000 Z-0.913
+X10.500 Y3.000 Z-0.908
+X10.600 Y3.000 Z-0.902
+X10.700 Y3.000 Z-0.897
+X10.800 Y3.000 Z-0.892
+X10.900 Y3.000 Z-0.887
+X11.000 Y3.000 Z-0.882
+X11.100 Y3.000 Z-0.877
+X11.200 Y3.000 Z-0.872
+X11.300 Y3.000 Z-0.868
+X11.400 Y3.000 Z-0.864
+X11.500 Y3.000 Z-0.860
+X11.600 Y3.000 Z-0.856
+X11.700 Y3.000 Z-0.852
+X11.800 Y3.000 Z-0.848
+X11.900 Y3.000 Z-0.845
+X12.000 Y3.000 Z-0.842
+X12.100 Y3.000 Z-0.839
+X12.200 Y3.000 Z-0.836
+X12.300 Y3.000 Z-0.833
+X12.400 Y3.000 Z-0.831
+X12.500 Y3.000 Z-0.828
+X12.600 Y3.000 Z-0.826
+X12.700 Y3.000 Z-0.825
+X12.800 Y3.000 Z-0.823
+X12.900 Y3.000 Z-0.822
+X13.000 Y3.000 Z-0.821
+X13.100 Y3.000 Z-0.820
+X13.200 Y3.000 Z-0.819
+X13.300 Y3.000 Z-0.819
+X13.400 Y3.000 Z-0.818
+X13.500 Y3.000 Z-0.818
+X13.600 Y3.000 Z-0.818
+X13.700 Y3.000 Z-0.819
+X13.800 Y3.000 Z-0.819
+X13.900 Y3.000 Z-0.820
+X14.000 Y3.000 Z-0.821
+X14.100 Y3.000 Z-0.823
+X14.200 Y3.000 Z-0.824
+X14.300 Y3.000 Z-0.826
+X14.400 Y3.000 Z-0.828
+X14.500 Y3.000 Z-0.830
+X14.600 Y3.000 Z-0.832
+X14.700 Y3.000 Z-0.835
+X14.800 Y3.000 Z-0.838
+X14.900 Y3.000 Z-0.841
+X15.000 Y3.000 Z-0.844
+X15.100 Y3.000 Z-0.847
+X15.200 Y3.000 Z-0.851
+X15.300 Y3.000 Z-0.854
+X15.400 Y3.000 Z-0.858
+X15.500 Y3.000 Z-0.862
+X15.600 Y3.000 Z-0.867
+X15.700 Y3.000 Z-0.871
+X15.800 Y3.000 Z-0.876
+X15.900 Y3.000 Z-0.880
+X16.000 Y3.000 Z-0.885
+X16.100 Y3.000 Z-0.890
+X16.200 Y3.000 Z-0.895
+X16.300 Y3.000 Z-0.901
+X16.400 Y3.000 Z-0.906
+X16.500 Y3.000 Z-0.912
+X16.600 Y3.000 Z-0.917
+X16.700 Y3.000 Z-0.923
+X16.800 Y3.000 Z-0.929
+X16.900 Y3.000 Z-0.935
+X17.000 Y3.000 Z-0.941
+X17.100 Y3.000 Z-0.947
+X17.200 Y3.000 Z-0.953
+X17.300 Y3.000 Z-0.959
+X17.400 Y3.000 Z-0.965
+X17.500 Y3.000 Z-0.971
+X17.600 Y3.000 Z-0.978
+X17.700 Y3.000 Z-0.984
+X17.800 Y3.000 Z-0.990
+X17.900 Y3.000 Z-0.997
+X18.000 Y3.000 Z-1.003
+X18.100 Y3.000 Z-1.009
+X18.200 Y3.000 Z-1.016
+X18.300 Y3.000 Z-1.022
+X18.400 Y3.000 Z-1.028
+X18.500 Y3.000 Z-1.035
+X18.600 Y3.000 Z-1.041
+X18.700 Y3.000 Z-1.047
+X18.800 Y3.000 Z-1.053
+X18.900 Y3.000 Z-1.059
+X19.000 Y3.000 Z-1.065
+X19.100 Y3.000 Z-1.071
+X19.200 Y3.000 Z-1.077
+X19.300 Y3.000 Z-1.083
+X19.400 Y3.000 Z-1.088
+X19.500 Y3.000 Z-1.094
+X19.600 Y3.000 Z-1.099
+X19.700 Y3.000 Z-1.104
+X19.800 Y3.000 Z-1.110
+X19.900 Y3.000 Z-1.115
+X20.000 Y3.000 Z-1.119
+X20.100 Y3.000 Z-1.124
+X20.200 Y3.000 Z-1.129
+X20.300 Y3.000 Z-1.133
+X20.400 Y3.000 Z-1.137
+X20.500 Y3.000 Z-1.141
+X20.600 Y3.000 Z-1.145
+X20.700 Y3.000 Z-1.149
+X20.800 Y3.000 Z-1.153
+X20.900 Y3.000 Z-1.156
+X21.000 Y3.000 Z-1.159
+X21.100 Y3.000 Z-1.162
+X21.200 Y3.000 Z-1.165
+X21.300 Y3.000 Z-1.167
+X21.400 Y3.000 Z-1.170
+X21.500 Y3.000 Z-1.172
+X21.600 Y3.000 Z-1.174
+X21.700 Y3.000 Z-1.176
+X21.800 Y3.000 Z-1.177
+X21.900 Y3.000 Z-1.179
+X22.000 Y3.000 Z-1.180
+X22.100 Y3.000 Z-1.180
+X22.200 Y3.000 Z-1.181
+X22.300 Y3.000 Z-1.182
+X22.400 Y3.000 Z-1.182
+X22.500 Y3.000 Z-1.182
+X22.600 Y3.000 Z-1.181
+X22.700 Y3.000 Z-1.181
+X22.800 Y3.000 Z-1.180
+X22.900 Y3.000 Z-1.179
+X23.000 Y3.000 Z-1.178
+X23.100 Y3.000 Z-1.177
+X23.200 Y3.000 Z-1.175
+X23.300 Y3.000 Z-1.174
+X23.400 Y3.000 Z-1.172
+X23.500 Y3.000 Z-1.169
+X23.600 Y3.000 Z-1.167
+X23.700 Y3.000 Z-1.164
+X23.800 Y3.000 Z-1.162
+X23.900 Y3.000 Z-1.159
+X24.000 Y3.000 Z-1.155
+X24.100 Y3.000 Z-1.152
+X24.200 Y3.000 Z-1.148
+X24.300 Y3.000 Z-1.145
+X24.400 Y3.000 Z-1.141
+X24.500 Y3.000 Z-1.137
+X24.600 Y3.000 Z-1.132
+X24.700 Y3.000 Z-1.128
+X24.800 Y3.000 Z-1.123
+X24.900 Y3.000 Z-1.118
+X25.000 Y3.000 Z-1.114
+X25.100 Y3.000 Z-1.109
+X25.200 Y3.000 Z-1.103
+X25.300 Y3.000 Z-1.098
+X25.400 Y3.000 Z-1.093
+X25.500 Y3.000 Z-1.087
+X25.600 Y3.000 Z-1.081
+X25.700 Y3.000 Z-1.076
+X25.800 Y3.000 Z-1.070
+X25.900 Y3.000 Z-1.064
+X26.000 Y3.000 Z-1.058
+X26.100 Y3.000 Z-1.052
+X26.200 Y3.000 Z-1.046
+X26.300 Y3.000 Z-1.040
+X26.400 Y3.000 Z-1.033
+X26.500 Y3.000 Z-1.027
+X26.600 Y3.000 Z-1.021
+X26.700 Y3.000 Z-1.014
+X26.800 Y3.000 Z-1.008
+X26.900 Y3.000 Z-1.002
+X27.000 Y3.000 Z-0.995
+X27.100 Y3.000 Z-0.989
+X27.200 Y3.000 Z-0.983
+X27.300 Y3.000 Z-0.976
+X27.400 Y3.000 Z-0.970
+X27.500 Y3.000 Z-0.964
+X27.600 Y3.000 Z-0.958
+X27.700 Y3.000 Z-0.951
+X27.800 Y3.000 Z-0.945
+X27.900 Y3.000 Z-0.939
+X28.000 Y3.000 Z-0.933
+X28.100 Y3.000 Z-0.928
+X28.200 Y3.000 Z-0.922
+X28.300 Y3.000 Z-0.916
+X28.400 Y3.000 Z-0.910
+X28.500 Y3.000 Z-0.905
+X28.600 Y3.000 Z-0.900
+X28.700 Y3.000 Z-0.894
+X28.800 Y3.000 Z-0.889
+X28.900 Y3.000 Z-0.884
+X29.000 Y3.000 Z-0.879
+X29.100 Y3.000 Z-0.875
+X29.200 Y3.000 Z-0.870
+X29.300 Y3.000 Z-0.866
+X29.400 Y3.000 Z-0.862
+X29.500 Y3.000 Z-0.858
+X29.600 Y3.000 Z-0.854
+X29.700 Y3.000 Z-0.850
+X29.800 Y3.000 Z-0.847
+X29.900 Y3.000 Z-0.843
+X30.000 Y3.000 Z-0.840
+X30.000 Y3.500 Z-0.645
+X29.900 Y3.500 Z-0.652
+X29.800 Y3.500 Z-0.659
+X29.700 Y3.500 Z-0.667
+X29.600 Y3.500 Z-0.675
+X29.500 Y3.500 Z-0.684
+X29.400 Y3.500 Z-0.693
+X29.300 Y3.500 Z-0.702
+X29.200 Y3.500 Z-0.712
+X29.100 Y3.500 Z-0.722
+X29.000 Y3.500 Z-0.732
+X28.900 Y3.500 Z-0.743
+X28.800 Y3.500 Z-0.754
+X28.700 Y3.500 Z-0.765
+X28.600 Y3.500 Z-0.777
+X28.500 Y3.500 Z-0.789
+X28.400 Y3.500 Z-0.801
+X28.300 Y3.500 Z-0.813
+X28.200 Y3.500 Z-0.826
+X28.100 Y3.500 Z-0.839
+X28.000 Y3.500 Z-0.852
+X27.900 Y3.500 Z-0.865
+X27.800 Y3.500 Z-0.879
+X27.700 Y3.500 Z-0.892
+X27.600 Y3.500 Z-0.906
+X27.500 Y3.500 Z-0.920
+X27.400 Y3.500 Z-0.934
+X27.300 Y3.500 Z-0.948
+X27.200 Y3.500 Z-0.962
+X27.100 Y3.500 Z-0.976
+X27.000 Y3.500 Z-0.990
+X26.900 Y3.500 Z-1.004
+X26.800 Y3.500 Z-1.018
+X26.700 Y3.500 Z-1.032
+X26.600 Y3.500 Z-1.046
+X26.500 Y3.500 Z-1.060
+X26.400 Y3.500 Z-1.074
+X26.300 Y3.500 Z-1.088
+X26.200 Y3.500 Z-1.102
+X26.100 Y3.500 Z-1.115
+X26.000 Y3.500 Z-1.129
+X25.900 Y3.500 Z-1.142
+X25.800 Y3.500 Z-1.155
+X25.700 Y3.500 Z-1.168
+X25.600 Y3.500 Z-1.181
+X25.500 Y3.500 Z-1.194
+X25.400 Y3.500 Z-1.206
+X25.300 Y3.500 Z-1.218
+X25.200 Y3.500 Z-1.230
+X25.100 Y3.500 Z-1.241
+X25.000 Y3.500 Z-1.252
+X24.900 Y3.500 Z-1.263
+X24.800 Y3.500 Z-1.274
+X24.700 Y3.500 Z-1.284
+X24.600 Y3.500 Z-1.294
+X24.500 Y3.500 Z-1.303
+X24.400 Y3.500 Z-1.313
+X24.300 Y3.500 Z-1.321
+X24.200 Y3.500 Z-1.330
+X24.100 Y3.500 Z-1.338
+X24.000 Y3.500 Z-1.345
+X23.900 Y3.500 Z-1.352
+X23.800 Y3.500 Z-1.359
+X23.700 Y3.500 Z-1.365
+X23.600 Y3.500 Z-1.371
+X23.500 Y3.500 Z-1.376
+X23.400 Y3.500 Z-1.381
+X23.300 Y3.500 Z-1.386
+X23.200 Y3.500 Z-1.390
+X23.100 Y3.500 Z-1.393
+X23.000 Y3.500 Z-1.396
+X22.900 Y3.500 Z-1.399
+X22.800 Y3.500 Z-1.401
+X22.700 Y3.500 Z-1.402
+X22.600 Y3.500 Z-1.403
+X22.500 Y3.500 Z-1.404
+X22.400 Y3.500 Z-1.404
+X22.300 Y3.500 Z-1.403
+X22.200 Y3.500 Z-1.402
+X22.100 Y3.500 Z-1.401
+X22.000 Y3.500 Z-1.399
+X21.900 Y3.500 Z-1.397
+X21.800 Y3.500 Z-1.394
+X21.700 Y3.500 Z-1.390
+X21.600 Y3.500 Z-1.387
+X21.500 Y3.500 Z-1.382
+X21.400 Y3.500 Z-1.377
+X21.300 Y3.500 Z-1.372
+X21.200 Y3.500 Z-1.366
+X21.100 Y3.500 Z-1.360
+X21.000 Y3.500 Z-1.354
+X20.900 Y3.500 Z-1.347
+X20.800 Y3.500 Z-1.339
+X20.700 Y3.500 Z-1.331
+X20.600 Y3.500 Z-1.323
+X20.500 Y3.500 Z-1.314
+X20.400 Y3.500 Z-1.305
+X20.300 Y3.500 Z-1.296
+X20.200 Y3.500 Z-1.286
+X20.100 Y3.500 Z-1.276
+X20.000 Y3.500 Z-1.265
+X19.900 Y3.500 Z-1.255
+X19.800 Y3.500 Z-1.243
+X19.700 Y3.500 Z-1.232
+X19.600 Y3.500 Z-1.220
+X19.500 Y3.500 Z-1.208
+X19.400 Y3.500 Z-1.196
+X19.300 Y3.500 Z-1.184
+X19.200 Y3.500 Z-1.171
+X19.100 Y3.500 Z-1.158
+X19.000 Y3.500 Z-1.145
+X18.900 Y3.500 Z-1.132
+X18.800 Y3.500 Z-1.118
+X18.700 Y3.500 Z-1.105
+X18.600 Y3.500 Z-1.091
+X18.500 Y3.500 Z-1.077
+X18.400 Y3.500 Z-1.063
+X18.300 Y3.500 Z-1.049
+X18.200 Y3.500 Z-1.035
+X18.100 Y3.500 Z-1.021
+X18.000 Y3.500 Z-1.007
+X17.900 Y3.500 Z-0.993
+X17.800 Y3.500 Z-0.979
+X17.700 Y3.500 Z-0.964
+X17.600 Y3.500 Z-0.950
+X17.500 Y3.500 Z-0.936
+X17.400 Y3.500 Z-0.922
+X17.300 Y3.500 Z-0.909
+X17.200 Y3.500 Z-0.895
+X17.100 Y3.500 Z-0.881
+X17.000 Y3.500 Z-0.868
+X16.900 Y3.500 Z-0.855
+X16.800 Y3.500 Z-0.842
+X16.700 Y3.500 Z-0.829
+X16.600 Y3.500 Z-0.816
+X16.500 Y3.500 Z-0.803
+X16.400 Y3.500 Z-0.791
+X16.300 Y3.500 Z-0.779
+X16.200 Y3.500 Z-0.768
+X16.100 Y3.500 Z-0.756
+X16.000 Y3.500 Z-0.745
+X15.900 Y3.500 Z-0.734
+X15.800 Y3.500 Z-0.724
+X15.700 Y3.500 Z-0.714
+X15.600 Y3.500 Z-0.704
+X15.500 Y3.500 Z-0.694
+X15.400 Y3.500 Z-0.685
+X15.300 Y3.500 Z-0.677
+X15.200 Y3.500 Z-0.668
+X15.100 Y3.500 Z-0.661
+X15.000 Y3.500 Z-0.653
+X14.900 Y3.500 Z-0.646
+X14.800 Y3.500 Z-0.639
+X14.700 Y3.500 Z-0.633
+X14.600 Y3.500 Z-0.628
+X14.500 Y3.500 Z-0.622
+X14.400 Y3.500 Z-0.618
+X14.300 Y3.500 Z-0.613
+X14.200 Y3.500 Z-0.609
+X14.100 Y3.500 Z-0.606
+X14.000 Y3.500 Z-0.603
+X13.900 Y3.500 Z-0.601
+X13.800 Y3.500 Z-0.599
+X13.700 Y3.500 Z-0.598
+X13.600 Y3.500 Z-0.597
+X13.500 Y3.500 Z-0.596
+X13.400 Y3.500 Z-0.596
+X13.300 Y3.500 Z-0.597
+X13.200 Y3.500 Z-0.598
+X13.100 Y3.500 Z-0.599
+X13.000 Y3.500 Z-0.601
+X12.900 Y3.500 Z-0.604
+X12.800 Y3.500 Z-0.607
+X12.700 Y3.500 Z-0.610
+X12.600 Y3.500 Z-0.614
+X12.500 Y3.500 Z-0.619
+X12.400 Y3.500 Z-0.624
+X12.300 Y3.500 Z-0.629
+X12.200 Y3.500 Z-0.635
+X12.100 Y3.500 Z-0.641
+X12.000 Y3.500 Z-0.648
+X11.900 Y3.500 Z-0.655
+X11.800 Y3.500 Z-0.663
+X11.700 Y3.500 Z-0.671
+X11.600 Y3.500 Z-0.679
+X11.500 Y3.500 Z-0.688
+X11.400 Y3.500 Z-0.697
+X11.300 Y3.500 Z-0.707
+X11.200 Y3.500 Z-0.716
+X11.100 Y3.500 Z-0.727
+X11.000 Y3.500 Z-0.737
+X10.900 Y3.500 Z-0.748
+X10.800 Y3.500 Z-0.759
+X10.700 Y3.500 Z-0.771
+X10.600 Y3.500 Z-0.783
+X10.500 Y3.500 Z-0.795
+X10.400 Y3.500 Z-0.807
+X10.300 Y3.500 Z-0.819
+X10.200 Y3.500 Z-0.832
+X10.100 Y3.500 Z-0.845
+X10.000 Y3.500 Z-0.858
+X9.900 Y3.500 Z-0.872
+X9.800 Y3.500 Z-0.885
+X9.700 Y3.500 Z-0.899
+X9.600 Y3.500 Z-0.912
+X9.500 Y3.500 Z-0.926
+X9.400 Y3.500 Z-0.940
+X9.300 Y3.500 Z-0.954
+X9.200 Y3.500 Z-0.968
+X9.100 Y3.500 Z-0.982
+X9.000 Y3.500 Z-0.997
+X8.900 Y3.500 Z-1.011
+X8.800 Y3.500 Z-1.025
+X8.700 Y3.500 Z-1.039
+X8.600 Y3.500 Z-1.053
+X8.500 Y3.500 Z-1.067
+X8.400 Y3.500 Z-1.081
+X8.300 Y3.500 Z-1.095
+X8.200 Y3.500 Z-1.108
+X8.100 Y3.500 Z-1.122
+X8.000 Y3.500 Z-1.135
+X7.900 Y3.500 Z-1.149
+X7.800 Y3.500 Z-1.162
+X7.700 Y3.500 Z-1.174
+X7.600 Y3.500 Z-1.187
+X7.500 Y3.500 Z-1.199
+X7.400 Y3.500 Z-1.212
+X7.300 Y3.500 Z-1.224
+X7.200 Y3.500 Z-1.235
+X7.100 Y3.500 Z-1.247
+X7.000 Y3.500 Z-1.258
+X6.900 Y3.500 Z-1.268
+X6.800 Y3.500 Z-1.279
+X6.700 Y3.500 Z-1.289
+X6.600 Y3.500 Z-1.298
+X6.500 Y3.500 Z-1.308
+X6.400 Y3.500 Z-1.317
+X6.300 Y3.500 Z-1.325
+X6.200 Y3.500 Z-1.334
+X6.100 Y3.500 Z-1.341
+X6.000 Y3.500 Z-1.349
+X5.900 Y3.500 Z-1.356
+X5.800 Y3.500 Z-1.362
+X5.700 Y3.500 Z-1.368
+X5.600 Y3.500 Z-1.374
+X5.500 Y3.500 Z-1.379
+X5.400 Y3.500 Z-1.383
+X5.300 Y3.500 Z-1.388
+X5.200 Y3.500 Z-1.391
+X5.100 Y3.500 Z-1.395
+X5.000 Y3.500 Z-1.397
+X4.900 Y3.500 Z-1.400
+X4.800 Y3.500 Z-1.401
+X4.700 Y3.500 Z-1.403
+X4.600 Y3.500 Z-1.404
+X4.500 Y3.500 Z-1.404
+X4.400 Y3.500 Z-1.404
+X4.300 Y3.500 Z-1.403
+X4.200 Y3.500 Z-1.402
+X4.100 Y3.500 Z-1.400
+X4.000 Y3.500 Z-1.398
+X3.900 Y3.500 Z-1.395
+X3.800 Y3.500 Z-1.392
+X3.700 Y3.500 Z-1.389
+X3.600 Y3.500 Z-1.385
+X3.500 Y3.500 Z-1.380
+X3.400 Y3.500 Z-1.375
+X3.300 Y3.500 Z-1.369
+X3.200 Y3.500 Z-1.364
+X3.100 Y3.500 Z-1.357
+X3.000 Y3.500 Z-1.350
+X2.900 Y3.500 Z-1.343
+X2.800 Y3.500 Z-1.335
+X2.700 Y3.500 Z-1.327
+X2.600 Y3.500 Z-1.319
+X2.500 Y3.500 Z-1.310
+X2.400 Y3.500 Z-1.301
+X2.300 Y3.500 Z-1.291
+X2.200 Y3.500 Z-1.281
+X2.100 Y3.500 Z-1.271
+X2.000 Y3.500 Z-1.260
+X1.900 Y3.500 Z-1.249
+X1.800 Y3.500 Z-1.238
+X1.700 Y3.500 Z-1.226
+X1.600 Y3.500 Z-1.215
+X1.500 Y3.500 Z-1.202
+X1.400 Y3.500 Z-1.190
+X1.300 Y3.500 Z-1.177
+X1.200 Y3.500 Z-1.165
+X1.100 Y3.500 Z-1.152
+X1.000 Y3.500 Z-1.138
+X0.900 Y3.500 Z-1.125
+X0.800 Y3.500 Z-1.112
+X0.700 Y3.500 Z-1.098
+X0.600 Y3.500 Z-1.084
+X0.500 Y3.500 Z-1.070
+X0.400 Y3.500 Z-1.056
+X0.300 Y3.500 Z-1.042
+X0.200 Y3.500 Z-1.028
+X0.100 Y3.500 Z-1.014
+X0.000 Y3.500 Z-1.000
+X0.000 Y4.000 Z-1.000
+X0.100 Y4.000 Z-1.021
+X0.200 Y4.000 Z-1.041
+X0.300 Y4.000 Z-1.062
+X0.400 Y4.000 Z-1.082
+X0.500 Y4.000 Z-1.103
+X0.600 Y4.000 Z-1.123
+X0.700 Y4.000 Z-1.143
+X0.800 Y4.000 Z-1.163
+X0.900 Y4.000 Z-1.183
+X1.000 Y4.000 Z-1.202
+X1.100 Y4.000 Z-1.222
+X1.200 Y4.000 Z-1.241
+X1.300 Y4.000 Z-1.259
+X1.400 Y4.000 Z-1.278
+X1.500 Y4.000 Z-1.296
+X1.600 Y4.000 Z-1.313
+X1.700 Y4.000 Z-1.331
+X1.800 Y4.000 Z-1.348
+X1.900 Y4.000 Z-1.364
+X2.000 Y4.000 Z-1.380
+X2.100 Y4.000 Z-1.396
+X2.200 Y4.000 Z-1.411
+X2.300 Y4.000 Z-1.425
+X2.400 Y4.000 Z-1.439
+X2.500 Y4.000 Z-1.453
+X2.600 Y4.000 Z-1.466
+X2.700 Y4.000 Z-1.478
+X2.800 Y4.000 Z-1.490
+X2.900 Y4.000 Z-1.501
+X3.000 Y4.000 Z-1.512
+X3.100 Y4.000 Z-1.522
+X3.200 Y4.000 Z-1.531
+X3.300 Y4.000 Z-1.540
+X3.400 Y4.000 Z-1.548
+X3.500 Y4.000 Z-1.555
+X3.600 Y4.000 Z-1.562
+X3.700 Y4.000 Z-1.568
+X3.800 Y4.000 Z-1.573
+X3.900 Y4.000 Z-1.577
+X4.000 Y4.000 Z-1.581
+X4.100 Y4.000 Z-1.584
+X4.200 Y4.000 Z-1.587
+X4.300 Y4.000 Z-1.589
+X4.400 Y4.000 Z-1.590
+X4.500 Y4.000 Z-1.590
+X4.600 Y4.000 Z-1.589
+X4.700 Y4.000 Z-1.588
+X4.800 Y4.000 Z-1.586
+X4.900 Y4.000 Z-1.584
+X5.000 Y4.000 Z-1.580
+X5.100 Y4.000 Z-1.576
+X5.200 Y4.000 Z-1.572
+X5.300 Y4.000 Z-1.566
+X5.400 Y4.000 Z-1.560
+X5.500 Y4.000 Z-1.553
+X5.600 Y4.000 Z-1.546
+X5.700 Y4.000 Z-1.538
+X5.800 Y4.000 Z-1.529
+X5.900 Y4.000 Z-1.519
+X6.000 Y4.000 Z-1.509
+X6.100 Y4.000 Z-1.498
+X6.200 Y4.000 Z-1.487
+X6.300 Y4.000 Z-1.475
+X6.400 Y4.000 Z-1.463
+X6.500 Y4.000 Z-1.450
+X6.600 Y4.000 Z-1.436
+X6.700 Y4.000 Z-1.422
+X6.800 Y4.000 Z-1.407
+X6.900 Y4.000 Z-1.392
+X7.000 Y4.000 Z-1.376
+X7.100 Y4.000 Z-1.360
+X7.200 Y4.000 Z-1.344
+X7.300 Y4.000 Z-1.327
+X7.400 Y4.000 Z-1.309
+X7.500 Y4.000 Z-1.291
+X7.600 Y4.000 Z-1.273
+X7.700 Y4.000 Z-1.255
+X7.800 Y4.000 Z-1.236
+X7.900 Y4.000 Z-1.217
+X8.000 Y4.000 Z-1.198
+X8.100 Y4.000 Z-1.178
+X8.200 Y4.000 Z-1.158
+X8.300 Y4.000 Z-1.138
+X8.400 Y4.000 Z-1.118
+X8.500 Y4.000 Z-1.098
+X8.600 Y4.000 Z-1.077
+X8.700 Y4.000 Z-1.057
+X8.800 Y4.000 Z-1.036
+X8.900 Y4.000 Z-1.016
+X9.000 Y4.000 Z-0.995
+X9.100 Y4.000 Z-0.974
+X9.200 Y4.000 Z-0.954
+X9.300 Y4.000 Z-0.933
+X9.400 Y4.000 Z-0.913
+X9.500 Y4.000 Z-0.892
+X9.600 Y4.000 Z-0.872
+X9.700 Y4.000 Z-0.852
+X9.800 Y4.000 Z-0.832
+X9.900 Y4.000 Z-0.813
+X10.000 Y4.000 Z-0.793
+X10.100 Y4.000 Z-0.774
+X10.200 Y4.000 Z-0.755
+X10.300 Y4.000 Z-0.736
+X10.400 Y4.000 Z-0.718
+X10.500 Y4.000 Z-0.700
+X10.600 Y4.000 Z-0.682
+X10.700 Y4.000 Z-0.665
+X10.800 Y4.000 Z-0.648
+X10.900 Y4.000 Z-0.632
+X11.000 Y4.000 Z-0.616
+X11.100 Y4.000 Z-0.601
+X11.200 Y4.000 Z-0.586
+X11.300 Y4.000 Z-0.571
+X11.400 Y4.000 Z-0.557
+X11.500 Y4.000 Z-0.544
+X11.600 Y4.000 Z-0.531
+X11.700 Y4.000 Z-0.519
+X11.800 Y4.000 Z-0.507
+X11.900 Y4.000 Z-0.496
+X12.000 Y4.000 Z-0.486
+X12.100 Y4.000 Z-0.476
+X12.200 Y4.000 Z-0.467
+X12.300 Y4.000 Z-0.458
+X12.400 Y4.000 Z-0.451
+X12.500 Y4.000 Z-0.443
+X12.600 Y4.000 Z-0.437
+X12.700 Y4.000 Z-0.431
+X12.800 Y4.000 Z-0.426
+X12.900 Y4.000 Z-0.422
+X13.000 Y4.000 Z-0.418
+X13.100 Y4.000 Z-0.415
+X13.200 Y4.000 Z-0.413
+X13.300 Y4.000 Z-0.411
+X13.400 Y4.000 Z-0.410
+X13.500 Y4.000 Z-0.410
+X13.600 Y4.000 Z-0.411
+X13.700 Y4.000 Z-0.412
+X13.800 Y4.000 Z-0.414
+X13.900 Y4.000 Z-0.417
+X14.000 Y4.000 Z-0.420
+X14.100 Y4.000 Z-0.425
+X14.200 Y4.000 Z-0.430
+X14.300 Y4.000 Z-0.435
+X14.400 Y4.000 Z-0.441
+X14.500 Y4.000 Z-0.448
+X14.600 Y4.000 Z-0.456
+X14.700 Y4.000 Z-0.464
+X14.800 Y4.000 Z-0.473
+X14.900 Y4.000 Z-0.483
+X15.000 Y4.000 Z-0.493
+X15.100 Y4.000 Z-0.504
+X15.200 Y4.000 Z-0.516
+X15.300 Y4.000 Z-0.528
+X15.400 Y4.000 Z-0.540
+X15.500 Y4.000 Z-0.554
+X15.600 Y4.000 Z-0.567
+X15.700 Y4.000 Z-0.582
+X15.800 Y4.000 Z-0.597
+X15.900 Y4.000 Z-0.612
+X16.000 Y4.000 Z-0.628
+X16.100 Y4.000 Z-0.644
+X16.200 Y4.000 Z-0.661
+X16.300 Y4.000 Z-0.678
+X16.400 Y4.000 Z-0.695
+X16.500 Y4.000 Z-0.713
+X16.600 Y4.000 Z-0.731
+X16.700 Y4.000 Z-0.750
+X16.800 Y4.000 Z-0.769
+X16.900 Y4.000 Z-0.788
+X17.000 Y4.000 Z-0.807
+X17.100 Y4.000 Z-0.827
+X17.200 Y4.000 Z-0.847
+X17.300 Y4.000 Z-0.867
+X17.400 Y4.000 Z-0.887
+X17.500 Y4.000 Z-0.907
+X17.600 Y4.000 Z-0.928
+X17.700 Y4.000 Z-0.948
+X17.800 Y4.000 Z-0.969
+X17.900 Y4.000 Z-0.989
+X18.000 Y4.000 Z-1.010
+X18.100 Y4.000 Z-1.031
+X18.200 Y4.000 Z-1.051
+X18.300 Y4.000 Z-1.072
+X18.400 Y4.000 Z-1.092
+X18.500 Y4.000 Z-1.112
+X18.600 Y4.000 Z-1.133
+X18.700 Y4.000 Z-1.153
+X18.800 Y4.000 Z-1.173
+X18.900 Y4.000 Z-1.192
+X19.000 Y4.000 Z-1.212
+X19.100 Y4.000 Z-1.231
+X19.200 Y4.000 Z-1.250
+X19.300 Y4.000 Z-1.268
+X19.400 Y4.000 Z-1.286
+X19.500 Y4.000 Z-1.304
+X19.600 Y4.000 Z-1.322
+X19.700 Y4.000 Z-1.339
+X19.800 Y4.000 Z-1.356
+X19.900 Y4.000 Z-1.372
+X20.000 Y4.000 Z-1.388
+X20.100 Y4.000 Z-1.403
+X20.200 Y4.000 Z-1.418
+X20.300 Y4.000 Z-1.432
+X20.400 Y4.000 Z-1.446
+X20.500 Y4.000 Z-1.459
+X20.600 Y4.000 Z-1.472
+X20.700 Y4.000 Z-1.484
+X20.800 Y4.000 Z-1.495
+X20.900 Y4.000 Z-1.506
+X21.000 Y4.000 Z-1.517
+X21.100 Y4.000 Z-1.526
+X21.200 Y4.000 Z-1.535
+X21.300 Y4.000 Z-1.544
+X21.400 Y4.000 Z-1.551
+X21.500 Y4.000 Z-1.558
+X21.600 Y4.000 Z-1.565
+X21.700 Y4.000 Z-1.570
+X21.800 Y4.000 Z-1.575
+X21.900 Y4.000 Z-1.579
+X22.000 Y4.000 Z-1.583
+X22.100 Y4.000 Z-1.586
+X22.200 Y4.000 Z-1.588
+X22.300 Y4.000 Z-1.589
+X22.400 Y4.000 Z-1.590
+X22.500 Y4.000 Z-1.590
+X22.600 Y4.000 Z-1.589
+X22.700 Y4.000 Z-1.587
+X22.800 Y4.000 Z-1.585
+X22.900 Y4.000 Z-1.582
+X23.000 Y4.000 Z-1.579
+X23.100 Y4.000 Z-1.574
+X23.200 Y4.000 Z-1.569
+X23.300 Y4.000 Z-1.563
+X23.400 Y4.000 Z-1.557
+X23.500 Y4.000 Z-1.550
+X23.600 Y4.000 Z-1.542
+X23.700 Y4.000 Z-1.533
+X23.800 Y4.000 Z-1.524
+X23.900 Y4.000 Z-1.515
+X24.000 Y4.000 Z-1.504
+X24.100 Y4.000 Z-1.493
+X24.200 Y4.000 Z-1.481
+X24.300 Y4.000 Z-1.469
+X24.400 Y4.000 Z-1.456
+X24.500 Y4.000 Z-1.443
+X24.600 Y4.000 Z-1.429
+X24.700 Y4.000 Z-1.415
+X24.800 Y4.000 Z-1.400
+X24.900 Y4.000 Z-1.384
+X25.000 Y4.000 Z-1.369
+X25.100 Y4.000 Z-1.352
+X25.200 Y4.000 Z-1.335
+X25.300 Y4.000 Z-1.318
+X25.400 Y4.000 Z-1.301
+X25.500 Y4.000 Z-1.283
+X25.600 Y4.000 Z-1.264
+X25.700 Y4.000 Z-1.246
+X25.800 Y4.000 Z-1.227
+X25.900 Y4.000 Z-1.208
+X26.000 Y4.000 Z-1.188
+X26.100 Y4.000 Z-1.169
+X26.200 Y4.000 Z-1.149
+X26.300 Y4.000 Z-1.129
+X26.400 Y4.000 Z-1.108
+X26.500 Y4.000 Z-1.088
+X26.600 Y4.000 Z-1.068
+X26.700 Y4.000 Z-1.047
+X26.800 Y4.000 Z-1.026
+X26.900 Y4.000 Z-1.006
+X27.000 Y4.000 Z-0.985
+X27.100 Y4.000 Z-0.964
+X27.200 Y4.000 Z-0.944
+X27.300 Y4.000 Z-0.923
+X27.400 Y4.000 Z-0.903
+X27.500 Y4.000 Z-0.883
+X27.600 Y4.000 Z-0.863
+X27.700 Y4.000 Z-0.843
+X27.800 Y4.000 Z-0.823
+X27.900 Y4.000 Z-0.803
+X28.000 Y4.000 Z-0.784
+X28.100 Y4.000 Z-0.765
+X28.200 Y4.000 Z-0.746
+X28.300 Y4.000 Z-0.727
+X28.400 Y4.000 Z-0.709
+X28.500 Y4.000 Z-0.692
+X28.600 Y4.000 Z-0.674
+X28.700 Y4.000 Z-0.657
+X28.800 Y4.000 Z-0.641
+X28.900 Y4.000 Z-0.624
+X29.000 Y4.000 Z-0.609
+X29.100 Y4.000 Z-0.593
+X29.200 Y4.000 Z-0.579
+X29.300 Y4.000 Z-0.565
+X29.400 Y4.000 Z-0.551
+X29.500 Y4.000 Z-0.538
+X29.600 Y4.000 Z-0.525
+X29.700 Y4.000 Z-0.513
+X29.800 Y4.000 Z-0.502
+X29.900 Y4.000 Z-0.491
+X30.000 Y4.000 Z-0.481
+X30.000 Y4.500 Z-0.364
+X29.900 Y4.500 Z-0.376
+X29.800 Y4.500 Z-0.389
+X29.700 Y4.500 Z-0.403
+X29.600 Y4.500 Z-0.418
+X29.500 Y4.500 Z-0.433
+X29.400 Y4.500 Z-0.449
+X29.300 Y4.500 Z-0.466
+X29.200 Y4.500 Z-0.484
+X29.100 Y4.500 Z-0.502
+X29.000 Y4.500 Z-0.520
+X28.900 Y4.500 Z-0.539
+X28.800 Y4.500 Z-0.559
+X28.700 Y4.500 Z-0.580
+X28.600 Y4.500 Z-0.600
+X28.500 Y4.500 Z-0.622
+X28.400 Y4.500 Z-0.644
+X28.300 Y4.500 Z-0.666
+X28.200 Y4.500 Z-0.689
+X28.100 Y4.500 Z-0.712
+X28.000 Y4.500 Z-0.735
+X27.900 Y4.500 Z-0.759
+X27.800 Y4.500 Z-0.783
+X27.700 Y4.500 Z-0.807
+X27.600 Y4.500 Z-0.831
+X27.500 Y4.500 Z-0.856
+X27.400 Y4.500 Z-0.881
+X27.300 Y4.500 Z-0.906
+X27.200 Y4.500 Z-0.931
+X27.100 Y4.500 Z-0.956
+X27.000 Y4.500 Z-0.982
+X26.900 Y4.500 Z-1.007
+X26.800 Y4.500 Z-1.032
+X26.700 Y4.500 Z-1.058
+X26.600 Y4.500 Z-1.083
+X26.500 Y4.500 Z-1.108
+X26.400 Y4.500 Z-1.133
+X26.300 Y4.500 Z-1.158
+X26.200 Y4.500 Z-1.182
+X26.100 Y4.500 Z-1.207
+X26.000 Y4.500 Z-1.231
+X25.900 Y4.500 Z-1.255
+X25.800 Y4.500 Z-1.278
+X25.700 Y4.500 Z-1.301
+X25.600 Y4.500 Z-1.324
+X25.500 Y4.500 Z-1.347
+X25.400 Y4.500 Z-1.369
+X25.300 Y4.500 Z-1.390
+X25.200 Y4.500 Z-1.411
+X25.100 Y4.500 Z-1.432
+X25.000 Y4.500 Z-1.452
+X24.900 Y4.500 Z-1.471
+X24.800 Y4.500 Z-1.490
+X24.700 Y4.500 Z-1.509
+X24.600 Y4.500 Z-1.526
+X24.500 Y4.500 Z-1.543
+X24.400 Y4.500 Z-1.560
+X24.300 Y4.500 Z-1.575
+X24.200 Y4.500 Z-1.590
+X24.100 Y4.500 Z-1.605
+X24.000 Y4.500 Z-1.618
+X23.900 Y4.500 Z-1.631
+X23.800 Y4.500 Z-1.643
+X23.700 Y4.500 Z-1.654
+X23.600 Y4.500 Z-1.664
+X23.500 Y4.500 Z-1.674
+X23.400 Y4.500 Z-1.683
+X23.300 Y4.500 Z-1.691
+X23.200 Y4.500 Z-1.698
+X23.100 Y4.500 Z-1.704
+X23.000 Y4.500 Z-1.709
+X22.900 Y4.500 Z-1.714
+X22.800 Y4.500 Z-1.718
+X22.700 Y4.500 Z-1.720
+X22.600 Y4.500 Z-1.722
+X22.500 Y4.500 Z-1.723
+X22.400 Y4.500 Z-1.723
+X22.300 Y4.500 Z-1.722
+X22.200 Y4.500 Z-1.721
+X22.100 Y4.500 Z-1.718
+X22.000 Y4.500 Z-1.715
+X21.900 Y4.500 Z-1.710
+X21.800 Y4.500 Z-1.705
+X21.700 Y4.500 Z-1.699
+X21.600 Y4.500 Z-1.692
+X21.500 Y4.500 Z-1.684
+X21.400 Y4.500 Z-1.676
+X21.300 Y4.500 Z-1.666
+X21.200 Y4.500 Z-1.656
+X21.100 Y4.500 Z-1.645
+X21.000 Y4.500 Z-1.633
+X20.900 Y4.500 Z-1.621
+X20.800 Y4.500 Z-1.607
+X20.700 Y4.500 Z-1.593
+X20.600 Y4.500 Z-1.578
+X20.500 Y4.500 Z-1.563
+X20.400 Y4.500 Z-1.547
+X20.300 Y4.500 Z-1.530
+X20.200 Y4.500 Z-1.512
+X20.100 Y4.500 Z-1.494
+X20.000 Y4.500 Z-1.475
+X19.900 Y4.500 Z-1.456
+X19.800 Y4.500 Z-1.436
+X19.700 Y4.500 Z-1.415
+X19.600 Y4.500 Z-1.394
+X19.500 Y4.500 Z-1.373
+X19.400 Y4.500 Z-1.351
+X19.300 Y4.500 Z-1.329
+X19.200 Y4.500 Z-1.306
+X19.100 Y4.500 Z-1.283
+X19.000 Y4.500 Z-1.259
+X18.900 Y4.500 Z-1.236
+X18.800 Y4.500 Z-1.212
+X18.700 Y4.500 Z-1.187
+X18.600 Y4.500 Z-1.163
+X18.500 Y4.500 Z-1.138
+X18.400 Y4.500 Z-1.113
+X18.300 Y4.500 Z-1.088
+X18.200 Y4.500 Z-1.063
+X18.100 Y4.500 Z-1.037
+X18.000 Y4.500 Z-1.012
+X17.900 Y4.500 Z-0.987
+X17.800 Y4.500 Z-0.962
+X17.700 Y4.500 Z-0.936
+X17.600 Y4.500 Z-0.911
+X17.500 Y4.500 Z-0.886
+X17.400 Y4.500 Z-0.861
+X17.300 Y4.500 Z-0.836
+X17.200 Y4.500 Z-0.812
+X17.100 Y4.500 Z-0.788
+X17.000 Y4.500 Z-0.763
+X16.900 Y4.500 Z-0.740
+X16.800 Y4.500 Z-0.716
+X16.700 Y4.500 Z-0.693
+X16.600 Y4.500 Z-0.670
+X16.500 Y4.500 Z-0.648
+X16.400 Y4.500 Z-0.626
+X16.300 Y4.500 Z-0.605
+X16.200 Y4.500 Z-0.584
+X16.100 Y4.500 Z-0.563
+X16.000 Y4.500 Z-0.543
+X15.900 Y4.500 Z-0.524
+X15.800 Y4.500 Z-0.505
+X15.700 Y4.500 Z-0.487
+X15.600 Y4.500 Z-0.470
+X15.500 Y4.500 Z-0.453
+X15.400 Y4.500 Z-0.437
+X15.300 Y4.500 Z-0.421
+X15.200 Y4.500 Z-0.406
+X15.100 Y4.500 Z-0.392
+X15.000 Y4.500 Z-0.379
+X14.900 Y4.500 Z-0.366
+X14.800 Y4.500 Z-0.354
+X14.700 Y4.500 Z-0.343
+X14.600 Y4.500 Z-0.333
+X14.500 Y4.500 Z-0.324
+X14.400 Y4.500 Z-0.315
+X14.300 Y4.500 Z-0.307
+X14.200 Y4.500 Z-0.301
+X14.100 Y4.500 Z-0.295
+X14.000 Y4.500 Z-0.289
+X13.900 Y4.500 Z-0.285
+X13.800 Y4.500 Z-0.282
+X13.700 Y4.500 Z-0.279
+X13.600 Y4.500 Z-0.278
+X13.500 Y4.500 Z-0.277
+X13.400 Y4.500 Z-0.277
+X13.300 Y4.500 Z-0.278
+X13.200 Y4.500 Z-0.280
+X13.100 Y4.500 Z-0.283
+X13.000 Y4.500 Z-0.286
+X12.900 Y4.500 Z-0.291
+X12.800 Y4.500 Z-0.296
+X12.700 Y4.500 Z-0.302
+X12.600 Y4.500 Z-0.310
+X12.500 Y4.500 Z-0.318
+X12.400 Y4.500 Z-0.326
+X12.300 Y4.500 Z-0.336
+X12.200 Y4.500 Z-0.346
+X12.100 Y4.500 Z-0.358
+X12.000 Y4.500 Z-0.370
+X11.900 Y4.500 Z-0.382
+X11.800 Y4.500 Z-0.396
+X11.700 Y4.500 Z-0.410
+X11.600 Y4.500 Z-0.425
+X11.500 Y4.500 Z-0.441
+X11.400 Y4.500 Z-0.457
+X11.300 Y4.500 Z-0.474
+X11.200 Y4.500 Z-0.492
+X11.100 Y4.500 Z-0.510
+X11.000 Y4.500 Z-0.529
+X10.900 Y4.500 Z-0.549
+X10.800 Y4.500 Z-0.569
+X10.700 Y4.500 Z-0.590
+X10.600 Y4.500 Z-0.611
+X10.500 Y4.500 Z-0.632
+X10.400 Y4.500 Z-0.654
+X10.300 Y4.500 Z-0.677
+X10.200 Y4.500 Z-0.700
+X10.100 Y4.500 Z-0.723
+X10.000 Y4.500 Z-0.746
+X9.900 Y4.500 Z-0.770
+X9.800 Y4.500 Z-0.794
+X9.700 Y4.500 Z-0.819
+X9.600 Y4.500 Z-0.843
+X9.500 Y4.500 Z-0.868
+X9.400 Y4.500 Z-0.893
+X9.300 Y4.500 Z-0.918
+X9.200 Y4.500 Z-0.943
+X9.100 Y4.500 Z-0.969
+X9.000 Y4.500 Z-0.994
+X8.900 Y4.500 Z-1.019
+X8.800 Y4.500 Z-1.045
+X8.700 Y4.500 Z-1.070
+X8.600 Y4.500 Z-1.095
+X8.500 Y4.500 Z-1.120
+X8.400 Y4.500 Z-1.145
+X8.300 Y4.500 Z-1.170
+X8.200 Y4.500 Z-1.194
+X8.100 Y4.500 Z-1.218
+X8.000 Y4.500 Z-1.242
+X7.900 Y4.500 Z-1.266
+X7.800 Y4.500 Z-1.289
+X7.700 Y4.500 Z-1.312
+X7.600 Y4.500 Z-1.335
+X7.500 Y4.500 Z-1.357
+X7.400 Y4.500 Z-1.379
+X7.300 Y4.500 Z-1.400
+X7.200 Y4.500 Z-1.421
+X7.100 Y4.500 Z-1.441
+X7.000 Y4.500 Z-1.461
+X6.900 Y4.500 Z-1.480
+X6.800 Y4.500 Z-1.499
+X6.700 Y4.500 Z-1.517
+X6.600 Y4.500 Z-1.534
+X6.500 Y4.500 Z-1.551
+X6.400 Y4.500 Z-1.567
+X6.300 Y4.500 Z-1.583
+X6.200 Y4.500 Z-1.597
+X6.100 Y4.500 Z-1.611
+X6.000 Y4.500 Z-1.624
+X5.900 Y4.500 Z-1.637
+X5.800 Y4.500 Z-1.648
+X5.700 Y4.500 Z-1.659
+X5.600 Y4.500 Z-1.669
+X5.500 Y4.500 Z-1.678
+X5.400 Y4.500 Z-1.687
+X5.300 Y4.500 Z-1.694
+X5.200 Y4.500 Z-1.701
+X5.100 Y4.500 Z-1.707
+X5.000 Y4.500 Z-1.712
+X4.900 Y4.500 Z-1.716
+X4.800 Y4.500 Z-1.719
+X4.700 Y4.500 Z-1.721
+X4.600 Y4.500 Z-1.723
+X4.500 Y4.500 Z-1.723
+X4.400 Y4.500 Z-1.723
+X4.300 Y4.500 Z-1.722
+X4.200 Y4.500 Z-1.720
+X4.100 Y4.500 Z-1.717
+X4.000 Y4.500 Z-1.713
+X3.900 Y4.500 Z-1.708
+X3.800 Y4.500 Z-1.702
+X3.700 Y4.500 Z-1.696
+X3.600 Y4.500 Z-1.689
+X3.500 Y4.500 Z-1.680
+X3.400 Y4.500 Z-1.671
+X3.300 Y4.500 Z-1.662
+X3.200 Y4.500 Z-1.651
+X3.100 Y4.500 Z-1.640
+X3.000 Y4.500 Z-1.627
+X2.900 Y4.500 Z-1.614
+X2.800 Y4.500 Z-1.601
+X2.700 Y4.500 Z-1.586
+X2.600 Y4.500 Z-1.571
+X2.500 Y4.500 Z-1.555
+X2.400 Y4.500 Z-1.539
+X2.300 Y4.500 Z-1.521
+X2.200 Y4.500 Z-1.503
+X2.100 Y4.500 Z-1.485
+X2.000 Y4.500 Z-1.466
+X1.900 Y4.500 Z-1.446
+X1.800 Y4.500 Z-1.426
+X1.700 Y4.500 Z-1.405
+X1.600 Y4.500 Z-1.384
+X1.500 Y4.500 Z-1.363
+X1.400 Y4.500 Z-1.340
+X1.300 Y4.500 Z-1.318
+X1.200 Y4.500 Z-1.295
+X1.100 Y4.500 Z-1.272
+X1.000 Y4.500 Z-1.248
+X0.900 Y4.500 Z-1.224
+X0.800 Y4.500 Z-1.200
+X0.700 Y4.500 Z-1.175
+X0.600 Y4.500 Z-1.151
+X0.500 Y4.500 Z-1.126
+X0.400 Y4.500 Z-1.101
+X0.300 Y4.500 Z-1.076
+X0.200 Y4.500 Z-1.051
+X0.100 Y4.500 Z-1.025
+X0.000 Y4.500 Z-1.000
+X0.000 Y5.000 Z-1.000
+X0.100 Y5.000 Z-1.028
+X0.200 Y5.000 Z-1.055
+X0.300 Y5.000 Z-1.083
+X0.400 Y5.000 Z-1.111
+X0.500 Y5.000 Z-1.138
+X0.600 Y5.000 Z-1.165
+X0.700 Y5.000 Z-1.192
+X0.800 Y5.000 Z-1.219
+X0.900 Y5.000 Z-1.245
+X1.000 Y5.000 Z-1.272
+X1.100 Y5.000 Z-1.297
+X1.200 Y5.000 Z-1.323
+X1.300 Y5.000 Z-1.348
+X1.400 Y5.000 Z-1.373
+X1.500 Y5.000 Z-1.397
+X1.600 Y5.000 Z-1.421
+X1.700 Y5.000 Z-1.444
+X1.800 Y5.000 Z-1.467
+X1.900 Y5.000 Z-1.489
+X2.000 Y5.000 Z-1.510
+X2.100 Y5.000 Z-1.531
+X2.200 Y5.000 Z-1.551
+X2.300 Y5.000 Z-1.571
+X2.400 Y5.000 Z-1.590
+X2.500 Y5.000 Z-1.608
+X2.600 Y5.000 Z-1.625
+X2.700 Y5.000 Z-1.642
+X2.800 Y5.000 Z-1.658
+X2.900 Y5.000 Z-1.673
+X3.000 Y5.000 Z-1.687
+X3.100 Y5.000 Z-1.700
+X3.200 Y5.000 Z-1.713
+X3.300 Y5.000 Z-1.725
+X3.400 Y5.000 Z-1.735
+X3.500 Y5.000 Z-1.745
+X3.600 Y5.000 Z-1.754
+X3.700 Y5.000 Z-1.762
+X3.800 Y5.000 Z-1.769
+X3.900 Y5.000 Z-1.775
+X4.000 Y5.000 Z-1.780
+X4.100 Y5.000 Z-1.785
+X4.200 Y5.000 Z-1.788
+X4.300 Y5.000 Z-1.790
+X4.400 Y5.000 Z-1.792
+X4.500 Y5.000 Z-1.792
+X4.600 Y5.000 Z-1.791
+X4.700 Y5.000 Z-1.790
+X4.800 Y5.000 Z-1.787
+X4.900 Y5.000 Z-1.784
+X5.000 Y5.000 Z-1.779
+X5.100 Y5.000 Z-1.774
+X5.200 Y5.000 Z-1.768
+X5.300 Y5.000 Z-1.760
+X5.400 Y5.000 Z-1.752
+X5.500 Y5.000 Z-1.743
+X5.600 Y5.000 Z-1.733
+X5.700 Y5.000 Z-1.722
+X5.800 Y5.000 Z-1.710
+X5.900 Y5.000 Z-1.697
+X6.000 Y5.000 Z-1.684
+X6.100 Y5.000 Z-1.669
+X6.200 Y5.000 Z-1.654
+X6.300 Y5.000 Z-1.638
+X6.400 Y5.000 Z-1.621
+X6.500 Y5.000 Z-1.604
+X6.600 Y5.000 Z-1.585
+X6.700 Y5.000 Z-1.566
+X6.800 Y5.000 Z-1.547
+X6.900 Y5.000 Z-1.526
+X7.000 Y5.000 Z-1.505
+X7.100 Y5.000 Z-1.483
+X7.200 Y5.000 Z-1.461
+X7.300 Y5.000 Z-1.438
+X7.400 Y5.000 Z-1.415
+X7.500 Y5.000 Z-1.391
+X7.600 Y5.000 Z-1.367
+X7.700 Y5.000 Z-1.342
+X7.800 Y5.000 Z-1.317
+X7.900 Y5.000 Z-1.291
+X8.000 Y5.000 Z-1.265
+X8.100 Y5.000 Z-1.239
+X8.200 Y5.000 Z-1.212
+X8.300 Y5.000 Z-1.186
+X8.400 Y5.000 Z-1.159
+X8.500 Y5.000 Z-1.131
+X8.600 Y5.000 Z-1.104
+X8.700 Y5.000 Z-1.076
+X8.800 Y5.000 Z-1.049
+X8.900 Y5.000 Z-1.021
+X9.000 Y5.000 Z-0.993
+X9.100 Y5.000 Z-0.966
+X9.200 Y5.000 Z-0.938
+X9.300 Y5.000 Z-0.910
+X9.400 Y5.000 Z-0.883
+X9.500 Y5.000 Z-0.856
+X9.600 Y5.000 Z-0.828
+X9.700 Y5.000 Z-0.801
+X9.800 Y5.000 Z-0.775
+X9.900 Y5.000 Z-0.748
+X10.000 Y5.000 Z-0.722
+X10.100 Y5.000 Z-0.696
+X10.200 Y5.000 Z-0.671
+X10.300 Y5.000 Z-0.646
+X10.400 Y5.000 Z-0.621
+X10.500 Y5.000 Z-0.597
+X10.600 Y5.000 Z-0.574
+X10.700 Y5.000 Z-0.551
+X10.800 Y5.000 Z-0.528
+X10.900 Y5.000 Z-0.506
+X11.000 Y5.000 Z-0.485
+X11.100 Y5.000 Z-0.464
+X11.200 Y5.000 Z-0.444
+X11.300 Y5.000 Z-0.425
+X11.400 Y5.000 Z-0.406
+X11.500 Y5.000 Z-0.388
+X11.600 Y5.000 Z-0.371
+X11.700 Y5.000 Z-0.354
+X11.800 Y5.000 Z-0.339
+X11.900 Y5.000 Z-0.324
+X12.000 Y5.000 Z-0.310
+X12.100 Y5.000 Z-0.297
+X12.200 Y5.000 Z-0.284
+X12.300 Y5.000 Z-0.273
+X12.400 Y5.000 Z-0.262
+X12.500 Y5.000 Z-0.253
+X12.600 Y5.000 Z-0.244
+X12.700 Y5.000 Z-0.236
+X12.800 Y5.000 Z-0.229
+X12.900 Y5.000 Z-0.223
+X13.000 Y5.000 Z-0.218
+X13.100 Y5.000 Z-0.214
+X13.200 Y5.000 Z-0.211
+X13.300 Y5.000 Z-0.209
+X13.400 Y5.000 Z-0.208
+X13.500 Y5.000 Z-0.208
+X13.600 Y5.000 Z-0.209
+X13.700 Y5.000 Z-0.211
+X13.800 Y5.000 Z-0.213
+X13.900 Y5.000 Z-0.217
+X14.000 Y5.000 Z-0.222
+X14.100 Y5.000 Z-0.228
+X14.200 Y5.000 Z-0.234
+X14.300 Y5.000 Z-0.242
+X14.400 Y5.000 Z-0.250
+X14.500 Y5.000 Z-0.260
+X14.600 Y5.000 Z-0.270
+X14.700 Y5.000 Z-0.281
+X14.800 Y5.000 Z-0.293
+X14.900 Y5.000 Z-0.306
+X15.000 Y5.000 Z-0.320
+X15.100 Y5.000 Z-0.334
+X15.200 Y5.000 Z-0.350
+X15.300 Y5.000 Z-0.366
+X15.400 Y5.000 Z-0.383
+X15.500 Y5.000 Z-0.401
+X15.600 Y5.000 Z-0.419
+X15.700 Y5.000 Z-0.438
+X15.800 Y5.000 Z-0.458
+X15.900 Y5.000 Z-0.479
+X16.000 Y5.000 Z-0.500
+X16.100 Y5.000 Z-0.522
+X16.200 Y5.000 Z-0.544
+X16.300 Y5.000 Z-0.567
+X16.400 Y5.000 Z-0.591
+X16.500 Y5.000 Z-0.615
+X16.600 Y5.000 Z-0.639
+X16.700 Y5.000 Z-0.664
+X16.800 Y5.000 Z-0.689
+X16.900 Y5.000 Z-0.715
+X17.000 Y5.000 Z-0.741
+X17.100 Y5.000 Z-0.767
+X17.200 Y5.000 Z-0.794
+X17.300 Y5.000 Z-0.821
+X17.400 Y5.000 Z-0.848
+X17.500 Y5.000 Z-0.875
+X17.600 Y5.000 Z-0.903
+X17.700 Y5.000 Z-0.930
+X17.800 Y5.000 Z-0.958
+X17.900 Y5.000 Z-0.986
+X18.000 Y5.000 Z-1.013
+X18.100 Y5.000 Z-1.041
+X18.200 Y5.000 Z-1.069
+X18.300 Y5.000 Z-1.096
+X18.400 Y5.000 Z-1.124
+X18.500 Y5.000 Z-1.151
+X18.600 Y5.000 Z-1.178
+X18.700 Y5.000 Z-1.205
+X18.800 Y5.000 Z-1.232
+X18.900 Y5.000 Z-1.258
+X19.000 Y5.000 Z-1.284
+X19.100 Y5.000 Z-1.310
+X19.200 Y5.000 Z-1.335
+X19.300 Y5.000 Z-1.360
+X19.400 Y5.000 Z-1.384
+X19.500 Y5.000 Z-1.408
+X19.600 Y5.000 Z-1.432
+X19.700 Y5.000 Z-1.455
+X19.800 Y5.000 Z-1.477
+X19.900 Y5.000 Z-1.499
+X20.000 Y5.000 Z-1.520
+X20.100 Y5.000 Z-1.541
+X20.200 Y5.000 Z-1.561
+X20.300 Y5.000 Z-1.580
+X20.400 Y5.000 Z-1.599
+X20.500 Y5.000 Z-1.616
+X20.600 Y5.000 Z-1.633
+X20.700 Y5.000 Z-1.650
+X20.800 Y5.000 Z-1.665
+X20.900 Y5.000 Z-1.680
+X21.000 Y5.000 Z-1.694
+X21.100 Y5.000 Z-1.706
+X21.200 Y5.000 Z-1.719
+X21.300 Y5.000 Z-1.730
+X21.400 Y5.000 Z-1.740
+X21.500 Y5.000 Z-1.750
+X21.600 Y5.000 Z-1.758
+X21.700 Y5.000 Z-1.766
+X21.800 Y5.000 Z-1.772
+X21.900 Y5.000 Z-1.778
+X22.000 Y5.000 Z-1.783
+X22.100 Y5.000 Z-1.786
+X22.200 Y5.000 Z-1.789
+X22.300 Y5.000 Z-1.791
+X22.400 Y5.000 Z-1.792
+X22.500 Y5.000 Z-1.792
+X22.600 Y5.000 Z-1.791
+X22.700 Y5.000 Z-1.789
+X22.800 Y5.000 Z-1.786
+X22.900 Y5.000 Z-1.782
+X23.000 Y5.000 Z-1.777
+X23.100 Y5.000 Z-1.771
+X23.200 Y5.000 Z-1.764
+X23.300 Y5.000 Z-1.756
+X23.400 Y5.000 Z-1.748
+X23.500 Y5.000 Z-1.738
+X23.600 Y5.000 Z-1.728
+X23.700 Y5.000 Z-1.716
+X23.800 Y5.000 Z-1.704
+X23.900 Y5.000 Z-1.691
+X24.000 Y5.000 Z-1.677
+X24.100 Y5.000 Z-1.662
+X24.200 Y5.000 Z-1.646
+X24.300 Y5.000 Z-1.630
+X24.400 Y5.000 Z-1.613
+X24.500 Y5.000 Z-1.595
+X24.600 Y5.000 Z-1.576
+X24.700 Y5.000 Z-1.557
+X24.800 Y5.000 Z-1.537
+X24.900 Y5.000 Z-1.516
+X25.000 Y5.000 Z-1.495
+X25.100 Y5.000 Z-1.473
+X25.200 Y5.000 Z-1.450
+X25.300 Y5.000 Z-1.427
+X25.400 Y5.000 Z-1.404
+X25.500 Y5.000 Z-1.380
+X25.600 Y5.000 Z-1.355
+X25.700 Y5.000 Z-1.330
+X25.800 Y5.000 Z-1.305
+X25.900 Y5.000 Z-1.279
+X26.000 Y5.000 Z-1.253
+X26.100 Y5.000 Z-1.226
+X26.200 Y5.000 Z-1.200
+X26.300 Y5.000 Z-1.173
+X26.400 Y5.000 Z-1.146
+X26.500 Y5.000 Z-1.118
+X26.600 Y5.000 Z-1.091
+X26.700 Y5.000 Z-1.063
+X26.800 Y5.000 Z-1.035
+X26.900 Y5.000 Z-1.008
+X27.000 Y5.000 Z-0.980
+X27.100 Y5.000 Z-0.952
+X27.200 Y5.000 Z-0.925
+X27.300 Y5.000 Z-0.897
+X27.400 Y5.000 Z-0.870
+X27.500 Y5.000 Z-0.842
+X27.600 Y5.000 Z-0.815
+X27.700 Y5.000 Z-0.789
+X27.800 Y5.000 Z-0.762
+X27.900 Y5.000 Z-0.736
+X28.000 Y5.000 Z-0.710
+X28.100 Y5.000 Z-0.684
+X28.200 Y5.000 Z-0.659
+X28.300 Y5.000 Z-0.634
+X28.400 Y5.000 Z-0.610
+X28.500 Y5.000 Z-0.586
+X28.600 Y5.000 Z-0.563
+X28.700 Y5.000 Z-0.540
+X28.800 Y5.000 Z-0.517
+X28.900 Y5.000 Z-0.496
+X29.000 Y5.000 Z-0.475
+X29.100 Y5.000 Z-0.454
+X29.200 Y5.000 Z-0.435
+X29.300 Y5.000 Z-0.415
+X29.400 Y5.000 Z-0.397
+X29.500 Y5.000 Z-0.380
+X29.600 Y5.000 Z-0.363
+X29.700 Y5.000 Z-0.347
+X29.800 Y5.000 Z-0.331
+X29.900 Y5.000 Z-0.317
+X30.000 Y5.000 Z-0.303
+X30.000 Y5.500 Z-0.305
+X29.900 Y5.500 Z-0.319
+X29.800 Y5.500 Z-0.333
+X29.700 Y5.500 Z-0.348
+X29.600 Y5.500 Z-0.364
+X29.500 Y5.500 Z-0.381
+X29.400 Y5.500 Z-0.399
+X29.300 Y5.500 Z-0.417
+X29.200 Y5.500 Z-0.436
+X29.100 Y5.500 Z-0.456
+X29.000 Y5.500 Z-0.476
+X28.900 Y5.500 Z-0.497
+X28.800 Y5.500 Z-0.519
+X28.700 Y5.500 Z-0.541
+X28.600 Y5.500 Z-0.564
+X28.500 Y5.500 Z-0.587
+X28.400 Y5.500 Z-0.611
+X28.300 Y5.500 Z-0.635
+X28.200 Y5.500 Z-0.660
+X28.100 Y5.500 Z-0.685
+X28.000 Y5.500 Z-0.710
+X27.900 Y5.500 Z-0.736
+X27.800 Y5.500 Z-0.763
+X27.700 Y5.500 Z-0.789
+X27.600 Y5.500 Z-0.816
+X27.500 Y5.500 Z-0.843
+X27.400 Y5.500 Z-0.870
+X27.300 Y5.500 Z-0.897
+X27.200 Y5.500 Z-0.925
+X27.100 Y5.500 Z-0.952
+X27.000 Y5.500 Z-0.980
+X26.900 Y5.500 Z-1.008
+X26.800 Y5.500 Z-1.035
+X26.700 Y5.500 Z-1.063
+X26.600 Y5.500 Z-1.090
+X26.500 Y5.500 Z-1.118
+X26.400 Y5.500 Z-1.145
+X26.300 Y5.500 Z-1.172
+X26.200 Y5.500 Z-1.199
+X26.100 Y5.500 Z-1.226
+X26.000 Y5.500 Z-1.252
+X25.900 Y5.500 Z-1.278
+X25.800 Y5.500 Z-1.304
+X25.700 Y5.500 Z-1.329
+X25.600 Y5.500 Z-1.354
+X25.500 Y5.500 Z-1.379
+X25.400 Y5.500 Z-1.403
+X25.300 Y5.500 Z-1.426
+X25.200 Y5.500 Z-1.449
+X25.100 Y5.500 Z-1.472
+X25.000 Y5.500 Z-1.494
+X24.900 Y5.500 Z-1.515
+X24.800 Y5.500 Z-1.535
+X24.700 Y5.500 Z-1.555
+X24.600 Y5.500 Z-1.575
+X24.500 Y5.500 Z-1.593
+X24.400 Y5.500 Z-1.611
+X24.300 Y5.500 Z-1.628
+X24.200 Y5.500 Z-1.645
+X24.100 Y5.500 Z-1.660
+X24.000 Y5.500 Z-1.675
+X23.900 Y5.500 Z-1.689
+X23.800 Y5.500 Z-1.702
+X23.700 Y5.500 Z-1.714
+X23.600 Y5.500 Z-1.726
+X23.500 Y5.500 Z-1.736
+X23.400 Y5.500 Z-1.746
+X23.300 Y5.500 Z-1.754
+X23.200 Y5.500 Z-1.762
+X23.100 Y5.500 Z-1.769
+X23.000 Y5.500 Z-1.775
+X22.900 Y5.500 Z-1.780
+X22.800 Y5.500 Z-1.784
+X22.700 Y5.500 Z-1.787
+X22.600 Y5.500 Z-1.789
+X22.500 Y5.500 Z-1.790
+X22.400 Y5.500 Z-1.790
+X22.300 Y5.500 Z-1.789
+X22.200 Y5.500 Z-1.787
+X22.100 Y5.500 Z-1.784
+X22.000 Y5.500 Z-1.781
+X21.900 Y5.500 Z-1.776
+X21.800 Y5.500 Z-1.770
+X21.700 Y5.500 Z-1.764
+X21.600 Y5.500 Z-1.756
+X21.500 Y5.500 Z-1.748
+X21.400 Y5.500 Z-1.738
+X21.300 Y5.500 Z-1.728
+X21.200 Y5.500 Z-1.717
+X21.100 Y5.500 Z-1.705
+X21.000 Y5.500 Z-1.692
+X20.900 Y5.500 Z-1.678
+X20.800 Y5.500 Z-1.663
+X20.700 Y5.500 Z-1.648
+X20.600 Y5.500 Z-1.632
+X20.500 Y5.500 Z-1.615
+X20.400 Y5.500 Z-1.597
+X20.300 Y5.500 Z-1.579
+X20.200 Y5.500 Z-1.559
+X20.100 Y5.500 Z-1.540
+X20.000 Y5.500 Z-1.519
+X19.900 Y5.500 Z-1.498
+X19.800 Y5.500 Z-1.476
+X19.700 Y5.500 Z-1.454
+X19.600 Y5.500 Z-1.431
+X19.500 Y5.500 Z-1.407
+X19.400 Y5.500 Z-1.383
+X19.300 Y5.500 Z-1.359
+X19.200 Y5.500 Z-1.334
+X19.100 Y5.500 Z-1.309
+X19.000 Y5.500 Z-1.283
+X18.900 Y5.500 Z-1.257
+X18.800 Y5.500 Z-1.231
+X18.700 Y5.500 Z-1.204
+X18.600 Y5.500 Z-1.178
+X18.500 Y5.500 Z-1.151
+X18.400 Y5.500 Z-1.123
+X18.300 Y5.500 Z-1.096
+X18.200 Y5.500 Z-1.068
+X18.100 Y5.500 Z-1.041
+X18.000 Y5.500 Z-1.013
+X17.900 Y5.500 Z-0.986
+X17.800 Y5.500 Z-0.958
+X17.700 Y5.500 Z-0.930
+X17.600 Y5.500 Z-0.903
+X17.500 Y5.500 Z-0.876
+X17.400 Y5.500 Z-0.848
+X17.300 Y5.500 Z-0.821
+X17.200 Y5.500 Z-0.794
+X17.100 Y5.500 Z-0.768
+X17.000 Y5.500 Z-0.742
+X16.900 Y5.500 Z-0.716
+X16.800 Y5.500 Z-0.690
+X16.700 Y5.500 Z-0.665
+X16.600 Y5.500 Z-0.640
+X16.500 Y5.500 Z-0.616
+X16.400 Y5.500 Z-0.592
+X16.300 Y5.500 Z-0.568
+X16.200 Y5.500 Z-0.545
+X16.100 Y5.500 Z-0.523
+X16.000 Y5.500 Z-0.501
+X15.900 Y5.500 Z-0.480
+X15.800 Y5.500 Z-0.460
+X15.700 Y5.500 Z-0.440
+X15.600 Y5.500 Z-0.421
+X15.500 Y5.500 Z-0.402
+X15.400 Y5.500 Z-0.385
+X15.300 Y5.500 Z-0.368
+X15.200 Y5.500 Z-0.351
+X15.100 Y5.500 Z-0.336
+X15.000 Y5.500 Z-0.321
+X14.900 Y5.500 Z-0.308
+X14.800 Y5.500 Z-0.295
+X14.700 Y5.500 Z-0.283
+X14.600 Y5.500 Z-0.272
+X14.500 Y5.500 Z-0.261
+X14.400 Y5.500 Z-0.252
+X14.300 Y5.500 Z-0.244
+X14.200 Y5.500 Z-0.236
+X14.100 Y5.500 Z-0.230
+X14.000 Y5.500 Z-0.224
+X13.900 Y5.500 Z-0.219
+X13.800 Y5.500 Z-0.215
+X13.700 Y5.500 Z-0.213
+X13.600 Y5.500 Z-0.211
+X13.500 Y5.500 Z-0.210
+X13.400 Y5.500 Z-0.210
+X13.300 Y5.500 Z-0.211
+X13.200 Y5.500 Z-0.213
+X13.100 Y5.500 Z-0.216
+X13.000 Y5.500 Z-0.220
+X12.900 Y5.500 Z-0.225
+X12.800 Y5.500 Z-0.231
+X12.700 Y5.500 Z-0.238
+X12.600 Y5.500 Z-0.246
+X12.500 Y5.500 Z-0.255
+X12.400 Y5.500 Z-0.264
+X12.300 Y5.500 Z-0.275
+X12.200 Y5.500 Z-0.286
+X12.100 Y5.500 Z-0.298
+X12.000 Y5.500 Z-0.311
+X11.900 Y5.500 Z-0.325
+X11.800 Y5.500 Z-0.340
+X11.700 Y5.500 Z-0.356
+X11.600 Y5.500 Z-0.372
+X11.500 Y5.500 Z-0.389
+X11.400 Y5.500 Z-0.407
+X11.300 Y5.500 Z-0.426
+X11.200 Y5.500 Z-0.445
+X11.100 Y5.500 Z-0.465
+X11.000 Y5.500 Z-0.486
+X10.900 Y5.500 Z-0.507
+X10.800 Y5.500 Z-0.529
+X10.700 Y5.500 Z-0.552
+X10.600 Y5.500 Z-0.575
+X10.500 Y5.500 Z-0.598
+X10.400 Y5.500 Z-0.622
+X10.300 Y5.500 Z-0.647
+X10.200 Y5.500 Z-0.672
+X10.100 Y5.500 Z-0.697
+X10.000 Y5.500 Z-0.723
+X9.900 Y5.500 Z-0.749
+X9.800 Y5.500 Z-0.775
+X9.700 Y5.500 Z-0.802
+X9.600 Y5.500 Z-0.829
+X9.500 Y5.500 Z-0.856
+X9.400 Y5.500 Z-0.883
+X9.300 Y5.500 Z-0.911
+X9.200 Y5.500 Z-0.938
+X9.100 Y5.500 Z-0.966
+X9.000 Y5.500 Z-0.993
+X8.900 Y5.500 Z-1.021
+X8.800 Y5.500 Z-1.049
+X8.700 Y5.500 Z-1.076
+X8.600 Y5.500 Z-1.104
+X8.500 Y5.500 Z-1.131
+X8.400 Y5.500 Z-1.158
+X8.300 Y5.500 Z-1.185
+X8.200 Y5.500 Z-1.212
+X8.100 Y5.500 Z-1.238
+X8.000 Y5.500 Z-1.265
+X7.900 Y5.500 Z-1.291
+X7.800 Y5.500 Z-1.316
+X7.700 Y5.500 Z-1.341
+X7.600 Y5.500 Z-1.366
+X7.500 Y5.500 Z-1.390
+X7.400 Y5.500 Z-1.414
+X7.300 Y5.500 Z-1.437
+X7.200 Y5.500 Z-1.460
+X7.100 Y5.500 Z-1.482
+X7.000 Y5.500 Z-1.504
+X6.900 Y5.500 Z-1.525
+X6.800 Y5.500 Z-1.545
+X6.700 Y5.500 Z-1.565
+X6.600 Y5.500 Z-1.584
+X6.500 Y5.500 Z-1.602
+X6.400 Y5.500 Z-1.620
+X6.300 Y5.500 Z-1.636
+X6.200 Y5.500 Z-1.652
+X6.100 Y5.500 Z-1.668
+X6.000 Y5.500 Z-1.682
+X5.900 Y5.500 Z-1.695
+X5.800 Y5.500 Z-1.708
+X5.700 Y5.500 Z-1.720
+X5.600 Y5.500 Z-1.731
+X5.500 Y5.500 Z-1.741
+X5.400 Y5.500 Z-1.750
+X5.300 Y5.500 Z-1.758
+X5.200 Y5.500 Z-1.766
+X5.100 Y5.500 Z-1.772
+X5.000 Y5.500 Z-1.777
+X4.900 Y5.500 Z-1.782
+X4.800 Y5.500 Z-1.785
+X4.700 Y5.500 Z-1.788
+X4.600 Y5.500 Z-1.789
+X4.500 Y5.500 Z-1.790
+X4.400 Y5.500 Z-1.790
+X4.300 Y5.500 Z-1.788
+X4.200 Y5.500 Z-1.786
+X4.100 Y5.500 Z-1.783
+X4.000 Y5.500 Z-1.778
+X3.900 Y5.500 Z-1.773
+X3.800 Y5.500 Z-1.767
+X3.700 Y5.500 Z-1.760
+X3.600 Y5.500 Z-1.752
+X3.500 Y5.500 Z-1.743
+X3.400 Y5.500 Z-1.733
+X3.300 Y5.500 Z-1.723
+X3.200 Y5.500 Z-1.711
+X3.100 Y5.500 Z-1.699
+X3.000 Y5.500 Z-1.685
+X2.900 Y5.500 Z-1.671
+X2.800 Y5.500 Z-1.656
+X2.700 Y5.500 Z-1.640
+X2.600 Y5.500 Z-1.624
+X2.500 Y5.500 Z-1.606
+X2.400 Y5.500 Z-1.588
+X2.300 Y5.500 Z-1.569
+X2.200 Y5.500 Z-1.550
+X2.100 Y5.500 Z-1.530
+X2.000 Y5.500 Z-1.509
+X1.900 Y5.500 Z-1.487
+X1.800 Y5.500 Z-1.465
+X1.700 Y5.500 Z-1.443
+X1.600 Y5.500 Z-1.420
+X1.500 Y5.500 Z-1.396
+X1.400 Y5.500 Z-1.372
+X1.300 Y5.500 Z-1.347
+X1.200 Y5.500 Z-1.322
+X1.100 Y5.500 Z-1.297
+X1.000 Y5.500 Z-1.271
+X0.900 Y5.500 Z-1.245
+X0.800 Y5.500 Z-1.218
+X0.700 Y5.500 Z-1.192
+X0.600 Y5.500 Z-1.165
+X0.500 Y5.500 Z-1.138
+X0.400 Y5.500 Z-1.110
+X0.300 Y5.500 Z-1.083
+X0.200 Y5.500 Z-1.055
+X0.100 Y5.500 Z-1.028
+X0.000 Y5.500 Z-1.000
+G0 Z2.000
+G0 X0.000 Y0.000
+M2
@@ -0,0 +1,58 @@
+(Circular pocket, 24mm diameter, 3 helical step-downs with concentric G2 passes)
+G21 G90 G17
+G0 Z2.000
+G0 X30.000 Y30.000
+G1 Z0.000 F200
+G0 X32.000 Y30.000
+G2 X32.000 Y30.000 Z-1.000 I-2.000 J0.000 F300
+G1 X32.000 Y30.000 F400
+G2 X32.000 Y30.000 I-2.000 J0.000
+G1 X33.500 Y30.000 F400
+G2 X33.500 Y30.000 I-3.500 J0.000
+G1 X35.000 Y30.000 F400
+G2 X35.000 Y30.000 I-5.000 J0.000
+G1 X36.500 Y30.000 F400
+G2 X36.500 Y30.000 I-6.500 J0.000
+G1 X38.000 Y30.000 F400
+G2 X38.000 Y30.000 I-8.000 J0.000
+G1 X39.500 Y30.000 F400
+G2 X39.500 Y30.000 I-9.500 J0.000
+G1 X41.000 Y30.000 F400
+G2 X41.000 Y30.000 I-11.000 J0.000
+G0 Z2.000
+G0 X32.000 Y30.000
+G2 X32.000 Y30.000 Z-2.000 I-2.000 J0.000 F300
+G1 X32.000 Y30.000 F400
+G2 X32.000 Y30.000 I-2.000 J0.000
+G1 X33.500 Y30.000 F400
+G2 X33.500 Y30.000 I-3.500 J0.000
+G1 X35.000 Y30.000 F400
+G2 X35.000 Y30.000 I-5.000 J0.000
+G1 X36.500 Y30.000 F400
+G2 X36.500 Y30.000 I-6.500 J0.000
+G1 X38.000 Y30.000 F400
+G2 X38.000 Y30.000 I-8.000 J0.000
+G1 X39.500 Y30.000 F400
+G2 X39.500 Y30.000 I-9.500 J0.000
+G1 X41.000 Y30.000 F400
+G2 X41.000 Y30.000 I-11.000 J0.000
+G0 Z2.000
+G0 X32.000 Y30.000
+G2 X32.000 Y30.000 Z-3.000 I-2.000 J0.000 F300
+G1 X32.000 Y30.000 F400
+G2 X32.000 Y30.000 I-2.000 J0.000
+G1 X33.500 Y30.000 F400
+G2 X33.500 Y30.000 I-3.500 J0.000
+G1 X35.000 Y30.000 F400
+G2 X35.000 Y30.000 I-5.000 J0.000
+G1 X36.500 Y30.000 F400
+G2 X36.500 Y30.000 I-6.500 J0.000
+G1 X38.000 Y30.000 F400
+G2 X38.000 Y30.000 I-8.000 J0.000
+G1 X39.500 Y30.000 F400
+G2 X39.500 Y30.000 I-9.500 J0.000
+G1 X41.000 Y30.000 F400
+G2 X41.000 Y30.000 I-11.000 J0.000
+G0 Z2.000
+G0 X0.000 Y0.000
+M2
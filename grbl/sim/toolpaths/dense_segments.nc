@@ -0,0 +1,2999 @@
+(Spiral of 0.05 mm line segments, 150 mm total path)
+G21 G90
+G0 X0.000 Y0.000
+G1 F450
+X0.0094 Y0.0502
+X0.0174 Y0.1007
+X0.0242 Y0.1513
+X0.0297 Y0.2021
+X0.0338 Y0.2530
+X0.0367 Y0.3040
+X0.0383 Y0.3550
+X0.0386 Y0.4061
+X0.0376 Y0.4571
+X0.0354 Y0.5081
+X0.0319 Y0.5590
+X0.0272 Y0.6097
+X0.0212 Y0.6604
+X0.0140 Y0.7108
+X0.0055 Y0.7611
+X-0.0041 Y0.8112
+X-0.0150 Y0.8610
+X-0.0270 Y0.9105
+X-0.0402 Y0.9597
+X-0.0546 Y1.0085
+X-0.0701 Y1.0570
+X-0.0867 Y1.1052
+X-0.1045 Y1.1529
+X-0.1234 Y1.2002
+X-0.1433 Y1.2470
+X-0.1643 Y1.2933
+X-0.1864 Y1.3392
+X-0.2096 Y1.3845
+X-0.2337 Y1.4293
+X-0.2589 Y1.4735
+X-0.2850 Y1.5171
+X-0.3121 Y1.5601
+X-0.3402 Y1.6025
+X-0.3692 Y1.6442
+X-0.3991 Y1.6853
+X-0.4300 Y1.7257
+X-0.4617 Y1.7654
+X-0.4943 Y1.8044
+X-0.5277 Y1.8427
+X-0.5619 Y1.8802
+X-0.5970 Y1.9170
+X-0.6328 Y1.9530
+X-0.6694 Y1.9882
+X-0.7067 Y2.0226
+X-0.7448 Y2.0562
+X-0.7835 Y2.0890
+X-0.8230 Y2.1210
+X-0.8631 Y2.1521
+X-0.9039 Y2.1823
+X-0.9453 Y2.2117
+X-0.9872 Y2.2402
+X-1.0298 Y2.2678
+X-1.0729 Y2.2945
+X-1.1166 Y2.3203
+X-1.1608 Y2.3452
+X-1.2055 Y2.3692
+X-1.2506 Y2.3923
+X-1.2963 Y2.4144
+X-1.3423 Y2.4356
+X-1.3888 Y2.4558
+X-1.4357 Y2.4751
+X-1.4830 Y2.4935
+X-1.5306 Y2.5109
+X-1.5785 Y2.5273
+X-1.6268 Y2.5428
+X-1.6753 Y2.5573
+X-1.7242 Y2.5708
+X-1.7733 Y2.5834
+X-1.8226 Y2.5950
+X-1.8721 Y2.6056
+X-1.9218 Y2.6152
+X-1.9718 Y2.6239
+X-2.0218 Y2.6315
+X-2.0720 Y2.6383
+X-2.1223 Y2.6440
+X-2.1727 Y2.6487
+X-2.2232 Y2.6525
+X-2.2738 Y2.6553
+X-2.3244 Y2.6572
+X-2.3750 Y2.6581
+X-2.4256 Y2.6580
+X-2.4762 Y2.6569
+X-2.5268 Y2.6549
+X-2.5773 Y2.6519
+X-2.6278 Y2.6480
+X-2.6781 Y2.6432
+X-2.7284 Y2.6374
+X-2.7786 Y2.6306
+X-2.8286 Y2.6230
+X-2.8784 Y2.6143
+X-2.9281 Y2.6048
+X-2.9776 Y2.5944
+X-3.0269 Y2.5830
+X-3.0760 Y2.5708
+X-3.1248 Y2.5576
+X-3.1734 Y2.5436
+X-3.2217 Y2.5287
+X-3.2697 Y2.5129
+X-3.3175 Y2.4962
+X-3.3649 Y2.4787
+X-3.4120 Y2.4603
+X-3.4588 Y2.4411
+X-3.5052 Y2.4211
+X-3.5512 Y2.4002
+X-3.5969 Y2.3785
+X-3.6421 Y2.3560
+X-3.6870 Y2.3327
+X-3.7314 Y2.3086
+X-3.7754 Y2.2837
+X-3.8189 Y2.2581
+X-3.8620 Y2.2317
+X-3.9046 Y2.2045
+X-3.9468 Y2.1766
+X-3.9884 Y2.1480
+X-4.0295 Y2.1187
+X-4.0701 Y2.0886
+X-4.1102 Y2.0579
+X-4.1498 Y2.0264
+X-4.1887 Y1.9943
+X-4.2272 Y1.9615
+X-4.2650 Y1.9281
+X-4.3023 Y1.8940
+X-4.3390 Y1.8593
+X-4.3751 Y1.8240
+X-4.4106 Y1.7881
+X-4.4455 Y1.7515
+X-4.4797 Y1.7144
+X-4.5133 Y1.6768
+X-4.5463 Y1.6385
+X-4.5786 Y1.5997
+X-4.6103 Y1.5604
+X-4.6413 Y1.5206
+X-4.6716 Y1.4802
+X-4.7013 Y1.4394
+X-4.7302 Y1.3980
+X-4.7585 Y1.3562
+X-4.7861 Y1.3139
+X-4.8130 Y1.2712
+X-4.8391 Y1.2281
+X-4.8646 Y1.1845
+X-4.8893 Y1.1405
+X-4.9133 Y1.0961
+X-4.9366 Y1.0513
+X-4.9591 Y1.0062
+X-4.9809 Y0.9607
+X-5.0020 Y0.9148
+X-5.0223 Y0.8687
+X-5.0419 Y0.8222
+X-5.0607 Y0.7753
+X-5.0788 Y0.7282
+X-5.0961 Y0.6809
+X-5.1126 Y0.6332
+X-5.1284 Y0.5853
+X-5.1434 Y0.5371
+X-5.1576 Y0.4887
+X-5.1711 Y0.4401
+X-5.1838 Y0.3913
+X-5.1957 Y0.3423
+X-5.2068 Y0.2931
+X-5.2172 Y0.2438
+X-5.2267 Y0.1942
+X-5.2355 Y0.1446
+X-5.2436 Y0.0948
+X-5.2508 Y0.0449
+X-5.2573 Y-0.0051
+X-5.2629 Y-0.0552
+X-5.2678 Y-0.1054
+X-5.2720 Y-0.1556
+X-5.2753 Y-0.2059
+X-5.2778 Y-0.2563
+X-5.2796 Y-0.3067
+X-5.2806 Y-0.3571
+X-5.2809 Y-0.4075
+X-5.2803 Y-0.4579
+X-5.2790 Y-0.5083
+X-5.2769 Y-0.5587
+X-5.2740 Y-0.6090
+X-5.2704 Y-0.6593
+X-5.2660 Y-0.7095
+X-5.2609 Y-0.7596
+X-5.2550 Y-0.8097
+X-5.2483 Y-0.8596
+X-5.2409 Y-0.9095
+X-5.2327 Y-0.9592
+X-5.2238 Y-1.0088
+X-5.2141 Y-1.0582
+X-5.2037 Y-1.1075
+X-5.1926 Y-1.1567
+X-5.1807 Y-1.2057
+X-5.1681 Y-1.2544
+X-5.1548 Y-1.3030
+X-5.1408 Y-1.3514
+X-5.1260 Y-1.3996
+X-5.1105 Y-1.4475
+X-5.0944 Y-1.4953
+X-5.0775 Y-1.5427
+X-5.0599 Y-1.5899
+X-5.0416 Y-1.6369
+X-5.0227 Y-1.6836
+X-5.0030 Y-1.7299
+X-4.9827 Y-1.7760
+X-4.9618 Y-1.8218
+X-4.9401 Y-1.8673
+X-4.9178 Y-1.9125
+X-4.8948 Y-1.9573
+X-4.8712 Y-2.0018
+X-4.8470 Y-2.0459
+X-4.8221 Y-2.0897
+X-4.7966 Y-2.1332
+X-4.7705 Y-2.1762
+X-4.7437 Y-2.2189
+X-4.7163 Y-2.2612
+X-4.6884 Y-2.3030
+X-4.6598 Y-2.3445
+X-4.6307 Y-2.3856
+X-4.6010 Y-2.4262
+X-4.5706 Y-2.4664
+X-4.5398 Y-2.5062
+X-4.5083 Y-2.5456
+X-4.4764 Y-2.5844
+X-4.4438 Y-2.6229
+X-4.4108 Y-2.6608
+X-4.3771 Y-2.6983
+X-4.3430 Y-2.7353
+X-4.3084 Y-2.7719
+X-4.2732 Y-2.8079
+X-4.2376 Y-2.8434
+X-4.2014 Y-2.8785
+X-4.1648 Y-2.9130
+X-4.1277 Y-2.9470
+X-4.0901 Y-2.9805
+X-4.0521 Y-3.0135
+X-4.0136 Y-3.0459
+X-3.9746 Y-3.0778
+X-3.9352 Y-3.1092
+X-3.8954 Y-3.1400
+X-3.8552 Y-3.1702
+X-3.8146 Y-3.1999
+X-3.7735 Y-3.2291
+X-3.7321 Y-3.2576
+X-3.6903 Y-3.2856
+X-3.6481 Y-3.3130
+X-3.6055 Y-3.3399
+X-3.5626 Y-3.3661
+X-3.5193 Y-3.3918
+X-3.4756 Y-3.4169
+X-3.4317 Y-3.4413
+X-3.3874 Y-3.4652
+X-3.3427 Y-3.4885
+X-3.2978 Y-3.5112
+X-3.2526 Y-3.5332
+X-3.2071 Y-3.5547
+X-3.1613 Y-3.5755
+X-3.1152 Y-3.5957
+X-3.0688 Y-3.6153
+X-3.0222 Y-3.6342
+X-2.9754 Y-3.6526
+X-2.9283 Y-3.6703
+X-2.8810 Y-3.6874
+X-2.8334 Y-3.7038
+X-2.7857 Y-3.7196
+X-2.7377 Y-3.7348
+X-2.6895 Y-3.7493
+X-2.6412 Y-3.7632
+X-2.5926 Y-3.7765
+X-2.5439 Y-3.7891
+X-2.4951 Y-3.8010
+X-2.4461 Y-3.8124
+X-2.3969 Y-3.8230
+X-2.3476 Y-3.8331
+X-2.2982 Y-3.8424
+X-2.2486 Y-3.8511
+X-2.1990 Y-3.8592
+X-2.1492 Y-3.8666
+X-2.0994 Y-3.8734
+X-2.0495 Y-3.8795
+X-1.9995 Y-3.8850
+X-1.9494 Y-3.8898
+X-1.8993 Y-3.8940
+X-1.8491 Y-3.8975
+X-1.7989 Y-3.9004
+X-1.7487 Y-3.9026
+X-1.6984 Y-3.9042
+X-1.6481 Y-3.9051
+X-1.5978 Y-3.9053
+X-1.5475 Y-3.9050
+X-1.4972 Y-3.9039
+X-1.4470 Y-3.9023
+X-1.3967 Y-3.9000
+X-1.3465 Y-3.8970
+X-1.2964 Y-3.8934
+X-1.2463 Y-3.8892
+X-1.1962 Y-3.8843
+X-1.1463 Y-3.8788
+X-1.0963 Y-3.8726
+X-1.0465 Y-3.8658
+X-0.9968 Y-3.8584
+X-0.9472 Y-3.8504
+X-0.8976 Y-3.8417
+X-0.8482 Y-3.8324
+X-0.7989 Y-3.8225
+X-0.7498 Y-3.8119
+X-0.7007 Y-3.8008
+X-0.6519 Y-3.7890
+X-0.6031 Y-3.7766
+X-0.5546 Y-3.7636
+X-0.5062 Y-3.7500
+X-0.4579 Y-3.7358
+X-0.4099 Y-3.7210
+X-0.3620 Y-3.7056
+X-0.3144 Y-3.6896
+X-0.2669 Y-3.6730
+X-0.2197 Y-3.6558
+X-0.1727 Y-3.6380
+X-0.1259 Y-3.6197
+X-0.0793 Y-3.6007
+X-0.0330 Y-3.5812
+X0.0131 Y-3.5611
+X0.0589 Y-3.5405
+X0.1045 Y-3.5193
+X0.1498 Y-3.4975
+X0.1949 Y-3.4752
+X0.2396 Y-3.4523
+X0.2841 Y-3.4289
+X0.3283 Y-3.4049
+X0.3722 Y-3.3804
+X0.4158 Y-3.3554
+X0.4590 Y-3.3298
+X0.5020 Y-3.3037
+X0.5446 Y-3.2771
+X0.5869 Y-3.2500
+X0.6289 Y-3.2223
+X0.6705 Y-3.1942
+X0.7118 Y-3.1655
+X0.7528 Y-3.1364
+X0.7934 Y-3.1067
+X0.8336 Y-3.0766
+X0.8734 Y-3.0460
+X0.9129 Y-3.0149
+X0.9520 Y-2.9833
+X0.9908 Y-2.9513
+X1.0291 Y-2.9188
+X1.0670 Y-2.8859
+X1.1046 Y-2.8525
+X1.1417 Y-2.8186
+X1.1784 Y-2.7843
+X1.2148 Y-2.7496
+X1.2507 Y-2.7144
+X1.2861 Y-2.6789
+X1.3212 Y-2.6429
+X1.3558 Y-2.6064
+X1.3900 Y-2.5696
+X1.4238 Y-2.5324
+X1.4571 Y-2.4948
+X1.4899 Y-2.4567
+X1.5223 Y-2.4183
+X1.5543 Y-2.3796
+X1.5858 Y-2.3404
+X1.6168 Y-2.3009
+X1.6473 Y-2.2610
+X1.6774 Y-2.2208
+X1.7070 Y-2.1802
+X1.7362 Y-2.1392
+X1.7648 Y-2.0980
+X1.7930 Y-2.0564
+X1.8207 Y-2.0144
+X1.8479 Y-1.9722
+X1.8745 Y-1.9296
+X1.9007 Y-1.8867
+X1.9264 Y-1.8436
+X1.9516 Y-1.8001
+X1.9763 Y-1.7563
+X2.0005 Y-1.7123
+X2.0241 Y-1.6680
+X2.0472 Y-1.6234
+X2.0699 Y-1.5785
+X2.0920 Y-1.5334
+X2.1136 Y-1.4881
+X2.1346 Y-1.4425
+X2.1551 Y-1.3966
+X2.1751 Y-1.3505
+X2.1946 Y-1.3042
+X2.2135 Y-1.2577
+X2.2319 Y-1.2110
+X2.2498 Y-1.1640
+X2.2671 Y-1.1169
+X2.2839 Y-1.0695
+X2.3002 Y-1.0220
+X2.3159 Y-0.9743
+X2.3310 Y-0.9264
+X2.3456 Y-0.8783
+X2.3597 Y-0.8301
+X2.3732 Y-0.7817
+X2.3862 Y-0.7332
+X2.3986 Y-0.6845
+X2.4104 Y-0.6357
+X2.4217 Y-0.5868
+X2.4325 Y-0.5377
+X2.4427 Y-0.4885
+X2.4523 Y-0.4393
+X2.4614 Y-0.3899
+X2.4699 Y-0.3404
+X2.4779 Y-0.2908
+X2.4853 Y-0.2411
+X2.4922 Y-0.1914
+X2.4985 Y-0.1415
+X2.5042 Y-0.0916
+X2.5094 Y-0.0417
+X2.5140 Y0.0083
+X2.5181 Y0.0584
+X2.5216 Y0.1085
+X2.5245 Y0.1586
+X2.5269 Y0.2088
+X2.5287 Y0.2590
+X2.5300 Y0.3092
+X2.5307 Y0.3594
+X2.5309 Y0.4096
+X2.5305 Y0.4598
+X2.5295 Y0.5100
+X2.5280 Y0.5602
+X2.5259 Y0.6104
+X2.5233 Y0.6605
+X2.5201 Y0.7106
+X2.5164 Y0.7607
+X2.5121 Y0.8107
+X2.5073 Y0.8607
+X2.5019 Y0.9106
+X2.4960 Y0.9605
+X2.4895 Y1.0103
+X2.4825 Y1.0600
+X2.4750 Y1.1097
+X2.4669 Y1.1592
+X2.4582 Y1.2087
+X2.4491 Y1.2580
+X2.4393 Y1.3073
+X2.4291 Y1.3565
+X2.4183 Y1.4055
+X2.4070 Y1.4544
+X2.3951 Y1.5032
+X2.3828 Y1.5519
+X2.3699 Y1.6004
+X2.3564 Y1.6488
+X2.3425 Y1.6970
+X2.3280 Y1.7451
+X2.3130 Y1.7930
+X2.2975 Y1.8407
+X2.2815 Y1.8883
+X2.2650 Y1.9357
+X2.2479 Y1.9829
+X2.2304 Y2.0300
+X2.2123 Y2.0768
+X2.1938 Y2.1235
+X2.1747 Y2.1699
+X2.1552 Y2.2162
+X2.1352 Y2.2622
+X2.1146 Y2.3080
+X2.0936 Y2.3536
+X2.0721 Y2.3990
+X2.0501 Y2.4441
+X2.0277 Y2.4890
+X2.0047 Y2.5336
+X1.9813 Y2.5781
+X1.9574 Y2.6222
+X1.9331 Y2.6661
+X1.9083 Y2.7097
+X1.8830 Y2.7531
+X1.8573 Y2.7962
+X1.8311 Y2.8390
+X1.8045 Y2.8816
+X1.7774 Y2.9239
+X1.7498 Y2.9658
+X1.7219 Y3.0075
+X1.6935 Y3.0489
+X1.6646 Y3.0900
+X1.6354 Y3.1308
+X1.6057 Y3.1712
+X1.5755 Y3.2114
+X1.5450 Y3.2512
+X1.5141 Y3.2907
+X1.4827 Y3.3299
+X1.4509 Y3.3688
+X1.4188 Y3.4073
+X1.3862 Y3.4455
+X1.3532 Y3.4833
+X1.3198 Y3.5208
+X1.2861 Y3.5580
+X1.2520 Y3.5948
+X1.2174 Y3.6312
+X1.1826 Y3.6673
+X1.1473 Y3.7030
+X1.1117 Y3.7384
+X1.0757 Y3.7733
+X1.0393 Y3.8079
+X1.0026 Y3.8422
+X0.9655 Y3.8760
+X0.9281 Y3.9095
+X0.8904 Y3.9425
+X0.8523 Y3.9752
+X0.8139 Y4.0075
+X0.7751 Y4.0394
+X0.7360 Y4.0709
+X0.6966 Y4.1020
+X0.6569 Y4.1327
+X0.6169 Y4.1629
+X0.5765 Y4.1928
+X0.5359 Y4.2222
+X0.4950 Y4.2513
+X0.4537 Y4.2799
+X0.4122 Y4.3081
+X0.3704 Y4.3358
+X0.3283 Y4.3631
+X0.2860 Y4.3900
+X0.2433 Y4.4165
+X0.2004 Y4.4426
+X0.1573 Y4.4682
+X0.1138 Y4.4933
+X0.0702 Y4.5180
+X0.0263 Y4.5423
+X-0.0179 Y4.5661
+X-0.0623 Y4.5895
+X-0.1069 Y4.6124
+X-0.1518 Y4.6349
+X-0.1969 Y4.6569
+X-0.2422 Y4.6785
+X-0.2877 Y4.6996
+X-0.3335 Y4.7203
+X-0.3794 Y4.7405
+X-0.4255 Y4.7602
+X-0.4719 Y4.7795
+X-0.5184 Y4.7983
+X-0.5651 Y4.8166
+X-0.6120 Y4.8345
+X-0.6591 Y4.8518
+X-0.7063 Y4.8688
+X-0.7537 Y4.8852
+X-0.8013 Y4.9012
+X-0.8490 Y4.9167
+X-0.8969 Y4.9317
+X-0.9449 Y4.9462
+X-0.9931 Y4.9603
+X-1.0414 Y4.9739
+X-1.0898 Y4.9870
+X-1.1384 Y4.9996
+X-1.1870 Y5.0118
+X-1.2358 Y5.0234
+X-1.2847 Y5.0346
+X-1.3338 Y5.0453
+X-1.3829 Y5.0555
+X-1.4321 Y5.0652
+X-1.4814 Y5.0744
+X-1.5308 Y5.0832
+X-1.5803 Y5.0914
+X-1.6299 Y5.0992
+X-1.6795 Y5.1065
+X-1.7292 Y5.1133
+X-1.7790 Y5.1196
+X-1.8289 Y5.1254
+X-1.8787 Y5.1307
+X-1.9287 Y5.1355
+X-1.9787 Y5.1399
+X-2.0287 Y5.1437
+X-2.0787 Y5.1471
+X-2.1288 Y5.1500
+X-2.1789 Y5.1524
+X-2.2291 Y5.1543
+X-2.2792 Y5.1557
+X-2.3294 Y5.1566
+X-2.3795 Y5.1570
+X-2.4297 Y5.1570
+X-2.4799 Y5.1564
+X-2.5300 Y5.1554
+X-2.5802 Y5.1539
+X-2.6303 Y5.1519
+X-2.6804 Y5.1494
+X-2.7305 Y5.1464
+X-2.7805 Y5.1429
+X-2.8305 Y5.1390
+X-2.8805 Y5.1346
+X-2.9304 Y5.1297
+X-2.9803 Y5.1243
+X-3.0301 Y5.1184
+X-3.0799 Y5.1121
+X-3.1296 Y5.1052
+X-3.1792 Y5.0979
+X-3.2288 Y5.0901
+X-3.2783 Y5.0819
+X-3.3277 Y5.0731
+X-3.3770 Y5.0639
+X-3.4262 Y5.0542
+X-3.4753 Y5.0441
+X-3.5243 Y5.0335
+X-3.5733 Y5.0224
+X-3.6221 Y5.0108
+X-3.6708 Y4.9988
+X-3.7193 Y4.9863
+X-3.7678 Y4.9734
+X-3.8161 Y4.9599
+X-3.8643 Y4.9461
+X-3.9124 Y4.9317
+X-3.9603 Y4.9170
+X-4.0081 Y4.9017
+X-4.0558 Y4.8860
+X-4.1033 Y4.8699
+X-4.1506 Y4.8533
+X-4.1978 Y4.8362
+X-4.2448 Y4.8188
+X-4.2916 Y4.8008
+X-4.3383 Y4.7825
+X-4.3848 Y4.7636
+X-4.4311 Y4.7444
+X-4.4773 Y4.7247
+X-4.5232 Y4.7046
+X-4.5690 Y4.6840
+X-4.6145 Y4.6630
+X-4.6599 Y4.6416
+X-4.7050 Y4.6198
+X-4.7500 Y4.5975
+X-4.7947 Y4.5749
+X-4.8392 Y4.5518
+X-4.8835 Y4.5282
+X-4.9276 Y4.5043
+X-4.9715 Y4.4800
+X-5.0151 Y4.4552
+X-5.0585 Y4.4301
+X-5.1016 Y4.4045
+X-5.1445 Y4.3786
+X-5.1872 Y4.3522
+X-5.2296 Y4.3254
+X-5.2718 Y4.2983
+X-5.3137 Y4.2707
+X-5.3554 Y4.2428
+X-5.3968 Y4.2145
+X-5.4379 Y4.1858
+X-5.4788 Y4.1567
+X-5.5193 Y4.1273
+X-5.5597 Y4.0974
+X-5.5997 Y4.0672
+X-5.6394 Y4.0366
+X-5.6789 Y4.0057
+X-5.7181 Y3.9744
+X-5.7570 Y3.9427
+X-5.7956 Y3.9107
+X-5.8339 Y3.8783
+X-5.8719 Y3.8456
+X-5.9096 Y3.8125
+X-5.9470 Y3.7791
+X-5.9840 Y3.7453
+X-6.0208 Y3.7112
+X-6.0573 Y3.6768
+X-6.0934 Y3.6420
+X-6.1292 Y3.6069
+X-6.1647 Y3.5715
+X-6.1999 Y3.5357
+X-6.2347 Y3.4996
+X-6.2692 Y3.4632
+X-6.3034 Y3.4265
+X-6.3372 Y3.3895
+X-6.3707 Y3.3522
+X-6.4039 Y3.3146
+X-6.4367 Y3.2766
+X-6.4691 Y3.2384
+X-6.5012 Y3.1999
+X-6.5330 Y3.1611
+X-6.5644 Y3.1220
+X-6.5954 Y3.0826
+X-6.6261 Y3.0429
+X-6.6564 Y3.0030
+X-6.6864 Y2.9628
+X-6.7160 Y2.9223
+X-6.7452 Y2.8816
+X-6.7741 Y2.8405
+X-6.8026 Y2.7993
+X-6.8307 Y2.7578
+X-6.8584 Y2.7160
+X-6.8857 Y2.6739
+X-6.9127 Y2.6317
+X-6.9393 Y2.5892
+X-6.9655 Y2.5464
+X-6.9913 Y2.5034
+X-7.0168 Y2.4602
+X-7.0418 Y2.4168
+X-7.0665 Y2.3731
+X-7.0907 Y2.3292
+X-7.1146 Y2.2851
+X-7.1380 Y2.2408
+X-7.1611 Y2.1963
+X-7.1838 Y2.1515
+X-7.2060 Y2.1066
+X-7.2279 Y2.0615
+X-7.2494 Y2.0162
+X-7.2704 Y1.9707
+X-7.2911 Y1.9250
+X-7.3113 Y1.8791
+X-7.3311 Y1.8330
+X-7.3505 Y1.7868
+X-7.3695 Y1.7404
+X-7.3881 Y1.6938
+X-7.4063 Y1.6471
+X-7.4240 Y1.6002
+X-7.4414 Y1.5532
+X-7.4583 Y1.5060
+X-7.4748 Y1.4586
+X-7.4909 Y1.4111
+X-7.5065 Y1.3635
+X-7.5218 Y1.3157
+X-7.5366 Y1.2678
+X-7.5509 Y1.2198
+X-7.5649 Y1.1716
+X-7.5784 Y1.1234
+X-7.5915 Y1.0750
+X-7.6042 Y1.0264
+X-7.6165 Y0.9778
+X-7.6283 Y0.9291
+X-7.6397 Y0.8803
+X-7.6507 Y0.8314
+X-7.6612 Y0.7823
+X-7.6713 Y0.7332
+X-7.6809 Y0.6840
+X-7.6902 Y0.6347
+X-7.6990 Y0.5854
+X-7.7073 Y0.5360
+X-7.7153 Y0.4864
+X-7.7228 Y0.4369
+X-7.7298 Y0.3872
+X-7.7365 Y0.3375
+X-7.7427 Y0.2878
+X-7.7484 Y0.2380
+X-7.7538 Y0.1881
+X-7.7587 Y0.1382
+X-7.7631 Y0.0883
+X-7.7671 Y0.0383
+X-7.7707 Y-0.0117
+X-7.7739 Y-0.0617
+X-7.7766 Y-0.1118
+X-7.7788 Y-0.1619
+X-7.7807 Y-0.2120
+X-7.7821 Y-0.2621
+X-7.7831 Y-0.3122
+X-7.7836 Y-0.3623
+X-7.7837 Y-0.4125
+X-7.7834 Y-0.4626
+X-7.7826 Y-0.5127
+X-7.7814 Y-0.5628
+X-7.7798 Y-0.6129
+X-7.7777 Y-0.6630
+X-7.7752 Y-0.7131
+X-7.7723 Y-0.7632
+X-7.7689 Y-0.8132
+X-7.7651 Y-0.8632
+X-7.7609 Y-0.9131
+X-7.7562 Y-0.9630
+X-7.7511 Y-1.0129
+X-7.7456 Y-1.0627
+X-7.7397 Y-1.1125
+X-7.7333 Y-1.1622
+X-7.7265 Y-1.2119
+X-7.7193 Y-1.2615
+X-7.7116 Y-1.3111
+X-7.7036 Y-1.3605
+X-7.6951 Y-1.4099
+X-7.6861 Y-1.4593
+X-7.6768 Y-1.5085
+X-7.6670 Y-1.5577
+X-7.6568 Y-1.6068
+X-7.6462 Y-1.6558
+X-7.6352 Y-1.7047
+X-7.6238 Y-1.7535
+X-7.6119 Y-1.8022
+X-7.5997 Y-1.8508
+X-7.5870 Y-1.8993
+X-7.5739 Y-1.9477
+X-7.5604 Y-1.9960
+X-7.5465 Y-2.0441
+X-7.5321 Y-2.0921
+X-7.5174 Y-2.1401
+X-7.5023 Y-2.1879
+X-7.4867 Y-2.2355
+X-7.4708 Y-2.2830
+X-7.4544 Y-2.3304
+X-7.4377 Y-2.3777
+X-7.4205 Y-2.4248
+X-7.4030 Y-2.4717
+X-7.3851 Y-2.5185
+X-7.3667 Y-2.5652
+X-7.3480 Y-2.6117
+X-7.3289 Y-2.6580
+X-7.3094 Y-2.7042
+X-7.2895 Y-2.7502
+X-7.2692 Y-2.7960
+X-7.2485 Y-2.8417
+X-7.2274 Y-2.8872
+X-7.2060 Y-2.9325
+X-7.1842 Y-2.9776
+X-7.1620 Y-3.0226
+X-7.1394 Y-3.0673
+X-7.1165 Y-3.1119
+X-7.0931 Y-3.1563
+X-7.0694 Y-3.2004
+X-7.0454 Y-3.2444
+X-7.0210 Y-3.2882
+X-6.9962 Y-3.3317
+X-6.9710 Y-3.3751
+X-6.9455 Y-3.4182
+X-6.9196 Y-3.4612
+X-6.8934 Y-3.5039
+X-6.8668 Y-3.5464
+X-6.8398 Y-3.5886
+X-6.8125 Y-3.6307
+X-6.7849 Y-3.6725
+X-6.7569 Y-3.7140
+X-6.7286 Y-3.7554
+X-6.6999 Y-3.7965
+X-6.6708 Y-3.8374
+X-6.6415 Y-3.8780
+X-6.6118 Y-3.9184
+X-6.5818 Y-3.9585
+X-6.5514 Y-3.9984
+X-6.5207 Y-4.0380
+X-6.4897 Y-4.0774
+X-6.4583 Y-4.1165
+X-6.4267 Y-4.1553
+X-6.3947 Y-4.1939
+X-6.3624 Y-4.2322
+X-6.3298 Y-4.2703
+X-6.2968 Y-4.3081
+X-6.2636 Y-4.3456
+X-6.2300 Y-4.3828
+X-6.1962 Y-4.4198
+X-6.1620 Y-4.4565
+X-6.1276 Y-4.4928
+X-6.0928 Y-4.5290
+X-6.0577 Y-4.5648
+X-6.0224 Y-4.6003
+X-5.9867 Y-4.6355
+X-5.9508 Y-4.6705
+X-5.9146 Y-4.7051
+X-5.8781 Y-4.7395
+X-5.8413 Y-4.7735
+X-5.8043 Y-4.8073
+X-5.7669 Y-4.8407
+X-5.7293 Y-4.8739
+X-5.6915 Y-4.9067
+X-5.6533 Y-4.9392
+X-5.6149 Y-4.9714
+X-5.5763 Y-5.0033
+X-5.5373 Y-5.0349
+X-5.4981 Y-5.0661
+X-5.4587 Y-5.0970
+X-5.4190 Y-5.1277
+X-5.3791 Y-5.1579
+X-5.3389 Y-5.1879
+X-5.2985 Y-5.2175
+X-5.2578 Y-5.2468
+X-5.2169 Y-5.2758
+X-5.1758 Y-5.3044
+X-5.1344 Y-5.3327
+X-5.0928 Y-5.3607
+X-5.0510 Y-5.3883
+X-5.0090 Y-5.4156
+X-4.9667 Y-5.4425
+X-4.9242 Y-5.4691
+X-4.8816 Y-5.4954
+X-4.8387 Y-5.5213
+X-4.7956 Y-5.5469
+X-4.7522 Y-5.5721
+X-4.7087 Y-5.5969
+X-4.6650 Y-5.6214
+X-4.6211 Y-5.6456
+X-4.5770 Y-5.6694
+X-4.5327 Y-5.6928
+X-4.4882 Y-5.7159
+X-4.4435 Y-5.7386
+X-4.3987 Y-5.7610
+X-4.3537 Y-5.7830
+X-4.3085 Y-5.8046
+X-4.2631 Y-5.8259
+X-4.2175 Y-5.8468
+X-4.1718 Y-5.8674
+X-4.1260 Y-5.8875
+X-4.0799 Y-5.9073
+X-4.0337 Y-5.9268
+X-3.9874 Y-5.9459
+X-3.9409 Y-5.9645
+X-3.8942 Y-5.9829
+X-3.8475 Y-6.0008
+X-3.8005 Y-6.0184
+X-3.7535 Y-6.0356
+X-3.7062 Y-6.0524
+X-3.6589 Y-6.0689
+X-3.6114 Y-6.0849
+X-3.5638 Y-6.1006
+X-3.5161 Y-6.1159
+X-3.4683 Y-6.1308
+X-3.4203 Y-6.1454
+X-3.3723 Y-6.1595
+X-3.3241 Y-6.1733
+X-3.2758 Y-6.1867
+X-3.2274 Y-6.1997
+X-3.1789 Y-6.2123
+X-3.1303 Y-6.2246
+X-3.0816 Y-6.2364
+X-3.0328 Y-6.2479
+X-2.9840 Y-6.2590
+X-2.9350 Y-6.2697
+X-2.8860 Y-6.2800
+X-2.8368 Y-6.2899
+X-2.7876 Y-6.2994
+X-2.7384 Y-6.3086
+X-2.6890 Y-6.3173
+X-2.6396 Y-6.3257
+X-2.5901 Y-6.3336
+X-2.5406 Y-6.3412
+X-2.4910 Y-6.3484
+X-2.4414 Y-6.3552
+X-2.3917 Y-6.3616
+X-2.3419 Y-6.3676
+X-2.2921 Y-6.3732
+X-2.2423 Y-6.3784
+X-2.1924 Y-6.3833
+X-2.1425 Y-6.3877
+X-2.0926 Y-6.3918
+X-2.0426 Y-6.3954
+X-1.9926 Y-6.3987
+X-1.9425 Y-6.4016
+X-1.8925 Y-6.4040
+X-1.8424 Y-6.4061
+X-1.7924 Y-6.4078
+X-1.7423 Y-6.4091
+X-1.6922 Y-6.4100
+X-1.6421 Y-6.4106
+X-1.5919 Y-6.4107
+X-1.5418 Y-6.4104
+X-1.4917 Y-6.4098
+X-1.4416 Y-6.4087
+X-1.3915 Y-6.4073
+X-1.3415 Y-6.4054
+X-1.2914 Y-6.4032
+X-1.2414 Y-6.4006
+X-1.1914 Y-6.3976
+X-1.1414 Y-6.3942
+X-1.0914 Y-6.3905
+X-1.0415 Y-6.3863
+X-0.9916 Y-6.3817
+X-0.9417 Y-6.3768
+X-0.8919 Y-6.3715
+X-0.8421 Y-6.3657
+X-0.7924 Y-6.3596
+X-0.7427 Y-6.3532
+X-0.6930 Y-6.3463
+X-0.6435 Y-6.3390
+X-0.5939 Y-6.3314
+X-0.5445 Y-6.3234
+X-0.4951 Y-6.3150
+X-0.4458 Y-6.3062
+X-0.3965 Y-6.2970
+X-0.3473 Y-6.2875
+X-0.2982 Y-6.2775
+X-0.2492 Y-6.2672
+X-0.2002 Y-6.2565
+X-0.1513 Y-6.2455
+X-0.1026 Y-6.2340
+X-0.0539 Y-6.2222
+X-0.0053 Y-6.2100
+X0.0432 Y-6.1975
+X0.0917 Y-6.1846
+X0.1400 Y-6.1712
+X0.1882 Y-6.1576
+X0.2363 Y-6.1435
+X0.2842 Y-6.1291
+X0.3321 Y-6.1143
+X0.3799 Y-6.0992
+X0.4275 Y-6.0837
+X0.4750 Y-6.0678
+X0.5224 Y-6.0515
+X0.5697 Y-6.0349
+X0.6169 Y-6.0180
+X0.6639 Y-6.0006
+X0.7107 Y-5.9829
+X0.7575 Y-5.9649
+X0.8041 Y-5.9465
+X0.8506 Y-5.9277
+X0.8969 Y-5.9086
+X0.9430 Y-5.8892
+X0.9891 Y-5.8694
+X1.0349 Y-5.8492
+X1.0806 Y-5.8287
+X1.1262 Y-5.8078
+X1.1716 Y-5.7866
+X1.2168 Y-5.7651
+X1.2619 Y-5.7432
+X1.3068 Y-5.7209
+X1.3515 Y-5.6984
+X1.3961 Y-5.6754
+X1.4404 Y-5.6522
+X1.4846 Y-5.6286
+X1.5287 Y-5.6047
+X1.5725 Y-5.5804
+X1.6162 Y-5.5558
+X1.6596 Y-5.5309
+X1.7029 Y-5.5057
+X1.7460 Y-5.4801
+X1.7889 Y-5.4542
+X1.8316 Y-5.4280
+X1.8741 Y-5.4014
+X1.9164 Y-5.3746
+X1.9585 Y-5.3474
+X2.0003 Y-5.3199
+X2.0420 Y-5.2921
+X2.0835 Y-5.2640
+X2.1247 Y-5.2355
+X2.1658 Y-5.2068
+X2.2066 Y-5.1777
+X2.2472 Y-5.1484
+X2.2875 Y-5.1187
+X2.3277 Y-5.0887
+X2.3676 Y-5.0585
+X2.4073 Y-5.0279
+X2.4468 Y-4.9970
+X2.4860 Y-4.9659
+X2.5250 Y-4.9344
+X2.5638 Y-4.9027
+X2.6023 Y-4.8706
+X2.6406 Y-4.8383
+X2.6786 Y-4.8057
+X2.7164 Y-4.7728
+X2.7539 Y-4.7397
+X2.7912 Y-4.7062
+X2.8283 Y-4.6725
+X2.8651 Y-4.6385
+X2.9016 Y-4.6042
+X2.9379 Y-4.5696
+X2.9739 Y-4.5348
+X3.0097 Y-4.4997
+X3.0452 Y-4.4644
+X3.0804 Y-4.4288
+X3.1154 Y-4.3929
+X3.1501 Y-4.3567
+X3.1845 Y-4.3204
+X3.2186 Y-4.2837
+X3.2525 Y-4.2468
+X3.2861 Y-4.2097
+X3.3195 Y-4.1722
+X3.3525 Y-4.1346
+X3.3853 Y-4.0967
+X3.4178 Y-4.0586
+X3.4500 Y-4.0202
+X3.4819 Y-3.9816
+X3.5135 Y-3.9427
+X3.5449 Y-3.9037
+X3.5759 Y-3.8644
+X3.6067 Y-3.8248
+X3.6372 Y-3.7851
+X3.6674 Y-3.7451
+X3.6972 Y-3.7049
+X3.7268 Y-3.6644
+X3.7561 Y-3.6238
+X3.7851 Y-3.5829
+X3.8138 Y-3.5418
+X3.8421 Y-3.5006
+X3.8702 Y-3.4591
+X3.8980 Y-3.4174
+X3.9254 Y-3.3755
+X3.9526 Y-3.3334
+X3.9794 Y-3.2911
+X4.0060 Y-3.2486
+X4.0322 Y-3.2059
+X4.0581 Y-3.1630
+X4.0836 Y-3.1199
+X4.1089 Y-3.0767
+X4.1339 Y-3.0332
+X4.1585 Y-2.9896
+X4.1828 Y-2.9458
+X4.2068 Y-2.9018
+X4.2304 Y-2.8577
+X4.2538 Y-2.8133
+X4.2768 Y-2.7688
+X4.2995 Y-2.7242
+X4.3219 Y-2.6793
+X4.3439 Y-2.6344
+X4.3656 Y-2.5892
+X4.3870 Y-2.5439
+X4.4080 Y-2.4984
+X4.4287 Y-2.4528
+X4.4491 Y-2.4071
+X4.4691 Y-2.3611
+X4.4888 Y-2.3151
+X4.5082 Y-2.2689
+X4.5273 Y-2.2226
+X4.5459 Y-2.1761
+X4.5643 Y-2.1295
+X4.5823 Y-2.0827
+X4.6000 Y-2.0359
+X4.6173 Y-1.9889
+X4.6343 Y-1.9417
+X4.6510 Y-1.8945
+X4.6673 Y-1.8471
+X4.6833 Y-1.7997
+X4.6989 Y-1.7521
+X4.7142 Y-1.7043
+X4.7291 Y-1.6565
+X4.7437 Y-1.6086
+X4.7579 Y-1.5606
+X4.7718 Y-1.5125
+X4.7853 Y-1.4642
+X4.7985 Y-1.4159
+X4.8114 Y-1.3675
+X4.8239 Y-1.3190
+X4.8360 Y-1.2704
+X4.8478 Y-1.2217
+X4.8592 Y-1.1729
+X4.8703 Y-1.1241
+X4.8811 Y-1.0751
+X4.8914 Y-1.0261
+X4.9015 Y-0.9770
+X4.9112 Y-0.9279
+X4.9205 Y-0.8787
+X4.9294 Y-0.8294
+X4.9381 Y-0.7801
+X4.9463 Y-0.7306
+X4.9542 Y-0.6812
+X4.9618 Y-0.6317
+X4.9689 Y-0.5821
+X4.9758 Y-0.5325
+X4.9823 Y-0.4828
+X4.9884 Y-0.4331
+X4.9942 Y-0.3833
+X4.9996 Y-0.3335
+X5.0046 Y-0.2837
+X5.0093 Y-0.2338
+X5.0137 Y-0.1839
+X5.0176 Y-0.1340
+X5.0213 Y-0.0840
+X5.0245 Y-0.0340
+X5.0274 Y0.0160
+X5.0300 Y0.0660
+X5.0322 Y0.1160
+X5.0340 Y0.1661
+X5.0355 Y0.2162
+X5.0366 Y0.2662
+X5.0374 Y0.3163
+X5.0378 Y0.3664
+X5.0379 Y0.4165
+X5.0376 Y0.4666
+X5.0369 Y0.5167
+X5.0359 Y0.5668
+X5.0345 Y0.6168
+X5.0328 Y0.6669
+X5.0307 Y0.7169
+X5.0283 Y0.7670
+X5.0255 Y0.8170
+X5.0224 Y0.8670
+X5.0189 Y0.9169
+X5.0150 Y0.9669
+X5.0108 Y1.0168
+X5.0062 Y1.0667
+X5.0013 Y1.1165
+X4.9961 Y1.1663
+X4.9905 Y1.2161
+X4.9845 Y1.2658
+X4.9782 Y1.3155
+X4.9715 Y1.3652
+X4.9645 Y1.4148
+X4.9571 Y1.4643
+X4.9494 Y1.5138
+X4.9413 Y1.5632
+X4.9329 Y1.6126
+X4.9241 Y1.6619
+X4.9150 Y1.7112
+X4.9055 Y1.7604
+X4.8957 Y1.8095
+X4.8856 Y1.8585
+X4.8751 Y1.9075
+X4.8642 Y1.9564
+X4.8531 Y2.0052
+X4.8415 Y2.0540
+X4.8297 Y2.1026
+X4.8175 Y2.1512
+X4.8049 Y2.1997
+X4.7920 Y2.2481
+X4.7788 Y2.2964
+X4.7652 Y2.3446
+X4.7513 Y2.3928
+X4.7371 Y2.4408
+X4.7225 Y2.4887
+X4.7076 Y2.5365
+X4.6923 Y2.5842
+X4.6768 Y2.6318
+X4.6608 Y2.6793
+X4.6446 Y2.7267
+X4.6280 Y2.7740
+X4.6111 Y2.8211
+X4.5939 Y2.8681
+X4.5763 Y2.9150
+X4.5584 Y2.9618
+X4.5402 Y3.0085
+X4.5217 Y3.0550
+X4.5028 Y3.1014
+X4.4837 Y3.1477
+X4.4641 Y3.1938
+X4.4443 Y3.2398
+X4.4242 Y3.2857
+X4.4037 Y3.3314
+X4.3829 Y3.3770
+X4.3618 Y3.4224
+X4.3404 Y3.4677
+X4.3187 Y3.5128
+X4.2967 Y3.5578
+X4.2743 Y3.6026
+X4.2517 Y3.6473
+X4.2287 Y3.6918
+X4.2054 Y3.7361
+X4.1818 Y3.7803
+X4.1579 Y3.8243
+X4.1338 Y3.8682
+X4.1093 Y3.9119
+X4.0845 Y3.9554
+X4.0594 Y3.9987
+X4.0340 Y4.0419
+X4.0083 Y4.0849
+X3.9823 Y4.1277
+X3.9560 Y4.1703
+X3.9294 Y4.2128
+X3.9026 Y4.2551
+X3.8754 Y4.2971
+X3.8480 Y4.3390
+X3.8202 Y4.3807
+X3.7922 Y4.4223
+X3.7639 Y4.4636
+X3.7353 Y4.5047
+X3.7064 Y4.5456
+X3.6773 Y4.5863
+X3.6478 Y4.6269
+X3.6181 Y4.6672
+X3.5881 Y4.7073
+X3.5579 Y4.7472
+X3.5273 Y4.7869
+X3.4965 Y4.8264
+X3.4655 Y4.8657
+X3.4341 Y4.9047
+X3.4025 Y4.9436
+X3.3706 Y4.9822
+X3.3385 Y5.0206
+X3.3061 Y5.0588
+X3.2734 Y5.0968
+X3.2405 Y5.1345
+X3.2073 Y5.1720
+X3.1739 Y5.2093
+X3.1402 Y5.2464
+X3.1062 Y5.2832
+X3.0721 Y5.3198
+X3.0376 Y5.3562
+X3.0029 Y5.3923
+X2.9680 Y5.4282
+X2.9328 Y5.4638
+X2.8974 Y5.4992
+X2.8617 Y5.5344
+X2.8258 Y5.5693
+X2.7897 Y5.6040
+X2.7533 Y5.6384
+X2.7167 Y5.6726
+X2.6799 Y5.7065
+X2.6428 Y5.7402
+X2.6055 Y5.7737
+X2.5680 Y5.8068
+X2.5303 Y5.8398
+X2.4923 Y5.8724
+X2.4541 Y5.9048
+X2.4157 Y5.9370
+X2.3771 Y5.9689
+X2.3383 Y6.0005
+X2.2992 Y6.0318
+X2.2600 Y6.0629
+X2.2205 Y6.0937
+X2.1808 Y6.1243
+X2.1409 Y6.1546
+X2.1008 Y6.1846
+X2.0605 Y6.2144
+X2.0201 Y6.2438
+X1.9794 Y6.2730
+X1.9385 Y6.3020
+X1.8974 Y6.3306
+X1.8561 Y6.3590
+X1.8147 Y6.3871
+X1.7730 Y6.4149
+X1.7312 Y6.4424
+X1.6892 Y6.4697
+X1.6470 Y6.4966
+X1.6046 Y6.5233
+X1.5620 Y6.5497
+X1.5193 Y6.5758
+X1.4764 Y6.6016
+X1.4333 Y6.6271
+X1.3900 Y6.6524
+X1.3466 Y6.6773
+X1.3030 Y6.7020
+X1.2592 Y6.7263
+X1.2153 Y6.7504
+X1.1713 Y6.7742
+X1.1270 Y6.7977
+X1.0826 Y6.8208
+X1.0381 Y6.8437
+X0.9934 Y6.8663
+X0.9485 Y6.8886
+X0.9035 Y6.9106
+X0.8584 Y6.9322
+X0.8131 Y6.9536
+X0.7677 Y6.9747
+X0.7221 Y6.9955
+X0.6764 Y7.0159
+X0.6305 Y7.0361
+X0.5846 Y7.0560
+X0.5385 Y7.0755
+X0.4922 Y7.0947
+X0.4459 Y7.1137
+X0.3994 Y7.1323
+X0.3528 Y7.1506
+X0.3060 Y7.1686
+X0.2592 Y7.1863
+X0.2122 Y7.2037
+X0.1651 Y7.2207
+X0.1179 Y7.2375
+X0.0706 Y7.2539
+X0.0232 Y7.2700
+X-0.0243 Y7.2858
+X-0.0719 Y7.3013
+X-0.1197 Y7.3165
+X-0.1675 Y7.3313
+X-0.2154 Y7.3459
+X-0.2634 Y7.3601
+X-0.3115 Y7.3740
+X-0.3597 Y7.3876
+X-0.4080 Y7.4008
+X-0.4564 Y7.4138
+X-0.5049 Y7.4264
+X-0.5534 Y7.4387
+X-0.6020 Y7.4507
+X-0.6507 Y7.4623
+X-0.6995 Y7.4736
+X-0.7484 Y7.4847
+X-0.7973 Y7.4953
+X-0.8463 Y7.5057
+X-0.8954 Y7.5157
+X-0.9445 Y7.5255
+X-0.9937 Y7.5349
+X-1.0429 Y7.5439
+X-1.0922 Y7.5527
+X-1.1416 Y7.5611
+X-1.1910 Y7.5692
+X-1.2405 Y7.5769
+X-1.2900 Y7.5844
+X-1.3396 Y7.5915
+X-1.3892 Y7.5983
+X-1.4388 Y7.6047
+X-1.4885 Y7.6109
+X-1.5383 Y7.6167
+X-1.5881 Y7.6221
+X-1.6379 Y7.6273
+X-1.6877 Y7.6321
+X-1.7376 Y7.6366
+X-1.7875 Y7.6408
+X-1.8374 Y7.6446
+X-1.8874 Y7.6481
+X-1.9374 Y7.6513
+X-1.9874 Y7.6542
+X-2.0374 Y7.6567
+X-2.0874 Y7.6589
+X-2.1374 Y7.6608
+X-2.1875 Y7.6624
+X-2.2375 Y7.6636
+X-2.2876 Y7.6645
+X-2.3377 Y7.6650
+X-2.3878 Y7.6653
+X-2.4378 Y7.6652
+X-2.4879 Y7.6648
+X-2.5380 Y7.6640
+X-2.5881 Y7.6630
+X-2.6381 Y7.6616
+X-2.6882 Y7.6599
+X-2.7382 Y7.6578
+X-2.7882 Y7.6554
+X-2.8382 Y7.6527
+X-2.8882 Y7.6497
+X-2.9382 Y7.6464
+X-2.9881 Y7.6427
+X-3.0380 Y7.6387
+X-3.0879 Y7.6344
+X-3.1378 Y7.6297
+X-3.1876 Y7.6247
+X-3.2374 Y7.6194
+X-3.2871 Y7.6138
+X-3.3369 Y7.6079
+X-3.3865 Y7.6016
+X-3.4362 Y7.5950
+X-3.4858 Y7.5881
+X-3.5353 Y7.5809
+X-3.5848 Y7.5733
+X-3.6343 Y7.5655
+X-3.6837 Y7.5573
+X-3.7330 Y7.5488
+X-3.7823 Y7.5399
+X-3.8316 Y7.5308
+X-3.8807 Y7.5213
+X-3.9298 Y7.5115
+X-3.9789 Y7.5014
+X-4.0279 Y7.4910
+X-4.0768 Y7.4803
+X-4.1256 Y7.4692
+X-4.1744 Y7.4578
+X-4.2231 Y7.4461
+X-4.2717 Y7.4342
+X-4.3202 Y7.4218
+X-4.3687 Y7.4092
+X-4.4171 Y7.3963
+X-4.4653 Y7.3830
+X-4.5135 Y7.3695
+X-4.5617 Y7.3556
+X-4.6097 Y7.3414
+X-4.6576 Y7.3270
+X-4.7055 Y7.3122
+X-4.7532 Y7.2971
+X-4.8008 Y7.2817
+X-4.8484 Y7.2659
+X-4.8958 Y7.2499
+X-4.9432 Y7.2336
+X-4.9904 Y7.2170
+X-5.0375 Y7.2000
+X-5.0845 Y7.1828
+X-5.1315 Y7.1653
+X-5.1782 Y7.1475
+X-5.2249 Y7.1293
+X-5.2715 Y7.1109
+X-5.3179 Y7.0922
+X-5.3642 Y7.0731
+X-5.4104 Y7.0538
+X-5.4565 Y7.0342
+X-5.5024 Y7.0143
+X-5.5483 Y6.9941
+X-5.5939 Y6.9736
+X-5.6395 Y6.9528
+X-5.6849 Y6.9317
+X-5.7302 Y6.9104
+X-5.7754 Y6.8887
+X-5.8204 Y6.8667
+X-5.8652 Y6.8445
+X-5.9099 Y6.8220
+X-5.9545 Y6.7992
+X-5.9990 Y6.7761
+X-6.0432 Y6.7527
+X-6.0874 Y6.7291
+X-6.1314 Y6.7052
+X-6.1752 Y6.6810
+X-6.2189 Y6.6565
+X-6.2624 Y6.6317
+X-6.3058 Y6.6067
+X-6.3490 Y6.5813
+X-6.3920 Y6.5558
+X-6.4349 Y6.5299
+X-6.4776 Y6.5038
+X-6.5201 Y6.4773
+X-6.5625 Y6.4507
+X-6.6047 Y6.4237
+X-6.6467 Y6.3965
+X-6.6886 Y6.3690
+X-6.7303 Y6.3413
+X-6.7718 Y6.3133
+X-6.8131 Y6.2850
+X-6.8543 Y6.2565
+X-6.8952 Y6.2277
+X-6.9360 Y6.1987
+X-6.9766 Y6.1694
+X-7.0170 Y6.1398
+X-7.0573 Y6.1100
+X-7.0973 Y6.0799
+X-7.1371 Y6.0496
+X-7.1768 Y6.0190
+X-7.2162 Y5.9882
+X-7.2555 Y5.9571
+X-7.2946 Y5.9258
+X-7.3335 Y5.8942
+X-7.3721 Y5.8624
+X-7.4106 Y5.8304
+X-7.4489 Y5.7981
+X-7.4869 Y5.7655
+X-7.5248 Y5.7328
+X-7.5624 Y5.6998
+X-7.5999 Y5.6665
+X-7.6371 Y5.6330
+X-7.6741 Y5.5993
+X-7.7109 Y5.5654
+X-7.7475 Y5.5312
+X-7.7839 Y5.4968
+X-7.8200 Y5.4621
+X-7.8560 Y5.4273
+X-7.8917 Y5.3922
+X-7.9272 Y5.3569
+X-7.9625 Y5.3213
+X-7.9975 Y5.2856
+X-8.0323 Y5.2496
+X-8.0670 Y5.2134
+X-8.1013 Y5.1770
+X-8.1355 Y5.1404
+X-8.1694 Y5.1036
+X-8.2031 Y5.0665
+X-8.2365 Y5.0293
+X-8.2697 Y4.9918
+X-8.3027 Y4.9541
+X-8.3355 Y4.9163
+X-8.3680 Y4.8782
+X-8.4003 Y4.8399
+X-8.4323 Y4.8014
+X-8.4641 Y4.7627
+X-8.4956 Y4.7238
+X-8.5269 Y4.6848
+X-8.5580 Y4.6455
+X-8.5888 Y4.6060
+X-8.6194 Y4.5664
+X-8.6497 Y4.5265
+X-8.6798 Y4.4865
+X-8.7096 Y4.4463
+X-8.7392 Y4.4059
+X-8.7685 Y4.3653
+X-8.7975 Y4.3245
+X-8.8263 Y4.2836
+X-8.8549 Y4.2424
+X-8.8832 Y4.2011
+X-8.9112 Y4.1597
+X-8.9390 Y4.1180
+X-8.9665 Y4.0762
+X-8.9938 Y4.0342
+X-9.0208 Y3.9920
+X-9.0475 Y3.9497
+X-9.0740 Y3.9072
+X-9.1002 Y3.8645
+X-9.1262 Y3.8217
+X-9.1519 Y3.7787
+X-9.1773 Y3.7356
+X-9.2024 Y3.6923
+X-9.2273 Y3.6488
+X-9.2519 Y3.6052
+X-9.2763 Y3.5615
+X-9.3003 Y3.5176
+X-9.3241 Y3.4735
+X-9.3476 Y3.4293
+X-9.3709 Y3.3850
+X-9.3939 Y3.3405
+X-9.4166 Y3.2959
+X-9.4390 Y3.2511
+X-9.4611 Y3.2062
+X-9.4830 Y3.1612
+X-9.5046 Y3.1160
+X-9.5259 Y3.0707
+X-9.5469 Y3.0252
+X-9.5677 Y2.9797
+X-9.5881 Y2.9340
+X-9.6083 Y2.8882
+X-9.6282 Y2.8422
+X-9.6478 Y2.7962
+X-9.6672 Y2.7500
+X-9.6862 Y2.7037
+X-9.7050 Y2.6573
+X-9.7235 Y2.6107
+X-9.7417 Y2.5641
+X-9.7596 Y2.5173
+X-9.7772 Y2.4705
+X-9.7945 Y2.4235
+X-9.8116 Y2.3764
+X-9.8283 Y2.3292
+X-9.8448 Y2.2819
+X-9.8610 Y2.2346
+X-9.8769 Y2.1871
+X-9.8924 Y2.1395
+X-9.9077 Y2.0918
+X-9.9228 Y2.0441
+X-9.9375 Y1.9962
+X-9.9519 Y1.9483
+X-9.9660 Y1.9002
+X-9.9798 Y1.8521
+X-9.9934 Y1.8039
+X-10.0066 Y1.7556
+X-10.0196 Y1.7073
+X-10.0322 Y1.6588
+X-10.0446 Y1.6103
+X-10.0566 Y1.5617
+X-10.0684 Y1.5130
+X-10.0799 Y1.4643
+X-10.0910 Y1.4155
+X-10.1019 Y1.3666
+X-10.1125 Y1.3177
+X-10.1227 Y1.2687
+X-10.1327 Y1.2196
+X-10.1424 Y1.1705
+X-10.1517 Y1.1213
+X-10.1608 Y1.0721
+X-10.1696 Y1.0228
+X-10.1781 Y0.9734
+X-10.1862 Y0.9241
+X-10.1941 Y0.8746
+X-10.2017 Y0.8251
+X-10.2089 Y0.7756
+X-10.2159 Y0.7260
+X-10.2226 Y0.6764
+X-10.2289 Y0.6267
+X-10.2350 Y0.5770
+X-10.2408 Y0.5273
+X-10.2462 Y0.4775
+X-10.2514 Y0.4277
+X-10.2562 Y0.3779
+X-10.2608 Y0.3280
+X-10.2650 Y0.2782
+X-10.2690 Y0.2282
+X-10.2726 Y0.1783
+X-10.2760 Y0.1284
+X-10.2790 Y0.0784
+X-10.2818 Y0.0284
+X-10.2842 Y-0.0216
+X-10.2863 Y-0.0716
+X-10.2882 Y-0.1217
+X-10.2897 Y-0.1717
+X-10.2909 Y-0.2218
+X-10.2918 Y-0.2718
+X-10.2925 Y-0.3219
+X-10.2928 Y-0.3719
+X-10.2928 Y-0.4220
+X-10.2925 Y-0.4721
+X-10.2919 Y-0.5221
+X-10.2910 Y-0.5722
+X-10.2898 Y-0.6222
+X-10.2883 Y-0.6723
+X-10.2865 Y-0.7223
+X-10.2844 Y-0.7723
+X-10.2820 Y-0.8223
+X-10.2793 Y-0.8723
+X-10.2763 Y-0.9223
+X-10.2730 Y-0.9723
+X-10.2694 Y-1.0222
+X-10.2655 Y-1.0721
+X-10.2613 Y-1.1220
+X-10.2568 Y-1.1719
+X-10.2520 Y-1.2217
+X-10.2469 Y-1.2715
+X-10.2415 Y-1.3213
+X-10.2358 Y-1.3710
+X-10.2298 Y-1.4207
+X-10.2235 Y-1.4704
+X-10.2169 Y-1.5200
+X-10.2101 Y-1.5696
+X-10.2029 Y-1.6191
+X-10.1954 Y-1.6686
+X-10.1876 Y-1.7181
+X-10.1795 Y-1.7675
+X-10.1711 Y-1.8169
+X-10.1625 Y-1.8662
+X-10.1535 Y-1.9154
+X-10.1443 Y-1.9646
+X-10.1347 Y-2.0138
+X-10.1249 Y-2.0629
+X-10.1147 Y-2.1119
+X-10.1043 Y-2.1609
+X-10.0936 Y-2.2098
+X-10.0825 Y-2.2586
+X-10.0712 Y-2.3074
+X-10.0596 Y-2.3561
+X-10.0477 Y-2.4047
+X-10.0356 Y-2.4533
+X-10.0231 Y-2.5017
+X-10.0103 Y-2.5501
+X-9.9973 Y-2.5985
+X-9.9840 Y-2.6467
+X-9.9703 Y-2.6949
+X-9.9564 Y-2.7430
+X-9.9422 Y-2.7910
+X-9.9277 Y-2.8389
+X-9.9130 Y-2.8868
+X-9.8979 Y-2.9345
+X-9.8826 Y-2.9822
+X-9.8670 Y-3.0297
+X-9.8511 Y-3.0772
+X-9.8349 Y-3.1246
+X-9.8184 Y-3.1719
+X-9.8017 Y-3.2191
+X-9.7847 Y-3.2661
+X-9.7674 Y-3.3131
+X-9.7498 Y-3.3600
+X-9.7319 Y-3.4068
+X-9.7138 Y-3.4534
+X-9.6954 Y-3.5000
+X-9.6767 Y-3.5464
+X-9.6577 Y-3.5927
+X-9.6385 Y-3.6390
+X-9.6190 Y-3.6851
+X-9.5992 Y-3.7311
+X-9.5792 Y-3.7769
+X-9.5588 Y-3.8227
+X-9.5382 Y-3.8683
+X-9.5174 Y-3.9138
+X-9.4962 Y-3.9592
+X-9.4748 Y-4.0045
+X-9.4532 Y-4.0496
+X-9.4312 Y-4.0946
+X-9.4090 Y-4.1395
+X-9.3866 Y-4.1842
+X-9.3638 Y-4.2288
+X-9.3408 Y-4.2733
+X-9.3176 Y-4.3176
+X-9.2941 Y-4.3618
+X-9.2703 Y-4.4059
+X-9.2463 Y-4.4498
+X-9.2220 Y-4.4936
+X-9.1974 Y-4.5372
+X-9.1726 Y-4.5807
+X-9.1476 Y-4.6240
+X-9.1222 Y-4.6672
+X-9.0967 Y-4.7102
+X-9.0708 Y-4.7531
+X-9.0448 Y-4.7959
+X-9.0184 Y-4.8384
+X-8.9919 Y-4.8809
+X-8.9650 Y-4.9231
+X-8.9380 Y-4.9652
+X-8.9107 Y-5.0072
+X-8.8831 Y-5.0490
+X-8.8553 Y-5.0906
+X-8.8272 Y-5.1321
+X-8.7989 Y-5.1734
+X-8.7704 Y-5.2145
+X-8.7416 Y-5.2555
+X-8.7126 Y-5.2962
+X-8.6833 Y-5.3369
+X-8.6538 Y-5.3773
+X-8.6241 Y-5.4176
+X-8.5941 Y-5.4577
+X-8.5639 Y-5.4976
+X-8.5335 Y-5.5374
+X-8.5028 Y-5.5769
+X-8.4719 Y-5.6163
+X-8.4408 Y-5.6555
+X-8.4095 Y-5.6946
+X-8.3779 Y-5.7334
+X-8.3461 Y-5.7721
+X-8.3140 Y-5.8105
+X-8.2818 Y-5.8488
+X-8.2493 Y-5.8869
+X-8.2166 Y-5.9248
+X-8.1837 Y-5.9625
+X-8.1505 Y-6.0000
+X-8.1172 Y-6.0374
+X-8.0836 Y-6.0745
+X-8.0498 Y-6.1114
+X-8.0158 Y-6.1481
+X-7.9815 Y-6.1847
+X-7.9471 Y-6.2210
+X-7.9125 Y-6.2572
+X-7.8776 Y-6.2931
+X-7.8425 Y-6.3288
+X-7.8073 Y-6.3643
+X-7.7718 Y-6.3997
+X-7.7361 Y-6.4348
+X-7.7002 Y-6.4697
+X-7.6641 Y-6.5044
+X-7.6279 Y-6.5388
+X-7.5914 Y-6.5731
+X-7.5547 Y-6.6072
+X-7.5178 Y-6.6410
+X-7.4807 Y-6.6747
+X-7.4434 Y-6.7081
+X-7.4060 Y-6.7413
+X-7.3683 Y-6.7743
+X-7.3305 Y-6.8070
+X-7.2924 Y-6.8396
+X-7.2542 Y-6.8719
+X-7.2158 Y-6.9040
+X-7.1772 Y-6.9359
+X-7.1384 Y-6.9675
+X-7.0994 Y-6.9989
+X-7.0603 Y-7.0301
+X-7.0210 Y-7.0611
+X-6.9815 Y-7.0919
+X-6.9418 Y-7.1224
+X-6.9019 Y-7.1527
+X-6.8619 Y-7.1827
+X-6.8217 Y-7.2125
+X-6.7813 Y-7.2421
+X-6.7407 Y-7.2715
+X-6.7000 Y-7.3006
+X-6.6592 Y-7.3295
+X-6.6181 Y-7.3582
+X-6.5769 Y-7.3866
+X-6.5355 Y-7.4148
+X-6.4940 Y-7.4427
+X-6.4523 Y-7.4704
+X-6.4104 Y-7.4978
+X-6.3684 Y-7.5251
+X-6.3262 Y-7.5520
+X-6.2839 Y-7.5788
+X-6.2414 Y-7.6052
+X-6.1988 Y-7.6315
+X-6.1560 Y-7.6575
+X-6.1131 Y-7.6832
+X-6.0700 Y-7.7087
+X-6.0268 Y-7.7340
+X-5.9834 Y-7.7590
+X-5.9399 Y-7.7837
+X-5.8963 Y-7.8082
+X-5.8525 Y-7.8325
+X-5.8085 Y-7.8565
+X-5.7645 Y-7.8802
+X-5.7203 Y-7.9037
+X-5.6759 Y-7.9270
+X-5.6315 Y-7.9500
+X-5.5869 Y-7.9727
+X-5.5421 Y-7.9952
+X-5.4973 Y-8.0174
+X-5.4523 Y-8.0394
+X-5.4072 Y-8.0611
+X-5.3619 Y-8.0825
+X-5.3166 Y-8.1037
+X-5.2711 Y-8.1246
+X-5.2255 Y-8.1453
+X-5.1798 Y-8.1657
+X-5.1340 Y-8.1858
+X-5.0880 Y-8.2057
+X-5.0420 Y-8.2253
+X-4.9958 Y-8.2447
+X-4.9495 Y-8.2638
+X-4.9032 Y-8.2826
+X-4.8567 Y-8.3011
+X-4.8101 Y-8.3194
+X-4.7634 Y-8.3375
+X-4.7166 Y-8.3552
+X-4.6697 Y-8.3727
+X-4.6227 Y-8.3899
+X-4.5756 Y-8.4069
+X-4.5284 Y-8.4236
+X-4.4811 Y-8.4400
+X-4.4337 Y-8.4562
+X-4.3862 Y-8.4720
+X-4.3387 Y-8.4877
+X-4.2910 Y-8.5030
+X-4.2433 Y-8.5181
+X-4.1955 Y-8.5329
+X-4.1476 Y-8.5474
+X-4.0996 Y-8.5616
+X-4.0515 Y-8.5756
+X-4.0034 Y-8.5893
+X-3.9551 Y-8.6027
+X-3.9068 Y-8.6159
+X-3.8585 Y-8.6288
+X-3.8100 Y-8.6414
+X-3.7615 Y-8.6537
+X-3.7129 Y-8.6658
+X-3.6643 Y-8.6776
+X-3.6156 Y-8.6891
+X-3.5668 Y-8.7003
+X-3.5179 Y-8.7112
+X-3.4690 Y-8.7219
+X-3.4201 Y-8.7323
+X-3.3710 Y-8.7424
+X-3.3220 Y-8.7523
+X-3.2728 Y-8.7618
+X-3.2236 Y-8.7711
+X-3.1744 Y-8.7801
+X-3.1251 Y-8.7889
+X-3.0758 Y-8.7973
+X-3.0264 Y-8.8055
+X-2.9769 Y-8.8134
+X-2.9275 Y-8.8210
+X-2.8779 Y-8.8283
+X-2.8284 Y-8.8354
+X-2.7788 Y-8.8421
+X-2.7292 Y-8.8486
+X-2.6795 Y-8.8548
+X-2.6298 Y-8.8608
+X-2.5800 Y-8.8664
+X-2.5303 Y-8.8718
+X-2.4805 Y-8.8769
+X-2.4307 Y-8.8817
+X-2.3808 Y-8.8862
+X-2.3309 Y-8.8905
+X-2.2810 Y-8.8944
+X-2.2311 Y-8.8981
+X-2.1812 Y-8.9015
+X-2.1312 Y-8.9046
+X-2.0812 Y-8.9075
+X-2.0312 Y-8.9100
+X-1.9812 Y-8.9123
+X-1.9312 Y-8.9143
+X-1.8812 Y-8.9160
+X-1.8312 Y-8.9175
+X-1.7811 Y-8.9186
+X-1.7311 Y-8.9195
+X-1.6810 Y-8.9201
+X-1.6310 Y-8.9204
+X-1.5809 Y-8.9204
+X-1.5308 Y-8.9202
+X-1.4808 Y-8.9197
+X-1.4307 Y-8.9189
+X-1.3807 Y-8.9178
+X-1.3307 Y-8.9164
+X-1.2806 Y-8.9147
+X-1.2306 Y-8.9128
+X-1.1806 Y-8.9106
+X-1.1306 Y-8.9081
+X-1.0806 Y-8.9053
+X-1.0307 Y-8.9023
+X-0.9807 Y-8.8989
+X-0.9308 Y-8.8953
+X-0.8809 Y-8.8914
+X-0.8310 Y-8.8873
+X-0.7812 Y-8.8828
+X-0.7313 Y-8.8781
+X-0.6815 Y-8.8731
+X-0.6317 Y-8.8678
+X-0.5820 Y-8.8622
+X-0.5323 Y-8.8564
+X-0.4826 Y-8.8503
+X-0.4330 Y-8.8439
+X-0.3833 Y-8.8372
+X-0.3338 Y-8.8303
+X-0.2842 Y-8.8231
+X-0.2348 Y-8.8156
+X-0.1853 Y-8.8078
+X-0.1359 Y-8.7997
+X-0.0865 Y-8.7914
+X-0.0372 Y-8.7828
+X0.0120 Y-8.7739
+X0.0612 Y-8.7648
+X0.1104 Y-8.7554
+X0.1595 Y-8.7457
+X0.2086 Y-8.7357
+X0.2576 Y-8.7255
+X0.3065 Y-8.7149
+X0.3554 Y-8.7042
+X0.4042 Y-8.6931
+X0.4530 Y-8.6818
+X0.5016 Y-8.6702
+X0.5503 Y-8.6583
+X0.5988 Y-8.6462
+X0.6473 Y-8.6338
+X0.6958 Y-8.6211
+X0.7441 Y-8.6081
+X0.7924 Y-8.5949
+X0.8406 Y-8.5814
+X0.8887 Y-8.5677
+X0.9368 Y-8.5537
+X0.9848 Y-8.5394
+X1.0326 Y-8.5249
+X1.0805 Y-8.5101
+X1.1282 Y-8.4950
+X1.1758 Y-8.4796
+X1.2234 Y-8.4640
+X1.2709 Y-8.4482
+X1.3183 Y-8.4320
+X1.3656 Y-8.4157
+X1.4128 Y-8.3990
+X1.4599 Y-8.3821
+X1.5069 Y-8.3649
+X1.5538 Y-8.3475
+X1.6006 Y-8.3298
+X1.6474 Y-8.3119
+X1.6940 Y-8.2937
+X1.7405 Y-8.2752
+X1.7869 Y-8.2565
+X1.8333 Y-8.2375
+X1.8795 Y-8.2183
+X1.9256 Y-8.1988
+X1.9716 Y-8.1791
+X2.0175 Y-8.1591
+X2.0632 Y-8.1388
+X2.1089 Y-8.1183
+X2.1545 Y-8.0976
+X2.1999 Y-8.0766
+X2.2452 Y-8.0553
+X2.2904 Y-8.0338
+X2.3355 Y-8.0121
+X2.3805 Y-7.9901
+X2.4253 Y-7.9679
+X2.4700 Y-7.9454
+X2.5146 Y-7.9227
+X2.5591 Y-7.8997
+X2.6034 Y-7.8765
+X2.6477 Y-7.8530
+X2.6917 Y-7.8293
+X2.7357 Y-7.8054
+X2.7795 Y-7.7812
+X2.8232 Y-7.7567
+X2.8668 Y-7.7321
+X2.9102 Y-7.7072
+X2.9535 Y-7.6820
+X2.9966 Y-7.6567
+X3.0396 Y-7.6310
+X3.0825 Y-7.6052
+X3.1252 Y-7.5791
+X3.1678 Y-7.5528
+X3.2102 Y-7.5262
+X3.2525 Y-7.4995
+X3.2946 Y-7.4724
+X3.3366 Y-7.4452
+X3.3785 Y-7.4177
+X3.4201 Y-7.3900
+X3.4617 Y-7.3621
+X3.5031 Y-7.3339
+X3.5443 Y-7.3056
+X3.5854 Y-7.2770
+X3.6263 Y-7.2481
+X3.6670 Y-7.2191
+X3.7076 Y-7.1898
+X3.7481 Y-7.1603
+X3.7884 Y-7.1306
+X3.8285 Y-7.1007
+X3.8684 Y-7.0705
+X3.9082 Y-7.0401
+X3.9478 Y-7.0095
+X3.9873 Y-6.9787
+X4.0266 Y-6.9477
+X4.0657 Y-6.9165
+X4.1046 Y-6.8851
+X4.1434 Y-6.8534
+X4.1820 Y-6.8215
+X4.2204 Y-6.7895
+X4.2587 Y-6.7572
+X4.2968 Y-6.7247
+X4.3347 Y-6.6920
+X4.3724 Y-6.6591
+X4.4099 Y-6.6260
+X4.4473 Y-6.5927
+X4.4845 Y-6.5592
+X4.5214 Y-6.5254
+X4.5583 Y-6.4915
+X4.5949 Y-6.4574
+X4.6313 Y-6.4231
+X4.6676 Y-6.3886
+X4.7036 Y-6.3539
+X4.7395 Y-6.3190
+X4.7752 Y-6.2839
+X4.8107 Y-6.2486
+X4.8460 Y-6.2131
+X4.8811 Y-6.1774
+X4.9160 Y-6.1416
+X4.9508 Y-6.1055
+X4.9853 Y-6.0693
+X5.0196 Y-6.0329
+X5.0538 Y-5.9963
+X5.0877 Y-5.9595
+X5.1214 Y-5.9225
+X5.1550 Y-5.8853
+X5.1883 Y-5.8480
+X5.2214 Y-5.8105
+X5.2543 Y-5.7728
+X5.2871 Y-5.7349
+X5.3196 Y-5.6969
+X5.3519 Y-5.6586
+X5.3840 Y-5.6202
+X5.4159 Y-5.5817
+X5.4476 Y-5.5429
+X5.4791 Y-5.5040
+X5.5103 Y-5.4649
+X5.5414 Y-5.4257
+X5.5722 Y-5.3863
+X5.6029 Y-5.3467
+X5.6333 Y-5.3069
+X5.6635 Y-5.2670
+X5.6935 Y-5.2269
+X5.7233 Y-5.1867
+X5.7528 Y-5.1463
+X5.7822 Y-5.1058
+X5.8113 Y-5.0651
+X5.8402 Y-5.0242
+X5.8689 Y-4.9832
+X5.8973 Y-4.9420
+X5.9255 Y-4.9007
+X5.9536 Y-4.8592
+X5.9813 Y-4.8176
+X6.0089 Y-4.7758
+X6.0363 Y-4.7339
+X6.0634 Y-4.6918
+X6.0903 Y-4.6496
+X6.1169 Y-4.6072
+X6.1434 Y-4.5647
+X6.1696 Y-4.5221
+X6.1955 Y-4.4793
+X6.2213 Y-4.4364
+X6.2468 Y-4.3933
+X6.2721 Y-4.3501
+X6.2971 Y-4.3068
+X6.3220 Y-4.2633
+X6.3465 Y-4.2197
+X6.3709 Y-4.1760
+X6.3950 Y-4.1321
+X6.4189 Y-4.0882
+X6.4425 Y-4.0440
+X6.4660 Y-3.9998
+X6.4891 Y-3.9554
+X6.5121 Y-3.9110
+X6.5348 Y-3.8663
+X6.5572 Y-3.8216
+X6.5794 Y-3.7768
+X6.6014 Y-3.7318
+X6.6232 Y-3.6867
+X6.6447 Y-3.6415
+X6.6659 Y-3.5962
+X6.6869 Y-3.5508
+X6.7077 Y-3.5052
+X6.7282 Y-3.4596
+X6.7485 Y-3.4138
+X6.7686 Y-3.3680
+X6.7884 Y-3.3220
+X6.8079 Y-3.2759
+X6.8272 Y-3.2298
+X6.8463 Y-3.1835
+X6.8651 Y-3.1371
+X6.8836 Y-3.0906
+X6.9020 Y-3.0440
+X6.9200 Y-2.9974
+X6.9378 Y-2.9506
+X6.9554 Y-2.9037
+X6.9727 Y-2.8568
+X6.9898 Y-2.8097
+X7.0066 Y-2.7626
+X7.0232 Y-2.7153
+X7.0395 Y-2.6680
+X7.0556 Y-2.6206
+X7.0714 Y-2.5731
+X7.0869 Y-2.5256
+X7.1023 Y-2.4779
+X7.1173 Y-2.4302
+X7.1321 Y-2.3824
+X7.1467 Y-2.3345
+X7.1609 Y-2.2865
+X7.1750 Y-2.2385
+X7.1888 Y-2.1904
+X7.2023 Y-2.1422
+X7.2156 Y-2.0939
+X7.2286 Y-2.0456
+X7.2413 Y-1.9972
+X7.2538 Y-1.9487
+X7.2661 Y-1.9002
+X7.2781 Y-1.8516
+X7.2898 Y-1.8029
+X7.3013 Y-1.7542
+X7.3125 Y-1.7054
+X7.3235 Y-1.6566
+X7.3342 Y-1.6077
+X7.3446 Y-1.5588
+X7.3548 Y-1.5098
+X7.3647 Y-1.4607
+X7.3744 Y-1.4116
+X7.3838 Y-1.3624
+X7.3929 Y-1.3132
+X7.4018 Y-1.2640
+X7.4104 Y-1.2147
+X7.4188 Y-1.1653
+X7.4269 Y-1.1159
+X7.4347 Y-1.0665
+X7.4423 Y-1.0170
+X7.4496 Y-0.9675
+X7.4567 Y-0.9180
+X7.4635 Y-0.8684
+X7.4700 Y-0.8188
+X7.4763 Y-0.7691
+X7.4823 Y-0.7194
+X7.4880 Y-0.6697
+X7.4935 Y-0.6200
+X7.4987 Y-0.5702
+X7.5037 Y-0.5204
+X7.5084 Y-0.4705
+X7.5128 Y-0.4207
+X7.5170 Y-0.3708
+X7.5209 Y-0.3209
+X7.5246 Y-0.2710
+X7.5280 Y-0.2211
+X7.5311 Y-0.1711
+X7.5340 Y-0.1212
+X7.5366 Y-0.0712
+X7.5389 Y-0.0212
+X7.5410 Y0.0288
+X7.5428 Y0.0788
+X7.5444 Y0.1289
+X7.5456 Y0.1789
+X7.5467 Y0.2289
+X7.5474 Y0.2790
+X7.5479 Y0.3290
+X7.5482 Y0.3791
+X7.5481 Y0.4291
+X7.5479 Y0.4792
+X7.5473 Y0.5292
+X7.5465 Y0.5793
+X7.5454 Y0.6293
+X7.5441 Y0.6793
+X7.5425 Y0.7294
+X7.5406 Y0.7794
+X7.5385 Y0.8294
+X7.5361 Y0.8794
+X7.5335 Y0.9294
+X7.5306 Y0.9793
+X7.5274 Y1.0293
+X7.5240 Y1.0792
+X7.5203 Y1.1291
+X7.5164 Y1.1790
+X7.5122 Y1.2289
+X7.5077 Y1.2787
+X7.5030 Y1.3285
+X7.4980 Y1.3783
+X7.4927 Y1.4281
+X7.4872 Y1.4779
+X7.4815 Y1.5276
+X7.4754 Y1.5773
+X7.4691 Y1.6269
+X7.4626 Y1.6765
+X7.4558 Y1.7261
+X7.4487 Y1.7757
+X7.4414 Y1.8252
+X7.4338 Y1.8746
+X7.4260 Y1.9241
+X7.4179 Y1.9735
+X7.4096 Y2.0228
+X7.4009 Y2.0721
+X7.3921 Y2.1214
+X7.3830 Y2.1706
+X7.3736 Y2.2198
+X7.3640 Y2.2689
+X7.3541 Y2.3179
+X7.3439 Y2.3669
+X7.3335 Y2.4159
+X7.3229 Y2.4648
+X7.3120 Y2.5136
+X7.3008 Y2.5624
+X7.2894 Y2.6112
+X7.2778 Y2.6598
+X7.2658 Y2.7084
+X7.2537 Y2.7570
+X7.2413 Y2.8055
+X7.2286 Y2.8539
+X7.2157 Y2.9022
+X7.2025 Y2.9505
+X7.1891 Y2.9987
+X7.1754 Y3.0469
+X7.1615 Y3.0950
+X7.1473 Y3.1430
+X7.1329 Y3.1909
+X7.1182 Y3.2387
+X7.1033 Y3.2865
+X7.0882 Y3.3342
+X7.0728 Y3.3818
+X7.0571 Y3.4294
+X7.0412 Y3.4768
+X7.0251 Y3.5242
+X7.0087 Y3.5715
+X6.9920 Y3.6187
+X6.9752 Y3.6658
+X6.9580 Y3.7128
+X6.9407 Y3.7598
+X6.9231 Y3.8066
+X6.9052 Y3.8534
+X6.8871 Y3.9000
+X6.8688 Y3.9466
+X6.8502 Y3.9931
+X6.8314 Y4.0395
+X6.8124 Y4.0857
+X6.7931 Y4.1319
+X6.7736 Y4.1780
+X6.7538 Y4.2240
+X6.7338 Y4.2699
+X6.7136 Y4.3157
+X6.6931 Y4.3613
+X6.6724 Y4.4069
+X6.6515 Y4.4523
+X6.6303 Y4.4977
+X6.6089 Y4.5429
+X6.5873 Y4.5881
+X6.5654 Y4.6331
+X6.5433 Y4.6780
+X6.5210 Y4.7228
+X6.4984 Y4.7674
+X6.4756 Y4.8120
+X6.4526 Y4.8564
+X6.4294 Y4.9008
+X6.4059 Y4.9450
+X6.3822 Y4.9890
+X6.3583 Y5.0330
+X6.3341 Y5.0768
+X6.3097 Y5.1205
+X6.2851 Y5.1641
+X6.2603 Y5.2076
+X6.2353 Y5.2509
+X6.2100 Y5.2941
+X6.1845 Y5.3372
+X6.1588 Y5.3801
+X6.1329 Y5.4229
+X6.1067 Y5.4656
+X6.0804 Y5.5081
+X6.0538 Y5.5505
+X6.0270 Y5.5928
+X6.0000 Y5.6349
+X5.9727 Y5.6769
+X5.9453 Y5.7188
+X5.9176 Y5.7605
+X5.8897 Y5.8020
+X5.8617 Y5.8435
+X5.8334 Y5.8848
+X5.8049 Y5.9259
+X5.7761 Y5.9669
+X5.7472 Y6.0077
+X5.7181 Y6.0484
+X5.6887 Y6.0889
+X5.6592 Y6.1293
+X5.6294 Y6.1696
+X5.5995 Y6.2097
+X5.5693 Y6.2496
+X5.5389 Y6.2894
+X5.5084 Y6.3290
+X5.4776 Y6.3685
+X5.4466 Y6.4078
+X5.4154 Y6.4469
+X5.3841 Y6.4859
+X5.3525 Y6.5248
+X5.3207 Y6.5634
+X5.2888 Y6.6019
+X5.2566 Y6.6403
+X5.2243 Y6.6785
+X5.1917 Y6.7165
+X5.1590 Y6.7543
+X5.1260 Y6.7920
+X5.0929 Y6.8295
+X5.0596 Y6.8669
+X5.0261 Y6.9041
+X4.9924 Y6.9411
+X4.9585 Y6.9779
+X4.9244 Y7.0146
+X4.8902 Y7.0510
+X4.8558 Y7.0874
+X4.8211 Y7.1235
+X4.7863 Y7.1595
+X4.7513 Y7.1952
+X4.7162 Y7.2308
+X4.6808 Y7.2663
+X4.6453 Y7.3015
+X4.6096 Y7.3366
+X4.5737 Y7.3715
+X4.5376 Y7.4062
+X4.5014 Y7.4407
+X4.4650 Y7.4750
+X4.4284 Y7.5092
+X4.3916 Y7.5431
+X4.3547 Y7.5769
+X4.3176 Y7.6105
+X4.2803 Y7.6439
+X4.2429 Y7.6771
+X4.2053 Y7.7101
+X4.1675 Y7.7430
+X4.1296 Y7.7756
+X4.0915 Y7.8081
+X4.0532 Y7.8403
+X4.0148 Y7.8724
+X3.9762 Y7.9042
+X3.9375 Y7.9359
+X3.8986 Y7.9674
+X3.8595 Y7.9987
+X3.8203 Y8.0297
+X3.7809 Y8.0606
+X3.7413 Y8.0913
+X3.7016 Y8.1218
+X3.6618 Y8.1521
+X3.6218 Y8.1821
+X3.5817 Y8.2120
+X3.5414 Y8.2417
+X3.5009 Y8.2712
+X3.4603 Y8.3004
+X3.4196 Y8.3295
+X3.3787 Y8.3583
+X3.3376 Y8.3870
+X3.2965 Y8.4154
+X3.2551 Y8.4437
+X3.2137 Y8.4717
+X3.1721 Y8.4995
+X3.1303 Y8.5271
+X3.0885 Y8.5545
+X3.0464 Y8.5817
+X3.0043 Y8.6087
+X2.9620 Y8.6354
+X2.9196 Y8.6620
+X2.8770 Y8.6883
+X2.8343 Y8.7144
+X2.7915 Y8.7403
+X2.7486 Y8.7660
+X2.7055 Y8.7915
+X2.6623 Y8.8168
+X2.6190 Y8.8418
+X2.5755 Y8.8666
+X2.5319 Y8.8912
+X2.4882 Y8.9156
+X2.4444 Y8.9398
+X2.4004 Y8.9637
+X2.3564 Y8.9874
+X2.3122 Y9.0109
+X2.2679 Y9.0342
+X2.2235 Y9.0573
+X2.1790 Y9.0801
+X2.1343 Y9.1027
+X2.0895 Y9.1251
+X2.0447 Y9.1473
+X1.9997 Y9.1692
+X1.9546 Y9.1909
+X1.9094 Y9.2124
+X1.8641 Y9.2337
+X1.8187 Y9.2547
+X1.7732 Y9.2755
+X1.7276 Y9.2961
+X1.6818 Y9.3165
+X1.6360 Y9.3366
+X1.5901 Y9.3565
+X1.5441 Y9.3761
+X1.4980 Y9.3956
+X1.4517 Y9.4148
+X1.4054 Y9.4337
+X1.3590 Y9.4525
+X1.3125 Y9.4710
+X1.2659 Y9.4893
+X1.2193 Y9.5073
+X1.1725 Y9.5251
+X1.1256 Y9.5427
+X1.0787 Y9.5600
+X1.0317 Y9.5771
+X0.9846 Y9.5940
+X0.9374 Y9.6106
+X0.8901 Y9.6270
+X0.8427 Y9.6432
+X0.7953 Y9.6591
+X0.7478 Y9.6748
+X0.7002 Y9.6903
+X0.6525 Y9.7055
+X0.6047 Y9.7205
+X0.5569 Y9.7352
+X0.5090 Y9.7497
+X0.4610 Y9.7640
+X0.4130 Y9.7780
+X0.3649 Y9.7918
+X0.3167 Y9.8054
+X0.2685 Y9.8187
+X0.2202 Y9.8317
+X0.1718 Y9.8446
+X0.1234 Y9.8572
+X0.0749 Y9.8695
+X0.0263 Y9.8816
+X-0.0223 Y9.8935
+X-0.0710 Y9.9051
+X-0.1197 Y9.9165
+X-0.1685 Y9.9276
+X-0.2173 Y9.9385
+X-0.2662 Y9.9492
+X-0.3152 Y9.9596
+X-0.3642 Y9.9698
+X-0.4132 Y9.9797
+X-0.4623 Y9.9894
+X-0.5115 Y9.9988
+X-0.5607 Y10.0080
+X-0.6099 Y10.0170
+X-0.6592 Y10.0257
+X-0.7085 Y10.0342
+X-0.7579 Y10.0424
+X-0.8073 Y10.0504
+X-0.8567 Y10.0581
+X-0.9062 Y10.0656
+X-0.9557 Y10.0728
+X-1.0053 Y10.0798
+X-1.0549 Y10.0866
+X-1.1045 Y10.0931
+X-1.1541 Y10.0994
+X-1.2038 Y10.1054
+X-1.2535 Y10.1111
+X-1.3032 Y10.1167
+X-1.3530 Y10.1220
+X-1.4028 Y10.1270
+X-1.4526 Y10.1318
+X-1.5025 Y10.1363
+X-1.5523 Y10.1406
+X-1.6022 Y10.1447
+X-1.6521 Y10.1485
+X-1.7020 Y10.1520
+X-1.7519 Y10.1553
+X-1.8019 Y10.1584
+X-1.8519 Y10.1612
+X-1.9018 Y10.1638
+X-1.9518 Y10.1661
+X-2.0018 Y10.1682
+X-2.0518 Y10.1700
+X-2.1018 Y10.1716
+X-2.1519 Y10.1730
+X-2.2019 Y10.1741
+X-2.2519 Y10.1749
+X-2.3020 Y10.1755
+X-2.3520 Y10.1759
+X-2.4021 Y10.1760
+X-2.4521 Y10.1759
+X-2.5022 Y10.1755
+X-2.5522 Y10.1749
+X-2.6022 Y10.1740
+X-2.6523 Y10.1729
+X-2.7023 Y10.1715
+X-2.7523 Y10.1699
+X-2.8023 Y10.1680
+X-2.8523 Y10.1659
+X-2.9023 Y10.1636
+X-2.9523 Y10.1610
+X-3.0022 Y10.1582
+X-3.0522 Y10.1551
+X-3.1021 Y10.1517
+X-3.1520 Y10.1482
+X-3.2019 Y10.1444
+X-3.2518 Y10.1403
+X-3.3017 Y10.1360
+X-3.3515 Y10.1314
+X-3.4013 Y10.1266
+X-3.4511 Y10.1216
+X-3.5009 Y10.1163
+X-3.5506 Y10.1108
+X-3.6003 Y10.1050
+X-3.6500 Y10.0990
+X-3.6996 Y10.0928
+X-3.7493 Y10.0863
+X-3.7988 Y10.0795
+X-3.8484 Y10.0725
+X-3.8979 Y10.0653
+X-3.9474 Y10.0578
+X-3.9968 Y10.0501
+X-4.0463 Y10.0422
+X-4.0956 Y10.0340
+X-4.1449 Y10.0256
+X-4.1942 Y10.0169
+X-4.2435 Y10.0080
+X-4.2927 Y9.9988
+X-4.3418 Y9.9894
+X-4.3909 Y9.9798
+X-4.4400 Y9.9699
+X-4.4890 Y9.9598
+X-4.5380 Y9.9494
+X-4.5869 Y9.9389
+X-4.6357 Y9.9280
+X-4.6845 Y9.9170
+X-4.7333 Y9.9057
+X-4.7820 Y9.8941
+X-4.8306 Y9.8823
+X-4.8792 Y9.8703
+X-4.9277 Y9.8581
+X-4.9762 Y9.8456
+X-5.0246 Y9.8328
+X-5.0729 Y9.8199
+X-5.1212 Y9.8067
+X-5.1694 Y9.7933
+X-5.2175 Y9.7796
+X-5.2656 Y9.7657
+X-5.3136 Y9.7516
+X-5.3615 Y9.7372
+X-5.4094 Y9.7226
+X-5.4572 Y9.7078
+X-5.5049 Y9.6927
+X-5.5526 Y9.6774
+X-5.6001 Y9.6619
+X-5.6476 Y9.6461
+X-5.6950 Y9.6301
+X-5.7424 Y9.6139
+X-5.7897 Y9.5975
+X-5.8368 Y9.5808
+X-5.8839 Y9.5639
+X-5.9310 Y9.5468
+X-5.9779 Y9.5294
+X-6.0247 Y9.5118
+X-6.0715 Y9.4940
+X-6.1182 Y9.4759
+X-6.1648 Y9.4577
+X-6.2113 Y9.4392
+X-6.2577 Y9.4205
+X-6.3040 Y9.4015
+X-6.3502 Y9.3824
+X-6.3963 Y9.3630
+X-6.4424 Y9.3433
+X-6.4883 Y9.3235
+X-6.5342 Y9.3034
+X-6.5799 Y9.2832
+X-6.6256 Y9.2627
+X-6.6711 Y9.2419
+X-6.7166 Y9.2210
+X-6.7619 Y9.1998
+X-6.8072 Y9.1785
+X-6.8523 Y9.1569
+X-6.8973 Y9.1350
+X-6.9423 Y9.1130
+X-6.9871 Y9.0908
+X-7.0318 Y9.0683
+X-7.0764 Y9.0456
+X-7.1209 Y9.0227
+X-7.1653 Y8.9996
+X-7.2096 Y8.9763
+X-7.2537 Y8.9527
+X-7.2978 Y8.9290
+X-7.3417 Y8.9050
+X-7.3855 Y8.8808
+X-7.4292 Y8.8564
+X-7.4728 Y8.8319
+X-7.5162 Y8.8070
+X-7.5596 Y8.7820
+X-7.6028 Y8.7568
+X-7.6459 Y8.7314
+X-7.6889 Y8.7057
+X-7.7317 Y8.6799
+X-7.7744 Y8.6538
+X-7.8170 Y8.6276
+X-7.8595 Y8.6011
+X-7.9019 Y8.5744
+X-7.9441 Y8.5476
+X-7.9862 Y8.5205
+X-8.0281 Y8.4932
+X-8.0699 Y8.4657
+X-8.1116 Y8.4381
+X-8.1532 Y8.4102
+X-8.1946 Y8.3821
+X-8.2359 Y8.3538
+X-8.2770 Y8.3254
+X-8.3181 Y8.2967
+X-8.3589 Y8.2678
+X-8.3997 Y8.2388
+X-8.4403 Y8.2095
+X-8.4807 Y8.1801
+X-8.5210 Y8.1504
+X-8.5612 Y8.1206
+X-8.6012 Y8.0905
+X-8.6411 Y8.0603
+X-8.6809 Y8.0299
+X-8.7205 Y7.9993
+X-8.7599 Y7.9685
+X-8.7992 Y7.9375
+X-8.8383 Y7.9063
+X-8.8773 Y7.8750
+X-8.9162 Y7.8434
+X-8.9549 Y7.8117
+X-8.9934 Y7.7798
+X-9.0318 Y7.7477
+X-9.0700 Y7.7154
+X-9.1081 Y7.6829
+X-9.1461 Y7.6503
+X-9.1838 Y7.6175
+X-9.2214 Y7.5845
+X-9.2589 Y7.5513
+X-9.2962 Y7.5179
+X-9.3333 Y7.4844
+X-9.3703 Y7.4506
+X-9.4071 Y7.4167
+X-9.4437 Y7.3827
+X-9.4802 Y7.3484
+X-9.5165 Y7.3140
+X-9.5527 Y7.2794
+X-9.5887 Y7.2446
+X-9.6245 Y7.2097
+X-9.6602 Y7.1746
+X-9.6957 Y7.1393
+X-9.7310 Y7.1039
+X-9.7661 Y7.0683
+X-9.8011 Y7.0325
+X-9.8359 Y6.9965
+X-9.8706 Y6.9604
+X-9.9050 Y6.9241
+X-9.9393 Y6.8877
+X-9.9734 Y6.8511
+X-10.0074 Y6.8143
+X-10.0412 Y6.7774
+X-10.0748 Y6.7403
+X-10.1082 Y6.7030
+X-10.1414 Y6.6656
+X-10.1745 Y6.6281
+X-10.2073 Y6.5904
+X-10.2400 Y6.5525
+X-10.2726 Y6.5144
+X-10.3049 Y6.4763
+X-10.3371 Y6.4379
+X-10.3690 Y6.3994
+X-10.4008 Y6.3608
+X-10.4324 Y6.3220
+X-10.4638 Y6.2830
+X-10.4951 Y6.2439
+X-10.5261 Y6.2047
+X-10.5570 Y6.1653
+X-10.5877 Y6.1258
+X-10.6182 Y6.0861
+X-10.6485 Y6.0463
+X-10.6786 Y6.0063
+X-10.7085 Y5.9662
+X-10.7382 Y5.9259
+X-10.7678 Y5.8855
+X-10.7971 Y5.8450
+X-10.8263 Y5.8043
+X-10.8552 Y5.7635
+X-10.8840 Y5.7226
+X-10.9126 Y5.6815
+X-10.9409 Y5.6403
+X-10.9691 Y5.5989
+X-10.9971 Y5.5575
+X-11.0249 Y5.5158
+X-11.0525 Y5.4741
+X-11.0799 Y5.4322
+X-11.1071 Y5.3902
+X-11.1341 Y5.3481
+X-11.1609 Y5.3058
+X-11.1875 Y5.2634
+X-11.2139 Y5.2209
+X-11.2401 Y5.1783
+X-11.2660 Y5.1355
+X-11.2918 Y5.0927
+X-11.3174 Y5.0496
+X-11.3428 Y5.0065
+X-11.3680 Y4.9633
+X-11.3930 Y4.9199
+X-11.4177 Y4.8764
+X-11.4423 Y4.8328
+X-11.4667 Y4.7891
+X-11.4908 Y4.7453
+X-11.5148 Y4.7014
+X-11.5385 Y4.6573
+X-11.5620 Y4.6132
+X-11.5853 Y4.5689
+X-11.6085 Y4.5245
+X-11.6314 Y4.4800
+X-11.6540 Y4.4354
+X-11.6765 Y4.3907
+X-11.6988 Y4.3459
+X-11.7209 Y4.3010
+X-11.7427 Y4.2560
+X-11.7643 Y4.2108
+X-11.7858 Y4.1656
+X-11.8070 Y4.1203
+X-11.8280 Y4.0749
+X-11.8487 Y4.0293
+X-11.8693 Y3.9837
+X-11.8897 Y3.9380
+X-11.9098 Y3.8922
+X-11.9297 Y3.8463
+X-11.9494 Y3.8003
+X-11.9689 Y3.7542
+X-11.9882 Y3.7080
+X-12.0072 Y3.6618
+X-12.0261 Y3.6154
+X-12.0447 Y3.5690
+X-12.0631 Y3.5224
+X-12.0813 Y3.4758
+X-12.0992 Y3.4291
+X-12.1170 Y3.3823
+X-12.1345 Y3.3354
+X-12.1518 Y3.2885
+X-12.1689 Y3.2415
+X-12.1858 Y3.1943
+X-12.2024 Y3.1472
+X-12.2188 Y3.0999
+X-12.2350 Y3.0525
+X-12.2510 Y3.0051
+X-12.2667 Y2.9576
+X-12.2823 Y2.9101
+X-12.2976 Y2.8624
+X-12.3127 Y2.8147
+X-12.3275 Y2.7669
+X-12.3422 Y2.7191
+X-12.3566 Y2.6712
+X-12.3708 Y2.6232
+X-12.3847 Y2.5751
+X-12.3985 Y2.5270
+X-12.4120 Y2.4788
+X-12.4253 Y2.4306
+X-12.4383 Y2.3823
+X-12.4511 Y2.3339
+X-12.4638 Y2.2855
+X-12.4761 Y2.2370
+X-12.4883 Y2.1885
+X-12.5002 Y2.1399
+X-12.5119 Y2.0912
+X-12.5234 Y2.0425
+X-12.5346 Y1.9937
+X-12.5457 Y1.9449
+X-12.5564 Y1.8961
+X-12.5670 Y1.8472
+X-12.5773 Y1.7982
+X-12.5874 Y1.7492
+X-12.5973 Y1.7001
+X-12.6070 Y1.6510
+X-12.6164 Y1.6019
+X-12.6256 Y1.5527
+X-12.6345 Y1.5035
+X-12.6433 Y1.4542
+X-12.6518 Y1.4049
+X-12.6600 Y1.3555
+X-12.6681 Y1.3061
+X-12.6759 Y1.2567
+X-12.6835 Y1.2073
+X-12.6908 Y1.1578
+X-12.6979 Y1.1082
+X-12.7048 Y1.0587
+X-12.7115 Y1.0091
+X-12.7179 Y0.9595
+X-12.7241 Y0.9098
+X-12.7300 Y0.8601
+X-12.7358 Y0.8104
+X-12.7413 Y0.7607
+X-12.7465 Y0.7109
+X-12.7516 Y0.6611
+X-12.7564 Y0.6113
+X-12.7610 Y0.5615
+X-12.7653 Y0.5116
+X-12.7694 Y0.4618
+X-12.7733 Y0.4119
+X-12.7770 Y0.3620
+X-12.7804 Y0.3121
+X-12.7836 Y0.2621
+X-12.7865 Y0.2122
+X-12.7892 Y0.1622
+X-12.7917 Y0.1122
+X-12.7940 Y0.0622
+X-12.7960 Y0.0122
+X-12.7978 Y-0.0378
+X-12.7994 Y-0.0878
+X-12.8007 Y-0.1378
+X-12.8018 Y-0.1878
+X-12.8026 Y-0.2379
+X-12.8033 Y-0.2879
+X-12.8037 Y-0.3379
+X-12.8039 Y-0.3880
+X-12.8038 Y-0.4380
+X-12.8035 Y-0.4880
+X-12.8030 Y-0.5381
+X-12.8022 Y-0.5881
+X-12.8012 Y-0.6381
+X-12.8000 Y-0.6882
+X-12.7986 Y-0.7382
+X-12.7969 Y-0.7882
+X-12.7950 Y-0.8382
+X-12.7928 Y-0.8882
+X-12.7904 Y-0.9382
+X-12.7878 Y-0.9881
+X-12.7850 Y-1.0381
+X-12.7819 Y-1.0880
+X-12.7786 Y-1.1380
+X-12.7751 Y-1.1879
+X-12.7713 Y-1.2378
+X-12.7673 Y-1.2877
+X-12.7631 Y-1.3375
+X-12.7587 Y-1.3874
+X-12.7540 Y-1.4372
+X-12.7491 Y-1.4870
+X-12.7439 Y-1.5367
+X-12.7386 Y-1.5865
+X-12.7330 Y-1.6362
+X-12.7271 Y-1.6859
+X-12.7211 Y-1.7356
+X-12.7148 Y-1.7852
+X-12.7083 Y-1.8348
+X-12.7015 Y-1.8844
+X-12.6946 Y-1.9340
+X-12.6874 Y-1.9835
+X-12.6799 Y-2.0330
+X-12.6723 Y-2.0824
+X-12.6644 Y-2.1318
+X-12.6563 Y-2.1812
+X-12.6479 Y-2.2305
+X-12.6394 Y-2.2798
+X-12.6306 Y-2.3291
+X-12.6216 Y-2.3783
+X-12.6123 Y-2.4275
+X-12.6028 Y-2.4766
+X-12.5931 Y-2.5257
+X-12.5832 Y-2.5748
+X-12.5731 Y-2.6238
+X-12.5627 Y-2.6727
+X-12.5521 Y-2.7216
+X-12.5413 Y-2.7705
+X-12.5302 Y-2.8193
+X-12.5190 Y-2.8680
+X-12.5075 Y-2.9167
+X-12.4957 Y-2.9654
+X-12.4838 Y-3.0140
+X-12.4716 Y-3.0625
+X-12.4592 Y-3.1110
+X-12.4466 Y-3.1594
+X-12.4338 Y-3.2078
+X-12.4207 Y-3.2561
+X-12.4075 Y-3.3043
+X-12.3940 Y-3.3525
+X-12.3803 Y-3.4006
+X-12.3663 Y-3.4487
+X-12.3522 Y-3.4967
+X-12.3378 Y-3.5446
+X-12.3232 Y-3.5925
+X-12.3084 Y-3.6403
+X-12.2933 Y-3.6880
+X-12.2781 Y-3.7356
+X-12.2626 Y-3.7832
+X-12.2469 Y-3.8307
+X-12.2310 Y-3.8782
+X-12.2149 Y-3.9255
+X-12.1986 Y-3.9728
+X-12.1820 Y-4.0201
+X-12.1652 Y-4.0672
+X-12.1482 Y-4.1143
+X-12.1310 Y-4.1613
+X-12.1136 Y-4.2082
+X-12.0960 Y-4.2550
+X-12.0781 Y-4.3017
+X-12.0601 Y-4.3484
+X-12.0418 Y-4.3950
+X-12.0233 Y-4.4415
+X-12.0046 Y-4.4879
+X-11.9857 Y-4.5342
+X-11.9666 Y-4.5805
+X-11.9473 Y-4.6266
+X-11.9277 Y-4.6727
+X-11.9080 Y-4.7187
+X-11.8880 Y-4.7645
+X-11.8679 Y-4.8103
+X-11.8475 Y-4.8560
+X-11.8269 Y-4.9016
+X-11.8061 Y-4.9472
+X-11.7851 Y-4.9926
+X-11.7639 Y-5.0379
+X-11.7425 Y-5.0831
+X-11.7209 Y-5.1282
+X-11.6990 Y-5.1733
+X-11.6770 Y-5.2182
+X-11.6548 Y-5.2630
+X-11.6323 Y-5.3077
+X-11.6097 Y-5.3524
+X-11.5869 Y-5.3969
+X-11.5638 Y-5.4413
+X-11.5406 Y-5.4856
+X-11.5171 Y-5.5298
+X-11.4935 Y-5.5739
+X-11.4696 Y-5.6179
+X-11.4456 Y-5.6618
+X-11.4213 Y-5.7055
+X-11.3969 Y-5.7492
+X-11.3722 Y-5.7927
+X-11.3474 Y-5.8362
+X-11.3223 Y-5.8795
+X-11.2971 Y-5.9227
+X-11.2717 Y-5.9658
+X-11.2460 Y-6.0088
+X-11.2202 Y-6.0516
+X-11.1942 Y-6.0944
+X-11.1680 Y-6.1370
+X-11.1416 Y-6.1795
+X-11.1150 Y-6.2219
+X-11.0882 Y-6.2641
+X-11.0612 Y-6.3063
+X-11.0340 Y-6.3483
+X-11.0067 Y-6.3902
+X-10.9791 Y-6.4319
+X-10.9514 Y-6.4736
+X-10.9234 Y-6.5151
+X-10.8953 Y-6.5565
+X-10.8670 Y-6.5978
+X-10.8385 Y-6.6389
+X-10.8098 Y-6.6799
+X-10.7810 Y-6.7208
+X-10.7519 Y-6.7615
+X-10.7227 Y-6.8021
+X-10.6933 Y-6.8426
+X-10.6637 Y-6.8829
+X-10.6339 Y-6.9231
+X-10.6039 Y-6.9632
+X-10.5738 Y-7.0032
+X-10.5435 Y-7.0430
+X-10.5130 Y-7.0826
+X-10.4823 Y-7.1221
+X-10.4514 Y-7.1615
+X-10.4204 Y-7.2008
+X-10.3892 Y-7.2399
+X-10.3578 Y-7.2789
+X-10.3262 Y-7.3177
+X-10.2945 Y-7.3564
+X-10.2626 Y-7.3949
+X-10.2305 Y-7.4333
+X-10.1982 Y-7.4715
+X-10.1658 Y-7.5096
+X-10.1332 Y-7.5476
+X-10.1004 Y-7.5854
+X-10.0674 Y-7.6230
+X-10.0343 Y-7.6606
+X-10.0010 Y-7.6979
+X-9.9676 Y-7.7351
+X-9.9340 Y-7.7722
+X-9.9002 Y-7.8091
+X-9.8662 Y-7.8458
+X-9.8321 Y-7.8824
+X-9.7978 Y-7.9189
+X-9.7634 Y-7.9552
+X-9.7287 Y-7.9913
+X-9.6940 Y-8.0273
+X-9.6590 Y-8.0631
+X-9.6239 Y-8.0988
+X-9.5887 Y-8.1343
+G0 X0.000 Y0.000
+M2
@@ -0,0 +1,89 @@
+(Line engraving with plunges and rapids between strokes)
+G21 G90
+G0 Z1.000
+G0 X0.000 Y0.000
+G1 Z-0.200 F200
+G1 X0.000 Y5.000 F400
+G1 X3.000 Y5.000 F400
+G1 X3.000 Y2.500 F400
+G1 X0.000 Y2.500 F400
+G0 Z1.000
+G0 X6.000 Y0.000
+G1 Z-0.200 F200
+G1 X6.000 Y5.000 F400
+G1 X9.000 Y5.000 F400
+G1 X9.000 Y2.500 F400
+G1 X6.000 Y2.500 F400
+G0 Z1.000
+G0 X7.000 Y0.000
+G1 Z-0.200 F200
+G1 X10.000 Y0.000 F400
+G0 Z1.000
+G0 X12.000 Y0.000
+G1 Z-0.200 F200
+G1 X12.000 Y5.000 F400
+G1 X15.000 Y5.000 F400
+G1 X15.000 Y2.500 F400
+G1 X12.000 Y2.500 F400
+G0 Z1.000
+G0 X13.000 Y0.000
+G1 Z-0.200 F200
+G1 X16.000 Y0.000 F400
+G0 Z1.000
+G0 X16.000 Y0.000
+G1 Z-0.200 F200
+G1 X16.000 Y5.000 F400
+G0 Z1.000
+G0 X18.000 Y0.000
+G1 Z-0.200 F200
+G1 X18.000 Y5.000 F400
+G1 X21.000 Y5.000 F400
+G1 X21.000 Y2.500 F400
+G1 X18.000 Y2.500 F400
+G0 Z1.000
+G0 X24.000 Y0.000
+G1 Z-0.200 F200
+G1 X24.000 Y5.000 F400
+G1 X27.000 Y5.000 F400
+G1 X27.000 Y2.500 F400
+G1 X24.000 Y2.500 F400
+G0 Z1.000
+G0 X25.000 Y0.000
+G1 Z-0.200 F200
+G1 X28.000 Y0.000 F400
+G0 Z1.000
+G0 X30.000 Y0.000
+G1 Z-0.200 F200
+G1 X30.000 Y5.000 F400
+G1 X33.000 Y5.000 F400
+G1 X33.000 Y2.500 F400
+G1 X30.000 Y2.500 F400
+G0 Z1.000
+G0 X31.000 Y0.000
+G1 Z-0.200 F200
+G1 X34.000 Y0.000 F400
+G0 Z1.000
+G0 X34.000 Y0.000
+G1 Z-0.200 F200
+G1 X34.000 Y5.000 F400
+G0 Z1.000
+G0 X36.000 Y0.000
+G1 Z-0.200 F200
+G1 X36.000 Y5.000 F400
+G1 X39.000 Y5.000 F400
+G1 X39.000 Y2.500 F400
+G1 X36.000 Y2.500 F400
+G0 Z1.000
+G0 X42.000 Y0.000
+G1 Z-0.200 F200
+G1 X42.000 Y5.000 F400
+G1 X45.000 Y5.000 F400
+G1 X45.000 Y2.500 F400
+G1 X42.000 Y2.500 F400
+G0 Z1.000
+G0 X43.000 Y0.000
+G1 Z-0.200 F200
+G1 X46.000 Y0.000 F400
+G0 Z1.000
+G0 X0.000 Y0.000
+M2
@@ -500,7 +500,7 @@ void st_update_plan_block_parameters()
 { 
   if (pl_block != NULL) { // Ignore if at start of a new block.
     prep.flag_partial_block = true;
-    pl_block->entry_speed_sqr = prep.current_speed*prep.current_speed; // Update entry speed.
+    pl_block->entry_speed_sqr = plan_speed_sqr_from_float(prep.current_speed*prep.current_speed); // Update entry speed.
     pl_block = NULL; // Flag st_prep_segment() to load new velocity profile.
   }
 }
@@ -572,9 +572,9 @@ void st_prep_buffer()
         if (sys.state & (STATE_HOLD|STATE_MOTION_CANCEL|STATE_SAFETY_DOOR)) {
           // Override planner block entry speed and enforce deceleration during feed hold.
           prep.current_speed = prep.exit_speed; 
-          pl_block->entry_speed_sqr = prep.exit_speed*prep.exit_speed; 
+          pl_block->entry_speed_sqr = plan_speed_sqr_from_float(prep.exit_speed*prep.exit_speed); 
         }
-        else { prep.current_speed = sqrt(pl_block->entry_speed_sqr); }
+        else { prep.current_speed = sqrt(plan_speed_sqr_to_float(pl_block->entry_speed_sqr)); }
       }
      
       /* --------------------------------------------------------------------------------- 
@@ -585,15 +585,17 @@ void st_prep_buffer()
       */
       prep.mm_complete = 0.0; // Default velocity profile complete at 0.0mm from end of block.
       float inv_2_accel = 0.5/pl_block->acceleration;
+      float entry_speed_sqr = plan_speed_sqr_to_float(pl_block->entry_speed_sqr);
+      float nominal_speed_sqr = plan_speed_sqr_to_float(pl_block->nominal_speed_sqr);
       if (sys.state & (STATE_HOLD|STATE_MOTION_CANCEL|STATE_SAFETY_DOOR)) { // [Forced Deceleration to Zero Velocity]
         // Compute velocity profile parameters for a feed hold in-progress. This profile overrides
         // the planner block profile, enforcing a deceleration to zero speed.
         prep.ramp_type = RAMP_DECEL;
         // Compute decelerate distance relative to end of block.
-        float decel_dist = pl_block->millimeters - inv_2_accel*pl_block->entry_speed_sqr;
+        float decel_dist = pl_block->millimeters - inv_2_accel*entry_speed_sqr;
         if (decel_dist < 0.0) {
           // Deceleration through entire planner block. End of feed hold is not in this block.
-          prep.exit_speed = sqrt(pl_block->entry_speed_sqr-2*pl_block->acceleration*pl_block->millimeters);
+          prep.exit_speed = sqrt(entry_speed_sqr-2*pl_block->acceleration*pl_block->millimeters);
         } else {
           prep.mm_complete = decel_dist; // End of feed hold.
           prep.exit_speed = 0.0;
@@ -605,19 +607,19 @@ void st_prep_buffer()
         prep.exit_speed = plan_get_exec_block_exit_speed();   
         float exit_speed_sqr = prep.exit_speed*prep.exit_speed;
         float intersect_distance =
-                0.5*(pl_block->millimeters+inv_2_accel*(pl_block->entry_speed_sqr-exit_speed_sqr));
+                0.5*(pl_block->millimeters+inv_2_accel*(entry_speed_sqr-exit_speed_sqr));
         if (intersect_distance > 0.0) {
           if (intersect_distance < pl_block->millimeters) { // Either trapezoid or triangle types
             // NOTE: For acceleration-cruise and cruise-only types, following calculation will be 0.0.
-            prep.decelerate_after = inv_2_accel*(pl_block->nominal_speed_sqr-exit_speed_sqr);
+            prep.decelerate_after = inv_2_accel*(nominal_speed_sqr-exit_speed_sqr);
             if (prep.decelerate_after < intersect_distance) { // Trapezoid type
-              prep.maximum_speed = sqrt(pl_block->nominal_speed_sqr);
+              prep.maximum_speed = sqrt(nominal_speed_sqr);
               if (pl_block->entry_speed_sqr == pl_block->nominal_speed_sqr) { 
                 // Cruise-deceleration or cruise-only type.
                 prep.ramp_type = RAMP_CRUISE;
               } else {
                 // Full-trapezoid or acceleration-cruise types
-                prep.accelerate_until -= inv_2_accel*(pl_block->nominal_speed_sqr-pl_block->entry_speed_sqr); 
+                prep.accelerate_until -= inv_2_accel*(nominal_speed_sqr-entry_speed_sqr); 
               }
             } else { // Triangle type
               prep.accelerate_until = intersect_distance;